@@ -8,6 +8,7 @@
 
 #include "BruceBLE.h"
 #include "../core/RadioWarden.h"
+#include "../core/SDManager.h"
 
 namespace Vanguard {
 
@@ -25,6 +26,7 @@ BruceBLE::BruceBLE()
     , m_initialized(false)
     , m_scanStartMs(0)
     , m_scanDurationMs(BLE_SCAN_DURATION_MS)
+    , m_scanProfile(BLEScanProfileId::BALANCED)
     , m_spamType(BLESpamType::RANDOM)
     , m_advertisementsSent(0)
     , m_lastAdvMs(0)
@@ -32,6 +34,8 @@ BruceBLE::BruceBLE()
     , m_advertising(nullptr)
     , m_onDeviceFound(nullptr)
     , m_onScanComplete(nullptr)
+    , m_onBeaconSeen(nullptr)
+    , m_onTrackerAlert(nullptr)
     , m_onSpamProgress(nullptr)
     , m_scanCallbacks(nullptr)
 {
@@ -91,13 +95,13 @@ bool BruceBLE::init() {
             m_scanCallbacks = new ScanCallbacks(this);
         }
         m_scanner->setAdvertisedDeviceCallbacks(m_scanCallbacks);
-        // m_scanner->setActiveScan(true); // MOVED to onEnable/tick
-        // m_scanner->setInterval(100);
-        // m_scanner->setWindow(99);
+        // Interval, window and mode come from the scan profile (beginScan)
     }
 
     m_advertising = NimBLEDevice::getAdvertising();
-    
+
+    loadSignatures();
+
     m_initialized = true;
     if (Serial) Serial.printf("[BLE] Init-Once complete (%ums)\n", millis() - initStart);
     return true;
@@ -109,6 +113,13 @@ void BruceBLE::shutdown() {
 }
 
 void BruceBLE::onTick() {
+    // Adverts queued by the BLE host task, including any left after a stop
+    drainAdverts();
+
+    // Scanning or not, devices that went quiet are forgotten (O(1) when
+    // none did), by the same policy the engine ages its targets with
+    m_devices.pruneStale(millis(), AgingPolicy::defaults());
+
     switch (m_state) {
         case BLEAdapterState::SCANNING:
             tickScan();
@@ -151,19 +162,52 @@ bool BruceBLE::beginScan(uint32_t durationMs) {
     stopHardwareActivities();
 
     m_devices.clear();
+    m_adverts.clear();
+    m_beacons.reset();
     m_scanStartMs = millis();
     m_scanDurationMs = durationMs;
-
-    m_scanner->start(0, false);
-    m_state = BLEAdapterState::SCANNING;
+    startScanner();
 
     if (Serial) {
-        Serial.printf("[BLE] Scan started (%ums)\n", durationMs);
+        Serial.printf("[BLE] Scan started (%ums, %s)\n", durationMs,
+                      getBleScanProfile(m_scanProfile).name);
+    }
+
+    return true;
+}
+
+bool BruceBLE::resumeScan(uint32_t durationMs) {
+    // Only a scan (running or paused at a slice end) can be resumed
+    if (!m_enabled || (m_state != BLEAdapterState::IDLE && m_state != BLEAdapterState::SCANNING)) {
+        return beginScan(durationMs);
     }
 
+    m_scanStartMs = millis();
+    m_scanDurationMs = durationMs;
+    if (m_state != BLEAdapterState::SCANNING || !m_scanner->isScanning()) {
+        startScanner();
+    }
     return true;
 }
 
+void BruceBLE::startScanner() {
+    const BLEScanProfile& profile = getBleScanProfile(m_scanProfile);
+    m_scanner->setInterval(profile.intervalMs);
+    m_scanner->setWindow(profile.windowMs);
+    m_scanner->setActiveScan(profile.active);
+    m_scanner->setDuplicateFilter(profile.filterDuplicates);
+    // Callbacks only: the registry is the device store, and NimBLE would
+    // otherwise search its own result list on every advert
+    m_scanner->setMaxResults(0);
+
+    m_scanner->start(0, false);
+    m_state = BLEAdapterState::SCANNING;
+}
+
+void BruceBLE::setScanProfile(BLEScanProfileId id) {
+    m_scanProfile = id;
+}
+
 void BruceBLE::stopScan() {
     if (m_state == BLEAdapterState::SCANNING) {
         // Force stop scanner
@@ -175,12 +219,13 @@ void BruceBLE::stopScan() {
         m_state = BLEAdapterState::IDLE;
 
         if (Serial) {
-            Serial.printf("[BLE] Scan stopped: %d devices\n", m_devices.size());
+            Serial.printf("[BLE] Scan stopped: %d devices, %u adverts dropped\n",
+                          (int)m_devices.count(), m_adverts.drops());
         }
 
         // Fire callback last (in case it triggers new scan)
         if (m_onScanComplete) {
-            m_onScanComplete(m_devices.size());
+            m_onScanComplete(m_devices.count());
         }
     }
 }
@@ -190,11 +235,15 @@ bool BruceBLE::isScanComplete() const {
 }
 
 const std::vector<BLEDeviceInfo>& BruceBLE::getDevices() const {
-    return m_devices;
+    return m_devices.devices();
 }
 
 size_t BruceBLE::getDeviceCount() const {
-    return m_devices.size();
+    return m_devices.count();
+}
+
+uint32_t BruceBLE::getDroppedAdverts() const {
+    return m_adverts.drops();
 }
 
 void BruceBLE::onDeviceFound(BLEScanCallback cb) {
@@ -205,6 +254,14 @@ void BruceBLE::onScanComplete(BLEScanCompleteCallback cb) {
     m_onScanComplete = cb;
 }
 
+void BruceBLE::onBeaconSeen(BLEBeaconCallback cb) {
+    m_onBeaconSeen = cb;
+}
+
+void BruceBLE::onTrackerAlert(BLETrackerCallback cb) {
+    m_onTrackerAlert = cb;
+}
+
 void BruceBLE::tickScan() {
     // Check for timeout
     uint32_t elapsed = millis() - m_scanStartMs;
@@ -218,12 +275,12 @@ void BruceBLE::tickScan() {
         m_state = BLEAdapterState::IDLE;
 
         if (Serial) {
-            Serial.printf("[BLE] Scan timeout after %ums: %d devices\n", elapsed, m_devices.size());
+            Serial.printf("[BLE] Scan timeout after %ums: %d devices\n", elapsed, (int)m_devices.count());
         }
 
         // Fire completion callback
         if (m_onScanComplete) {
-            m_onScanComplete(m_devices.size());
+            m_onScanComplete(m_devices.count());
         }
     }
 }
@@ -235,57 +292,56 @@ void BruceBLE::tickScan() {
 void BruceBLE::ScanCallbacks::onResult(NimBLEAdvertisedDevice* device) {
     if (!m_parent) return;
 
+    // BLE host task: copy the advert as received and get out. Parsing,
+    // dedup and naming happen in drainAdverts() on SystemTask.
+    NimBLEAddress addr = device->getAddress();
+    m_parent->m_adverts.push(addr.getNative(), addr.getType(), device->getAdvType(),
+                             (int8_t)device->getRSSI(), device->getPayload(),
+                             device->getPayloadLength(), millis());
+}
+
+void BruceBLE::drainAdverts() {
+    RawAdvert adv;
     BLEDeviceInfo info;
-    memset(&info, 0, sizeof(info));
+    AdvertFields fields;
+    BLEBeaconInfo beacon;
+    TrackerAlert alert;
 
-    // Copy address
-    NimBLEAddress addr = device->getAddress();
-    const uint8_t* addrBytes = addr.getNative();
-    memcpy(info.address, addrBytes, 6);
-
-    // Copy name
-    std::string name = device->getName();
-    strncpy(info.name, name.c_str(), sizeof(info.name) - 1);
-    info.name[sizeof(info.name) - 1] = '\0';
-
-    // If no name, show address
-    if (strlen(info.name) == 0) {
-        snprintf(info.name, sizeof(info.name), "%s", addr.toString().c_str());
-    }
-
-    info.rssi = device->getRSSI();
-    info.isConnectable = device->isConnectable();
-    info.hasServices = device->haveServiceUUID();
-    info.lastSeenMs = millis();
-
-    // Extract manufacturer data if present
-    if (device->haveManufacturerData()) {
-        std::string mfgData = device->getManufacturerData();
-        if (mfgData.length() >= 2) {
-            info.manufacturerId = (uint8_t)mfgData[0] | ((uint8_t)mfgData[1] << 8);
-            size_t dataLen = min(mfgData.length() - 2, sizeof(info.manufacturerData));
-            memcpy(info.manufacturerData, mfgData.data() + 2, dataLen);
-            info.manufacturerDataLen = dataLen;
+    // Bounded per tick so a busy band can't starve the rest of the loop
+    for (size_t i = 0; i < ADVERT_DRAIN_BATCH && m_adverts.pop(adv); i++) {
+        decodeAdvert(adv, info, &fields);
+
+        // Ahead of the beacon check: FMDN trackers use Eddystone's UUID
+        if (m_trackers.observe(adv, fields, alert) && m_onTrackerAlert) {
+            m_onTrackerAlert(alert);
         }
-    }
 
-    // Check if we already have this device
-    bool found = false;
-    for (auto& existing : m_parent->m_devices) {
-        if (memcmp(existing.address, info.address, 6) == 0) {
-            // Update existing
-            existing.rssi = info.rssi;
-            existing.lastSeenMs = info.lastSeenMs;
-            found = true;
-            break;
+        // Beacons are keyed by what they broadcast; their (often rotating)
+        // addresses stay out of the device registry
+        if (decodeBeacon(adv, fields, beacon)) {
+            if (m_beacons.admit(beacon, adv.timestampMs) && m_onBeaconSeen) {
+                m_onBeaconSeen(beacon);
+            }
+            continue;
         }
-    }
 
-    if (!found) {
-        m_parent->m_devices.push_back(info);
+        // Signatures run at ingest: for a new device, or when a known one
+        // reveals a different name. Placeholder names come after, so
+        // "nameless" rules see the advert as it was.
+        const BLEDeviceInfo* known = m_devices.find(info.address);
+        if (!known || (info.name[0] != '\0' && strcmp(known->name, info.name) != 0)) {
+            info.signature = m_signatures.match(info);
+            if (info.signature && Serial) {
+                Serial.printf("[BLE] Signature match: %s\n", m_signatures.label(info.signature));
+            }
+        }
+        if (info.name[0] == '\0' && !known) {
+            formatAdvertAddress(info.address, info.name, sizeof(info.name));
+        }
 
-        if (m_parent->m_onDeviceFound) {
-            m_parent->m_onDeviceFound(info);
+        // Hash lookup; refreshes a known device, evicts the stalest when full
+        if (m_devices.observe(info) && m_onDeviceFound) {
+            m_onDeviceFound(info);
         }
     }
 }
@@ -582,33 +638,38 @@ void BruceBLE::tickBeacon() {
 // =============================================================================
 
 bool BruceBLE::isLikelySkimmer(const BLEDeviceInfo& device) const {
-    // Check for common skimmer signatures
+    // Matched once at ingest (see drainAdverts)
+    return device.signature != 0;
+}
 
-    // HC-05/HC-06 Bluetooth modules (common in skimmers)
-    if (strncmp(device.name, "HC-05", 5) == 0 ||
-        strncmp(device.name, "HC-06", 5) == 0) {
-        return true;
-    }
+const char* BruceBLE::getSignatureLabel(const BLEDeviceInfo& device) const {
+    return m_signatures.label(device.signature);
+}
 
-    // No name, connectable, no services - suspicious
-    if (strlen(device.name) == 0 && device.isConnectable && !device.hasServices) {
-        return true;
+size_t BruceBLE::getSuspiciousDevices(const BLEDeviceInfo** out, size_t max) const {
+    size_t n = 0;
+    for (const auto& device : m_devices.devices()) {
+        if (n >= max) break;
+        if (device.signature) out[n++] = &device;
     }
-
-    // Unknown Chinese manufacturer IDs often used in skimmers
-    // Add more as identified
-
-    return false;
+    return n;
 }
 
-std::vector<BLEDeviceInfo> BruceBLE::getSuspiciousDevices() const {
-    std::vector<BLEDeviceInfo> suspicious;
-    for (const auto& device : m_devices) {
-        if (isLikelySkimmer(device)) {
-            suspicious.push_back(device);
-        }
+void BruceBLE::loadSignatures() {
+    String rules = SDManager::getInstance().isAvailable()
+                 ? SDManager::getInstance().readFile(BLE_SIGNATURE_PATH) : String();
+
+    if (rules.length() > 0) {
+        m_signatures.clear();
+        m_signatures.load(rules.c_str(), rules.length());
+    }
+    if (m_signatures.count() == 0) {
+        m_signatures.loadDefaults();
+    }
+    if (Serial) {
+        Serial.printf("[BLE] %u signatures loaded (%u bad lines)\n",
+                      (unsigned)m_signatures.count(), (unsigned)m_signatures.rejected());
     }
-    return suspicious;
 }
 
 // =============================================================================
@@ -10,6 +10,7 @@
  * - BLE spam attacks (iOS, Windows, Samsung, Android)
  * - iBeacon spoofing
  * - Skimmer detection
+ * - Tracker-following detection
  *
  * Bruce Functions Wrapped:
  * - aj_adv(choice) → spam()
@@ -22,6 +23,12 @@
 #include <NimBLEDevice.h>
 #include "../core/VanguardTypes.h"
 #include "../core/VanguardModule.h"
+#include "../core/BLERegistry.h"
+#include "../core/AdvertRing.h"
+#include "../core/BLEBeacon.h"
+#include "../core/BLESignatures.h"
+#include "../core/TrackerDetector.h"
+#include "../core/BLEScanProfile.h"
 #include <functional>
 #include <vector>
 
@@ -62,30 +69,14 @@ enum class BLESpamType : uint8_t {
     RANDOM              // Random mix of above
 };
 
-/**
- * @brief Discovered BLE device info
- */
-struct BLEDeviceInfo {
-    uint8_t      address[6];     // BLE MAC address
-    char         name[32];       // Device name (if advertised)
-    int8_t       rssi;           // Signal strength
-    uint16_t     appearance;     // Device appearance code
-    bool         isConnectable;  // Can we connect?
-    bool         hasServices;    // Advertises services?
-    uint32_t     lastSeenMs;
-
-    // Manufacturer data (for detection)
-    uint16_t     manufacturerId;
-    uint8_t      manufacturerData[32];
-    uint8_t      manufacturerDataLen;
-};
-
 // =============================================================================
 // CALLBACKS
 // =============================================================================
 
 using BLEScanCallback = std::function<void(const BLEDeviceInfo&)>;
 using BLEScanCompleteCallback = std::function<void(int deviceCount)>;
+using BLEBeaconCallback = std::function<void(const BLEBeaconInfo&)>;
+using BLETrackerCallback = std::function<void(const TrackerAlert&)>;
 using BLESpamProgressCallback = std::function<void(uint32_t advertisementsSent)>;
 
 // =============================================================================
@@ -146,11 +137,31 @@ public:
      */
     bool beginScan(uint32_t durationMs = BLE_SCAN_DURATION_MS);
 
+    /**
+     * @brief Listen again without starting a new scan
+     *
+     * For the coordinator's BLE slices: devices, dedup and beacon
+     * throttling carry over from the previous slice and the scanner is
+     * only restarted, not torn down. Falls back to beginScan() if the
+     * radio was doing something else.
+     *
+     * @param durationMs Slice length (0 = continuous until stop)
+     */
+    bool resumeScan(uint32_t durationMs);
+
     /**
      * @brief Stop ongoing scan
      */
     void stopScan();
 
+    /**
+     * @brief Interval, window, active/passive and duplicate filtering
+     *
+     * Takes effect at the next beginScan() or resumed slice; NimBLE
+     * can't change them while scanning.
+     */
+    void setScanProfile(BLEScanProfileId id);
+
     /**
      * @brief Stop any active hardware operations (attacks, scans)
      */
@@ -173,6 +184,11 @@ public:
      */
     size_t getDeviceCount() const;
 
+    /**
+     * @brief Advertisements lost because SystemTask fell behind
+     */
+    uint32_t getDroppedAdverts() const;
+
     /**
      * @brief Register device found callback
      */
@@ -183,6 +199,23 @@ public:
      */
     void onScanComplete(BLEScanCompleteCallback cb);
 
+    /**
+     * @brief Register beacon callback
+     *
+     * Fires for a new beacon identity and then at most once per
+     * BLE_BEACON_REPORT_MS; beacons don't go through onDeviceFound.
+     */
+    void onBeaconSeen(BLEBeaconCallback cb);
+
+    /**
+     * @brief Register tracker-following callback
+     *
+     * Fires when a tracker (AirTag, SmartTag...) has stayed with us for
+     * TRACKER_ALERT_SPAN_MS, across address rotations. Detector state
+     * outlives individual scans.
+     */
+    void onTrackerAlert(BLETrackerCallback cb);
+
     // -------------------------------------------------------------------------
     // Spam Attacks
     // -------------------------------------------------------------------------
@@ -251,19 +284,27 @@ public:
     // -------------------------------------------------------------------------
 
     /**
-     * @brief Check if device looks like a skimmer
+     * @brief Check if device matched a threat signature
      *
-     * Analyzes manufacturer data and characteristics.
+     * Signatures (BLE_SIGNATURE_PATH on SD, else the built-in set) are
+     * matched once when the device is first stored; this only reads
+     * the result.
      *
-     * @param device Device to analyze
+     * @param device Device to check
      * @return true if suspicious
      */
     bool isLikelySkimmer(const BLEDeviceInfo& device) const;
 
     /**
-     * @brief Get list of suspicious devices from last scan
+     * @brief Label of the signature the device matched ("" if none)
+     */
+    const char* getSignatureLabel(const BLEDeviceInfo& device) const;
+
+    /**
+     * @brief Suspicious devices from the current scan, without copying
+     * @return Number written to out (pointers valid until the next tick)
      */
-    std::vector<BLEDeviceInfo> getSuspiciousDevices() const;
+    size_t getSuspiciousDevices(const BLEDeviceInfo** out, size_t max) const;
 
 
 
@@ -275,10 +316,15 @@ private:
     BLEAdapterState        m_state;
     bool                   m_initialized;
 
-    // Scan results
-    std::vector<BLEDeviceInfo> m_devices;
+    // Scan results (bounded, hashed by address)
+    BLERegistry            m_devices;
+    AdvertRing             m_adverts;        // onResult -> onTick, unparsed
+    BeaconTracker          m_beacons;        // By broadcast identity, not address
+    BLESignatureSet        m_signatures;
+    TrackerDetector        m_trackers;       // Not reset between scans
     uint32_t               m_scanStartMs;
     uint32_t               m_scanDurationMs;
+    BLEScanProfileId       m_scanProfile;
 
     // Attack state
     BLESpamType            m_spamType;
@@ -292,9 +338,14 @@ private:
     // Callbacks
     BLEScanCallback        m_onDeviceFound;
     BLEScanCompleteCallback m_onScanComplete;
+    BLEBeaconCallback      m_onBeaconSeen;
+    BLETrackerCallback     m_onTrackerAlert;
     BLESpamProgressCallback m_onSpamProgress;
 
     // Internal tick handlers
+    void loadSignatures();
+    void drainAdverts();
+    void startScanner();
     void tickScan();
     void tickSpam();
     void tickBeacon();
@@ -16,6 +16,16 @@
 
 namespace Vanguard {
 
+// ScanIngest mirrors the driver's auth modes as plain numbers
+static_assert(AP_AUTH_OPEN == WIFI_AUTH_OPEN, "auth mode mismatch");
+static_assert(AP_AUTH_WEP == WIFI_AUTH_WEP, "auth mode mismatch");
+static_assert(AP_AUTH_WPA_PSK == WIFI_AUTH_WPA_PSK, "auth mode mismatch");
+static_assert(AP_AUTH_WPA2_PSK == WIFI_AUTH_WPA2_PSK, "auth mode mismatch");
+static_assert(AP_AUTH_WPA_WPA2_PSK == WIFI_AUTH_WPA_WPA2_PSK, "auth mode mismatch");
+static_assert(AP_AUTH_WPA2_ENTERPRISE == WIFI_AUTH_WPA2_ENTERPRISE, "auth mode mismatch");
+static_assert(AP_AUTH_WPA3_PSK == WIFI_AUTH_WPA3_PSK, "auth mode mismatch");
+static_assert(AP_AUTH_WPA2_WPA3_PSK == WIFI_AUTH_WPA2_WPA3_PSK, "auth mode mismatch");
+
 // Static instance for promiscuous callback
 BruceWiFi* BruceWiFi::s_instance = nullptr;
 
@@ -94,10 +104,29 @@ BruceWiFi::BruceWiFi()
     , m_packetsSent(0)
     , m_lastPacketMs(0)
     , m_handshakeCaptured(false)
+    , m_eapolCount(0)
+    , m_passiveDiscovery(false)
+    , m_lastDensityMs(0)
+    , m_packetSubId(-1)
+    , m_pcapWriter(nullptr)
+    , m_captureRing(nullptr)
+    , m_captureActive(false)
+    , m_captureFiltered(false)
 {
     memset(m_attackTargetMac, 0, 6);
+    memset(m_captureBssid, 0, 6);
     memset(m_attackApMac, 0, 6);
     s_instance = this;
+
+    // Built-in analyzers: client discovery and EAPOL sniffing only ever
+    // look at data frames, so they never run for beacons or control traffic
+    m_frames.subscribe(FrameMask::data(), [this](const FrameView& f) { handleDataFrame(f); });
+    m_frames.subscribe(FrameMask::data((1 << WIFI_SUBTYPE_DATA) | (1 << WIFI_SUBTYPE_QOS_DATA)),
+                       [this](const FrameView& f) { handleEapolFrame(f); });
+    m_frames.subscribe(FrameMask::mgmt(WIFI_SUBTYPE_BEACON).withSubtype(WIFI_SUBTYPE_PROBE_RESP),
+                       [this](const FrameView& f) { handleBeaconFrame(f); });
+    m_frames.subscribe(FrameMask::mgmt(WIFI_SUBTYPE_PROBE_REQ),
+                       [this](const FrameView& f) { handleProbeRequest(f); });
 }
 
 BruceWiFi::~BruceWiFi() {
@@ -141,6 +170,8 @@ void BruceWiFi::shutdown() {
 }
 
 void BruceWiFi::onTick() {
+    drainCapture();
+
     switch (m_state) {
         case WiFiAdapterState::SCANNING:
             tickScan();
@@ -175,7 +206,7 @@ WiFiAdapterState BruceWiFi::getState() const {
 // SCANNING (Async)
 // =============================================================================
 
-void BruceWiFi::beginScan() {
+void BruceWiFi::beginScan(uint8_t channel) {
     if (!m_enabled && !onEnable()) return;
 
     if (m_state != WiFiAdapterState::IDLE) {
@@ -184,7 +215,7 @@ void BruceWiFi::beginScan() {
 
     // Passive scan is more stable and catches stealthy APs
     // 120ms dwell time per channel
-    WiFi.scanNetworks(true, true, true, 120); 
+    WiFi.scanNetworks(true, true, true, 120, channel);
     m_state = WiFiAdapterState::SCANNING;
 }
 
@@ -226,6 +257,27 @@ bool BruceWiFi::getScanResult(int index, ScanResultEntry& result) const {
     return true;
 }
 
+size_t BruceWiFi::collectScanRecords(ScanIngest& ingest) const {
+    ingest.begin();
+
+    int count = WiFi.scanComplete();
+    for (int i = 0; i < count; i++) {
+        const wifi_ap_record_t* ap = (const wifi_ap_record_t*)WiFi.getScanInfoByIndex(i);
+        if (!ap) continue;
+
+        ApRecord* rec = ingest.slotFor(ap->rssi);
+        if (!rec) continue;
+
+        memcpy(rec->bssid, ap->bssid, 6);
+        memcpy(rec->ssid, ap->ssid, SSID_MAX_LEN);
+        rec->ssid[SSID_MAX_LEN] = '\0';
+        rec->channel = ap->primary;
+        rec->rssi = ap->rssi;
+        rec->authMode = (uint8_t)ap->authmode;
+    }
+    return ingest.size();
+}
+
 void BruceWiFi::onScanComplete(ScanCompleteCallback cb) {
     m_onScanComplete = cb;
 }
@@ -409,6 +461,7 @@ bool BruceWiFi::captureHandshake(const uint8_t* apMac,
     stopHardwareActivities();
     setChannel(channel);
     setPromiscuous(true);
+    setCaptureFilter(apMac);   // Only this AP's traffic goes to the PCAP
 
     memcpy(m_attackApMac, apMac, 6);
     m_handshakeCaptured = false;
@@ -544,28 +597,93 @@ bool BruceWiFi::startMonitor(uint8_t channel) {
     if (!m_initialized) return false;
 
     stopHardwareActivities();
-    if (channel > 0) {
-        setChannel(channel);
-    }
     setPromiscuous(true);
 
+    // tickMonitor() tunes on its first pass, pinned or not
+    m_hopper.reset(millis());
+    m_hopper.pin(channel);
+    m_lastDensityMs = 0;
+
     m_state = WiFiAdapterState::MONITORING;
     return true;
 }
 
+void BruceWiFi::pinChannel(uint8_t channel) {
+    m_hopper.pin(channel);
+}
+
+void BruceWiFi::setChannelFocus(uint16_t mask) {
+    m_hopper.setFocus(mask);
+}
+
 void BruceWiFi::stopMonitor() {
     if (m_state == WiFiAdapterState::MONITORING) {
         setPromiscuous(false);
         m_state = WiFiAdapterState::IDLE;
+        m_passiveDiscovery = false;
     }
 }
 
+bool BruceWiFi::beginPassiveDiscovery(uint8_t channel) {
+    if (!m_enabled && !onEnable()) return false;
+
+    stopHardwareActivities();
+    m_beaconThrottle.reset();
+    m_probeThrottle.reset();
+
+    if (!setPromiscuous(true)) return false;
+
+    m_hopper.reset(millis());
+    m_hopper.pin(channel);
+    m_lastDensityMs = 0;
+
+    m_passiveDiscovery = true;
+    m_state = WiFiAdapterState::MONITORING;
+    if (Serial) Serial.printf("[WiFi] Passive discovery on %s\n", channel ? "fixed channel" : "all channels");
+    return true;
+}
+
+void BruceWiFi::onApObserved(ApObservedCallback cb) {
+    m_onApObserved = cb;
+}
+
+void BruceWiFi::onProbeRequest(ProbeRequestCallback cb) {
+    m_onProbeRequest = cb;
+}
+
 void BruceWiFi::onPacketReceived(PacketCallback cb) {
     m_onPacketReceived = cb;
+
+    // Generic consumers see every frame, so only subscribe while one is set
+    if (m_packetSubId >= 0) {
+        m_frames.unsubscribe(m_packetSubId);
+        m_packetSubId = -1;
+    }
+    if (m_onPacketReceived) {
+        m_packetSubId = m_frames.subscribe(FrameMask::any(), [this](const FrameView& f) {
+            m_onPacketReceived(f.raw, f.len, f.rssi);
+        });
+    }
 }
 
 void BruceWiFi::tickMonitor() {
-    // Packet handling happens in promiscuous callback
+    // Packet handling happens in promiscuous callback; here we only hop
+    uint32_t now = millis();
+
+    // Known APs per channel weight the dwell alongside the frame rate
+    if (m_lastDensityMs == 0 || now - m_lastDensityMs >= HOP_DENSITY_REFRESH_MS) {
+        m_lastDensityMs = now;
+        uint8_t counts[WIFI_CHANNEL_MAX + 1];
+        m_beaconThrottle.countByChannel(counts, now, TARGET_AGE_TIMEOUT);
+        for (uint8_t ch = WIFI_CHANNEL_MIN; ch <= WIFI_CHANNEL_MAX; ch++) {
+            m_hopper.setTargetCount(ch, counts[ch]);
+        }
+    }
+
+    uint8_t next = m_hopper.tick(now);
+    if (next) {
+        setChannel(next);
+    }
 }
 
 // =============================================================================
@@ -580,7 +698,9 @@ void BruceWiFi::stopHardwareActivities() {
 
     setPromiscuous(false);
     setPcapLogging(false); // Ensure PCAP closed
+    setCaptureFilter(nullptr);
     m_state = WiFiAdapterState::IDLE;
+    m_passiveDiscovery = false;
     m_packetsSent = 0;
     m_eapolCount = 0;
 }
@@ -634,12 +754,25 @@ bool BruceWiFi::setPromiscuous(bool enable) {
 
 void BruceWiFi::setPcapLogging(bool enabled, const char* filename) {
     if (m_pcapWriter) {
+        // Stop the producer, then flush whatever it already queued
+        m_captureActive = false;
+        drainCapture();
         m_pcapWriter->close();
         delete m_pcapWriter;
         m_pcapWriter = nullptr;
     }
 
     if (enabled && filename) {
+        if (!m_captureRing) {
+            m_captureRing = new PacketRing(CAPTURE_RING_BYTES);
+            if (m_captureRing->capacity() == 0) {
+                if (Serial) Serial.println("[WiFi] Capture ring alloc failed!");
+                delete m_captureRing;
+                m_captureRing = nullptr;
+                return;
+            }
+        }
+
         m_pcapWriter = new PCAPWriter(filename);
         if (!m_pcapWriter->open()) {
             if (Serial) Serial.println("[WiFi] PCAP open failed!");
@@ -647,99 +780,165 @@ void BruceWiFi::setPcapLogging(bool enabled, const char* filename) {
             m_pcapWriter = nullptr;
         } else {
             if (Serial) Serial.printf("[WiFi] Logging to %s\n", filename);
+            m_captureRing->clear();
+            m_captureRing->resetHighWater();
+            m_captureStats.reset(millis());
+            m_captureActive = true;
+        }
+    }
+}
+
+void BruceWiFi::setCaptureFilter(const uint8_t* bssid) {
+    if (bssid) memcpy(m_captureBssid, bssid, 6);
+    m_captureFiltered = (bssid != nullptr);
+}
+
+bool BruceWiFi::pollCaptureStats(CaptureStatsSnapshot& out) {
+    if (!m_captureActive || !m_captureStats.sample(millis(), out)) return false;
+
+    out.ringUsed = (uint16_t)(m_captureRing->used() / 1024);
+    out.ringPeak = (uint16_t)(m_captureRing->highWater() / 1024);
+    out.ringCapacity = (uint16_t)(m_captureRing->capacity() / 1024);
+    m_captureRing->resetHighWater();
+    return true;
+}
+
+void BruceWiFi::drainCapture() {
+    if (!m_pcapWriter || !m_captureRing) return;
+
+    static uint8_t frame[CAPTURE_MAX_FRAME];
+    PacketRecordHeader header;
+
+    for (size_t i = 0; i < CAPTURE_DRAIN_BATCH; i++) {
+        if (!m_captureRing->pop(header, frame, sizeof(frame))) break;
+
+        uint16_t len = header.len < sizeof(frame) ? header.len : sizeof(frame);
+        uint32_t start = micros();
+        if (m_pcapWriter->writePacket(frame, len, header.timestampMs)) {
+            m_captureStats.countWrite(sizeof(pcap_packet_header) + len, micros() - start);
         }
     }
 }
 
+bool BruceWiFi::passesCaptureFilter(const uint8_t* payload, uint16_t len) const {
+    if (!m_captureFiltered) return true;
+
+    // Keep the frame if any address it carries is the target: covers
+    // mgmt/data in every DS direction and the RA/TA of control frames
+    for (uint16_t off = 4; off + 6 <= len && off <= 16; off += 6) {
+        if (memcmp(payload + off, m_captureBssid, 6) == 0) return true;
+    }
+    return false;
+}
+
 void BruceWiFi::onAssociation(AssociationCallback cb) {
     m_onAssociation = cb;
 }
 
+int BruceWiFi::subscribeFrames(const FrameMask& mask, FrameHandler handler) {
+    return m_frames.subscribe(mask, handler);
+}
+
+void BruceWiFi::unsubscribeFrames(int id) {
+    m_frames.unsubscribe(id);
+}
+
 void BruceWiFi::promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type) {
     if (!s_instance) return;
 
     wifi_promiscuous_pkt_t* pkt = (wifi_promiscuous_pkt_t*)buf;
     uint8_t* payload = pkt->payload;
     uint16_t len = pkt->rx_ctrl.sig_len;
-    int8_t rssi = pkt->rx_ctrl.rssi;
-
-    // [PHASE 3.3] PCAP Logging
-    if (s_instance->m_pcapWriter) {
-        s_instance->m_pcapWriter->writePacket(payload, len);
-    }
-
-    // Forward to packet callback if registered
-    if (s_instance->m_onPacketReceived) {
-        s_instance->m_onPacketReceived(payload, len, rssi);
-    }
-
-    // [PHASE 3.1] Client Discovery Implementation
-    // We only care about Data frames for client discovery
-    if (type == WIFI_PKT_DATA) {
-        wifi_data_frame_header_t* header = (wifi_data_frame_header_t*)payload;
-        
-        // Extract Frame Control bits
-        uint16_t fc = header->frame_control;
-        bool toDs = (fc & 0x0100) != 0;
-        bool fromDs = (fc & 0x0200) != 0;
-
-        // In 802.11 Data Frames:
-        // ToDS=0, FromDS=0: Addr1=Dst, Addr2=Src (Client), Addr3=BSSID (AP)
-        // ToDS=1, FromDS=0: Addr1=BSSID (AP), Addr2=Src (Client), Addr3=Dst
-        // ToDS=0, FromDS=1: Addr1=Dst, Addr2=BSSID (AP), Addr3=Src (Client)
-        // ToDS=1, FromDS=1: WDS (Ignore)
-
-        const uint8_t* clientMac = nullptr;
-        const uint8_t* apMac = nullptr;
-
-        if (!toDs && !fromDs) {
-            clientMac = header->addr2;
-            apMac = header->addr3;
-        } else if (toDs && !fromDs) {
-            clientMac = header->addr2;
-            apMac = header->addr1;
-        } else if (!toDs && fromDs) {
-            clientMac = header->addr3;
-            apMac = header->addr2;
-        }
 
-        // If we found a valid mapping, send to association callback
-        if (clientMac && apMac && s_instance->m_onAssociation) {
-            // Check if client is not broadcast/multicast
-            if (!(clientMac[0] & 0x01)) {
-                s_instance->m_onAssociation(clientMac, apMac);
-            }
+    // [PHASE 3.3] PCAP Logging: queue for the writer, never block here
+    if (s_instance->m_captureActive) {
+        CaptureStats& stats = s_instance->m_captureStats;
+        stats.countRx(pkt->rx_ctrl.channel);
+
+        if (type == WIFI_PKT_MISC || !s_instance->passesCaptureFilter(payload, len)) {
+            stats.countFiltered();
+        } else if (s_instance->m_captureRing->push(payload, len, pkt->rx_ctrl.channel,
+                                                   pkt->rx_ctrl.rssi, millis())) {
+            stats.countEnqueued();
+        } else {
+            stats.countDropped();
         }
     }
 
+    // sig_len includes the 4-byte FCS; analyzers only want header + body
+    if (type == WIFI_PKT_MISC || len <= 4) return;
+
+    s_instance->m_hopper.recordFrame(pkt->rx_ctrl.channel);
+
+    FrameView frame;
+    if (!FrameDispatcher::parse(payload, len - 4, pkt->rx_ctrl.rssi,
+                                pkt->rx_ctrl.channel, frame)) {
+        return;
+    }
+    s_instance->m_frames.dispatch(frame);
+}
+
+// =============================================================================
+// FRAME CONSUMERS
+// =============================================================================
+
+void BruceWiFi::handleDataFrame(const FrameView& frame) {
+    // [PHASE 3.1] Client Discovery
+    // ToDS=0, FromDS=0: Addr2=Src (Client), Addr3=BSSID (AP)
+    // ToDS=1, FromDS=0: Addr1=BSSID (AP), Addr2=Src (Client)
+    // ToDS=0, FromDS=1: Addr1=Dst (Client), Addr2=BSSID (AP)
+    // ToDS=1, FromDS=1: WDS (Ignore)
+    if (!m_onAssociation) return;
+
+    const uint8_t* clientMac = frame.station();
+    const uint8_t* apMac = frame.bssid();
+
+    // Skip broadcast/multicast "clients"
+    if (clientMac && apMac && !(clientMac[0] & 0x01)) {
+        // RSSI is the transmitter's: only the station's own when it sent the frame
+        int8_t rssi = (frame.addr2 == clientMac) ? frame.rssi : 0;
+        m_onAssociation(clientMac, apMac, rssi, frame.channel);
+    }
+}
+
+void BruceWiFi::handleEapolFrame(const FrameView& frame) {
     // [PHASE 3.3] Handshake Capture
-    // EAPOL Detection
-    if (type == WIFI_PKT_DATA) {
-        // EtherType for EAPOL is 0x888e
-        // In 802.11 Data frames, the payload starts after the header
-        // For QoS Data, header is 26 bytes. For Data, header is 24 bytes.
-        // But wifi_data_frame_header_t handles basic fields.
-        // SNAP header (8 bytes) usually precedes the EAPOL payload.
-        // Index 24-25 is often the length/type in some captures, but 
-        // 802.11 stack usually gives us the 802.2 LLC/SNAP header.
-        
-        // Simpler check: EAPOL frames are small and have a specific structure.
-        // We look for 0x88 0x8e in the payload.
-        for (int i = 0; i < len - 1; i++) {
-            if (payload[i] == 0x88 && payload[i+1] == 0x8e) {
-                // Found potential EAPOL!
-                s_instance->m_eapolCount++;
-                
-                if (s_instance->m_onHandshakeCaptured) {
-                    // In a real handshake, we'd captures multiple parts. 
-                    // For now, signal that we saw EAPOL for this BSSID.
-                    wifi_data_frame_header_t* header = (wifi_data_frame_header_t*)payload;
-                    s_instance->m_onHandshakeCaptured(header->addr3); // Addr3 is BSSID
-                }
-                break;
-            }
-        }
+    // EAPOL rides in the clear behind an LLC/SNAP header:
+    // AA AA 03 00 00 00 88 8E
+    static const uint8_t EAPOL_SNAP[] = {0xAA, 0xAA, 0x03, 0x00, 0x00, 0x00, 0x88, 0x8E};
+
+    if (frame.isProtected || frame.bodyLen < sizeof(EAPOL_SNAP)) return;
+    if (memcmp(frame.body, EAPOL_SNAP, sizeof(EAPOL_SNAP)) != 0) return;
+
+    m_eapolCount++;
+
+    if (m_onHandshakeCaptured) {
+        // In a real handshake, we'd capture multiple parts.
+        // For now, signal that we saw EAPOL for this BSSID.
+        const uint8_t* bssid = frame.bssid();
+        if (bssid) m_onHandshakeCaptured(bssid);
     }
 }
 
+void BruceWiFi::handleBeaconFrame(const FrameView& frame) {
+    if (!m_passiveDiscovery || !m_onApObserved) return;
+
+    BeaconInfo info;
+    if (!BeaconParser::parse(frame, info)) return;
+    if (!m_beaconThrottle.admit(info, millis())) return;
+
+    m_onApObserved(info);
+}
+
+void BruceWiFi::handleProbeRequest(const FrameView& frame) {
+    if (!m_onProbeRequest) return;
+
+    ProbeInfo info;
+    if (!BeaconParser::parseProbeRequest(frame, info)) return;
+    if (info.ssidLen == 0) return;                      // Wildcard: no PNL entry
+    if (!m_probeThrottle.admit(info, millis())) return;
+
+    m_onProbeRequest(info);
+}
+
 } // namespace Vanguard
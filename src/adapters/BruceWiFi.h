@@ -25,6 +25,12 @@
 #include <esp_wifi.h>
 #include "../core/VanguardTypes.h"
 #include "../core/VanguardModule.h"
+#include "../core/FrameDispatcher.h"
+#include "../core/BeaconParser.h"
+#include "../core/ChannelScheduler.h"
+#include "../core/PacketRing.h"
+#include "../core/CaptureStats.h"
+#include "../core/ScanIngest.h"
 #include <functional>
 
 namespace Vanguard {
@@ -37,6 +43,10 @@ constexpr uint32_t DEAUTH_INTERVAL_MS   = 10;    // Time between deauth frames
 constexpr uint32_t BEACON_INTERVAL_MS   = 100;   // Time between beacon frames
 constexpr uint32_t SCAN_POLL_INTERVAL   = 100;   // How often to check scan status
 constexpr size_t   MAX_BEACON_SSIDS     = 32;    // For beacon flood attack
+constexpr uint32_t HOP_DENSITY_REFRESH_MS = 1000; // How often AP counts feed the hopper
+constexpr size_t   CAPTURE_RING_BYTES   = 32768; // rx callback -> SD writer queue
+constexpr size_t   CAPTURE_DRAIN_BATCH  = 32;    // Frames written per tick
+constexpr size_t   CAPTURE_MAX_FRAME    = 2500;  // Longer frames are truncated in the PCAP
 
 // =============================================================================
 // ENUMERATIONS
@@ -76,7 +86,10 @@ using AttackProgressCallback = std::function<void(uint32_t packetsSent)>;
 using HandshakeCapturedCallback = std::function<void(const uint8_t* bssid)>;
 using CredentialCapturedCallback = std::function<void(const char* ssid, const char* password)>;
 using PacketCallback = std::function<void(const uint8_t* payload, uint16_t len, int8_t rssi)>;
-using AssociationCallback = std::function<void(const uint8_t* clientMac, const uint8_t* apMac)>;
+using AssociationCallback = std::function<void(const uint8_t* clientMac, const uint8_t* apMac,
+                                               int8_t rssi, uint8_t channel)>;
+using ApObservedCallback = std::function<void(const BeaconInfo& info)>;
+using ProbeRequestCallback = std::function<void(const ProbeInfo& info)>;
 
 // =============================================================================
 // BruceWiFi Adapter Class
@@ -134,8 +147,10 @@ public:
      *
      * Wraps WiFi.scanNetworks(true) for non-blocking operation.
      * Check getScanState() or use callback.
+     *
+     * @param channel Scan only this channel (0 = all channels)
      */
-    void beginScan();
+    void beginScan(uint8_t channel = 0);
 
     /**
      * @brief Stop ongoing scan
@@ -160,6 +175,17 @@ public:
      */
     bool getScanResult(int index, ScanResultEntry& result) const;
 
+    /**
+     * @brief Copy all scan results into a bulk-ingest buffer
+     *
+     * Reads the driver's AP records directly: no String copies and no
+     * per-field lookups. Keeps the strongest APs if there are more
+     * results than the buffer holds.
+     *
+     * @return Number of records in ingest
+     */
+    size_t collectScanRecords(ScanIngest& ingest) const;
+
     /**
      * @brief Register scan complete callback
      */
@@ -310,11 +336,62 @@ public:
      */
     bool startMonitor(uint8_t channel = 0);
 
+    /**
+     * @brief Park the hopper on one channel while monitoring
+     * @param channel Channel to hold (0 = resume adaptive hopping)
+     */
+    void pinChannel(uint8_t channel);
+
+    /**
+     * @brief Restrict hopping to a set of channels
+     * @param mask Bit N = channel N (0 = all channels)
+     */
+    void setChannelFocus(uint16_t mask);
+
+    /**
+     * @brief Hopper state (dwell/frame-rate stats)
+     */
+    const ChannelScheduler& getChannelScheduler() const { return m_hopper; }
+
     /**
      * @brief Stop monitoring
      */
     void stopMonitor();
 
+    /**
+     * @brief Start passive AP discovery from beacons/probe responses
+     *
+     * Runs promiscuous mode and reports each AP through onApObserved()
+     * at most once per BEACON_THROTTLE_MS. Client associations seen
+     * along the way are reported through onAssociation(), directed
+     * probe requests through onProbeRequest().
+     *
+     * @param channel Channel to listen on (0 = adaptive hopping)
+     * @return true if discovery started
+     */
+    bool beginPassiveDiscovery(uint8_t channel = 0);
+
+    /**
+     * @brief Check if passive discovery is running
+     */
+    bool isPassiveDiscovery() const { return m_passiveDiscovery; }
+
+    /**
+     * @brief Register passive AP observation callback
+     *
+     * Called from the promiscuous callback context.
+     */
+    void onApObserved(ApObservedCallback cb);
+
+    /**
+     * @brief Register directed probe request callback (station PNLs)
+     *
+     * Called from the promiscuous callback context, at most once per
+     * PROBE_THROTTLE_MS for each station + SSID. Wildcard probes are
+     * not reported.
+     */
+    void onProbeRequest(ProbeRequestCallback cb);
+
     /**
      * @brief Register packet callback
      */
@@ -325,15 +402,55 @@ public:
      */
     void onAssociation(AssociationCallback cb);
 
+    /**
+     * @brief Subscribe an analyzer to promiscuous frames
+     *
+     * The handler only runs for frames matching the mask. Register
+     * before enabling promiscuous mode.
+     *
+     * @return Subscription id, or -1 if no slots are left
+     */
+    int subscribeFrames(const FrameMask& mask, FrameHandler handler);
+
+    /**
+     * @brief Remove a frame subscription
+     */
+    void unsubscribeFrames(int id);
+
     // -------------------------------------------------------------------------
     // Attack Control (Common)
     // -------------------------------------------------------------------------
 
     /**
      * @brief Enable/disable PCAP logging to SD card
+     *
+     * Captures rotate by size/age under /captures (see CaptureRotation).
+     *
+     * @param filename Label for the session's files, e.g. "hs_AABBCC"
      */
     void setPcapLogging(bool enabled, const char* filename = nullptr);
 
+    /**
+     * @brief Only log frames to/from/about one BSSID
+     *
+     * Rejected frames are counted as "filtered". Cleared by
+     * stopHardwareActivities().
+     *
+     * @param bssid AP to keep (nullptr = log everything)
+     */
+    void setCaptureFilter(const uint8_t* bssid);
+
+    /**
+     * @brief Check if PCAP logging is running
+     */
+    bool isCapturing() const { return m_captureActive; }
+
+    /**
+     * @brief Close a stats interval once per second while logging
+     * @return true if out was filled
+     */
+    bool pollCaptureStats(CaptureStatsSnapshot& out);
+
     /**
      * @brief Stop any active attack
      */
@@ -405,10 +522,31 @@ private:
     CredentialCapturedCallback m_onCredentialCaptured;
     PacketCallback            m_onPacketReceived;
     AssociationCallback       m_onAssociation;
+    ApObservedCallback        m_onApObserved;
+    ProbeRequestCallback      m_onProbeRequest;
     uint32_t                  m_eapolCount;
 
-    // PCAP Logging
+    // Passive discovery
+    bool                      m_passiveDiscovery;
+    BeaconThrottle            m_beaconThrottle;
+    ProbeThrottle             m_probeThrottle;
+
+    // Monitor-mode channel hopping
+    ChannelScheduler          m_hopper;
+    uint32_t                  m_lastDensityMs;
+
+    // Promiscuous frame routing
+    FrameDispatcher           m_frames;
+    int                       m_packetSubId;
+
+    // PCAP Logging: the rx callback queues frames into m_captureRing and
+    // onTick() drains them to SD, so the radio never waits on the card
     class PCAPWriter* m_pcapWriter;
+    PacketRing*       m_captureRing;     // Allocated once, never freed
+    CaptureStats      m_captureStats;
+    volatile bool     m_captureActive;
+    bool              m_captureFiltered;
+    uint8_t           m_captureBssid[6];
 
     // Internal tick handlers
     void tickScan();
@@ -416,6 +554,7 @@ private:
     void tickBeaconFlood();
     void tickHandshakeCapture();
     void tickMonitor();
+    void drainCapture();
 
     // Frame builders (from Bruce)
     void buildDeauthFrame(uint8_t* frame, const uint8_t* dst,
@@ -424,6 +563,14 @@ private:
                           const char* ssid, const uint8_t* bssid,
                           uint8_t channel);
 
+    // Frame consumers (registered with m_frames)
+    void handleDataFrame(const FrameView& frame);
+    void handleEapolFrame(const FrameView& frame);
+    void handleBeaconFrame(const FrameView& frame);
+    void handleProbeRequest(const FrameView& frame);
+
+    bool passesCaptureFilter(const uint8_t* payload, uint16_t len) const;
+
     // Promiscuous callback (static for C API)
     static void promiscuousCallback(void* buf, wifi_promiscuous_pkt_type_t type);
     static BruceWiFi* s_instance;  // For static callback access
@@ -0,0 +1,84 @@
+/**
+ * @file AdvertRing.cpp
+ * @brief SPSC fixed-slot advertisement ring
+ */
+
+#include "AdvertRing.h"
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+namespace Vanguard {
+
+AdvertRing::AdvertRing(size_t slots)
+    : m_buffer(nullptr)
+    , m_slots(2)
+    , m_mask(0)
+    , m_head(0)
+    , m_tail(0)
+    , m_drops(0)
+{
+    while (m_slots < slots) m_slots <<= 1;
+    m_mask = m_slots - 1;
+    m_buffer = (RawAdvert*)malloc(m_slots * sizeof(RawAdvert));
+    if (!m_buffer) m_slots = 0;
+}
+
+AdvertRing::~AdvertRing() {
+    free(m_buffer);
+}
+
+// =============================================================================
+// PRODUCER
+// =============================================================================
+
+bool AdvertRing::push(const uint8_t* address, uint8_t addressType, uint8_t advType,
+                      int8_t rssi, const uint8_t* payload, size_t len, uint32_t timestampMs) {
+    uint32_t head = m_head.load(std::memory_order_relaxed);
+    uint32_t tail = m_tail.load(std::memory_order_acquire);
+    if (!m_buffer || head - tail >= m_slots) {
+        m_drops = m_drops + 1;
+        return false;
+    }
+
+    if (len > BLE_ADV_MAX_LEN) len = BLE_ADV_MAX_LEN;
+
+    RawAdvert& slot = m_buffer[head & m_mask];
+    memcpy(slot.address, address, 6);
+    slot.addressType = addressType;
+    slot.advType = advType;
+    slot.rssi = rssi;
+    slot.len = (uint8_t)len;
+    slot.timestampMs = timestampMs;
+    if (payload && len) memcpy(slot.payload, payload, len);
+
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+// =============================================================================
+// CONSUMER
+// =============================================================================
+
+bool AdvertRing::pop(RawAdvert& out) {
+    uint32_t tail = m_tail.load(std::memory_order_relaxed);
+    uint32_t head = m_head.load(std::memory_order_acquire);
+    if (tail == head) return false;
+
+    // Only the header and the bytes actually received
+    const RawAdvert& slot = m_buffer[tail & m_mask];
+    memcpy(&out, &slot, offsetof(RawAdvert, payload) + slot.len);
+
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+void AdvertRing::clear() {
+    m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+size_t AdvertRing::used() const {
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+}
+
+} // namespace Vanguard
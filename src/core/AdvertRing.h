@@ -0,0 +1,89 @@
+#ifndef VANGUARD_ADVERT_RING_H
+#define VANGUARD_ADVERT_RING_H
+
+/**
+ * @file AdvertRing.h
+ * @brief Lock-free single-producer/single-consumer advertisement queue
+ *
+ * Sits between the NimBLE scan callback (producer, BLE host task) and
+ * BruceBLE::onTick (consumer, SystemTask). Adverts are short and close
+ * to fixed size, so unlike PacketRing every slot is a whole RawAdvert:
+ * push() is one bounded memcpy and two atomic operations. When the ring
+ * is full the advert is dropped and counted; the host task never waits.
+ *
+ * @example
+ * AdvertRing ring(64);
+ * // onResult:
+ * ring.push(addr, addrType, advType, rssi, payload, len, millis());
+ * // SystemTask:
+ * RawAdvert adv;
+ * for (int i = 0; i < ADVERT_DRAIN_BATCH && ring.pop(adv); i++) handle(adv);
+ */
+
+#include "BLEAdvert.h"
+#include <atomic>
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t ADVERT_RING_SLOTS  = 64;    // ~5 KB
+constexpr size_t ADVERT_DRAIN_BATCH = 32;    // Adverts handled per SystemTask tick
+
+// =============================================================================
+// AdvertRing Class
+// =============================================================================
+
+class AdvertRing {
+public:
+    /**
+     * @param slots Adverts held (rounded up to a power of two)
+     */
+    explicit AdvertRing(size_t slots = ADVERT_RING_SLOTS);
+    ~AdvertRing();
+
+    // Owns its buffer
+    AdvertRing(const AdvertRing&) = delete;
+    AdvertRing& operator=(const AdvertRing&) = delete;
+
+    /**
+     * @brief Queue an advertisement (producer side only)
+     * @param len Payload bytes; anything past BLE_ADV_MAX_LEN is cut
+     * @return false if the ring is full; the advert is counted as dropped
+     */
+    bool push(const uint8_t* address, uint8_t addressType, uint8_t advType,
+              int8_t rssi, const uint8_t* payload, size_t len, uint32_t timestampMs);
+
+    /**
+     * @brief Take the oldest advertisement (consumer side only)
+     * @return false if the ring is empty
+     */
+    bool pop(RawAdvert& out);
+
+    /**
+     * @brief Discard everything queued (consumer side only)
+     */
+    void clear();
+
+    size_t capacity() const { return m_slots; }
+    size_t used() const;
+
+    /**
+     * @brief Adverts refused because the ring was full
+     */
+    uint32_t drops() const { return m_drops; }
+
+private:
+    RawAdvert*            m_buffer;
+    uint32_t              m_slots;       // Power of two
+    uint32_t              m_mask;
+    std::atomic<uint32_t> m_head;        // Free-running write index
+    std::atomic<uint32_t> m_tail;        // Free-running read index
+    volatile uint32_t     m_drops;       // Written by the producer only
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_ADVERT_RING_H
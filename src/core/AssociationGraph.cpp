@@ -0,0 +1,247 @@
+/**
+ * @file AssociationGraph.cpp
+ * @brief Edge store with dual adjacency chains and periodic compaction
+ */
+
+#include "AssociationGraph.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Vanguard {
+
+static_assert(GRAPH_INDEX_SLOTS >= GRAPH_MAX_NODES * 2, "index too small");
+static_assert(GRAPH_MAX_EDGES < 0x7FFF && GRAPH_MAX_NODES < 0xFFFF, "ids are 16-bit");
+
+static const uint16_t DEAD_NODE = 0xFFFF;
+
+AssociationGraph::AssociationGraph()
+    : m_evictions(0)
+{
+    clear();
+}
+
+// =============================================================================
+// UPDATES
+// =============================================================================
+
+bool AssociationGraph::observe(const uint8_t* station, const uint8_t* bssid, uint32_t now) {
+    if (memcmp(station, bssid, 6) == 0) return false;
+
+    // Existing link: update in place, never compact on the hot path
+    int s = findNode(station);
+    int a = findNode(bssid);
+    if (s >= 0 && a >= 0) {
+        for (int16_t i = m_nodes[s].asStation; i >= 0; i = m_edges[i].nextForStation) {
+            Edge& e = m_edges[i];
+            if (e.ap == a && e.station != DEAD_NODE) {
+                e.lastSeenMs = now;
+                if (e.frames < 0xFFFF) e.frames++;
+                return false;
+            }
+        }
+    }
+
+    if (m_edgeCount >= GRAPH_MAX_EDGES || m_nodeCount + 2 > GRAPH_MAX_NODES) {
+        makeRoom();                      // Renumbers nodes
+    }
+    s = findNode(station);
+    if (s < 0) s = addNode(station);
+    a = findNode(bssid);
+    if (a < 0) a = addNode(bssid);
+    if (s < 0 || a < 0 || m_edgeCount >= GRAPH_MAX_EDGES) return false;
+
+    size_t idx = m_edgeCount++;
+    Edge& e = m_edges[idx];
+    e.station = (uint16_t)s;
+    e.ap = (uint16_t)a;
+    e.firstSeenMs = now;
+    e.lastSeenMs = now;
+    e.frames = 1;
+    e.nextForStation = m_nodes[s].asStation;
+    e.nextForAp = m_nodes[a].asAp;
+    m_nodes[s].asStation = (int16_t)idx;
+    m_nodes[a].asAp = (int16_t)idx;
+    return true;
+}
+
+size_t AssociationGraph::expire(uint32_t now, uint32_t maxAgeMs) {
+    size_t dropped = 0;
+    for (size_t i = 0; i < m_edgeCount; i++) {
+        Edge& e = m_edges[i];
+        if (e.station != DEAD_NODE && now - e.lastSeenMs > maxAgeMs) {
+            kill(i);
+            dropped++;
+        }
+    }
+    if (m_deadCount > 0) compact();
+    return dropped;
+}
+
+void AssociationGraph::compact() {
+    int16_t remap[GRAPH_MAX_NODES];
+    for (size_t i = 0; i < m_nodeCount; i++) remap[i] = -1;
+
+    // Which nodes still have a live edge
+    for (size_t i = 0; i < m_edgeCount; i++) {
+        const Edge& e = m_edges[i];
+        if (e.station == DEAD_NODE) continue;
+        remap[e.station] = 0;
+        remap[e.ap] = 0;
+    }
+
+    // Pack nodes (in place; the write cursor never passes the read cursor)
+    size_t nodes = 0;
+    for (size_t i = 0; i < m_nodeCount; i++) {
+        if (remap[i] < 0) continue;
+        if (nodes != i) memcpy(m_nodes[nodes].mac, m_nodes[i].mac, 6);
+        m_nodes[nodes].asStation = -1;
+        m_nodes[nodes].asAp = -1;
+        remap[i] = (int16_t)nodes++;
+    }
+    m_nodeCount = nodes;
+
+    // Pack edges, oldest first, pushing each onto its chains so the
+    // newest ends up at the head again
+    size_t edges = 0;
+    for (size_t i = 0; i < m_edgeCount; i++) {
+        Edge e = m_edges[i];
+        if (e.station == DEAD_NODE) continue;
+
+        e.station = (uint16_t)remap[e.station];
+        e.ap = (uint16_t)remap[e.ap];
+        e.nextForStation = m_nodes[e.station].asStation;
+        e.nextForAp = m_nodes[e.ap].asAp;
+        m_nodes[e.station].asStation = (int16_t)edges;
+        m_nodes[e.ap].asAp = (int16_t)edges;
+        m_edges[edges++] = e;
+    }
+    m_edgeCount = edges;
+    m_deadCount = 0;
+
+    m_index.clear();
+    for (size_t i = 0; i < m_nodeCount; i++) m_index.insert(i, m_nodes[i].mac);
+}
+
+void AssociationGraph::clear() {
+    m_nodeCount = 0;
+    m_edgeCount = 0;
+    m_deadCount = 0;
+    m_index.clear();
+}
+
+// =============================================================================
+// QUERIES
+// =============================================================================
+
+size_t AssociationGraph::stationsOf(const uint8_t* bssid, AssociationEdge* out, size_t max) const {
+    int a = findNode(bssid);
+    return (a >= 0) ? collect(m_nodes[a].asAp, false, out, max) : 0;
+}
+
+size_t AssociationGraph::apsOf(const uint8_t* station, AssociationEdge* out, size_t max) const {
+    int s = findNode(station);
+    return (s >= 0) ? collect(m_nodes[s].asStation, true, out, max) : 0;
+}
+
+size_t AssociationGraph::stationCount(const uint8_t* bssid) const {
+    int a = findNode(bssid);
+    if (a < 0) return 0;
+    size_t n = 0;
+    for (int16_t i = m_nodes[a].asAp; i >= 0; i = m_edges[i].nextForAp) {
+        if (m_edges[i].station != DEAD_NODE) n++;
+    }
+    return n;
+}
+
+size_t AssociationGraph::apCount(const uint8_t* station) const {
+    int s = findNode(station);
+    if (s < 0) return 0;
+    size_t n = 0;
+    for (int16_t i = m_nodes[s].asStation; i >= 0; i = m_edges[i].nextForStation) {
+        if (m_edges[i].station != DEAD_NODE) n++;
+    }
+    return n;
+}
+
+// =============================================================================
+// PRIVATE
+// =============================================================================
+
+int AssociationGraph::findNode(const uint8_t* mac) const {
+    return m_index.find(mac, [this](size_t n) { return m_nodes[n].mac; });
+}
+
+int AssociationGraph::addNode(const uint8_t* mac) {
+    if (m_nodeCount >= GRAPH_MAX_NODES) return -1;
+
+    size_t node = m_nodeCount++;
+    memcpy(m_nodes[node].mac, mac, 6);
+    m_nodes[node].asStation = -1;
+    m_nodes[node].asAp = -1;
+
+    m_index.insert(node, mac);
+    return (int)node;
+}
+
+void AssociationGraph::makeRoom() {
+    compact();
+    if (m_edgeCount < GRAPH_MAX_EDGES && m_nodeCount + 2 <= GRAPH_MAX_NODES) return;
+    if (m_edgeCount == 0) return;
+
+    // Still full of live links (or of the nodes they use): evict the oldest eighth
+    uint32_t seen[GRAPH_MAX_EDGES];
+    for (size_t i = 0; i < m_edgeCount; i++) seen[i] = m_edges[i].lastSeenMs;
+    size_t k = m_edgeCount / 8;
+    std::nth_element(seen, seen + k, seen + m_edgeCount);
+    uint32_t cutoff = seen[k];
+
+    for (size_t i = 0; i < m_edgeCount; i++) {
+        if (m_edges[i].lastSeenMs < cutoff) {
+            kill(i);
+            m_evictions++;
+        }
+    }
+    // All the same age: drop the oldest-inserted
+    if (m_deadCount == 0) {
+        kill(0);
+        m_evictions++;
+    }
+    compact();
+}
+
+void AssociationGraph::kill(size_t edge) {
+    m_edges[edge].station = DEAD_NODE;
+    m_deadCount++;
+}
+
+void AssociationGraph::fill(const Edge& e, AssociationEdge& out) const {
+    memcpy(out.station, m_nodes[e.station].mac, 6);
+    memcpy(out.bssid, m_nodes[e.ap].mac, 6);
+    out.firstSeenMs = e.firstSeenMs;
+    out.lastSeenMs = e.lastSeenMs;
+    out.frames = e.frames;
+}
+
+size_t AssociationGraph::collect(int16_t head, bool asStation, AssociationEdge* out, size_t max) const {
+    if (max == 0) return 0;
+
+    // Keep the max most recently seen, in order (insertion into a short list)
+    size_t n = 0;
+    for (int16_t i = head; i >= 0;
+         i = asStation ? m_edges[i].nextForStation : m_edges[i].nextForAp) {
+        const Edge& e = m_edges[i];
+        if (e.station == DEAD_NODE) continue;
+
+        size_t pos = n;
+        while (pos > 0 && (int32_t)(out[pos - 1].lastSeenMs - e.lastSeenMs) < 0) pos--;
+        if (pos >= max) continue;
+
+        size_t last = (n < max) ? n : max - 1;
+        for (size_t j = last; j > pos; j--) out[j] = out[j - 1];
+        fill(e, out[pos]);
+        if (n < max) n++;
+    }
+    return n;
+}
+
+} // namespace Vanguard
@@ -0,0 +1,145 @@
+#ifndef VANGUARD_ASSOCIATION_GRAPH_H
+#define VANGUARD_ASSOCIATION_GRAPH_H
+
+/**
+ * @file AssociationGraph.h
+ * @brief Timestamped station <-> AP edges, queryable from either side
+ *
+ * StationTable knows where each station is now; the graph remembers
+ * every AP a station has been seen with, and when. That answers both
+ * "who are this AP's clients" and "which APs has this client talked to"
+ * (roaming history).
+ *
+ * Layout, all fixed-size:
+ *   - nodes: one per MAC (station or AP), found through an open-addressing
+ *     index; each heads two edge chains (as station, as AP)
+ *   - edges: 16-bit node ids plus first/last seen and a frame count,
+ *     appended to a packed array and threaded onto both chains
+ *
+ * Neighbour queries walk one chain: O(degree). Expired or evicted edges
+ * are only marked dead; compact() repacks edges and nodes and rebuilds
+ * the chains and index in one linear pass. It runs on a timer from the
+ * engine and whenever the arrays fill up. When still full after that,
+ * the oldest eighth of the edges is evicted.
+ *
+ * @example
+ * AssociationGraph graph;
+ * graph.observe(stationMac, bssid, millis());
+ * AssociationEdge clients[8];
+ * size_t n = graph.stationsOf(bssid, clients, 8);   // Most recent first
+ */
+
+#include "VanguardTypes.h"
+#include "MacIndex.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t   GRAPH_MAX_NODES       = 512;
+constexpr size_t   GRAPH_MAX_EDGES       = 768;
+constexpr size_t   GRAPH_INDEX_SLOTS     = 1024;     // Power of two, load <= 0.5
+constexpr uint32_t GRAPH_EDGE_TIMEOUT_MS = 600000;   // Forget links idle for 10 min
+constexpr uint32_t GRAPH_COMPACT_MS      = 10000;
+
+/**
+ * @brief One station <-> AP link, as returned by queries
+ */
+struct AssociationEdge {
+    uint8_t  station[6];
+    uint8_t  bssid[6];
+    uint32_t firstSeenMs;
+    uint32_t lastSeenMs;
+    uint16_t frames;            // Saturates at 65535
+};
+
+// =============================================================================
+// AssociationGraph Class
+// =============================================================================
+
+class AssociationGraph {
+public:
+    AssociationGraph();
+
+    /**
+     * @brief A station was seen talking to an AP
+     * @return true if this link is new
+     */
+    bool observe(const uint8_t* station, const uint8_t* bssid, uint32_t now);
+
+    /**
+     * @brief An AP's clients, most recently seen first
+     * @return Number written to out
+     */
+    size_t stationsOf(const uint8_t* bssid, AssociationEdge* out, size_t max) const;
+
+    /**
+     * @brief APs a station has been seen with, most recently seen first
+     */
+    size_t apsOf(const uint8_t* station, AssociationEdge* out, size_t max) const;
+
+    /**
+     * @brief Live link counts without copying
+     */
+    size_t stationCount(const uint8_t* bssid) const;
+    size_t apCount(const uint8_t* station) const;
+
+    /**
+     * @brief Drop links idle for maxAgeMs, then compact if anything died
+     * @return Links dropped
+     */
+    size_t expire(uint32_t now, uint32_t maxAgeMs = GRAPH_EDGE_TIMEOUT_MS);
+
+    /**
+     * @brief Repack live edges and the nodes they use
+     */
+    void compact();
+
+    void clear();
+
+    size_t edgeCount() const { return m_edgeCount - m_deadCount; }
+    size_t nodeCount() const { return m_nodeCount; }
+
+    /**
+     * @brief Live links dropped to make room
+     */
+    uint32_t evictions() const { return m_evictions; }
+
+private:
+    struct Node {
+        uint8_t mac[6];
+        int16_t asStation;      // Head of edges where this node is the station
+        int16_t asAp;           // Head of edges where this node is the AP
+    };
+
+    struct Edge {
+        uint16_t station;       // Node ids; DEAD_NODE once expired
+        uint16_t ap;
+        uint32_t firstSeenMs;
+        uint32_t lastSeenMs;
+        uint16_t frames;
+        int16_t  nextForStation;
+        int16_t  nextForAp;
+    };
+
+    Node     m_nodes[GRAPH_MAX_NODES];
+    Edge     m_edges[GRAPH_MAX_EDGES];
+    MacIndex<GRAPH_INDEX_SLOTS> m_index;    // MAC -> node
+    size_t   m_nodeCount;
+    size_t   m_edgeCount;                    // Including dead ones
+    size_t   m_deadCount;
+    uint32_t m_evictions;
+
+    int  findNode(const uint8_t* mac) const;
+    int  addNode(const uint8_t* mac);
+    void makeRoom();
+    void kill(size_t edge);
+    void fill(const Edge& e, AssociationEdge& out) const;
+    size_t collect(int16_t head, bool asStation, AssociationEdge* out, size_t max) const;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_ASSOCIATION_GRAPH_H
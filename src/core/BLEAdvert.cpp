@@ -0,0 +1,190 @@
+/**
+ * @file BLEAdvert.cpp
+ * @brief AD structure walk for deferred advertisement parsing
+ */
+
+#include "BLEAdvert.h"
+#include <cstdio>
+#include <cstring>
+
+namespace Vanguard {
+
+static inline uint16_t readLE16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline ADSpan spanOf(const ADIterator& it, size_t skip) {
+    ADSpan s;
+    s.offset = (uint8_t)(it.offset() + skip);
+    s.len = (uint8_t)(it.length() - skip);
+    return s;
+}
+
+// =============================================================================
+// ADIterator
+// =============================================================================
+
+ADIterator::ADIterator(const uint8_t* data, size_t len)
+    : m_start(data)
+    , m_pos(data)
+    , m_end(data + len)
+    , m_type(0)
+    , m_len(0)
+    , m_data(data)
+    , m_malformed(false)
+{
+}
+
+bool ADIterator::next() {
+    if (m_pos >= m_end) return false;
+
+    uint8_t adLen = m_pos[0];
+    if (adLen == 0) {                               // Zero padding ends the data
+        m_pos = m_end;
+        return false;
+    }
+    if ((size_t)(m_end - m_pos) < (size_t)adLen + 1) {
+        m_malformed = true;
+        m_pos = m_end;
+        return false;
+    }
+
+    m_type = m_pos[1];
+    m_len = adLen - 1;
+    m_data = m_pos + 2;
+    m_pos += 1 + adLen;
+    return true;
+}
+
+// =============================================================================
+// DECODING
+// =============================================================================
+
+bool parseAdvertFields(const uint8_t* payload, size_t len, AdvertFields& out) {
+    memset(&out, 0, sizeof(out));
+    out.txPower = ADV_TX_POWER_NONE;
+
+    ADIterator it(payload, len);
+    while (it.next()) {
+        const uint8_t* d = it.data();
+        uint8_t n = it.length();
+
+        switch (it.type()) {
+            case AD_TYPE_FLAGS:
+                if (n >= 1) {
+                    out.flags = d[0];
+                    out.present |= ADV_HAS_FLAGS;
+                }
+                break;
+
+            case AD_TYPE_UUID16_PARTIAL:
+            case AD_TYPE_UUID16_COMPLETE:
+                out.present |= ADV_HAS_SERVICES;
+                for (uint8_t i = 0; i + 2 <= n; i += 2) {
+                    if (out.uuid16Count < ADV_MAX_UUID16) out.uuid16[out.uuid16Count++] = readLE16(d + i);
+                    else out.overflow++;
+                }
+                break;
+
+            case AD_TYPE_UUID32_PARTIAL:
+            case AD_TYPE_UUID32_COMPLETE:
+                out.present |= ADV_HAS_SERVICES;
+                break;
+
+            case AD_TYPE_UUID128_PARTIAL:
+            case AD_TYPE_UUID128_COMPLETE:
+                out.present |= ADV_HAS_SERVICES;
+                for (uint8_t i = 0; i + 16 <= n; i += 16) {
+                    if (out.uuid128Count >= ADV_MAX_UUID128) { out.overflow++; continue; }
+                    ADSpan& s = out.uuid128[out.uuid128Count++];
+                    s.offset = (uint8_t)(it.offset() + i);
+                    s.len = 16;
+                }
+                break;
+
+            case AD_TYPE_NAME_SHORT:
+            case AD_TYPE_NAME_COMPLETE:
+                if (out.nameComplete) break;
+                out.name = spanOf(it, 0);
+                out.nameComplete = (it.type() == AD_TYPE_NAME_COMPLETE);
+                out.present |= ADV_HAS_NAME;
+                break;
+
+            case AD_TYPE_TX_POWER:
+                if (n >= 1) {
+                    out.txPower = (int8_t)d[0];
+                    out.present |= ADV_HAS_TX_POWER;
+                }
+                break;
+
+            case AD_TYPE_SERVICE_DATA16:
+                if (n < 2) break;
+                if (out.serviceDataCount >= ADV_MAX_SERVICE_DATA) { out.overflow++; break; }
+                out.serviceDataUuid[out.serviceDataCount] = readLE16(d);
+                out.serviceData[out.serviceDataCount++] = spanOf(it, 2);
+                break;
+
+            case AD_TYPE_APPEARANCE:
+                if (n >= 2) {
+                    out.appearance = readLE16(d);
+                    out.present |= ADV_HAS_APPEARANCE;
+                }
+                break;
+
+            case AD_TYPE_MANUFACTURER:
+                if (n >= 2) {
+                    out.manufacturerId = readLE16(d);
+                    out.manufacturerData = spanOf(it, 2);
+                    out.present |= ADV_HAS_MANUFACTURER;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+    return !it.malformed();
+}
+
+bool decodeAdvert(const RawAdvert& adv, BLEDeviceInfo& out, AdvertFields* fields) {
+    memset(&out, 0, sizeof(out));
+    memcpy(out.address, adv.address, 6);
+    out.isRandomAddress = (adv.addressType & BLE_ADDR_TYPE_RANDOM) != 0;
+    out.rssi = adv.rssi;
+    out.lastSeenMs = adv.timestampMs;
+    out.isConnectable = (adv.advType == ADV_EVT_IND || adv.advType == ADV_EVT_DIRECT_IND);
+
+    AdvertFields local;
+    AdvertFields& f = fields ? *fields : local;
+    size_t len = (adv.len < BLE_ADV_MAX_LEN) ? adv.len : BLE_ADV_MAX_LEN;
+    bool ok = parseAdvertFields(adv.payload, len, f);
+
+    if (f.has(ADV_HAS_NAME)) {
+        size_t n = (f.name.len < sizeof(out.name) - 1) ? f.name.len : sizeof(out.name) - 1;
+        memcpy(out.name, f.bytes(adv.payload, f.name), n);
+        out.name[n] = '\0';
+    }
+    if (f.has(ADV_HAS_MANUFACTURER)) {
+        size_t n = (f.manufacturerData.len < sizeof(out.manufacturerData))
+                 ? f.manufacturerData.len : sizeof(out.manufacturerData);
+        out.manufacturerId = f.manufacturerId;
+        memcpy(out.manufacturerData, f.bytes(adv.payload, f.manufacturerData), n);
+        out.manufacturerDataLen = (uint8_t)n;
+    }
+
+    out.appearance = f.appearance;
+    out.hasServices = f.has(ADV_HAS_SERVICES);
+    out.flags = f.flags;
+    out.txPower = f.txPower;
+    out.serviceUuidCount = (f.uuid16Count < BLE_DEVICE_MAX_UUIDS) ? f.uuid16Count : BLE_DEVICE_MAX_UUIDS;
+    memcpy(out.serviceUuids, f.uuid16, out.serviceUuidCount * sizeof(uint16_t));
+    return ok;
+}
+
+void formatAdvertAddress(const uint8_t* address, char* out, size_t outLen) {
+    // Native order is least significant byte first
+    snprintf(out, outLen, "%02x:%02x:%02x:%02x:%02x:%02x",
+             address[5], address[4], address[3], address[2], address[1], address[0]);
+}
+
+} // namespace Vanguard
@@ -0,0 +1,211 @@
+#ifndef VANGUARD_BLE_ADVERT_H
+#define VANGUARD_BLE_ADVERT_H
+
+/**
+ * @file BLEAdvert.h
+ * @brief Raw BLE advertisement record and its decoders
+ *
+ * The scan callback runs on the BLE host task and must not stall it, so
+ * it only copies the advertisement as received (address, RSSI, time and
+ * the AD payload bytes) into a RawAdvert. Everything that costs time -
+ * walking the AD structures, picking out the name and manufacturer data,
+ * formatting a placeholder name - happens later on SystemTask through
+ * decodeAdvert().
+ *
+ * The payload is a sequence of AD structures, [length][type][data].
+ * ADIterator walks them in place; parseAdvertFields() collects the ones
+ * we care about into an AdvertFields record that points back into the
+ * payload instead of copying it.
+ *
+ * @example
+ * RawAdvert adv;
+ * while (ring.pop(adv)) {
+ *     BLEDeviceInfo info;
+ *     decodeAdvert(adv, info);
+ *     registry.observe(info);
+ * }
+ *
+ * AdvertFields f;
+ * parseAdvertFields(adv.payload, adv.len, f);
+ * for (uint8_t i = 0; i < f.serviceDataCount; i++) {
+ *     if (f.serviceDataUuid[i] == 0xFEAA) eddystone(f.bytes(adv.payload, f.serviceData[i]));
+ * }
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t  BLE_ADV_MAX_LEN = 62;     // Legacy advert + scan response
+
+// AD types (Bluetooth Assigned Numbers, "Common Data Types")
+constexpr uint8_t AD_TYPE_FLAGS            = 0x01;
+constexpr uint8_t AD_TYPE_UUID16_PARTIAL   = 0x02;
+constexpr uint8_t AD_TYPE_UUID16_COMPLETE  = 0x03;
+constexpr uint8_t AD_TYPE_UUID32_PARTIAL   = 0x04;
+constexpr uint8_t AD_TYPE_UUID32_COMPLETE  = 0x05;
+constexpr uint8_t AD_TYPE_UUID128_PARTIAL  = 0x06;
+constexpr uint8_t AD_TYPE_UUID128_COMPLETE = 0x07;
+constexpr uint8_t AD_TYPE_NAME_SHORT       = 0x08;
+constexpr uint8_t AD_TYPE_NAME_COMPLETE    = 0x09;
+constexpr uint8_t AD_TYPE_TX_POWER         = 0x0A;
+constexpr uint8_t AD_TYPE_SERVICE_DATA16   = 0x16;
+constexpr uint8_t AD_TYPE_APPEARANCE       = 0x19;
+constexpr uint8_t AD_TYPE_MANUFACTURER     = 0xFF;
+
+// AdvertFields limits; a legacy payload can't hold many more than these
+constexpr size_t  ADV_MAX_UUID16       = 8;
+constexpr size_t  ADV_MAX_UUID128      = 2;
+constexpr size_t  ADV_MAX_SERVICE_DATA = 3;
+constexpr int8_t  ADV_TX_POWER_NONE    = 127;   // Not advertised
+
+// AdvertFields::present bits
+constexpr uint8_t ADV_HAS_FLAGS        = 0x01;
+constexpr uint8_t ADV_HAS_TX_POWER     = 0x02;
+constexpr uint8_t ADV_HAS_APPEARANCE   = 0x04;
+constexpr uint8_t ADV_HAS_MANUFACTURER = 0x08;
+constexpr uint8_t ADV_HAS_NAME         = 0x10;
+constexpr uint8_t ADV_HAS_SERVICES     = 0x20;  // Any UUID list, 32-bit included
+
+// Advertising report event types (HCI LE Advertising Report)
+constexpr uint8_t ADV_EVT_IND          = 0x00;
+constexpr uint8_t ADV_EVT_DIRECT_IND   = 0x01;
+constexpr uint8_t ADV_EVT_SCAN_IND     = 0x02;
+constexpr uint8_t ADV_EVT_NONCONN_IND  = 0x03;
+constexpr uint8_t ADV_EVT_SCAN_RSP     = 0x04;
+
+// Address types as NimBLE reports them: public, random, and their
+// identity-resolved forms; bit 0 set means random
+constexpr uint8_t BLE_ADDR_TYPE_RANDOM = 0x01;
+
+/**
+ * @brief One advertisement exactly as the controller reported it
+ *
+ * Payloads longer than BLE_ADV_MAX_LEN are cut; the decoder ignores an
+ * AD structure that runs past the end.
+ */
+struct RawAdvert {
+    uint8_t  address[6];         // As NimBLEAddress::getNative()
+    uint8_t  addressType;
+    uint8_t  advType;            // ADV_EVT_*
+    int8_t   rssi;
+    uint8_t  len;                // Payload bytes
+    uint32_t timestampMs;
+    uint8_t  payload[BLE_ADV_MAX_LEN];
+};
+
+/**
+ * @brief Where a field sits in the payload it was parsed from
+ */
+struct ADSpan {
+    uint8_t offset;
+    uint8_t len;
+};
+
+/**
+ * @brief Everything we use from one advertisement (48 bytes)
+ *
+ * Numbers are decoded; byte strings (name, manufacturer data, service
+ * data, 128-bit UUIDs) are spans into the payload, valid as long as it
+ * is. Entries past the limits are counted in `overflow` and dropped.
+ */
+struct AdvertFields {
+    uint8_t  present;                                // ADV_HAS_* bits
+    uint8_t  flags;
+    int8_t   txPower;                                // ADV_TX_POWER_NONE if absent
+    bool     nameComplete;
+    uint16_t appearance;
+    uint16_t manufacturerId;
+    ADSpan   manufacturerData;                       // After the company ID
+    ADSpan   name;
+
+    uint8_t  uuid16Count;
+    uint8_t  uuid128Count;
+    uint8_t  serviceDataCount;
+    uint8_t  overflow;
+    uint16_t uuid16[ADV_MAX_UUID16];
+    ADSpan   uuid128[ADV_MAX_UUID128];               // 16 bytes, little endian
+    uint16_t serviceDataUuid[ADV_MAX_SERVICE_DATA];
+    ADSpan   serviceData[ADV_MAX_SERVICE_DATA];      // After the UUID
+
+    bool has(uint8_t bit) const { return (present & bit) != 0; }
+
+    static const uint8_t* bytes(const uint8_t* payload, ADSpan span) {
+        return payload + span.offset;
+    }
+};
+
+// =============================================================================
+// ADIterator Class
+// =============================================================================
+
+/**
+ * @brief Walks length-type-data AD structures in place
+ *
+ * Stops at zero padding or at the first structure that would run past
+ * the end of the buffer; malformed() tells the two apart.
+ */
+class ADIterator {
+public:
+    ADIterator(const uint8_t* data, size_t len);
+
+    /**
+     * @brief Advance to the next structure
+     * @return false when no complete structure remains
+     */
+    bool next();
+
+    uint8_t        type() const     { return m_type; }
+    uint8_t        length() const   { return m_len; }     // Data bytes, type excluded
+    const uint8_t* data() const     { return m_data; }
+    size_t         offset() const   { return (size_t)(m_data - m_start); }
+    bool           malformed() const { return m_malformed; }
+
+private:
+    const uint8_t* m_start;
+    const uint8_t* m_pos;
+    const uint8_t* m_end;
+    uint8_t        m_type;
+    uint8_t        m_len;
+    const uint8_t* m_data;
+    bool           m_malformed;
+};
+
+// =============================================================================
+// DECODING
+// =============================================================================
+
+/**
+ * @brief Collect the fields of an AD payload without copying it
+ *
+ * Takes the complete local name over the shortened one.
+ *
+ * @return false if the payload was malformed (what came before the bad
+ *         structure is still filled in)
+ */
+bool parseAdvertFields(const uint8_t* payload, size_t len, AdvertFields& out);
+
+/**
+ * @brief Fill a BLEDeviceInfo from a raw advertisement
+ *
+ * Leaves the name empty when the device doesn't advertise one; the
+ * UUID list keeps the first BLE_DEVICE_MAX_UUIDS 16-bit UUIDs.
+ *
+ * @param fields If given, receives the parsed fields for further
+ *        decoding (beacon frames) without a second walk
+ * @return false as parseAdvertFields()
+ */
+bool decodeAdvert(const RawAdvert& adv, BLEDeviceInfo& out, AdvertFields* fields = nullptr);
+
+/**
+ * @brief Placeholder name for a nameless device: "aa:bb:cc:dd:ee:ff"
+ */
+void formatAdvertAddress(const uint8_t* address, char* out, size_t outLen);
+
+} // namespace Vanguard
+
+#endif // VANGUARD_BLE_ADVERT_H
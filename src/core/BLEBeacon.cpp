@@ -0,0 +1,237 @@
+/**
+ * @file BLEBeacon.cpp
+ * @brief Beacon frame layouts, identity keys and the report throttle
+ */
+
+#include "BLEBeacon.h"
+#include <cstdio>
+#include <cstring>
+
+namespace Vanguard {
+
+// Frame markers
+static const uint8_t IBEACON_TYPE[2]   = {0x02, 0x15};
+static const uint8_t ALTBEACON_CODE[2] = {0xBE, 0xAC};
+static const uint8_t EDDYSTONE_UID_FRAME = 0x00;
+static const uint8_t EDDYSTONE_URL_FRAME = 0x10;
+static const uint8_t EDDYSTONE_TLM_FRAME = 0x20;
+
+// Eddystone-URL scheme prefixes and expansion codes
+static const char* const URL_SCHEMES[] = {"http://www.", "https://www.", "http://", "https://"};
+static const char* const URL_EXPANSIONS[] = {
+    ".com/", ".org/", ".edu/", ".net/", ".info/", ".biz/", ".gov/",
+    ".com",  ".org",  ".edu",  ".net",  ".info",  ".biz",  ".gov"
+};
+
+static inline uint16_t readBE16(const uint8_t* p) {
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static inline uint32_t readBE32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// FNV-1a over the format and identity bytes, folded into something shaped
+// like a locally administered unicast address
+static void identityKey(BLEBeaconInfo& b, const uint8_t* id, size_t len) {
+    uint64_t h = 0xCBF29CE484222325ull;
+    h = (h ^ (uint8_t)b.format) * 0x100000001B3ull;
+    for (size_t i = 0; i < len; i++) h = (h ^ id[i]) * 0x100000001B3ull;
+
+    for (int i = 5; i >= 0; i--) {
+        b.key[i] = (uint8_t)h;
+        h >>= 8;
+    }
+    b.key[0] = (uint8_t)((b.key[0] & 0xFC) | 0x02);
+}
+
+static void decodeUrl(const uint8_t* d, size_t len, char* out, size_t outLen) {
+    size_t n = 0;
+    if (d[0] < sizeof(URL_SCHEMES) / sizeof(URL_SCHEMES[0])) {
+        n = (size_t)snprintf(out, outLen, "%s", URL_SCHEMES[d[0]]);
+        if (n >= outLen) n = outLen - 1;
+    }
+    for (size_t i = 1; i < len && n + 1 < outLen; i++) {
+        uint8_t c = d[i];
+        if (c < sizeof(URL_EXPANSIONS) / sizeof(URL_EXPANSIONS[0])) {
+            for (const char* e = URL_EXPANSIONS[c]; *e && n + 1 < outLen; e++) out[n++] = *e;
+        } else if (c > 0x20 && c < 0x7F) {
+            out[n++] = (char)c;
+        }
+    }
+    out[n] = '\0';
+}
+
+// =============================================================================
+// DECODING
+// =============================================================================
+
+static bool decodeManufacturer(const uint8_t* d, size_t len, uint16_t company, BLEBeaconInfo& out) {
+    if (company == COMPANY_APPLE && len >= 23 && memcmp(d, IBEACON_TYPE, 2) == 0) {
+        out.format = BLEBeaconFormat::IBEACON;
+        out.idLen = 20;                             // UUID + major + minor
+        memcpy(out.id, d + 2, 20);
+        out.major = readBE16(d + 18);
+        out.minor = readBE16(d + 20);
+        out.measuredPower = (int8_t)d[22];
+        return true;
+    }
+    if (len >= 24 && memcmp(d, ALTBEACON_CODE, 2) == 0) {
+        out.format = BLEBeaconFormat::ALTBEACON;
+        out.idLen = 20;
+        memcpy(out.id, d + 2, 20);
+        out.measuredPower = (int8_t)d[22];
+        return true;
+    }
+    return false;
+}
+
+static bool decodeEddystone(const uint8_t* d, size_t len, BLEBeaconInfo& out) {
+    if (len < 2) return false;
+
+    switch (d[0]) {
+        case EDDYSTONE_UID_FRAME:
+            if (len < 18) return false;
+            out.format = BLEBeaconFormat::EDDYSTONE_UID;
+            out.measuredPower = (int8_t)d[1];
+            out.idLen = 16;                         // Namespace + instance
+            memcpy(out.id, d + 2, 16);
+            return true;
+
+        case EDDYSTONE_URL_FRAME:
+            if (len < 4) return false;
+            out.format = BLEBeaconFormat::EDDYSTONE_URL;
+            out.measuredPower = (int8_t)d[1];
+            out.idLen = (uint8_t)((len - 2 < BLE_BEACON_ID_MAX) ? len - 2 : BLE_BEACON_ID_MAX);
+            memcpy(out.id, d + 2, out.idLen);       // Encoded URL
+            decodeUrl(d + 2, len - 2, out.url, sizeof(out.url));
+            return true;
+
+        case EDDYSTONE_TLM_FRAME:
+            if (len < 14 || d[1] != 0x00) return false;   // Version 1 is encrypted
+            out.format = BLEBeaconFormat::EDDYSTONE_TLM;
+            out.batteryMv = readBE16(d + 2);
+            out.temperature = (int16_t)readBE16(d + 4);
+            out.advCount = readBE32(d + 6);
+            out.uptimeDs = readBE32(d + 10);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+bool decodeBeacon(const RawAdvert& adv, const AdvertFields& fields, BLEBeaconInfo& out) {
+    memset(&out, 0, sizeof(out));
+    memcpy(out.address, adv.address, 6);
+    out.rssi = adv.rssi;
+    out.seenMs = adv.timestampMs;
+
+    bool found = false;
+    if (fields.has(ADV_HAS_MANUFACTURER)) {
+        found = decodeManufacturer(AdvertFields::bytes(adv.payload, fields.manufacturerData),
+                                   fields.manufacturerData.len, fields.manufacturerId, out);
+    }
+    for (uint8_t i = 0; !found && i < fields.serviceDataCount; i++) {
+        if (fields.serviceDataUuid[i] != UUID16_EDDYSTONE) continue;
+        found = decodeEddystone(AdvertFields::bytes(adv.payload, fields.serviceData[i]),
+                                fields.serviceData[i].len, out);
+    }
+    if (!found) return false;
+
+    if (out.format != BLEBeaconFormat::EDDYSTONE_TLM) identityKey(out, out.id, out.idLen);
+    return true;
+}
+
+void formatBeaconName(const BLEBeaconInfo& b, char* out, size_t outLen) {
+    switch (b.format) {
+        case BLEBeaconFormat::IBEACON:
+            snprintf(out, outLen, "iBeacon %02X%02X%02X%02X %u.%u",
+                     b.id[0], b.id[1], b.id[2], b.id[3], b.major, b.minor);
+            break;
+        case BLEBeaconFormat::ALTBEACON:
+            snprintf(out, outLen, "AltBeacon %02X%02X%02X%02X",
+                     b.id[0], b.id[1], b.id[2], b.id[3]);
+            break;
+        case BLEBeaconFormat::EDDYSTONE_UID:
+            snprintf(out, outLen, "Eddystone %02X%02X%02X%02X/%02X%02X",
+                     b.id[0], b.id[1], b.id[2], b.id[3], b.id[14], b.id[15]);
+            break;
+        case BLEBeaconFormat::EDDYSTONE_URL: {
+            // Drop the scheme; the host is what identifies it on screen
+            const char* url = strstr(b.url, "://");
+            url = url ? url + 3 : b.url;
+            if (strncmp(url, "www.", 4) == 0) url += 4;
+            snprintf(out, outLen, "%s", url);
+            break;
+        }
+        case BLEBeaconFormat::EDDYSTONE_TLM:
+            snprintf(out, outLen, "Eddystone TLM");
+            break;
+        default:
+            snprintf(out, outLen, "Beacon");
+            break;
+    }
+}
+
+// =============================================================================
+// BeaconTracker
+// =============================================================================
+
+BeaconTracker::BeaconTracker() {
+    reset();
+}
+
+void BeaconTracker::reset() {
+    memset(m_slots, 0, sizeof(m_slots));
+    m_rotations = 0;
+}
+
+bool BeaconTracker::admit(BLEBeaconInfo& beacon, uint32_t now) {
+    if (beacon.format == BLEBeaconFormat::NONE) return false;
+
+    // Telemetry belongs to whichever identity this address last sent
+    if (beacon.format == BLEBeaconFormat::EDDYSTONE_TLM) {
+        for (size_t i = 0; i < BLE_BEACON_SLOTS; i++) {
+            Slot& s = m_slots[i];
+            if (!s.used || memcmp(s.address, beacon.address, 6) != 0) continue;
+            memcpy(beacon.key, s.key, 6);
+            s.lastSeenMs = now;
+            if (now - s.lastTlmMs < BLE_BEACON_REPORT_MS) return false;
+            s.lastTlmMs = now;
+            return true;
+        }
+        return false;
+    }
+
+    Slot* victim = nullptr;
+    for (size_t i = 0; i < BLE_BEACON_SLOTS; i++) {
+        Slot& s = m_slots[i];
+        if (!s.used) {
+            if (!victim || victim->used) victim = &s;
+            continue;
+        }
+        if (memcmp(s.key, beacon.key, 6) == 0) {
+            s.lastSeenMs = now;
+            if (memcmp(s.address, beacon.address, 6) != 0) {
+                memcpy(s.address, beacon.address, 6);
+                m_rotations++;
+            } else if (now - s.lastReportMs < BLE_BEACON_REPORT_MS) {
+                return false;
+            }
+            s.lastReportMs = now;
+            return true;
+        }
+        if (!victim || (victim->used && (int32_t)(s.lastSeenMs - victim->lastSeenMs) < 0)) victim = &s;
+    }
+
+    memcpy(victim->key, beacon.key, 6);
+    memcpy(victim->address, beacon.address, 6);
+    victim->lastSeenMs = now;
+    victim->lastReportMs = now;
+    victim->lastTlmMs = now - BLE_BEACON_REPORT_MS;
+    victim->used = true;
+    return true;
+}
+
+} // namespace Vanguard
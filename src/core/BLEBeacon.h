@@ -0,0 +1,144 @@
+#ifndef VANGUARD_BLE_BEACON_H
+#define VANGUARD_BLE_BEACON_H
+
+/**
+ * @file BLEBeacon.h
+ * @brief iBeacon / AltBeacon / Eddystone decoding and identity tracking
+ *
+ * Beacons are identified by what they broadcast, not by their address:
+ * many rotate a random address every few minutes while the UUID/major/
+ * minor (or Eddystone namespace/instance) stays put. decodeBeacon()
+ * recognises the frame from the manufacturer or service data already
+ * located by parseAdvertFields() and derives a 6-byte identity key that
+ * stands in for the address in TargetTable, so a rotating beacon stays
+ * one target.
+ *
+ * Eddystone-TLM frames carry telemetry but no identity; BeaconTracker
+ * attributes them to the UID/URL last heard from the same address.
+ *
+ * @example
+ * BLEBeaconInfo beacon;
+ * if (decodeBeacon(adv, fields, beacon) && tracker.admit(beacon, now)) {
+ *     report(beacon);   // New identity, or the periodic refresh
+ * }
+ */
+
+#include "BLEAdvert.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr uint16_t COMPANY_APPLE        = 0x004C;
+constexpr uint16_t UUID16_EDDYSTONE     = 0xFEAA;
+
+constexpr size_t   BLE_BEACON_ID_MAX    = 20;    // AltBeacon ID is the longest
+constexpr size_t   BLE_BEACON_URL_MAX   = 40;    // Decoded Eddystone-URL
+constexpr size_t   BLE_BEACON_SLOTS     = 32;    // Identities BeaconTracker follows
+constexpr uint32_t BLE_BEACON_REPORT_MS = 1000;  // Refresh rate per identity
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+enum class BLEBeaconFormat : uint8_t {
+    NONE,
+    IBEACON,
+    ALTBEACON,
+    EDDYSTONE_UID,
+    EDDYSTONE_URL,
+    EDDYSTONE_TLM
+};
+
+/**
+ * @brief One decoded beacon frame
+ */
+struct BLEBeaconInfo {
+    BLEBeaconFormat format;
+    uint8_t  key[6];                      // Identity key (unset for TLM until admitted)
+    uint8_t  address[6];                  // Address it came from this time
+    int8_t   rssi;
+    int8_t   measuredPower;               // Calibrated RSSI at 1 m (Eddystone: 0 m)
+    uint32_t seenMs;
+
+    // Identity
+    uint8_t  idLen;
+    uint8_t  id[BLE_BEACON_ID_MAX];       // UUID, AltBeacon ID, namespace + instance
+    uint16_t major;                       // iBeacon only
+    uint16_t minor;
+    char     url[BLE_BEACON_URL_MAX + 1]; // Eddystone-URL only
+
+    // Eddystone-TLM
+    uint16_t batteryMv;                   // 0 if not supported
+    int16_t  temperature;                 // 1/256 degC, 0x8000 if not supported
+    uint32_t advCount;
+    uint32_t uptimeDs;                    // Tenths of a second since power-up
+};
+
+// =============================================================================
+// DECODING
+// =============================================================================
+
+/**
+ * @brief Recognise a beacon frame in an advertisement
+ * @param fields The advert's parseAdvertFields() result
+ * @return false if the advert isn't a beacon format we know
+ */
+bool decodeBeacon(const RawAdvert& adv, const AdvertFields& fields, BLEBeaconInfo& out);
+
+/**
+ * @brief Short display name, e.g. "iBeacon E2C56DB5 1.2" or the URL
+ */
+void formatBeaconName(const BLEBeaconInfo& beacon, char* out, size_t outLen);
+
+// =============================================================================
+// BeaconTracker Class
+// =============================================================================
+
+/**
+ * @brief Per-identity rate limiter and TLM attribution
+ *
+ * A beacon advertises several times a second; the target table only
+ * needs a refresh now and then. Fixed-size (least recently seen
+ * identity is replaced) and linear - BLE_BEACON_SLOTS is small.
+ */
+class BeaconTracker {
+public:
+    BeaconTracker();
+
+    /**
+     * @brief Decide whether a frame is worth reporting
+     *
+     * Identity frames are admitted when new, when their address has
+     * rotated, or once per BLE_BEACON_REPORT_MS. TLM frames get the key
+     * of the identity last heard from their address and are admitted at
+     * the same rate; with no such identity they are dropped.
+     */
+    bool admit(BLEBeaconInfo& beacon, uint32_t now);
+
+    void reset();
+
+    /**
+     * @brief Times a known identity reappeared under a new address
+     */
+    uint32_t rotations() const { return m_rotations; }
+
+private:
+    struct Slot {
+        uint8_t  key[6];
+        uint8_t  address[6];
+        uint32_t lastSeenMs;
+        uint32_t lastReportMs;
+        uint32_t lastTlmMs;
+        bool     used;
+    };
+
+    Slot     m_slots[BLE_BEACON_SLOTS];
+    uint32_t m_rotations;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_BLE_BEACON_H
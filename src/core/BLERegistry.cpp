@@ -0,0 +1,157 @@
+/**
+ * @file BLERegistry.cpp
+ * @brief BLE device storage, address index and recency list
+ */
+
+#include "BLERegistry.h"
+#include <cstring>
+
+namespace Vanguard {
+
+BLERegistry::BLERegistry(size_t capacity)
+    : m_capacity(capacity < 1 ? 1 : (capacity > BLE_REGISTRY_MAX ? BLE_REGISTRY_MAX : capacity))
+    , m_newest(NIL)
+    , m_oldest(NIL)
+    , m_evictions(0)
+{
+    m_devices.reserve(m_capacity);
+    m_links.resize(m_capacity);
+    m_index.resize(m_capacity * 2);         // Load <= 0.5
+}
+
+// =============================================================================
+// PUBLIC
+// =============================================================================
+
+bool BLERegistry::observe(const BLEDeviceInfo& info) {
+    int idx = indexOf(info.address);
+
+    if (idx >= 0) {
+        BLEDeviceInfo& d = m_devices[idx];
+        d.rssi = info.rssi;
+        d.lastSeenMs = info.lastSeenMs;
+        if (info.name[0] != '\0' && strcmp(d.name, info.name) != 0) {
+            memcpy(d.name, info.name, sizeof(d.name));
+            d.signature = info.signature;        // Matched against the new name
+        }
+        if ((uint16_t)idx != m_newest) {
+            unlink(idx);
+            pushNewest(idx);
+        }
+        return false;
+    }
+
+    if (m_devices.size() >= m_capacity) {
+        removeAt(m_oldest);
+        m_evictions++;
+    }
+
+    size_t entry = m_devices.size();
+    m_devices.push_back(info);        // Within the reservation: no reallocation
+    m_index.insert(entry, info.address);
+    pushNewest(entry);
+    return true;
+}
+
+const BLEDeviceInfo* BLERegistry::find(const uint8_t* address) const {
+    int idx = indexOf(address);
+    return (idx >= 0) ? &m_devices[idx] : nullptr;
+}
+
+bool BLERegistry::remove(const uint8_t* address) {
+    int idx = indexOf(address);
+    if (idx < 0) return false;
+    removeAt(idx);
+    return true;
+}
+
+size_t BLERegistry::pruneStale(uint32_t now, uint32_t maxAgeMs) {
+    size_t removed = 0;
+    while (m_oldest != NIL && now - m_devices[m_oldest].lastSeenMs > maxAgeMs) {
+        removeAt(m_oldest);
+        removed++;
+    }
+    return removed;
+}
+
+size_t BLERegistry::pruneStale(uint32_t now, const AgingPolicy& policy) {
+    uint32_t random = agingTimeoutMs(policy, TargetType::BLE_DEVICE, true);
+    uint32_t fixed = agingTimeoutMs(policy, TargetType::BLE_DEVICE, false);
+    uint32_t shortest = (random == 0) ? fixed : (fixed == 0 || random < fixed) ? random : fixed;
+    if (shortest == 0) return 0;
+
+    size_t removed = 0;
+    uint16_t entry = m_oldest;
+    while (entry != NIL && now - m_devices[entry].lastSeenMs > shortest) {
+        uint16_t next = m_links[entry].newer;
+        const BLEDeviceInfo& d = m_devices[entry];
+        uint32_t maxAge = d.isRandomAddress ? random : fixed;
+
+        if (maxAge != 0 && now - d.lastSeenMs > maxAge) {
+            // The last device moves into the hole
+            if (next == m_devices.size() - 1) next = entry;
+            removeAt(entry);
+            removed++;
+        }
+        entry = next;
+    }
+    return removed;
+}
+
+void BLERegistry::clear() {
+    m_devices.clear();
+    m_index.clear();
+    m_newest = NIL;
+    m_oldest = NIL;
+}
+
+// =============================================================================
+// ADDRESS INDEX
+// =============================================================================
+
+int BLERegistry::indexOf(const uint8_t* mac) const {
+    return m_index.find(mac, [this](size_t e) { return m_devices[e].address; });
+}
+
+// =============================================================================
+// RECENCY LIST
+// =============================================================================
+
+void BLERegistry::pushNewest(size_t entry) {
+    Links& l = m_links[entry];
+    l.newer = NIL;
+    l.older = m_newest;
+    if (m_newest != NIL) m_links[m_newest].newer = (uint16_t)entry;
+    m_newest = (uint16_t)entry;
+    if (m_oldest == NIL) m_oldest = (uint16_t)entry;
+}
+
+void BLERegistry::unlink(size_t entry) {
+    Links& l = m_links[entry];
+    if (l.newer != NIL) m_links[l.newer].older = l.older;
+    else                m_newest = l.older;
+    if (l.older != NIL) m_links[l.older].newer = l.newer;
+    else                m_oldest = l.newer;
+}
+
+void BLERegistry::removeAt(size_t entry) {
+    unlink(entry);
+    m_index.erase(entry, [this](size_t e) { return m_devices[e].address; });
+
+    size_t last = m_devices.size() - 1;
+    if (entry != last) {
+        // Move the last device into the hole and fix everything pointing at it
+        m_devices[entry] = m_devices[last];
+        m_links[entry] = m_links[last];
+        m_index.repoint(m_devices[entry].address, last, entry);
+
+        const Links& l = m_links[entry];
+        if (l.newer != NIL) m_links[l.newer].older = (uint16_t)entry;
+        else                m_newest = (uint16_t)entry;
+        if (l.older != NIL) m_links[l.older].newer = (uint16_t)entry;
+        else                m_oldest = (uint16_t)entry;
+    }
+    m_devices.pop_back();
+}
+
+} // namespace Vanguard
@@ -0,0 +1,123 @@
+#ifndef VANGUARD_BLE_REGISTRY_H
+#define VANGUARD_BLE_REGISTRY_H
+
+/**
+ * @file BLERegistry.h
+ * @brief Bounded BLE device set with a MAC hash index and LRU aging
+ *
+ * Every advertisement is a lookup, so in a crowded BLE space a linear
+ * scan per advert dominates. The registry:
+ *   - keeps devices packed in a vector reserved once at construction
+ *     (never reallocates; removal swaps the last one in)
+ *   - finds them through an open-addressing index on the address
+ *   - threads them on a least-recently-seen list, so refreshing a
+ *     device and evicting the oldest one are both O(1)
+ *
+ * The capacity is fixed per instance; the adapter uses
+ * BLE_REGISTRY_CAPACITY, host tests go far beyond it.
+ *
+ * @example
+ * BLERegistry devices;
+ * if (devices.observe(info)) onNewDevice(info);
+ * devices.pruneStale(millis(), AgingPolicy::defaults());
+ */
+
+#include "VanguardTypes.h"
+#include "TargetAging.h"
+#include "MacIndex.h"
+#include <vector>
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t   BLE_REGISTRY_CAPACITY = 256;     // ~24 KB of BLEDeviceInfo
+constexpr size_t   BLE_REGISTRY_MAX      = 0x7FFF;  // 16-bit links
+constexpr uint32_t BLE_DEVICE_TIMEOUT_MS = 60000;
+
+// =============================================================================
+// BLERegistry Class
+// =============================================================================
+
+class BLERegistry {
+public:
+    /**
+     * @param capacity Devices kept before the least recently seen is
+     *        evicted (clamped to 1..BLE_REGISTRY_MAX)
+     */
+    explicit BLERegistry(size_t capacity = BLE_REGISTRY_CAPACITY);
+
+    /**
+     * @brief An advertisement was received
+     *
+     * A known device gets its RSSI and timestamp refreshed, and its name
+     * replaced when this advert carries a different one (a scan response
+     * naming a device first stored under its address) - along with its
+     * signature, which depends on the name. A new one is stored whole.
+     *
+     * @return true if the device is new
+     */
+    bool observe(const BLEDeviceInfo& info);
+
+    const BLEDeviceInfo* find(const uint8_t* address) const;
+
+    bool remove(const uint8_t* address);
+
+    /**
+     * @brief Drop devices not seen for maxAgeMs (oldest first, stops early)
+     * @return Number removed
+     */
+    size_t pruneStale(uint32_t now, uint32_t maxAgeMs = BLE_DEVICE_TIMEOUT_MS);
+
+    /**
+     * @brief Drop devices older than the policy allows for their address type
+     *
+     * Walks from the oldest device and stops at the first one younger
+     * than the shorter BLE age, so it stays cheap when nothing expired.
+     *
+     * @return Number removed
+     */
+    size_t pruneStale(uint32_t now, const AgingPolicy& policy);
+
+    void clear();
+
+    /**
+     * @brief All devices, packed (order changes on removal)
+     */
+    const std::vector<BLEDeviceInfo>& devices() const { return m_devices; }
+    size_t count() const { return m_devices.size(); }
+    size_t capacity() const { return m_capacity; }
+
+    /**
+     * @brief Devices dropped to make room
+     */
+    uint32_t evictions() const { return m_evictions; }
+
+private:
+    static const uint16_t NIL = 0xFFFF;
+
+    struct Links {
+        uint16_t newer;
+        uint16_t older;
+    };
+
+    std::vector<BLEDeviceInfo> m_devices;
+    std::vector<Links>         m_links;      // Parallel to m_devices
+    MacIndex<>                 m_index;      // Sized from the capacity
+    size_t                     m_capacity;
+    uint16_t                   m_newest;
+    uint16_t                   m_oldest;
+    uint32_t                   m_evictions;
+
+    int  indexOf(const uint8_t* mac) const;
+
+    void pushNewest(size_t entry);
+    void unlink(size_t entry);
+    void removeAt(size_t entry);
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_BLE_REGISTRY_H
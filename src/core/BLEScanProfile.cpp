@@ -0,0 +1,30 @@
+/**
+ * @file BLEScanProfile.cpp
+ * @brief The scan profile table
+ */
+
+#include "BLEScanProfile.h"
+
+namespace Vanguard {
+
+// Indexed by BLEScanProfileId
+static const BLEScanProfile PROFILES[BLE_SCAN_PROFILE_COUNT] = {
+    // name         interval window active  dedup  duration
+    { "Fast",       40,      40,    true,   false, 5000  },
+    { "Balanced",   100,     50,    true,   false, 10000 },
+    { "Low power",  320,     32,    false,  true,  15000 }
+};
+
+const BLEScanProfile& getBleScanProfile(BLEScanProfileId id) {
+    size_t i = (size_t)id;
+    if (i >= BLE_SCAN_PROFILE_COUNT) i = (size_t)BLEScanProfileId::BALANCED;
+    return PROFILES[i];
+}
+
+uint8_t bleScanDutyPercent(const BLEScanProfile& profile) {
+    if (profile.intervalMs == 0) return 0;
+    uint32_t pct = (uint32_t)profile.windowMs * 100 / profile.intervalMs;
+    return (uint8_t)(pct > 100 ? 100 : pct);
+}
+
+} // namespace Vanguard
@@ -0,0 +1,65 @@
+#ifndef VANGUARD_BLE_SCAN_PROFILE_H
+#define VANGUARD_BLE_SCAN_PROFILE_H
+
+/**
+ * @file BLEScanProfile.h
+ * @brief Named BLE scan duty cycles
+ *
+ * The controller listens for `windowMs` out of every `intervalMs`,
+ * moving to the next advertising channel each interval. The window to
+ * interval ratio is the radio duty cycle: it drives both power draw and
+ * how soon a device's adverts land in a window. Active scanning follows
+ * each advert with a scan request (names often arrive only in the scan
+ * response). With duplicate filtering, the controller reports each
+ * address once per scan, which saves host work. It also leaves
+ * TrackerDetector one advert per scan to work with.
+ *
+ * @example
+ * const BLEScanProfile& p = getBleScanProfile(BLEScanProfileId::BALANCED);
+ * scanner->setInterval(p.intervalMs);
+ * scanner->setWindow(p.windowMs);
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Vanguard {
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+enum class BLEScanProfileId : uint8_t {
+    FAST,           // Continuous listening, every advert reported
+    BALANCED,       // Half duty; the default
+    LOW_POWER       // 10% duty, passive, duplicates filtered
+};
+
+constexpr size_t BLE_SCAN_PROFILE_COUNT = 3;
+
+struct BLEScanProfile {
+    const char* name;
+    uint16_t    intervalMs;         // Start of one window to the next
+    uint16_t    windowMs;           // Listening time per interval
+    bool        active;             // Send scan requests
+    bool        filterDuplicates;   // One report per address per scan
+    uint32_t    durationMs;         // Length of a standalone BLE scan
+};
+
+// =============================================================================
+// LOOKUP
+// =============================================================================
+
+/**
+ * @brief Parameters of a profile (BALANCED for an out-of-range id)
+ */
+const BLEScanProfile& getBleScanProfile(BLEScanProfileId id);
+
+/**
+ * @brief Radio duty cycle, 0-100
+ */
+uint8_t bleScanDutyPercent(const BLEScanProfile& profile);
+
+} // namespace Vanguard
+
+#endif // VANGUARD_BLE_SCAN_PROFILE_H
@@ -0,0 +1,294 @@
+/**
+ * @file BLESignatures.cpp
+ * @brief Rule parsing, the prefix trie and the bitset match
+ */
+
+#include "BLESignatures.h"
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Vanguard {
+
+// What BruceBLE::isLikelySkimmer used to check, plus common relatives
+static const char DEFAULT_RULES[] =
+    "HC-05 serial module: name=HC-05\n"
+    "HC-06 serial module: name=HC-06\n"
+    "HC-08 serial module: name=HC-08\n"
+    "JDY serial module: name=JDY-\n"
+    "Unnamed serial bridge: nameless connectable noservices\n";
+
+static const size_t LINE_MAX_LEN = 128;
+
+// A parsed line, checked before anything is committed
+struct ParsedRule {
+    char        label[BLE_SIG_LABEL_LEN];
+    const char* prefix;
+    size_t      prefixLen;
+    bool        hasMfg;
+    uint16_t    mfg;
+    bool        hasUuid;
+    uint16_t    uuid;
+    uint8_t     flags;
+    bool        connectable;
+    bool        nameless;
+    bool        noServices;
+};
+
+static bool parseHex16(const char* s, size_t len, uint16_t& out) {
+    if (len == 0 || len > 6) return false;
+    char buf[8];
+    memcpy(buf, s, len);
+    buf[len] = '\0';
+    char* end = nullptr;
+    unsigned long v = strtoul(buf, &end, 16);
+    if (*end != '\0' || v > 0xFFFF) return false;
+    out = (uint16_t)v;
+    return true;
+}
+
+static bool keyIs(const char* s, size_t len, const char* key) {
+    return strlen(key) == len && memcmp(s, key, len) == 0;
+}
+
+BLESignatureSet::BLESignatureSet() {
+    clear();
+}
+
+// =============================================================================
+// LOADING
+// =============================================================================
+
+void BLESignatureSet::clear() {
+    m_ruleCount = 0;
+    m_rejected = 0;
+    memset(m_trie, 0, sizeof(m_trie));
+    m_trieCount = 1;                     // Root
+    m_mfgCount = 0;
+    m_uuidCount = 0;
+    m_anyName = m_anyMfg = m_anyUuid = 0;
+    m_needConnectable = m_needNameless = m_needNoServices = 0;
+    memset(m_needFlag, 0, sizeof(m_needFlag));
+}
+
+void BLESignatureSet::loadDefaults() {
+    clear();
+    load(DEFAULT_RULES, sizeof(DEFAULT_RULES) - 1);
+}
+
+size_t BLESignatureSet::load(const char* text, size_t len) {
+    size_t accepted = 0;
+    size_t pos = 0;
+
+    while (pos < len) {
+        size_t end = pos;
+        while (end < len && text[end] != '\n') end++;
+
+        size_t lineLen = end - pos;
+        if (lineLen > 0 && text[end - 1] == '\r') lineLen--;
+
+        // Skip blanks and comments; everything else is a rule or an error
+        size_t first = pos;
+        while (first < pos + lineLen && isspace((unsigned char)text[first])) first++;
+        if (first < pos + lineLen && text[first] != '#') {
+            if (lineLen < LINE_MAX_LEN && parseLine(text + pos, lineLen)) accepted++;
+            else m_rejected++;
+        }
+        pos = end + 1;
+    }
+    return accepted;
+}
+
+bool BLESignatureSet::parseLine(const char* line, size_t len) {
+    if (m_ruleCount >= BLE_SIG_MAX_RULES) return false;
+
+    char buf[LINE_MAX_LEN];
+    memcpy(buf, line, len);
+    buf[len] = '\0';
+
+    char* colon = strchr(buf, ':');
+    if (!colon || colon == buf) return false;
+
+    ParsedRule r;
+    memset(&r, 0, sizeof(r));
+    *colon = '\0';
+    size_t labelLen = (size_t)(colon - buf);
+    if (labelLen >= sizeof(r.label)) labelLen = sizeof(r.label) - 1;
+    memcpy(r.label, buf, labelLen);
+
+    bool any = false;
+    char* p = colon + 1;
+    while (true) {
+        while (*p && isspace((unsigned char)*p)) p++;
+        if (!*p) break;
+
+        const char* key = p;
+        while (*p && *p != '=' && !isspace((unsigned char)*p)) p++;
+        size_t keyLen = (size_t)(p - key);
+
+        if (*p != '=') {
+            if      (keyIs(key, keyLen, "connectable")) r.connectable = true;
+            else if (keyIs(key, keyLen, "nameless"))    r.nameless = true;
+            else if (keyIs(key, keyLen, "noservices"))  r.noServices = true;
+            else return false;
+            any = true;
+            continue;
+        }
+
+        // Value: bare word, or "quoted" to allow spaces in a name prefix
+        p++;
+        const char* value = p;
+        if (*p == '"') {
+            value = ++p;
+            while (*p && *p != '"') p++;
+            if (*p != '"') return false;
+        } else {
+            while (*p && !isspace((unsigned char)*p)) p++;
+        }
+        size_t valueLen = (size_t)(p - value);
+        if (*p == '"') p++;
+
+        if (keyIs(key, keyLen, "name")) {
+            if (valueLen == 0 || valueLen > 31) return false;
+            r.prefix = value;
+            r.prefixLen = valueLen;
+        } else if (keyIs(key, keyLen, "mfg")) {
+            if (!parseHex16(value, valueLen, r.mfg)) return false;
+            r.hasMfg = true;
+        } else if (keyIs(key, keyLen, "uuid")) {
+            if (!parseHex16(value, valueLen, r.uuid)) return false;
+            r.hasUuid = true;
+        } else if (keyIs(key, keyLen, "flags")) {
+            uint16_t f;
+            if (!parseHex16(value, valueLen, f) || f > 0xFF) return false;
+            r.flags = (uint8_t)f;
+        } else {
+            return false;
+        }
+        any = true;
+    }
+    if (!any) return false;                 // Would match everything
+
+    // Room in the key tables first, so a failure leaves no stray bits
+    if (r.hasMfg && !lookup(m_mfg, m_mfgCount, r.mfg) && m_mfgCount >= BLE_SIG_MAX_KEYS) return false;
+    if (r.hasUuid && !lookup(m_uuid, m_uuidCount, r.uuid) && m_uuidCount >= BLE_SIG_MAX_KEYS) return false;
+
+    uint64_t bit = 1ull << m_ruleCount;
+    if (r.prefix) {
+        if (!addPrefix(r.prefix, r.prefixLen, bit)) return false;
+    } else {
+        m_anyName |= bit;
+    }
+    if (r.hasMfg) addKey(m_mfg, m_mfgCount, r.mfg, bit);
+    else          m_anyMfg |= bit;
+    if (r.hasUuid) addKey(m_uuid, m_uuidCount, r.uuid, bit);
+    else           m_anyUuid |= bit;
+
+    if (r.connectable) m_needConnectable |= bit;
+    if (r.nameless)    m_needNameless |= bit;
+    if (r.noServices)  m_needNoServices |= bit;
+    for (int b = 0; b < 8; b++) {
+        if (r.flags & (1 << b)) m_needFlag[b] |= bit;
+    }
+
+    memcpy(m_labels[m_ruleCount], r.label, sizeof(r.label));
+    m_ruleCount++;
+    return true;
+}
+
+// =============================================================================
+// MATCHERS
+// =============================================================================
+
+bool BLESignatureSet::addPrefix(const char* prefix, size_t len, uint64_t bit) {
+    uint16_t node = 0;
+    for (size_t i = 0; i < len; i++) {
+        uint16_t child = m_trie[node].child;
+        while (child && m_trie[child].c != prefix[i]) child = m_trie[child].sibling;
+
+        if (!child) {
+            if (m_trieCount >= BLE_SIG_TRIE_NODES) return false;
+            child = (uint16_t)m_trieCount++;
+            m_trie[child].c = prefix[i];
+            m_trie[child].sibling = m_trie[node].child;
+            m_trie[node].child = child;
+        }
+        node = child;
+    }
+    m_trie[node].rules |= bit;
+    return true;
+}
+
+bool BLESignatureSet::addKey(KeyBits* table, size_t& count, uint16_t key, uint64_t bit) {
+    size_t i = 0;
+    while (i < count && table[i].key < key) i++;
+    if (i < count && table[i].key == key) {
+        table[i].rules |= bit;
+        return true;
+    }
+    if (count >= BLE_SIG_MAX_KEYS) return false;
+
+    memmove(&table[i + 1], &table[i], (count - i) * sizeof(KeyBits));
+    table[i].key = key;
+    table[i].rules = bit;
+    count++;
+    return true;
+}
+
+uint64_t BLESignatureSet::lookup(const KeyBits* table, size_t count, uint16_t key) {
+    size_t lo = 0, hi = count;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (table[mid].key < key) lo = mid + 1;
+        else                      hi = mid;
+    }
+    return (lo < count && table[lo].key == key) ? table[lo].rules : 0;
+}
+
+uint8_t BLESignatureSet::match(const BLEDeviceInfo& device) const {
+    if (m_ruleCount == 0) return 0;
+    uint64_t m = (m_ruleCount == 64) ? ~0ull : ((1ull << m_ruleCount) - 1);
+
+    // Every prefix of the name that is also a rule prefix
+    uint64_t byName = m_anyName;
+    uint16_t node = 0;
+    for (size_t i = 0; i < sizeof(device.name) && device.name[i]; i++) {
+        uint16_t child = m_trie[node].child;
+        while (child && m_trie[child].c != device.name[i]) child = m_trie[child].sibling;
+        if (!child) break;
+        byName |= m_trie[child].rules;
+        node = child;
+    }
+    m &= byName;
+    if (!m) return 0;
+
+    bool hasMfg = device.manufacturerDataLen > 0 || device.manufacturerId != 0;
+    m &= m_anyMfg | (hasMfg ? lookup(m_mfg, m_mfgCount, device.manufacturerId) : 0);
+
+    uint64_t byUuid = m_anyUuid;
+    for (uint8_t i = 0; i < device.serviceUuidCount && i < BLE_DEVICE_MAX_UUIDS; i++) {
+        byUuid |= lookup(m_uuid, m_uuidCount, device.serviceUuids[i]);
+    }
+    m &= byUuid;
+
+    if (!device.isConnectable) m &= ~m_needConnectable;
+    if (device.name[0])        m &= ~m_needNameless;
+    if (device.hasServices)    m &= ~m_needNoServices;
+    for (int b = 0; b < 8; b++) {
+        if (!(device.flags & (1 << b))) m &= ~m_needFlag[b];
+    }
+    if (!m) return 0;
+
+    // Lowest set bit: the earliest rule wins
+    uint8_t id = 1;
+    while (!(m & 1)) { m >>= 1; id++; }
+    return id;
+}
+
+const char* BLESignatureSet::label(uint8_t id) const {
+    if (id == 0 || id > m_ruleCount) return "";
+    return m_labels[id - 1];
+}
+
+} // namespace Vanguard
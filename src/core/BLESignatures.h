@@ -0,0 +1,129 @@
+#ifndef VANGUARD_BLE_SIGNATURES_H
+#define VANGUARD_BLE_SIGNATURES_H
+
+/**
+ * @file BLESignatures.h
+ * @brief Table-driven BLE threat signatures (skimmer modules and the like)
+ *
+ * A signature is a conjunction of conditions on a device's first
+ * advertisements: name prefix, manufacturer ID, a 16-bit service UUID,
+ * AD flag bits and a few attributes (connectable, nameless, no
+ * services). Each rule owns one bit of a 64-bit set; adding a rule folds
+ * its conditions into per-field matchers:
+ *   - name prefixes share a trie whose nodes carry the rules ending there
+ *   - manufacturer IDs and UUIDs are sorted (key, rule bits) tables
+ *   - attributes and flag bits are "rules that require this" masks
+ * match() ANDs one set per field, so its cost depends on the device, not
+ * on how many rules are loaded. It runs once per new device at ingest.
+ *
+ * Rules load from a text file, one per line:
+ *
+ *     # label: condition ...
+ *     HC-05 serial module: name=HC-05
+ *     Unnamed serial bridge: nameless connectable noservices
+ *     Tile tracker: uuid=FEED
+ *
+ * Conditions: name=<prefix> mfg=<hex> uuid=<hex> flags=<hex, all set>
+ * connectable nameless noservices.
+ *
+ * @example
+ * BLESignatureSet sigs;
+ * sigs.loadDefaults();
+ * info.signature = sigs.match(info);
+ * if (info.signature) log(sigs.label(info.signature));
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t BLE_SIG_MAX_RULES  = 64;    // One bit each
+constexpr size_t BLE_SIG_LABEL_LEN  = 24;
+constexpr size_t BLE_SIG_TRIE_NODES = 256;   // Shared by all name prefixes
+constexpr size_t BLE_SIG_MAX_KEYS   = 64;    // Per ID/UUID table
+
+constexpr const char* BLE_SIGNATURE_PATH = "/signatures/ble.txt";
+
+// =============================================================================
+// BLESignatureSet Class
+// =============================================================================
+
+class BLESignatureSet {
+public:
+    BLESignatureSet();
+
+    /**
+     * @brief Parse rules from text, appending to what is loaded
+     * @return Rules accepted; bad lines are skipped and counted in rejected()
+     */
+    size_t load(const char* text, size_t len);
+
+    /**
+     * @brief Replace the rules with the built-in set
+     */
+    void loadDefaults();
+
+    void clear();
+
+    /**
+     * @brief First rule (in load order) the device satisfies
+     * @return Rule number + 1, or 0 for no match
+     */
+    uint8_t match(const BLEDeviceInfo& device) const;
+
+    /**
+     * @param id As returned by match()
+     */
+    const char* label(uint8_t id) const;
+
+    size_t count() const { return m_ruleCount; }
+    size_t rejected() const { return m_rejected; }
+
+private:
+    struct TrieNode {
+        uint64_t rules;          // Rules whose prefix ends here
+        uint16_t child;          // 0 = none (node 0 is the root)
+        uint16_t sibling;
+        char     c;
+    };
+
+    struct KeyBits {
+        uint16_t key;
+        uint64_t rules;
+    };
+
+    char     m_labels[BLE_SIG_MAX_RULES][BLE_SIG_LABEL_LEN];
+    size_t   m_ruleCount;
+    size_t   m_rejected;
+
+    TrieNode m_trie[BLE_SIG_TRIE_NODES];
+    size_t   m_trieCount;
+    KeyBits  m_mfg[BLE_SIG_MAX_KEYS];
+    size_t   m_mfgCount;
+    KeyBits  m_uuid[BLE_SIG_MAX_KEYS];
+    size_t   m_uuidCount;
+
+    // Rules without a condition on the field pass it unconditionally
+    uint64_t m_anyName;
+    uint64_t m_anyMfg;
+    uint64_t m_anyUuid;
+
+    // Rules requiring an attribute fail when the device lacks it
+    uint64_t m_needConnectable;
+    uint64_t m_needNameless;
+    uint64_t m_needNoServices;
+    uint64_t m_needFlag[8];
+
+    bool parseLine(const char* line, size_t len);
+    bool addPrefix(const char* prefix, size_t len, uint64_t bit);
+    static bool addKey(KeyBits* table, size_t& count, uint16_t key, uint64_t bit);
+    static uint64_t lookup(const KeyBits* table, size_t count, uint16_t key);
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_BLE_SIGNATURES_H
@@ -0,0 +1,334 @@
+/**
+ * @file BeaconParser.cpp
+ * @brief Information element walking and AP security classification
+ */
+
+#include "BeaconParser.h"
+
+namespace Vanguard {
+
+// Cipher/AKM suite OUIs
+static const uint8_t OUI_IEEE[3] = {0x00, 0x0F, 0xAC};   // RSN suites
+static const uint8_t OUI_MSFT[3] = {0x00, 0x50, 0xF2};   // WPA1 suites
+constexpr uint8_t    MSFT_TYPE_WPA = 0x01;
+
+// AKM suite selectors (00-0F-AC and 00-50-F2 share 1 and 2)
+constexpr uint8_t AKM_8021X        = 1;
+constexpr uint8_t AKM_PSK          = 2;
+constexpr uint8_t AKM_FT_8021X     = 3;
+constexpr uint8_t AKM_FT_PSK       = 4;
+constexpr uint8_t AKM_8021X_SHA256 = 5;
+constexpr uint8_t AKM_PSK_SHA256   = 6;
+constexpr uint8_t AKM_SAE          = 8;
+constexpr uint8_t AKM_FT_SAE       = 9;
+constexpr uint8_t AKM_SUITE_B      = 11;
+constexpr uint8_t AKM_SUITE_B_192  = 12;
+constexpr uint8_t AKM_SAE_EXT      = 24;
+
+// =============================================================================
+// IE ITERATOR
+// =============================================================================
+
+IEIterator::IEIterator(const uint8_t* data, uint16_t len)
+    : m_pos(data)
+    , m_end(data ? data + len : data)
+    , m_id(0)
+    , m_len(0)
+    , m_data(nullptr)
+{
+}
+
+bool IEIterator::next() {
+    if (!m_pos || m_end - m_pos < 2) return false;
+
+    uint8_t id = m_pos[0];
+    uint8_t len = m_pos[1];
+    if (m_end - (m_pos + 2) < len) return false;  // Truncated element
+
+    m_id = id;
+    m_len = len;
+    m_data = m_pos + 2;
+    m_pos += 2 + len;
+    return true;
+}
+
+// =============================================================================
+// SECURITY
+// =============================================================================
+
+/**
+ * @brief Walk the shared RSN/WPA layout and classify by AKM suites
+ *
+ * Layout: version(2) group(4) pairwiseCount(2) pairwise(4n)
+ *         akmCount(2) akm(4m) ...
+ */
+static SecurityType classifyAkms(const uint8_t* data, uint8_t len,
+                                 const uint8_t* oui,
+                                 SecurityType psk, SecurityType enterprise) {
+    uint16_t pos = 2 + 4;  // Skip version and group cipher
+    if (len < pos + 2) return SecurityType::UNKNOWN;
+
+    // Bound the count before scaling it: a hostile one would wrap pos
+    uint16_t pairwise = data[pos] | (data[pos + 1] << 8);
+    if (pairwise > (len - pos - 2) / 4) return SecurityType::UNKNOWN;
+    pos += 2 + 4 * pairwise;
+    if (len < pos + 2) return SecurityType::UNKNOWN;
+
+    uint16_t akms = data[pos] | (data[pos + 1] << 8);
+    pos += 2;
+
+    bool hasPsk = false;
+    bool hasSae = false;
+    bool hasEnterprise = false;
+
+    for (uint16_t i = 0; i < akms && pos + 4 <= len; i++, pos += 4) {
+        if (memcmp(data + pos, oui, 3) != 0) continue;
+        switch (data[pos + 3]) {
+            case AKM_PSK:
+            case AKM_FT_PSK:
+            case AKM_PSK_SHA256:
+                hasPsk = true;
+                break;
+            case AKM_SAE:
+            case AKM_FT_SAE:
+            case AKM_SAE_EXT:
+                hasSae = true;
+                break;
+            case AKM_8021X:
+            case AKM_FT_8021X:
+            case AKM_8021X_SHA256:
+            case AKM_SUITE_B:
+            case AKM_SUITE_B_192:
+                hasEnterprise = true;
+                break;
+            default:
+                break;
+        }
+    }
+
+    // WPA2/WPA3 transition networks still accept PSK clients, which is
+    // what matters for handshake capture, so PSK wins over SAE
+    if (hasPsk) return psk;
+    if (hasSae) return SecurityType::WPA3_SAE;
+    if (hasEnterprise) return enterprise;
+    return SecurityType::UNKNOWN;
+}
+
+SecurityType BeaconParser::securityFromRsn(const uint8_t* data, uint8_t len) {
+    return classifyAkms(data, len, OUI_IEEE,
+                        SecurityType::WPA2_PSK, SecurityType::WPA2_ENTERPRISE);
+}
+
+SecurityType BeaconParser::securityFromWpa(const uint8_t* data, uint8_t len) {
+    return classifyAkms(data, len, OUI_MSFT,
+                        SecurityType::WPA_PSK, SecurityType::WPA2_ENTERPRISE);
+}
+
+// =============================================================================
+// PARSING
+// =============================================================================
+
+bool BeaconParser::parse(const FrameView& frame, BeaconInfo& out) {
+    if (frame.type != WIFI_TYPE_MGMT) return false;
+    if (frame.subtype != WIFI_SUBTYPE_BEACON &&
+        frame.subtype != WIFI_SUBTYPE_PROBE_RESP) return false;
+    if (!frame.addr3 || frame.bodyLen < BEACON_FIXED_LEN) return false;
+
+    const uint8_t* fixed = frame.body;
+    uint16_t capability = fixed[10] | (fixed[11] << 8);
+
+    memcpy(out.bssid, frame.addr3, 6);
+    out.ssid[0] = '\0';
+    out.channel = frame.channel;
+    out.rssi = frame.rssi;
+    out.isHidden = true;
+    out.isProbeResponse = (frame.subtype == WIFI_SUBTYPE_PROBE_RESP);
+    out.beaconIntervalTu = fixed[8] | (fixed[9] << 8);
+
+    SecurityType rsn = SecurityType::OPEN;
+    SecurityType wpa = SecurityType::OPEN;
+    bool hasRsn = false;
+    bool hasWpa = false;
+    bool hasSsid = false;
+
+    IEIterator ie(frame.body + BEACON_FIXED_LEN, frame.bodyLen - BEACON_FIXED_LEN);
+    while (ie.next()) {
+        switch (ie.id()) {
+            case IE_SSID:
+                // Only the first SSID element counts
+                if (hasSsid) break;
+                hasSsid = true;
+                if (ie.length() > 0 && ie.length() <= SSID_MAX_LEN && ie.data()[0] != '\0') {
+                    memcpy(out.ssid, ie.data(), ie.length());
+                    out.ssid[ie.length()] = '\0';
+                    out.isHidden = false;
+                }
+                break;
+
+            case IE_DS_PARAMS:
+                if (ie.length() >= 1 && ie.data()[0] >= WIFI_CHANNEL_MIN &&
+                    ie.data()[0] <= WIFI_CHANNEL_MAX) {
+                    out.channel = ie.data()[0];
+                }
+                break;
+
+            case IE_RSN:
+                hasRsn = true;
+                rsn = securityFromRsn(ie.data(), ie.length());
+                break;
+
+            case IE_VENDOR:
+                if (ie.length() >= 4 && memcmp(ie.data(), OUI_MSFT, 3) == 0 &&
+                    ie.data()[3] == MSFT_TYPE_WPA) {
+                    hasWpa = true;
+                    wpa = securityFromWpa(ie.data() + 4, ie.length() - 4);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    // No SSID element at all means we didn't get a usable body
+    if (!hasSsid) return false;
+
+    if (hasRsn) {
+        out.security = rsn;
+    } else if (hasWpa) {
+        out.security = wpa;
+    } else if (capability & CAPABILITY_PRIVACY) {
+        out.security = SecurityType::WEP;
+    } else {
+        out.security = SecurityType::OPEN;
+    }
+    return true;
+}
+
+bool BeaconParser::parseProbeRequest(const FrameView& frame, ProbeInfo& out) {
+    if (frame.type != WIFI_TYPE_MGMT || frame.subtype != WIFI_SUBTYPE_PROBE_REQ) return false;
+    if (!frame.addr2 || (frame.addr2[0] & 0x01)) return false;
+
+    memcpy(out.station, frame.addr2, 6);
+    out.ssid[0] = '\0';
+    out.ssidLen = 0;
+    out.rssi = frame.rssi;
+    out.channel = frame.channel;
+
+    IEIterator ie(frame.body, frame.bodyLen);
+    while (ie.next()) {
+        if (ie.id() != IE_SSID) continue;
+        // Zero length is a wildcard; a leading NUL is padding, not a name
+        if (ie.length() > 0 && ie.length() <= SSID_MAX_LEN && ie.data()[0] != '\0') {
+            memcpy(out.ssid, ie.data(), ie.length());
+            out.ssid[ie.length()] = '\0';
+            out.ssidLen = ie.length();
+        }
+        return true;
+    }
+    return false;
+}
+
+// =============================================================================
+// THROTTLE
+// =============================================================================
+
+BeaconThrottle::BeaconThrottle() {
+    reset();
+}
+
+void BeaconThrottle::reset() {
+    memset(m_slots, 0, sizeof(m_slots));
+}
+
+bool BeaconThrottle::admit(const BeaconInfo& info, uint32_t now) {
+    Slot* victim = nullptr;
+
+    for (size_t i = 0; i < BEACON_THROTTLE_SLOTS; i++) {
+        Slot& s = m_slots[i];
+        if (!s.used) {
+            if (!victim || victim->used) victim = &s;
+            continue;
+        }
+        if (memcmp(s.bssid, info.bssid, 6) == 0) {
+            if (!info.isHidden && !s.revealed) {
+                s.revealed = true;
+                s.lastMs = now;
+                s.channel = info.channel;
+                return true;
+            }
+            if (now - s.lastMs < BEACON_THROTTLE_MS) return false;
+            s.lastMs = now;
+            s.channel = info.channel;
+            return true;
+        }
+        // Evict the least recently reported AP when full
+        if (!victim || (victim->used && s.lastMs < victim->lastMs)) victim = &s;
+    }
+
+    memcpy(victim->bssid, info.bssid, 6);
+    victim->channel = info.channel;
+    victim->lastMs = now;
+    victim->used = true;
+    victim->revealed = !info.isHidden;
+    return true;
+}
+
+void BeaconThrottle::countByChannel(uint8_t* counts, uint32_t now, uint32_t maxAgeMs) const {
+    memset(counts, 0, WIFI_CHANNEL_MAX + 1);
+
+    for (size_t i = 0; i < BEACON_THROTTLE_SLOTS; i++) {
+        const Slot& s = m_slots[i];
+        if (!s.used || s.channel > WIFI_CHANNEL_MAX) continue;
+        if (now - s.lastMs > maxAgeMs) continue;
+        if (counts[s.channel] < 0xFF) counts[s.channel]++;
+    }
+}
+
+// =============================================================================
+// PROBE THROTTLE
+// =============================================================================
+
+static uint32_t ssidHash(const char* ssid, uint8_t len) {
+    uint32_t h = 2166136261u;
+    for (uint8_t i = 0; i < len; i++) {
+        h ^= (uint8_t)ssid[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+ProbeThrottle::ProbeThrottle() {
+    reset();
+}
+
+void ProbeThrottle::reset() {
+    memset(m_slots, 0, sizeof(m_slots));
+}
+
+bool ProbeThrottle::admit(const ProbeInfo& info, uint32_t now) {
+    uint32_t hash = ssidHash(info.ssid, info.ssidLen);
+    Slot* victim = nullptr;
+
+    for (size_t i = 0; i < PROBE_THROTTLE_SLOTS; i++) {
+        Slot& s = m_slots[i];
+        if (!s.used) {
+            if (!victim || victim->used) victim = &s;
+            continue;
+        }
+        if (s.ssidHash == hash && memcmp(s.station, info.station, 6) == 0) {
+            if (now - s.lastMs < PROBE_THROTTLE_MS) return false;
+            s.lastMs = now;
+            return true;
+        }
+        if (!victim || (victim->used && s.lastMs < victim->lastMs)) victim = &s;
+    }
+
+    memcpy(victim->station, info.station, 6);
+    victim->ssidHash = hash;
+    victim->lastMs = now;
+    victim->used = true;
+    return true;
+}
+
+} // namespace Vanguard
@@ -0,0 +1,213 @@
+#ifndef VANGUARD_BEACON_PARSER_H
+#define VANGUARD_BEACON_PARSER_H
+
+/**
+ * @file BeaconParser.h
+ * @brief Zero-copy decoding of beacons, probe responses and probe requests
+ *
+ * Walks the information elements of a management frame body in place
+ * (no allocation, no String) and extracts what the TargetTable needs:
+ * SSID, operating channel and security. BeaconThrottle keeps the
+ * resulting observations down to about one per AP per second so the
+ * IPC queue isn't flooded at 10 beacons/s per AP. ProbeThrottle does
+ * the same for probe requests, which stations repeat on every channel.
+ *
+ * @example
+ * BeaconInfo info;
+ * if (BeaconParser::parse(frame, info) && throttle.admit(info, millis())) {
+ *     // hand info to the engine
+ * }
+ */
+
+#include "VanguardTypes.h"
+#include "FrameDispatcher.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+// Information element IDs
+constexpr uint8_t  IE_SSID              = 0;
+constexpr uint8_t  IE_DS_PARAMS         = 3;
+constexpr uint8_t  IE_RSN               = 48;
+constexpr uint8_t  IE_VENDOR            = 221;
+
+// Beacon/probe response fixed fields: timestamp(8) + interval(2) + capability(2)
+constexpr uint16_t BEACON_FIXED_LEN     = 12;
+constexpr uint16_t CAPABILITY_PRIVACY   = 0x0010;
+
+constexpr size_t   BEACON_THROTTLE_SLOTS = MAX_TARGETS;
+constexpr uint32_t BEACON_THROTTLE_MS    = 1000;  // Min gap between reports per AP
+
+constexpr size_t   PROBE_THROTTLE_SLOTS  = 64;
+constexpr uint32_t PROBE_THROTTLE_MS     = 5000;  // Min gap per station + SSID (one sweep)
+
+// =============================================================================
+// DATA STRUCTURES
+// =============================================================================
+
+/**
+ * @brief AP details decoded from a beacon or probe response
+ */
+struct BeaconInfo {
+    uint8_t      bssid[6];
+    char         ssid[SSID_MAX_LEN + 1];   // Empty if hidden
+    uint8_t      channel;                  // From DS IE, else the rx channel
+    int8_t       rssi;
+    SecurityType security;
+    bool         isHidden;                 // Zero-length or nulled SSID
+    bool         isProbeResponse;
+    uint16_t     beaconIntervalTu;
+};
+
+/**
+ * @brief A probe request: who asked, and for which network
+ */
+struct ProbeInfo {
+    uint8_t station[6];
+    char    ssid[SSID_MAX_LEN + 1];        // Empty for a wildcard probe
+    uint8_t ssidLen;
+    int8_t  rssi;
+    uint8_t channel;                       // Rx channel
+};
+
+// =============================================================================
+// IEIterator Class
+// =============================================================================
+
+/**
+ * @brief Walks tag-length-value information elements in place
+ *
+ * Stops at the first element that would run past the end of the buffer,
+ * so a truncated or malformed body never reads out of bounds.
+ */
+class IEIterator {
+public:
+    IEIterator(const uint8_t* data, uint16_t len);
+
+    /**
+     * @brief Advance to the next element
+     * @return false when no complete element remains
+     */
+    bool next();
+
+    uint8_t        id() const     { return m_id; }
+    uint8_t        length() const { return m_len; }
+    const uint8_t* data() const   { return m_data; }
+
+private:
+    const uint8_t* m_pos;
+    const uint8_t* m_end;
+    uint8_t        m_id;
+    uint8_t        m_len;
+    const uint8_t* m_data;
+};
+
+// =============================================================================
+// BeaconParser Class
+// =============================================================================
+
+class BeaconParser {
+public:
+    /**
+     * @brief Decode a beacon or probe response
+     * @return false if the frame isn't one, or its body is truncated
+     */
+    static bool parse(const FrameView& frame, BeaconInfo& out);
+
+    /**
+     * @brief Decode a probe request (the body is IEs only)
+     * @return false if the frame isn't one, it has no SSID element, or
+     *         it was sent from a group address
+     */
+    static bool parseProbeRequest(const FrameView& frame, ProbeInfo& out);
+
+    /**
+     * @brief Classify an RSN (IE 48) element body
+     */
+    static SecurityType securityFromRsn(const uint8_t* data, uint8_t len);
+
+    /**
+     * @brief Classify a WPA1 vendor element body (after OUI + type)
+     */
+    static SecurityType securityFromWpa(const uint8_t* data, uint8_t len);
+};
+
+// =============================================================================
+// BeaconThrottle Class
+// =============================================================================
+
+/**
+ * @brief Per-BSSID rate limiter for passive observations
+ *
+ * Fixed-size, so it is safe to use from the promiscuous callback.
+ * A hidden AP whose SSID is revealed by a probe response is always let
+ * through once, regardless of the interval.
+ */
+class BeaconThrottle {
+public:
+    BeaconThrottle();
+
+    /**
+     * @brief Decide whether this observation should be reported
+     */
+    bool admit(const BeaconInfo& info, uint32_t now);
+
+    /**
+     * @brief Forget all APs
+     */
+    void reset();
+
+    /**
+     * @brief Count recently reported APs per channel
+     * @param counts Output, indexed by channel (WIFI_CHANNEL_MAX + 1 entries)
+     * @param maxAgeMs Ignore APs not reported for this long
+     */
+    void countByChannel(uint8_t* counts, uint32_t now, uint32_t maxAgeMs) const;
+
+private:
+    struct Slot {
+        uint8_t  bssid[6];
+        uint8_t  channel;
+        uint32_t lastMs;
+        bool     used;
+        bool     revealed;   // A non-hidden SSID has been reported
+    };
+
+    Slot m_slots[BEACON_THROTTLE_SLOTS];
+};
+
+// =============================================================================
+// ProbeThrottle Class
+// =============================================================================
+
+/**
+ * @brief Per-(station, SSID) rate limiter for probe requests
+ *
+ * A scanning phone sends the same directed probe on every channel in a
+ * burst; one report per sweep is all the PNL needs. Fixed-size and
+ * safe to use from the promiscuous callback.
+ */
+class ProbeThrottle {
+public:
+    ProbeThrottle();
+
+    bool admit(const ProbeInfo& info, uint32_t now);
+    void reset();
+
+private:
+    struct Slot {
+        uint8_t  station[6];
+        uint32_t ssidHash;
+        uint32_t lastMs;
+        bool     used;
+    };
+
+    Slot m_slots[PROBE_THROTTLE_SLOTS];
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_BEACON_PARSER_H
@@ -0,0 +1,148 @@
+/**
+ * @file CaptureRotation.cpp
+ * @brief Capture rotation policy and quota ledger
+ */
+
+#include "CaptureRotation.h"
+#include <cstdio>
+
+namespace Vanguard {
+
+CaptureRotation::CaptureRotation(const CapturePolicy& policy)
+    : m_policy(policy)
+    , m_sessionId(0)
+    , m_sequence(0)
+    , m_fileStartMs(0)
+    , m_count(0)
+    , m_totalBytes(0)
+{
+    m_tag[0] = '\0';
+}
+
+// =============================================================================
+// ROTATION
+// =============================================================================
+
+void CaptureRotation::begin(const char* tag, uint32_t sessionId, uint32_t now) {
+    strncpy(m_tag, tag ? tag : "cap", CAPTURE_TAG_LEN - 1);
+    m_tag[CAPTURE_TAG_LEN - 1] = '\0';
+    m_sessionId = sessionId;
+    m_sequence = 0;
+    m_fileStartMs = now;
+}
+
+void CaptureRotation::nextPath(char* out, size_t len, uint32_t now) {
+    snprintf(out, len, "%s/%08lX_%04u_%s.pcap",
+             CAPTURE_DIR, (unsigned long)m_sessionId, (unsigned)m_sequence, m_tag);
+    m_sequence++;
+    m_fileStartMs = now;
+}
+
+bool CaptureRotation::shouldRotate(uint32_t fileBytes, uint32_t now) const {
+    if (m_policy.maxFileBytes && fileBytes >= m_policy.maxFileBytes) return true;
+    if (m_policy.maxFileMs && now - m_fileStartMs >= m_policy.maxFileMs) return true;
+    return false;
+}
+
+// =============================================================================
+// LEDGER
+// =============================================================================
+
+bool CaptureRotation::track(const char* path, uint32_t bytes) {
+    int idx = find(path);
+    if (idx >= 0) {
+        m_totalBytes = m_totalBytes - m_entries[idx].bytes + bytes;
+        m_entries[idx].bytes = bytes;
+        return true;
+    }
+    if (m_count >= CAPTURE_LEDGER_SLOTS) return false;
+
+    uint64_t key = orderKey(path);
+
+    // Insertion sort: oldest (lowest key) first, ties by name
+    size_t pos = m_count;
+    while (pos > 0) {
+        const Entry& prev = m_entries[pos - 1];
+        if (prev.key < key || (prev.key == key && strcmp(prev.path, path) <= 0)) break;
+        m_entries[pos] = prev;
+        pos--;
+    }
+
+    Entry& e = m_entries[pos];
+    strncpy(e.path, path, CAPTURE_PATH_LEN - 1);
+    e.path[CAPTURE_PATH_LEN - 1] = '\0';
+    e.key = key;
+    e.bytes = bytes;
+
+    m_count++;
+    m_totalBytes += bytes;
+    return true;
+}
+
+void CaptureRotation::untrack(const char* path) {
+    int idx = find(path);
+    if (idx < 0) return;
+
+    m_totalBytes -= m_entries[idx].bytes;
+    for (size_t i = (size_t)idx; i + 1 < m_count; i++) {
+        m_entries[i] = m_entries[i + 1];
+    }
+    m_count--;
+}
+
+bool CaptureRotation::nextEviction(uint32_t reserveBytes, const char* keep,
+                                   char* out, size_t len) const {
+    bool overQuota = (uint64_t)m_totalBytes + reserveBytes > m_policy.maxTotalBytes;
+    bool ledgerFull = m_count >= CAPTURE_LEDGER_SLOTS;
+    if (!overQuota && !ledgerFull) return false;
+
+    for (size_t i = 0; i < m_count; i++) {
+        if (keep && strcmp(m_entries[i].path, keep) == 0) continue;
+        strncpy(out, m_entries[i].path, len - 1);
+        out[len - 1] = '\0';
+        return true;
+    }
+    return false;  // Only the open file is left
+}
+
+uint64_t CaptureRotation::orderKey(const char* path) {
+    const char* name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+
+    // "SSSSSSSS_NNNN_..." : 8 hex digits, '_', 4 decimal digits, '_' or '.'
+    uint32_t session = 0;
+    for (int i = 0; i < 8; i++) {
+        char c = name[i];
+        uint8_t v;
+        if (c >= '0' && c <= '9')      v = c - '0';
+        else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+        else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+        else return 0;
+        session = (session << 4) | v;
+    }
+    if (name[8] != '_') return 0;
+
+    uint32_t seq = 0;
+    for (int i = 9; i < 13; i++) {
+        char c = name[i];
+        if (c < '0' || c > '9') return 0;
+        seq = seq * 10 + (c - '0');
+    }
+    if (name[13] != '_' && name[13] != '.') return 0;
+
+    // +1 so a well-formed name always sorts after foreign files
+    return (((uint64_t)session << 16) | seq) + 1;
+}
+
+// =============================================================================
+// PRIVATE
+// =============================================================================
+
+int CaptureRotation::find(const char* path) const {
+    for (size_t i = 0; i < m_count; i++) {
+        if (strcmp(m_entries[i].path, path) == 0) return (int)i;
+    }
+    return -1;
+}
+
+} // namespace Vanguard
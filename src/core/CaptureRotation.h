@@ -0,0 +1,153 @@
+#ifndef VANGUARD_CAPTURE_ROTATION_H
+#define VANGUARD_CAPTURE_ROTATION_H
+
+/**
+ * @file CaptureRotation.h
+ * @brief Capture file naming, rotation and disk quota policy
+ *
+ * Decides when a capture file is rotated (size or age), what the next
+ * file is called, and which old captures must go to stay under the
+ * total space cap. Filenames lead with the session ID and sequence
+ * number ("/captures/0000002A_0003_hs_AABBCC.pcap") so the ledger can
+ * order them oldest-first without timestamps from an RTC we don't have.
+ *
+ * No SD access here - PCAPWriter does the I/O and reports back.
+ *
+ * @example
+ * CaptureRotation rot;
+ * rot.begin("hs_AABBCC", sessionId, millis());
+ * rot.nextPath(path, sizeof(path), millis());
+ * // ... write ...
+ * if (rot.shouldRotate(bytesWritten, millis())) { ... }
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr const char* CAPTURE_DIR            = "/captures";
+constexpr size_t   CAPTURE_PATH_LEN          = 64;
+constexpr size_t   CAPTURE_TAG_LEN           = 24;
+constexpr size_t   CAPTURE_LEDGER_SLOTS      = 64;
+
+constexpr uint32_t CAPTURE_MAX_FILE_BYTES    = 4UL * 1024 * 1024;   // 4MB per file
+constexpr uint32_t CAPTURE_MAX_FILE_MS       = 10UL * 60 * 1000;    // 10 min per file
+constexpr uint32_t CAPTURE_MAX_TOTAL_BYTES   = 64UL * 1024 * 1024;  // 64MB of captures
+
+// =============================================================================
+// DATA STRUCTURES
+// =============================================================================
+
+/**
+ * @brief Rotation and quota limits
+ */
+struct CapturePolicy {
+    uint32_t maxFileBytes;     // Rotate once a file reaches this size
+    uint32_t maxFileMs;        // Rotate once a file is this old (0 = never)
+    uint32_t maxTotalBytes;    // Delete oldest captures beyond this
+    bool     preallocate;      // Reserve maxFileBytes up front
+
+    static CapturePolicy defaults() {
+        CapturePolicy p = { CAPTURE_MAX_FILE_BYTES, CAPTURE_MAX_FILE_MS,
+                            CAPTURE_MAX_TOTAL_BYTES, true };
+        return p;
+    }
+};
+
+// =============================================================================
+// CaptureRotation Class
+// =============================================================================
+
+class CaptureRotation {
+public:
+    explicit CaptureRotation(const CapturePolicy& policy = CapturePolicy::defaults());
+
+    const CapturePolicy& policy() const { return m_policy; }
+
+    // -------------------------------------------------------------------------
+    // Rotation
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Start a capture session
+     * @param tag Short label appended to filenames ("hs_AABBCC")
+     */
+    void begin(const char* tag, uint32_t sessionId, uint32_t now);
+
+    /**
+     * @brief Name the next file in the session and start its clock
+     */
+    void nextPath(char* out, size_t len, uint32_t now);
+
+    /**
+     * @brief Check if the current file should be closed and a new one opened
+     */
+    bool shouldRotate(uint32_t fileBytes, uint32_t now) const;
+
+    uint32_t sessionId() const { return m_sessionId; }
+    uint16_t sequence() const  { return m_sequence; }
+
+    // -------------------------------------------------------------------------
+    // Ledger (space accounting)
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Add a file or update its size
+     * @return false if the ledger is full
+     */
+    bool track(const char* path, uint32_t bytes);
+
+    /**
+     * @brief Drop a file from the ledger (after deleting it)
+     */
+    void untrack(const char* path);
+
+    /**
+     * @brief Pick the oldest file that must be deleted to respect the cap
+     *
+     * Also evicts when the ledger itself is full, so it stays bounded.
+     *
+     * @param reserveBytes Space about to be claimed by a new file
+     * @param keep Path that must not be chosen (the open file), or nullptr
+     * @return false if nothing needs deleting
+     */
+    bool nextEviction(uint32_t reserveBytes, const char* keep, char* out, size_t len) const;
+
+    uint32_t totalBytes() const { return m_totalBytes; }
+    size_t   fileCount() const  { return m_count; }
+
+    /**
+     * @brief Sort key from a capture filename (session << 16 | sequence)
+     *
+     * Files not named by this scheme sort first (key 0), so captures
+     * from older firmware are treated as the oldest.
+     */
+    static uint64_t orderKey(const char* path);
+
+private:
+    struct Entry {
+        char     path[CAPTURE_PATH_LEN];
+        uint64_t key;
+        uint32_t bytes;
+    };
+
+    CapturePolicy m_policy;
+    char          m_tag[CAPTURE_TAG_LEN];
+    uint32_t      m_sessionId;
+    uint16_t      m_sequence;
+    uint32_t      m_fileStartMs;
+
+    Entry         m_entries[CAPTURE_LEDGER_SLOTS];  // Sorted oldest first
+    size_t        m_count;
+    uint32_t      m_totalBytes;
+
+    int find(const char* path) const;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_CAPTURE_ROTATION_H
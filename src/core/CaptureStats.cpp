@@ -0,0 +1,137 @@
+/**
+ * @file CaptureStats.cpp
+ * @brief Capture pipeline counters and per-second sampling
+ */
+
+#include "CaptureStats.h"
+#include <cstdio>
+#include <cstring>
+
+namespace Vanguard {
+
+uint8_t CaptureStatsSnapshot::busiestChannel() const {
+    uint8_t best = 0;
+    for (uint8_t ch = WIFI_CHANNEL_MIN; ch <= WIFI_CHANNEL_MAX; ch++) {
+        if (rxByChannel[ch] > (best ? rxByChannel[best] : 0)) best = ch;
+    }
+    return best;
+}
+
+CaptureStats::CaptureStats() {
+    reset(0);
+}
+
+void CaptureStats::reset(uint32_t now) {
+    m_rx = m_filtered = m_enqueued = m_dropped = 0;
+    m_bytes = m_writes = 0;
+    m_writeUs = 0;
+    m_writeMaxUs = 0;
+
+    m_intervalStartMs = now;
+    m_lastRx = m_lastFiltered = m_lastEnqueued = m_lastDropped = 0;
+    m_lastBytes = m_lastWrites = 0;
+    m_lastWriteUs = 0;
+
+    for (uint8_t ch = 0; ch <= WIFI_CHANNEL_MAX; ch++) {
+        m_rxByChannel[ch] = 0;
+        m_lastRxByChannel[ch] = 0;
+    }
+}
+
+// =============================================================================
+// COUNTING
+// =============================================================================
+
+void CaptureStats::countRx(uint8_t channel) {
+    m_rx++;
+    if (channel >= WIFI_CHANNEL_MIN && channel <= WIFI_CHANNEL_MAX) {
+        m_rxByChannel[channel]++;
+    }
+}
+
+void CaptureStats::countWrite(uint32_t bytes, uint32_t latencyUs) {
+    m_bytes += bytes;
+    m_writes++;
+    m_writeUs += latencyUs;
+    if (latencyUs > m_writeMaxUs) m_writeMaxUs = latencyUs;
+}
+
+// =============================================================================
+// SAMPLING
+// =============================================================================
+
+bool CaptureStats::sample(uint32_t now, CaptureStatsSnapshot& out) {
+    uint32_t elapsed = now - m_intervalStartMs;
+    if (elapsed < CAPTURE_STATS_INTERVAL_MS) return false;
+
+    // Read each producer counter once; deltas wrap correctly
+    uint32_t rx = m_rx;
+    uint32_t filtered = m_filtered;
+    uint32_t enqueued = m_enqueued;
+    uint32_t dropped = m_dropped;
+
+    auto perSec = [elapsed](uint32_t delta) -> uint32_t {
+        return (uint32_t)(((uint64_t)delta * 1000 + elapsed / 2) / elapsed);
+    };
+
+    memset(&out, 0, sizeof(out));
+    out.timestampMs    = now;
+    out.rxPerSec       = perSec(rx - m_lastRx);
+    out.filteredPerSec = perSec(filtered - m_lastFiltered);
+    out.enqueuedPerSec = perSec(enqueued - m_lastEnqueued);
+    out.droppedPerSec  = perSec(dropped - m_lastDropped);
+    out.bytesPerSec    = perSec(m_bytes - m_lastBytes);
+    out.totalDropped   = dropped;
+    out.totalBytes     = m_bytes;
+
+    uint32_t writes = m_writes - m_lastWrites;
+    out.writeAvgUs = writes ? (uint32_t)((m_writeUs - m_lastWriteUs) / writes) : 0;
+    out.writeMaxUs = m_writeMaxUs;
+
+    for (uint8_t ch = WIFI_CHANNEL_MIN; ch <= WIFI_CHANNEL_MAX; ch++) {
+        uint32_t count = m_rxByChannel[ch];
+        uint32_t rate = perSec(count - m_lastRxByChannel[ch]);
+        out.rxByChannel[ch] = rate > 0xFFFF ? 0xFFFF : (uint16_t)rate;
+        m_lastRxByChannel[ch] = count;
+    }
+
+    m_lastRx = rx;
+    m_lastFiltered = filtered;
+    m_lastEnqueued = enqueued;
+    m_lastDropped = dropped;
+    m_lastBytes = m_bytes;
+    m_lastWrites = m_writes;
+    m_lastWriteUs = m_writeUs;
+    m_writeMaxUs = 0;
+    m_intervalStartMs = now;
+    return true;
+}
+
+// =============================================================================
+// CSV
+// =============================================================================
+
+int CaptureStats::formatCsvHeader(char* buf, size_t len) {
+    int n = snprintf(buf, len,
+                     "ms,rx,filtered,enqueued,dropped,bytes,write_avg_us,write_max_us,"
+                     "ring_used,ring_peak");
+    for (uint8_t ch = WIFI_CHANNEL_MIN; ch <= WIFI_CHANNEL_MAX && n >= 0 && (size_t)n < len; ch++) {
+        n += snprintf(buf + n, len - n, ",ch%u", (unsigned)ch);
+    }
+    return n;
+}
+
+int CaptureStats::formatCsv(const CaptureStatsSnapshot& s, char* buf, size_t len) {
+    int n = snprintf(buf, len, "%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%u,%u",
+                     (unsigned long)s.timestampMs, (unsigned long)s.rxPerSec,
+                     (unsigned long)s.filteredPerSec, (unsigned long)s.enqueuedPerSec,
+                     (unsigned long)s.droppedPerSec, (unsigned long)s.bytesPerSec,
+                     (unsigned long)s.writeAvgUs, (unsigned long)s.writeMaxUs,
+                     (unsigned)s.ringUsed, (unsigned)s.ringPeak);
+    for (uint8_t ch = WIFI_CHANNEL_MIN; ch <= WIFI_CHANNEL_MAX && n >= 0 && (size_t)n < len; ch++) {
+        n += snprintf(buf + n, len - n, ",%u", (unsigned)s.rxByChannel[ch]);
+    }
+    return n;
+}
+
+} // namespace Vanguard
@@ -0,0 +1,130 @@
+#ifndef VANGUARD_CAPTURE_STATS_H
+#define VANGUARD_CAPTURE_STATS_H
+
+/**
+ * @file CaptureStats.h
+ * @brief Health counters for the capture pipeline
+ *
+ * Counts every stage a frame passes through - received, filtered out,
+ * queued to the ring, dropped because the ring was full, written to SD -
+ * plus SD write latency and per-channel receive counts. Counters are
+ * free-running totals written by one side each (rx callback or writer),
+ * and sample() turns them into per-second deltas, so neither side ever
+ * resets a counter the other is incrementing.
+ *
+ * @example
+ * CaptureStats stats;
+ * stats.reset(millis());
+ * // rx callback:
+ * stats.countRx(channel);
+ * // writer:
+ * stats.countWrite(bytes, latencyUs);
+ * // once per tick:
+ * CaptureStatsSnapshot snap;
+ * if (stats.sample(millis(), snap)) publish(snap);
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr uint32_t CAPTURE_STATS_INTERVAL_MS = 1000;
+constexpr const char* CAPTURE_STATS_LOG      = "/logs/capture_stats.csv";
+
+/**
+ * @brief One sampling interval's worth of counters
+ *
+ * Rates are scaled to per-second regardless of the exact interval.
+ */
+struct CaptureStatsSnapshot {
+    uint32_t timestampMs;        // End of the interval
+    uint32_t rxPerSec;           // Frames seen by the rx callback
+    uint32_t filteredPerSec;     // Rejected by the capture filter
+    uint32_t enqueuedPerSec;     // Accepted into the ring
+    uint32_t droppedPerSec;      // Ring full
+    uint32_t bytesPerSec;        // Written to SD
+    uint32_t writeAvgUs;         // Mean SD write latency this interval
+    uint32_t writeMaxUs;         // Worst SD write latency this interval
+    uint32_t totalDropped;       // Since reset()
+    uint32_t totalBytes;         // Since reset()
+    uint16_t ringUsed;           // Filled in by the owner of the ring
+    uint16_t ringPeak;
+    uint16_t ringCapacity;
+    uint16_t rxByChannel[WIFI_CHANNEL_MAX + 1];   // Frames/s, index = channel
+
+    /**
+     * @brief Channel with the most traffic this interval (0 if none)
+     */
+    uint8_t busiestChannel() const;
+};
+
+// =============================================================================
+// CaptureStats Class
+// =============================================================================
+
+class CaptureStats {
+public:
+    CaptureStats();
+
+    /**
+     * @brief Zero all counters and start a new interval
+     */
+    void reset(uint32_t now);
+
+    // Producer side (rx callback)
+    void countRx(uint8_t channel);
+    void countFiltered() { m_filtered++; }
+    void countEnqueued() { m_enqueued++; }
+    void countDropped()  { m_dropped++; }
+
+    // Consumer side (SD writer)
+    void countWrite(uint32_t bytes, uint32_t latencyUs);
+
+    /**
+     * @brief Close the interval once CAPTURE_STATS_INTERVAL_MS has passed
+     * @return true if out was filled
+     */
+    bool sample(uint32_t now, CaptureStatsSnapshot& out);
+
+    /**
+     * @brief Format a snapshot as one CSV line (no newline)
+     * @return Characters written, as snprintf
+     */
+    static int formatCsv(const CaptureStatsSnapshot& snap, char* buf, size_t len);
+
+    /**
+     * @brief Column names matching formatCsv()
+     */
+    static int formatCsvHeader(char* buf, size_t len);
+
+private:
+    // Free-running totals
+    volatile uint32_t m_rx;
+    volatile uint32_t m_filtered;
+    volatile uint32_t m_enqueued;
+    volatile uint32_t m_dropped;
+    volatile uint32_t m_rxByChannel[WIFI_CHANNEL_MAX + 1];
+    uint32_t m_bytes;
+    uint32_t m_writes;
+    uint64_t m_writeUs;
+    uint32_t m_writeMaxUs;       // Reset each interval
+
+    // Totals at the start of the current interval
+    uint32_t m_intervalStartMs;
+    uint32_t m_lastRx;
+    uint32_t m_lastFiltered;
+    uint32_t m_lastEnqueued;
+    uint32_t m_lastDropped;
+    uint32_t m_lastRxByChannel[WIFI_CHANNEL_MAX + 1];
+    uint32_t m_lastBytes;
+    uint32_t m_lastWrites;
+    uint64_t m_lastWriteUs;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_CAPTURE_STATS_H
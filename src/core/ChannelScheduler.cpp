@@ -0,0 +1,134 @@
+/**
+ * @file ChannelScheduler.cpp
+ * @brief Weighted round-robin channel hopping
+ */
+
+#include "ChannelScheduler.h"
+
+namespace Vanguard {
+
+ChannelScheduler::ChannelScheduler()
+    : m_focus(SCHED_ALL_CHANNELS)
+    , m_pinned(0)
+{
+    reset(0);
+}
+
+void ChannelScheduler::reset(uint32_t now) {
+    for (uint8_t ch = 0; ch <= WIFI_CHANNEL_MAX; ch++) {
+        m_frames[ch] = 0;
+        m_rate[ch] = 0.0f;
+        m_targets[ch] = 0;
+    }
+    m_current = 0;           // First tick tunes immediately
+    m_dwellStartMs = now;
+    m_dwellMs = 0;
+}
+
+// =============================================================================
+// INPUTS
+// =============================================================================
+
+void ChannelScheduler::recordFrame(uint8_t channel) {
+    if (valid(channel)) m_frames[channel]++;
+}
+
+void ChannelScheduler::setTargetCount(uint8_t channel, uint8_t count) {
+    if (valid(channel)) m_targets[channel] = count;
+}
+
+void ChannelScheduler::pin(uint8_t channel) {
+    m_pinned = valid(channel) ? channel : 0;
+}
+
+void ChannelScheduler::setFocus(uint16_t mask) {
+    mask &= SCHED_BAND_CHANNELS;
+    m_focus = mask ? mask : SCHED_ALL_CHANNELS;
+}
+
+// =============================================================================
+// SCHEDULING
+// =============================================================================
+
+uint8_t ChannelScheduler::tick(uint32_t now) {
+    if (m_pinned) {
+        if (m_current != m_pinned) {
+            closeWindow(now);
+            enter(m_pinned, now);
+            m_dwellMs = SCHED_MAX_DWELL_MS;
+            return m_pinned;
+        }
+        // Keep measuring so the rates are fresh when unpinned
+        if (now - m_dwellStartMs >= m_dwellMs) {
+            closeWindow(now);
+            m_dwellStartMs = now;
+        }
+        return 0;
+    }
+
+    // Focus may have changed under us; leave an excluded channel right away
+    bool inFocus = m_current && (m_focus & (1u << m_current));
+    if (inFocus && now - m_dwellStartMs < m_dwellMs) return 0;
+
+    closeWindow(now);
+    uint8_t next = nextChannel();
+    enter(next, now);
+    m_dwellMs = dwellFor(next);
+    return next;
+}
+
+float ChannelScheduler::frameRate(uint8_t channel) const {
+    return valid(channel) ? m_rate[channel] : 0.0f;
+}
+
+uint32_t ChannelScheduler::dwellFor(uint8_t channel) const {
+    float best = 0.0f;
+    for (uint8_t ch = WIFI_CHANNEL_MIN; ch <= WIFI_CHANNEL_MAX; ch++) {
+        if (!(m_focus & (1u << ch))) continue;
+        float s = score(ch);
+        if (s > best) best = s;
+    }
+    if (best <= 0.0f) return SCHED_MIN_DWELL_MS;
+
+    float share = score(channel) / best;
+    return SCHED_MIN_DWELL_MS + (uint32_t)(share * (SCHED_MAX_DWELL_MS - SCHED_MIN_DWELL_MS));
+}
+
+// =============================================================================
+// PRIVATE
+// =============================================================================
+
+float ChannelScheduler::score(uint8_t channel) const {
+    if (!valid(channel)) return 0.0f;
+    return m_rate[channel] + SCHED_TARGET_WEIGHT * m_targets[channel];
+}
+
+uint8_t ChannelScheduler::nextChannel() const {
+    uint8_t ch = m_current;
+    for (uint8_t i = 0; i < WIFI_CHANNEL_MAX; i++) {
+        ch = (ch >= WIFI_CHANNEL_MAX) ? WIFI_CHANNEL_MIN : ch + 1;
+        if (m_focus & (1u << ch)) return ch;
+    }
+    return WIFI_CHANNEL_MIN;  // Unreachable: focus is never empty
+}
+
+void ChannelScheduler::closeWindow(uint32_t now) {
+    if (!valid(m_current)) return;
+
+    uint32_t elapsed = now - m_dwellStartMs;
+    if (elapsed == 0) return;
+
+    uint32_t frames = m_frames[m_current];
+    m_frames[m_current] = 0;
+
+    float sample = (float)frames * 1000.0f / (float)elapsed;
+    m_rate[m_current] += SCHED_RATE_ALPHA * (sample - m_rate[m_current]);
+}
+
+void ChannelScheduler::enter(uint8_t channel, uint32_t now) {
+    m_current = channel;
+    m_dwellStartMs = now;
+    m_frames[channel] = 0;  // Drop anything counted while tuned elsewhere
+}
+
+} // namespace Vanguard
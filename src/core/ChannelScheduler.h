@@ -0,0 +1,124 @@
+#ifndef VANGUARD_CHANNEL_SCHEDULER_H
+#define VANGUARD_CHANNEL_SCHEDULER_H
+
+/**
+ * @file ChannelScheduler.h
+ * @brief Adaptive channel hopping for monitor mode
+ *
+ * Visits every channel in the focus set once per sweep (so quiet
+ * channels are never starved) but stretches the dwell on channels that
+ * are busy: dwell scales with an EWMA of the observed frame rate plus
+ * the number of known APs on that channel. Pinning parks the radio on
+ * one channel until unpinned.
+ *
+ * Pure logic with an injected clock - BruceWiFi feeds it frames from
+ * the promiscuous callback and asks it when to retune; tests drive it
+ * with a simulated clock.
+ *
+ * @example
+ * ChannelScheduler hopper;
+ * hopper.reset(millis());
+ * // promiscuous callback:
+ * hopper.recordFrame(pkt->rx_ctrl.channel);
+ * // tick:
+ * uint8_t next = hopper.tick(millis());
+ * if (next) setChannel(next);
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr uint32_t SCHED_MIN_DWELL_MS     = 100;   // Quiet channel
+constexpr uint32_t SCHED_MAX_DWELL_MS     = 500;   // Busiest channel
+constexpr float    SCHED_RATE_ALPHA       = 0.3f;  // EWMA weight of newest sample
+constexpr float    SCHED_TARGET_WEIGHT    = 5.0f;  // Score per known AP (frames/s equivalent)
+constexpr uint16_t SCHED_BAND_CHANNELS    = 0x7FFE; // Bits 1..14: anything tunable
+constexpr uint16_t SCHED_ALL_CHANNELS     = 0x3FFE; // Bits 1..13: default regulatory domain
+
+// =============================================================================
+// ChannelScheduler Class
+// =============================================================================
+
+class ChannelScheduler {
+public:
+    ChannelScheduler();
+
+    /**
+     * @brief Forget statistics and restart the sweep
+     */
+    void reset(uint32_t now);
+
+    /**
+     * @brief Count a received frame (safe to call from the rx callback)
+     */
+    void recordFrame(uint8_t channel);
+
+    /**
+     * @brief Set how many known targets live on a channel
+     */
+    void setTargetCount(uint8_t channel, uint8_t count);
+
+    /**
+     * @brief Park on one channel (0 = resume hopping)
+     */
+    void pin(uint8_t channel);
+
+    /**
+     * @brief Restrict hopping to a set of channels
+     * @param mask Bit N = channel N; 0 restores SCHED_ALL_CHANNELS (14 only if set)
+     */
+    void setFocus(uint16_t mask);
+
+    /**
+     * @brief Advance the schedule
+     * @return Channel to tune to, or 0 if the radio should stay put
+     */
+    uint8_t tick(uint32_t now);
+
+    // -------------------------------------------------------------------------
+    // Queries
+    // -------------------------------------------------------------------------
+
+    uint8_t  current() const     { return m_current; }
+    uint8_t  pinned() const      { return m_pinned; }
+    uint16_t focus() const       { return m_focus; }
+
+    /**
+     * @brief Smoothed frames/s last measured on a channel
+     */
+    float frameRate(uint8_t channel) const;
+
+    /**
+     * @brief Dwell the scheduler would use for a channel right now
+     */
+    uint32_t dwellFor(uint8_t channel) const;
+
+private:
+    volatile uint32_t m_frames[WIFI_CHANNEL_MAX + 1];  // Written by rx callback
+    float             m_rate[WIFI_CHANNEL_MAX + 1];
+    uint8_t           m_targets[WIFI_CHANNEL_MAX + 1];
+
+    uint16_t m_focus;
+    uint8_t  m_pinned;
+    uint8_t  m_current;
+    uint32_t m_dwellStartMs;
+    uint32_t m_dwellMs;
+
+    static bool valid(uint8_t channel) {
+        return channel >= WIFI_CHANNEL_MIN && channel <= WIFI_CHANNEL_MAX;
+    }
+
+    float   score(uint8_t channel) const;
+    uint8_t nextChannel() const;
+    void    closeWindow(uint32_t now);
+    void    enter(uint8_t channel, uint32_t now);
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_CHANNEL_SCHEDULER_H
@@ -0,0 +1,156 @@
+/**
+ * @file FrameDispatcher.cpp
+ * @brief 802.11 header parsing and table-driven frame routing
+ */
+
+#include "FrameDispatcher.h"
+
+namespace Vanguard {
+
+static_assert(MAX_FRAME_CONSUMERS <= 16, "consumer bitmap is 16 bits wide");
+
+// 802.11 MAC header sizes
+constexpr uint16_t HDR_LEN_3ADDR  = 24;
+constexpr uint16_t HDR_LEN_QOS    = 2;
+constexpr uint16_t HDR_LEN_HTC    = 4;
+constexpr uint16_t HDR_LEN_ADDR4  = 6;
+constexpr uint16_t HDR_LEN_CTRL_1 = 10;  // FC + Duration + RA (CTS, ACK)
+constexpr uint16_t HDR_LEN_CTRL_2 = 16;  // + TA (RTS, PS-Poll, BA, CF-End)
+
+FrameDispatcher::FrameDispatcher()
+    : m_active(0)
+{
+    memset(m_table, 0, sizeof(m_table));
+}
+
+// =============================================================================
+// PARSING
+// =============================================================================
+
+bool FrameDispatcher::parse(const uint8_t* payload, uint16_t len,
+                            int8_t rssi, uint8_t channel, FrameView& out) {
+    if (!payload || len < HDR_LEN_CTRL_1) return false;
+
+    // Frame control is little-endian: byte 0 = version/type/subtype, byte 1 = flags
+    uint8_t fc0 = payload[0];
+    uint8_t fc1 = payload[1];
+
+    out.raw = payload;
+    out.len = len;
+    out.rssi = rssi;
+    out.channel = channel;
+    out.type = (fc0 >> 2) & 0x03;
+    out.subtype = (fc0 >> 4) & 0x0F;
+    out.dir = fc1 & 0x03;
+    out.isProtected = (fc1 & 0x40) != 0;
+    out.addr1 = payload + 4;
+    out.addr2 = nullptr;
+    out.addr3 = nullptr;
+    out.addr4 = nullptr;
+    out.body = nullptr;
+    out.bodyLen = 0;
+
+    bool order = (fc1 & 0x80) != 0;
+    uint16_t hdrLen;
+
+    if (out.type == WIFI_TYPE_CTRL) {
+        // Subtypes 8..11, 14, 15 carry a transmitter address
+        bool hasTa = (out.subtype >= 8 && out.subtype <= 11) || out.subtype >= 14;
+        hdrLen = hasTa ? HDR_LEN_CTRL_2 : HDR_LEN_CTRL_1;
+        if (len < hdrLen) return false;
+        if (hasTa) out.addr2 = payload + 10;
+        out.dir = FRAME_DIR_NO_DS;
+    } else if (out.type == WIFI_TYPE_MGMT || out.type == WIFI_TYPE_DATA) {
+        hdrLen = HDR_LEN_3ADDR;
+        if (out.dir == FRAME_DIR_WDS) hdrLen += HDR_LEN_ADDR4;
+
+        bool qos = (out.type == WIFI_TYPE_DATA) && (out.subtype & 0x08);
+        if (qos) hdrLen += HDR_LEN_QOS;
+
+        // +HTC is present on mgmt frames and QoS data frames with Order set
+        if (order && (out.type == WIFI_TYPE_MGMT || qos)) hdrLen += HDR_LEN_HTC;
+
+        if (len < hdrLen) return false;
+        out.addr2 = payload + 10;
+        out.addr3 = payload + 16;
+        if (out.dir == FRAME_DIR_WDS) out.addr4 = payload + 24;
+    } else {
+        return false;  // Type 3 is reserved (or extension frames we don't handle)
+    }
+
+    out.body = payload + hdrLen;
+    out.bodyLen = len - hdrLen;
+    return true;
+}
+
+// =============================================================================
+// SUBSCRIPTIONS
+// =============================================================================
+
+int FrameDispatcher::subscribe(const FrameMask& mask, FrameHandler handler) {
+    if (!handler) return -1;
+
+    int id = -1;
+    for (size_t i = 0; i < MAX_FRAME_CONSUMERS; i++) {
+        if (!(m_active & (1u << i))) {
+            id = (int)i;
+            break;
+        }
+    }
+    if (id < 0) return -1;
+
+    m_handlers[id] = handler;
+    m_active |= (uint16_t)(1u << id);
+
+    // Fold the mask into every matching table entry
+    uint16_t bit = (uint16_t)(1u << id);
+    for (uint8_t type = 0; type < 3; type++) {
+        if (!(mask.types & (1u << type))) continue;
+        for (uint8_t subtype = 0; subtype < 16; subtype++) {
+            if (!(mask.subtypes & (1u << subtype))) continue;
+            for (uint8_t dir = 0; dir < 4; dir++) {
+                if (!(mask.dirs & (1u << dir))) continue;
+                m_table[keyOf(type, subtype, dir)] |= bit;
+            }
+        }
+    }
+    return id;
+}
+
+void FrameDispatcher::unsubscribe(int id) {
+    if (id < 0 || id >= (int)MAX_FRAME_CONSUMERS) return;
+
+    uint16_t keep = (uint16_t)~(1u << id);
+    for (size_t i = 0; i < 256; i++) {
+        m_table[i] &= keep;
+    }
+    m_active &= keep;
+    m_handlers[id] = nullptr;
+}
+
+// =============================================================================
+// DISPATCH
+// =============================================================================
+
+size_t FrameDispatcher::dispatch(const FrameView& frame) const {
+    uint16_t consumers = m_table[keyOf(frame.type, frame.subtype, frame.dir)];
+    size_t invoked = 0;
+
+    while (consumers) {
+        int id = __builtin_ctz(consumers);
+        consumers &= (uint16_t)(consumers - 1);
+        m_handlers[id](frame);
+        invoked++;
+    }
+    return invoked;
+}
+
+uint16_t FrameDispatcher::consumersFor(uint8_t type, uint8_t subtype, uint8_t dir) const {
+    return m_table[keyOf(type, subtype, dir)];
+}
+
+size_t FrameDispatcher::count() const {
+    return (size_t)__builtin_popcount(m_active);
+}
+
+} // namespace Vanguard
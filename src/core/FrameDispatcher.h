@@ -0,0 +1,202 @@
+#ifndef VANGUARD_FRAME_DISPATCHER_H
+#define VANGUARD_FRAME_DISPATCHER_H
+
+/**
+ * @file FrameDispatcher.h
+ * @brief Mask-based routing of promiscuous 802.11 frames to analyzers
+ *
+ * The promiscuous callback parses each frame header exactly once into a
+ * FrameView, then hands it to every consumer whose (type, subtype,
+ * direction) mask matches. Subscriptions are folded into a 256-entry
+ * table at registration time, so dispatch is a single table lookup
+ * followed by a walk over the matching consumers only. Adding an
+ * analyzer for beacons costs nothing on data frames.
+ *
+ * @example
+ * FrameDispatcher frames;
+ * frames.subscribe(FrameMask::mgmt(WIFI_SUBTYPE_BEACON), [](const FrameView& f) {
+ *     // f.bssid(), f.body, f.bodyLen ...
+ * });
+ * FrameView view;
+ * if (FrameDispatcher::parse(payload, len, rssi, channel, view)) {
+ *     frames.dispatch(view);
+ * }
+ */
+
+#include "VanguardTypes.h"
+#include <functional>
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t  MAX_FRAME_CONSUMERS = 16;
+
+// Direction (ToDS/FromDS) encoding used in FrameView::dir
+constexpr uint8_t FRAME_DIR_NO_DS     = 0;   // ToDS=0 FromDS=0 (mgmt, IBSS)
+constexpr uint8_t FRAME_DIR_TO_DS     = 1;   // Station -> AP
+constexpr uint8_t FRAME_DIR_FROM_DS   = 2;   // AP -> Station
+constexpr uint8_t FRAME_DIR_WDS       = 3;   // 4-address bridge
+
+// Mask bits for FrameMask::types / FrameMask::dirs
+constexpr uint8_t  FRAME_TYPES_ANY    = 0x07;    // mgmt | ctrl | data
+constexpr uint16_t FRAME_SUBTYPES_ANY = 0xFFFF;
+constexpr uint8_t  FRAME_DIRS_ANY     = 0x0F;
+
+// =============================================================================
+// DATA STRUCTURES
+// =============================================================================
+
+/**
+ * @brief Parsed, zero-copy view of a received 802.11 frame
+ *
+ * All pointers alias the radio's receive buffer and are only valid for
+ * the duration of the handler call.
+ */
+struct FrameView {
+    const uint8_t* raw;        // Start of 802.11 header
+    uint16_t       len;        // Header + body (FCS excluded)
+    int8_t         rssi;
+    uint8_t        channel;
+
+    uint8_t        type;       // WIFI_TYPE_*
+    uint8_t        subtype;    // WIFI_SUBTYPE_*
+    uint8_t        dir;        // FRAME_DIR_*
+    bool           isProtected;
+
+    const uint8_t* addr1;      // Receiver
+    const uint8_t* addr2;      // Transmitter (nullptr for CTS/ACK)
+    const uint8_t* addr3;      // nullptr for control frames
+    const uint8_t* addr4;      // WDS only
+
+    const uint8_t* body;       // First byte after the MAC header
+    uint16_t       bodyLen;
+
+    /**
+     * @brief BSSID for this frame, or nullptr if it has none (WDS/control)
+     */
+    const uint8_t* bssid() const {
+        if (type == WIFI_TYPE_CTRL) return nullptr;
+        switch (dir) {
+            case FRAME_DIR_NO_DS:   return addr3;
+            case FRAME_DIR_TO_DS:   return addr1;
+            case FRAME_DIR_FROM_DS: return addr2;
+            default:                return nullptr;
+        }
+    }
+
+    /**
+     * @brief Non-AP station taking part in a data exchange, or nullptr
+     */
+    const uint8_t* station() const {
+        if (type != WIFI_TYPE_DATA) return nullptr;
+        switch (dir) {
+            case FRAME_DIR_NO_DS:   return addr2;
+            case FRAME_DIR_TO_DS:   return addr2;
+            case FRAME_DIR_FROM_DS: return addr1;
+            default:                return nullptr;
+        }
+    }
+};
+
+/**
+ * @brief Subscription filter: a frame matches if its type, subtype and
+ *        direction bits are all set in the mask
+ */
+struct FrameMask {
+    uint8_t  types;      // bit N = frame type N
+    uint16_t subtypes;   // bit N = subtype N
+    uint8_t  dirs;       // bit N = FRAME_DIR_* N
+
+    static FrameMask any() {
+        FrameMask m = { FRAME_TYPES_ANY, FRAME_SUBTYPES_ANY, FRAME_DIRS_ANY };
+        return m;
+    }
+
+    static FrameMask mgmt(uint8_t subtype) {
+        FrameMask m = { (uint8_t)(1 << WIFI_TYPE_MGMT), (uint16_t)(1 << subtype), FRAME_DIRS_ANY };
+        return m;
+    }
+
+    static FrameMask data(uint16_t subtypes = FRAME_SUBTYPES_ANY, uint8_t dirs = FRAME_DIRS_ANY) {
+        FrameMask m = { (uint8_t)(1 << WIFI_TYPE_DATA), subtypes, dirs };
+        return m;
+    }
+
+    FrameMask& withSubtype(uint8_t subtype) {
+        subtypes |= (uint16_t)(1 << subtype);
+        return *this;
+    }
+};
+
+/**
+ * @brief Frame consumer callback
+ */
+using FrameHandler = std::function<void(const FrameView& frame)>;
+
+// =============================================================================
+// FrameDispatcher Class
+// =============================================================================
+
+class FrameDispatcher {
+public:
+    FrameDispatcher();
+
+    // Prevent copying (handlers capture owner state)
+    FrameDispatcher(const FrameDispatcher&) = delete;
+    FrameDispatcher& operator=(const FrameDispatcher&) = delete;
+
+    /**
+     * @brief Parse the MAC header of a raw frame
+     * @param payload Start of the 802.11 header
+     * @param len Frame length without FCS
+     * @return false if the frame is too short to carry its header
+     */
+    static bool parse(const uint8_t* payload, uint16_t len,
+                      int8_t rssi, uint8_t channel, FrameView& out);
+
+    /**
+     * @brief Register a consumer
+     * @return Subscription id, or -1 if all slots are taken
+     *
+     * Not safe to call while frames are being dispatched; register
+     * consumers before enabling promiscuous mode.
+     */
+    int subscribe(const FrameMask& mask, FrameHandler handler);
+
+    /**
+     * @brief Remove a consumer by subscription id
+     */
+    void unsubscribe(int id);
+
+    /**
+     * @brief Deliver a frame to all matching consumers
+     * @return Number of consumers invoked
+     */
+    size_t dispatch(const FrameView& frame) const;
+
+    /**
+     * @brief Bitmap of subscription ids matching a header triple
+     */
+    uint16_t consumersFor(uint8_t type, uint8_t subtype, uint8_t dir) const;
+
+    /**
+     * @brief Number of active subscriptions
+     */
+    size_t count() const;
+
+private:
+    uint16_t     m_table[256];                    // key -> consumer bitmap
+    FrameHandler m_handlers[MAX_FRAME_CONSUMERS];
+    uint16_t     m_active;                        // Allocated slot bitmap
+
+    static uint8_t keyOf(uint8_t type, uint8_t subtype, uint8_t dir) {
+        return (uint8_t)(((type & 0x03) << 6) | ((subtype & 0x0F) << 2) | (dir & 0x03));
+    }
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_FRAME_DISPATCHER_H
@@ -6,6 +6,10 @@
 
 namespace Vanguard {
 
+// Queue depths between the UI core and the System Task
+constexpr size_t SYSTEM_REQUEST_QUEUE_LEN = 10;
+constexpr size_t SYSTEM_EVENT_QUEUE_LEN   = 20;   // Events can be bursty
+
 // =============================================================================
 // COMMANDS (UI -> System)
 // =============================================================================
@@ -14,18 +18,23 @@ enum class SysCommand : uint8_t {
     NONE,
     
     // WiFi Scanning
-    WIFI_SCAN_START,      // Payload: Scan config (optional)
+    WIFI_SCAN_START,      // Payload: uint8_t channel (0 = all channels)
     WIFI_SCAN_STOP,
+    WIFI_PASSIVE_START,   // Payload: uint8_t channel (0 = hop)
+    WIFI_PASSIVE_STOP,
     
     // BLE Scanning
     BLE_SCAN_START,       // Payload: uint32_t duration_ms
+    BLE_SCAN_RESUME,      // Payload: uint32_t duration_ms; keeps devices and dedup state
     BLE_SCAN_STOP,
+    BLE_SET_PROFILE,      // Payload: uint8_t BLEScanProfileId
     
     // Attacks / Actions
     ACTION_START,         // Payload: ActionRequest*
     ACTION_STOP,
     
     // System
+    RADIO_COEX_START,     // Bring up WiFi + BLE together for a combined scan
     SYSTEM_SHUTDOWN
 };
 
@@ -36,11 +45,11 @@ struct ActionRequest {
 };
 
 struct SystemRequest {
-    SysCommand cmd;
-    void* payload;       // Command specific data (must be heap allocated or static)
+    SysCommand cmd = SysCommand::NONE;
+    void* payload = nullptr;  // Command specific data (must be heap allocated or static)
     
     // Helper to free payload if needed
-    void (*freeCb)(void*); 
+    void (*freeCb)(void*) = nullptr;
 };
 
 
@@ -53,26 +62,38 @@ enum class SysEventType : uint8_t {
     
     // WiFi Status
     WIFI_SCAN_STARTED,
-    WIFI_SCAN_COMPLETE,   // Payload: int count
+    WIFI_SCAN_COMPLETE,   // Payload: ScanCompleteEvent*
     ASSOCIATION_FOUND,    // Payload: AssociationEvent*
+    AP_OBSERVED,          // Payload: BeaconInfo* (passive discovery)
+    PROBE_OBSERVED,       // Payload: ProbeInfo* (directed probe request)
 
     
     // BLE Status
     BLE_SCAN_STARTED,
     BLE_SCAN_COMPLETE,    // Payload: int count
     BLE_DEVICE_FOUND,     // Payload: BLEDeviceInfo* (copy)
+    BLE_BEACON_SEEN,      // Payload: BLEBeaconInfo* (copy)
+    BLE_TRACKER_ALERT,    // Payload: TrackerAlert* (copy)
     
     // Action Status
     ACTION_PROGRESS,      // Payload: ActionProgress*
     ACTION_COMPLETE,      // Payload: ActionResult
+    CAPTURE_STATS,        // Payload: CaptureStatsSnapshot* (1 Hz while logging)
     
     // Errors
     ERROR_OCCURRED        // Payload: char* message
 };
 
+struct ScanCompleteEvent {
+    int     count;
+    uint8_t channel;        // As requested by WIFI_SCAN_START (0 = all)
+};
+
 struct AssociationEvent {
     uint8_t bssid[6];
     uint8_t station[6];
+    int8_t  rssi;           // Station's own signal, 0 if the AP transmitted
+    uint8_t channel;
 };
 
 struct SystemEvent {
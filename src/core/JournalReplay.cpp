@@ -0,0 +1,83 @@
+/**
+ * @file JournalReplay.cpp
+ * @brief Session journal replay into a TargetTable
+ */
+
+#include "JournalReplay.h"
+#include <cstring>
+
+namespace Vanguard {
+
+JournalReplay::JournalReplay(TargetTable& table)
+    : m_table(table)
+    , m_hook(nullptr)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+bool JournalReplay::run(const uint8_t* data, size_t length) {
+    JournalReader reader(data, length);
+    if (!reader.valid()) return false;
+
+    JournalRecord record;
+    while (reader.next(record)) {
+        apply(record);
+    }
+    return true;
+}
+
+void JournalReplay::apply(const JournalRecord& record) {
+    if (m_stats.records == 0) m_stats.firstMs = record.timestampMs;
+    m_stats.records++;
+    m_stats.lastMs = record.timestampMs;
+
+    bool ok = true;
+    switch (record.event) {
+        case JournalEvent::TARGET_ADDED:
+        case JournalEvent::TARGET_UPDATED:
+        {
+            Target target;
+            ok = SessionJournal::decodeTarget(record.payload, record.length, target);
+            if (ok) {
+                target.firstSeenMs = record.timestampMs;
+                target.lastSeenMs = record.timestampMs;
+                target.beaconCount = 1;
+                m_table.addOrUpdate(target);
+                m_stats.applied++;
+            }
+            break;
+        }
+
+        case JournalEvent::TARGET_REMOVED:
+            ok = (record.length >= 6);
+            if (ok && m_table.remove(record.payload)) m_stats.applied++;
+            break;
+
+        case JournalEvent::ASSOCIATION:
+            ok = (record.length >= 12);
+            if (ok && m_table.addAssociation(record.payload, record.payload + 6, 0, 0,
+                                             record.timestampMs)) {
+                m_stats.applied++;
+            }
+            break;
+
+        case JournalEvent::TABLE_CLEARED:
+            m_table.clear();
+            m_stats.applied++;
+            break;
+
+        case JournalEvent::SCAN_PHASE:
+        case JournalEvent::ACTION_START:
+        case JournalEvent::ACTION_STOP:
+            break;   // Hook only
+
+        default:
+            ok = false;
+            break;
+    }
+
+    if (!ok) m_stats.malformed++;
+    if (m_hook) m_hook(record);
+}
+
+} // namespace Vanguard
@@ -0,0 +1,76 @@
+#ifndef VANGUARD_JOURNAL_REPLAY_H
+#define VANGUARD_JOURNAL_REPLAY_H
+
+/**
+ * @file JournalReplay.h
+ * @brief Feeds a session journal back into a TargetTable
+ *
+ * Replays as fast as the table can take it: record timestamps become the
+ * targets' seen times, so ageing and pruning behave as they did live, but
+ * no wall-clock time passes. A session captured on the device becomes a
+ * repeatable workload for host tests and benchmarks.
+ *
+ * Scan phases and actions don't touch the table; pass a hook to see them.
+ *
+ * @example
+ * TargetTable table;
+ * JournalReplay replay(table);
+ * replay.run(image, imageLen);
+ * printf("%u records, %u targets\n", replay.stats().records, (unsigned)table.count());
+ */
+
+#include "VanguardTypes.h"
+#include "SessionJournal.h"
+#include "TargetTable.h"
+#include <functional>
+
+namespace Vanguard {
+
+/**
+ * @brief Called for every record, after it has been applied
+ */
+using JournalRecordHook = std::function<void(const JournalRecord&)>;
+
+/**
+ * @brief What a replay went through
+ */
+struct ReplayStats {
+    uint32_t records;       // Records read
+    uint32_t applied;       // Records that changed the table
+    uint32_t malformed;     // Bad payloads or unknown events (skipped)
+    uint32_t firstMs;       // Timestamp of the first record
+    uint32_t lastMs;        // Timestamp of the last record
+};
+
+// =============================================================================
+// JournalReplay Class
+// =============================================================================
+
+class JournalReplay {
+public:
+    explicit JournalReplay(TargetTable& table);
+
+    void onRecord(JournalRecordHook hook) { m_hook = hook; }
+
+    /**
+     * @brief Apply a whole journal image
+     * @return false if the image isn't a journal
+     */
+    bool run(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Apply a single record
+     */
+    void apply(const JournalRecord& record);
+
+    const ReplayStats& stats() const { return m_stats; }
+
+private:
+    TargetTable&      m_table;
+    JournalRecordHook m_hook;
+    ReplayStats       m_stats;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_JOURNAL_REPLAY_H
@@ -0,0 +1,23 @@
+/**
+ * @file MacIndex.cpp
+ * @brief Hashing and the backward-shift test for MacIndex
+ */
+
+#include "MacIndex.h"
+
+namespace Vanguard {
+
+uint32_t hashMac(const uint8_t* mac) {
+    uint32_t hi = ((uint32_t)mac[0] << 8) | mac[1];
+    uint32_t lo = ((uint32_t)mac[2] << 24) | ((uint32_t)mac[3] << 16) |
+                  ((uint32_t)mac[4] << 8) | mac[5];
+    uint32_t h = (lo ^ (hi * 0x85EBCA6Bu)) * 0x9E3779B1u;
+    return h ^ (h >> 16);
+}
+
+bool canBackShift(size_t hole, size_t from, size_t home) {
+    if (from > hole) return home <= hole || home > from;
+    return home <= hole && home > from;
+}
+
+} // namespace Vanguard
@@ -0,0 +1,200 @@
+#ifndef VANGUARD_MAC_INDEX_H
+#define VANGUARD_MAC_INDEX_H
+
+/**
+ * @file MacIndex.h
+ * @brief Open-addressing index from a key to an entry number
+ *
+ * The lookup structure shared by the packed tables (StationTable,
+ * ProbeTable, AssociationGraph, BLERegistry, SsidPool). Entries live in
+ * the owner's own array; the index only maps a key to its position:
+ *   - slots hold entry + 1, 0 = empty
+ *   - linear probing from the key's home slot, load kept <= 0.5
+ *   - backward-shift deletion, so probe chains never need tombstones
+ *
+ * The index never reads entries itself. Lookups take a predicate on an
+ * entry number, and deletion a function giving an entry's home slot, so
+ * a key can be a MAC (home() hashes it) or anything pre-hashed (slot()).
+ * Deleting and repointing go by entry number, not by key compare.
+ *
+ * MacIndex<N> keeps N slots inline, allocation-free; MacIndex<> is sized
+ * once with resize() for tables whose capacity is set at runtime.
+ *
+ * @example
+ * MacIndex<512> index;
+ * index.insert(entry, stations[entry].mac);
+ * int found = index.find(mac, [&](size_t e) { return stations[e].mac; });
+ * index.erase(found, [&](size_t e) { return stations[e].mac; });
+ */
+
+#include "VanguardTypes.h"
+#include <cstring>
+#include <vector>
+
+namespace Vanguard {
+
+// =============================================================================
+// HASHING
+// =============================================================================
+
+/**
+ * @brief Mix all six bytes (OUIs repeat, so the low bytes alone cluster)
+ */
+uint32_t hashMac(const uint8_t* mac);
+
+/**
+ * @brief Backward-shift test: may the entry at `from`, whose home slot is
+ *        `home`, move back into the hole at `hole`? (cyclic)
+ */
+bool canBackShift(size_t hole, size_t from, size_t home);
+
+// =============================================================================
+// SLOT STORAGE
+// =============================================================================
+
+template <size_t SLOTS>
+class MacIndexSlots {
+    static_assert(SLOTS >= 2 && (SLOTS & (SLOTS - 1)) == 0, "index size must be a power of two");
+
+public:
+    size_t slots() const { return SLOTS; }
+
+protected:
+    uint16_t m_slots[SLOTS];
+
+    size_t mask() const { return SLOTS - 1; }
+};
+
+template <>
+class MacIndexSlots<0> {
+public:
+    MacIndexSlots() : m_mask(0) {}
+
+    /**
+     * @brief Size the index, dropping its contents
+     * @param minSlots Rounded up to a power of two (at least 16)
+     */
+    void resize(size_t minSlots) {
+        size_t n = 16;
+        while (n < minSlots) n <<= 1;
+        m_slots.assign(n, 0);
+        m_mask = n - 1;
+    }
+
+    size_t slots() const { return m_slots.size(); }
+
+protected:
+    std::vector<uint16_t> m_slots;
+    size_t                m_mask;
+
+    size_t mask() const { return m_mask; }
+};
+
+// =============================================================================
+// MacIndex Class
+// =============================================================================
+
+template <size_t SLOTS = 0>
+class MacIndex : public MacIndexSlots<SLOTS> {
+public:
+    MacIndex() { clear(); }
+
+    void clear() {
+        if (this->slots()) memset(&this->m_slots[0], 0, this->slots() * sizeof(uint16_t));
+    }
+
+    // -------------------------------------------------------------------------
+    // Home slots
+    // -------------------------------------------------------------------------
+
+    size_t home(const uint8_t* mac) const { return hashMac(mac) & this->mask(); }
+    size_t slot(uint32_t hash) const      { return hash & this->mask(); }
+
+    // -------------------------------------------------------------------------
+    // By home slot (any key)
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief First entry on the probe chain from `home` that matches
+     * @param match bool(size_t entry)
+     * @return Entry number, -1 if none
+     */
+    template <typename Match>
+    int find(size_t home, Match match) const {
+        for (size_t i = home; this->m_slots[i] != 0; i = next(i)) {
+            size_t entry = this->m_slots[i] - 1;
+            if (match(entry)) return (int)entry;
+        }
+        return -1;
+    }
+
+    void insert(size_t home, size_t entry) {
+        size_t i = home;
+        while (this->m_slots[i] != 0) i = next(i);
+        this->m_slots[i] = (uint16_t)(entry + 1);
+    }
+
+    /**
+     * @brief Remove an entry, shifting later chain members back
+     * @param homeOf size_t(size_t entry), the home slot of any entry
+     */
+    template <typename HomeOf>
+    void erase(size_t home, size_t entry, HomeOf homeOf) {
+        size_t hole = locate(home, entry);
+        if (this->m_slots[hole] == 0) return;
+
+        size_t j = hole;
+        while (true) {
+            j = next(j);
+            if (this->m_slots[j] == 0) break;
+            if (canBackShift(hole, j, homeOf((size_t)this->m_slots[j] - 1))) {
+                this->m_slots[hole] = this->m_slots[j];
+                hole = j;
+            }
+        }
+        this->m_slots[hole] = 0;
+    }
+
+    /**
+     * @brief An entry moved from `from` to `to` (swap-remove)
+     */
+    void repoint(size_t home, size_t from, size_t to) {
+        size_t i = locate(home, from);
+        if (this->m_slots[i] != 0) this->m_slots[i] = (uint16_t)(to + 1);
+    }
+
+    // -------------------------------------------------------------------------
+    // By MAC
+    // -------------------------------------------------------------------------
+
+    /**
+     * @param macOf const uint8_t*(size_t entry), the key stored in an entry
+     */
+    template <typename MacOf>
+    int find(const uint8_t* mac, MacOf macOf) const {
+        return find(home(mac), [&](size_t e) { return memcmp(macOf(e), mac, 6) == 0; });
+    }
+
+    void insert(size_t entry, const uint8_t* mac) { insert(home(mac), entry); }
+
+    template <typename MacOf>
+    void erase(size_t entry, MacOf macOf) {
+        erase(home(macOf(entry)), entry, [&](size_t e) { return home(macOf(e)); });
+    }
+
+    void repoint(const uint8_t* mac, size_t from, size_t to) { repoint(home(mac), from, to); }
+
+private:
+    size_t next(size_t i) const { return (i + 1) & this->mask(); }
+
+    // Slot holding `entry`, or the empty slot ending its chain
+    size_t locate(size_t home, size_t entry) const {
+        size_t i = home;
+        while (this->m_slots[i] != 0 && this->m_slots[i] != entry + 1) i = next(i);
+        return i;
+    }
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_MAC_INDEX_H
@@ -0,0 +1,149 @@
+/**
+ * @file OuiData.cpp
+ * @brief Generated OUI vendor table - do not edit
+ *
+ * Source: oui_seed.csv
+ * Regenerate with: python tools/gen_oui.py --input <oui.csv>
+ *
+ * 191 OUIs, 29 vendors, 1387 bytes of flash
+ */
+
+#include "OuiLookup.h"
+
+namespace Vanguard {
+
+extern const size_t OUI_COUNT = 191;
+extern const size_t OUI_POOL_BYTES = 241;
+
+// OUI (3, big-endian) | pool offset (3, big-endian), sorted by OUI
+extern const uint8_t OUI_TABLE[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x42, 0x00, 0x00, 0x06,
+    0x00, 0x03, 0x7F, 0x00, 0x00, 0x14, 0x00, 0x03, 0x93, 0x00, 0x00, 0x1C,
+    0x00, 0x03, 0xFF, 0x00, 0x00, 0x22, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x2C,
+    0x00, 0x05, 0x5D, 0x00, 0x00, 0x30, 0x00, 0x05, 0x69, 0x00, 0x00, 0x37,
+    0x00, 0x06, 0x5B, 0x00, 0x00, 0x3E, 0x00, 0x08, 0x74, 0x00, 0x00, 0x3E,
+    0x00, 0x09, 0x5B, 0x00, 0x00, 0x43, 0x00, 0x09, 0xBF, 0x00, 0x00, 0x4B,
+    0x00, 0x0A, 0x95, 0x00, 0x00, 0x1C, 0x00, 0x0B, 0x86, 0x00, 0x00, 0x54,
+    0x00, 0x0B, 0xDB, 0x00, 0x00, 0x3E, 0x00, 0x0C, 0x29, 0x00, 0x00, 0x37,
+    0x00, 0x0C, 0x42, 0x00, 0x00, 0x5A, 0x00, 0x0C, 0x6E, 0x00, 0x00, 0x6A,
+    0x00, 0x0D, 0x3A, 0x00, 0x00, 0x22, 0x00, 0x0D, 0x56, 0x00, 0x00, 0x3E,
+    0x00, 0x0D, 0x88, 0x00, 0x00, 0x30, 0x00, 0x0E, 0x58, 0x00, 0x00, 0x72,
+    0x00, 0x0F, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x0F, 0x3D, 0x00, 0x00, 0x30,
+    0x00, 0x0F, 0xB5, 0x00, 0x00, 0x43, 0x00, 0x10, 0x18, 0x00, 0x00, 0x78,
+    0x00, 0x11, 0x2F, 0x00, 0x00, 0x6A, 0x00, 0x11, 0x43, 0x00, 0x00, 0x3E,
+    0x00, 0x11, 0x95, 0x00, 0x00, 0x30, 0x00, 0x12, 0x3F, 0x00, 0x00, 0x3E,
+    0x00, 0x12, 0x4B, 0x00, 0x00, 0x81, 0x00, 0x12, 0x5A, 0x00, 0x00, 0x22,
+    0x00, 0x12, 0xFB, 0x00, 0x00, 0x0C, 0x00, 0x13, 0x46, 0x00, 0x00, 0x30,
+    0x00, 0x13, 0x72, 0x00, 0x00, 0x3E, 0x00, 0x14, 0x22, 0x00, 0x00, 0x3E,
+    0x00, 0x14, 0x6C, 0x00, 0x00, 0x43, 0x00, 0x15, 0x5D, 0x00, 0x00, 0x22,
+    0x00, 0x15, 0x6D, 0x00, 0x00, 0x93, 0x00, 0x15, 0x99, 0x00, 0x00, 0x0C,
+    0x00, 0x15, 0xC5, 0x00, 0x00, 0x3E, 0x00, 0x15, 0xE9, 0x00, 0x00, 0x30,
+    0x00, 0x15, 0xF2, 0x00, 0x00, 0x6A, 0x00, 0x16, 0x32, 0x00, 0x00, 0x0C,
+    0x00, 0x16, 0x56, 0x00, 0x00, 0x4B, 0x00, 0x17, 0x31, 0x00, 0x00, 0x6A,
+    0x00, 0x17, 0x9A, 0x00, 0x00, 0x30, 0x00, 0x17, 0xAB, 0x00, 0x00, 0x4B,
+    0x00, 0x17, 0xF2, 0x00, 0x00, 0x1C, 0x00, 0x17, 0xFA, 0x00, 0x00, 0x22,
+    0x00, 0x18, 0x39, 0x00, 0x00, 0x9C, 0x00, 0x18, 0x82, 0x00, 0x00, 0xAA,
+    0x00, 0x19, 0x1D, 0x00, 0x00, 0x4B, 0x00, 0x19, 0x5B, 0x00, 0x00, 0x30,
+    0x00, 0x1A, 0x1E, 0x00, 0x00, 0x54, 0x00, 0x1A, 0x70, 0x00, 0x00, 0x9C,
+    0x00, 0x1A, 0x92, 0x00, 0x00, 0x6A, 0x00, 0x1A, 0xE9, 0x00, 0x00, 0x4B,
+    0x00, 0x1B, 0x11, 0x00, 0x00, 0x30, 0x00, 0x1B, 0x21, 0x00, 0x00, 0xB1,
+    0x00, 0x1B, 0x2F, 0x00, 0x00, 0x43, 0x00, 0x1B, 0x54, 0x00, 0x00, 0x06,
+    0x00, 0x1B, 0x63, 0x00, 0x00, 0x1C, 0x00, 0x1B, 0x7A, 0x00, 0x00, 0x4B,
+    0x00, 0x1B, 0xEA, 0x00, 0x00, 0x4B, 0x00, 0x1C, 0x4A, 0x00, 0x00, 0x2C,
+    0x00, 0x1C, 0xBE, 0x00, 0x00, 0x4B, 0x00, 0x1C, 0xF0, 0x00, 0x00, 0x30,
+    0x00, 0x1D, 0x60, 0x00, 0x00, 0x6A, 0x00, 0x1D, 0xBC, 0x00, 0x00, 0x4B,
+    0x00, 0x1E, 0x10, 0x00, 0x00, 0xAA, 0x00, 0x1E, 0x2A, 0x00, 0x00, 0x43,
+    0x00, 0x1E, 0x35, 0x00, 0x00, 0x4B, 0x00, 0x1E, 0x58, 0x00, 0x00, 0x30,
+    0x00, 0x1E, 0x64, 0x00, 0x00, 0xB1, 0x00, 0x1E, 0x8C, 0x00, 0x00, 0x6A,
+    0x00, 0x1E, 0xC2, 0x00, 0x00, 0x1C, 0x00, 0x1F, 0x32, 0x00, 0x00, 0x4B,
+    0x00, 0x1F, 0xC5, 0x00, 0x00, 0x4B, 0x00, 0x21, 0x47, 0x00, 0x00, 0x4B,
+    0x00, 0x21, 0x6A, 0x00, 0x00, 0xB1, 0x00, 0x21, 0x91, 0x00, 0x00, 0x30,
+    0x00, 0x21, 0xBD, 0x00, 0x00, 0x4B, 0x00, 0x22, 0x15, 0x00, 0x00, 0x6A,
+    0x00, 0x22, 0x3F, 0x00, 0x00, 0x43, 0x00, 0x22, 0x4C, 0x00, 0x00, 0x4B,
+    0x00, 0x22, 0xAA, 0x00, 0x00, 0x4B, 0x00, 0x22, 0xB0, 0x00, 0x00, 0x30,
+    0x00, 0x22, 0xD7, 0x00, 0x00, 0x4B, 0x00, 0x23, 0x31, 0x00, 0x00, 0x4B,
+    0x00, 0x23, 0x54, 0x00, 0x00, 0x6A, 0x00, 0x23, 0xCC, 0x00, 0x00, 0x4B,
+    0x00, 0x24, 0x01, 0x00, 0x00, 0x30, 0x00, 0x24, 0x1E, 0x00, 0x00, 0x4B,
+    0x00, 0x24, 0x44, 0x00, 0x00, 0x4B, 0x00, 0x24, 0x6C, 0x00, 0x00, 0x54,
+    0x00, 0x24, 0x8C, 0x00, 0x00, 0x6A, 0x00, 0x24, 0xB2, 0x00, 0x00, 0x43,
+    0x00, 0x24, 0xF3, 0x00, 0x00, 0x4B, 0x00, 0x24, 0xFE, 0x00, 0x00, 0x2C,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x25, 0xA0, 0x00, 0x00, 0x4B,
+    0x00, 0x26, 0x18, 0x00, 0x00, 0x6A, 0x00, 0x26, 0x59, 0x00, 0x00, 0x4B,
+    0x00, 0x26, 0x5A, 0x00, 0x00, 0x30, 0x00, 0x26, 0xBB, 0x00, 0x00, 0x1C,
+    0x00, 0x27, 0x19, 0x00, 0x00, 0xB7, 0x00, 0x27, 0x22, 0x00, 0x00, 0x93,
+    0x00, 0x50, 0x56, 0x00, 0x00, 0x37, 0x00, 0x50, 0xF2, 0x00, 0x00, 0x22,
+    0x00, 0xE0, 0x4C, 0x00, 0x00, 0xBF, 0x00, 0xE0, 0xFC, 0x00, 0x00, 0xAA,
+    0x04, 0x18, 0xD6, 0x00, 0x00, 0x93, 0x14, 0xCC, 0x20, 0x00, 0x00, 0xB7,
+    0x18, 0xFE, 0x34, 0x00, 0x00, 0xC7, 0x20, 0x4E, 0x7F, 0x00, 0x00, 0x43,
+    0x24, 0x0A, 0xC4, 0x00, 0x00, 0xC7, 0x24, 0x65, 0x11, 0x00, 0x00, 0x2C,
+    0x24, 0x6F, 0x28, 0x00, 0x00, 0xC7, 0x24, 0xA4, 0x3C, 0x00, 0x00, 0x93,
+    0x28, 0x18, 0x78, 0x00, 0x00, 0x22, 0x28, 0xCD, 0xC1, 0x00, 0x00, 0xD1,
+    0x28, 0xCF, 0xE9, 0x00, 0x00, 0x1C, 0x30, 0xAE, 0xA4, 0x00, 0x00, 0xC7,
+    0x34, 0xB1, 0xF7, 0x00, 0x00, 0x81, 0x38, 0x10, 0xD5, 0x00, 0x00, 0x2C,
+    0x3C, 0x07, 0x54, 0x00, 0x00, 0x1C, 0x3C, 0x5A, 0xB4, 0x00, 0x00, 0xDE,
+    0x3C, 0x71, 0xBF, 0x00, 0x00, 0xC7, 0x3C, 0xA6, 0x2F, 0x00, 0x00, 0x2C,
+    0x3C, 0xA9, 0xF4, 0x00, 0x00, 0xB1, 0x44, 0x65, 0x0D, 0x00, 0x00, 0xE5,
+    0x44, 0xD9, 0xE7, 0x00, 0x00, 0x93, 0x4C, 0x5E, 0x0C, 0x00, 0x00, 0x5A,
+    0x50, 0xC7, 0xBF, 0x00, 0x00, 0xB7, 0x54, 0x60, 0x09, 0x00, 0x00, 0xDE,
+    0x5C, 0x0A, 0x5B, 0x00, 0x00, 0x0C, 0x5C, 0x49, 0x79, 0x00, 0x00, 0x2C,
+    0x5C, 0xAA, 0xFD, 0x00, 0x00, 0x72, 0x5C, 0xCF, 0x7F, 0x00, 0x00, 0xC7,
+    0x60, 0x01, 0x94, 0x00, 0x00, 0xC7, 0x64, 0x70, 0x02, 0x00, 0x00, 0xB7,
+    0x64, 0xD1, 0x54, 0x00, 0x00, 0x5A, 0x68, 0x72, 0x51, 0x00, 0x00, 0x93,
+    0x6C, 0x3B, 0x6B, 0x00, 0x00, 0x5A, 0x74, 0xC2, 0x46, 0x00, 0x00, 0xE5,
+    0x78, 0x28, 0xCA, 0x00, 0x00, 0x72, 0x78, 0x8A, 0x20, 0x00, 0x00, 0x93,
+    0x7C, 0x9E, 0xBD, 0x00, 0x00, 0xC7, 0x7C, 0xFF, 0x4D, 0x00, 0x00, 0x2C,
+    0x80, 0x2A, 0xA8, 0x00, 0x00, 0x93, 0x84, 0xCC, 0xA8, 0x00, 0x00, 0xC7,
+    0x84, 0xF3, 0xEB, 0x00, 0x00, 0xC7, 0x8C, 0xAA, 0xB5, 0x00, 0x00, 0xC7,
+    0x94, 0x9F, 0x3E, 0x00, 0x00, 0x72, 0x9C, 0xC7, 0xA6, 0x00, 0x00, 0x2C,
+    0xA0, 0x40, 0xA0, 0x00, 0x00, 0x43, 0xA4, 0xCF, 0x12, 0x00, 0x00, 0xC7,
+    0xAC, 0xBC, 0x32, 0x00, 0x00, 0x1C, 0xB0, 0xA7, 0x37, 0x00, 0x00, 0xEC,
+    0xB8, 0x27, 0xEB, 0x00, 0x00, 0xD1, 0xB8, 0x69, 0xF4, 0x00, 0x00, 0x5A,
+    0xB8, 0xE9, 0x37, 0x00, 0x00, 0x72, 0xBC, 0x05, 0x43, 0x00, 0x00, 0x2C,
+    0xC0, 0x25, 0x06, 0x00, 0x00, 0x2C, 0xC0, 0x4A, 0x00, 0x00, 0x00, 0xB7,
+    0xC8, 0x0E, 0x14, 0x00, 0x00, 0x2C, 0xC8, 0x2B, 0x96, 0x00, 0x00, 0xC7,
+    0xCC, 0x2D, 0xE0, 0x00, 0x00, 0x5A, 0xCC, 0x6D, 0xA0, 0x00, 0x00, 0xEC,
+    0xD0, 0x23, 0xDB, 0x00, 0x00, 0x1C, 0xD4, 0xCA, 0x6D, 0x00, 0x00, 0x5A,
+    0xD8, 0x3A, 0xDD, 0x00, 0x00, 0xD1, 0xDC, 0x3A, 0x5E, 0x00, 0x00, 0xEC,
+    0xDC, 0x4F, 0x22, 0x00, 0x00, 0xC7, 0xDC, 0x9F, 0xDB, 0x00, 0x00, 0x93,
+    0xDC, 0xA6, 0x32, 0x00, 0x00, 0xD1, 0xE0, 0x28, 0x6D, 0x00, 0x00, 0x2C,
+    0xE4, 0x5F, 0x01, 0x00, 0x00, 0xD1, 0xE4, 0x8D, 0x8C, 0x00, 0x00, 0x5A,
+    0xEC, 0x08, 0x6B, 0x00, 0x00, 0xB7, 0xEC, 0xFA, 0xBC, 0x00, 0x00, 0xC7,
+    0xF0, 0x18, 0x98, 0x00, 0x00, 0x1C, 0xF0, 0x27, 0x2D, 0x00, 0x00, 0xE5,
+    0xF0, 0x9F, 0xC2, 0x00, 0x00, 0x93, 0xF4, 0xF2, 0x6D, 0x00, 0x00, 0xB7,
+    0xF4, 0xF5, 0xD8, 0x00, 0x00, 0xDE, 0xF4, 0xF5, 0xE8, 0x00, 0x00, 0xDE,
+    0xFC, 0xEC, 0xDA, 0x00, 0x00, 0x93,
+};
+
+extern const char OUI_POOL[] =
+    "Xerox\0"
+    "Cisco\0"
+    "Samsung\0"
+    "Atheros\0"
+    "Apple\0"
+    "Microsoft\0"
+    "AVM\0"
+    "D-Link\0"
+    "VMware\0"
+    "Dell\0"
+    "Netgear\0"
+    "Nintendo\0"
+    "Aruba\0"
+    "Routerboard.com\0"
+    "ASUSTek\0"
+    "Sonos\0"
+    "Broadcom\0"
+    "Texas Instruments\0"
+    "Ubiquiti\0"
+    "Cisco-Linksys\0"
+    "Huawei\0"
+    "Intel\0"
+    "TP-LINK\0"
+    "Realtek\0"
+    "Espressif\0"
+    "Raspberry Pi\0"
+    "Google\0"
+    "Amazon\0"
+    "Roku\0";
+
+} // namespace Vanguard
@@ -0,0 +1,69 @@
+/**
+ * @file OuiLookup.cpp
+ * @brief Binary search over the generated OUI table
+ */
+
+#include "OuiLookup.h"
+
+namespace Vanguard {
+
+static inline uint32_t get24(const uint8_t* p) {
+    return ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+}
+
+const char* OuiLookup::vendor(const uint8_t* mac) {
+    if (!mac) return nullptr;
+    if (mac[0] & 0x01) return nullptr;   // Group address
+    if (isLocal(mac)) return nullptr;
+    if (get24(mac) == 0 && get24(mac + 3) == 0) return nullptr;   // Placeholder (IR, virtual targets)
+    return find(OUI_TABLE, OUI_COUNT, OUI_POOL, get24(mac));
+}
+
+const char* OuiLookup::vendor(const Target& target) {
+    switch (target.type) {
+        case TargetType::BLE_DEVICE:
+        {
+            if (target.isRandomAddress) return nullptr;
+            uint8_t mac[6];
+            for (size_t i = 0; i < 6; i++) mac[i] = target.bssid[5 - i];
+            return vendor(mac);
+        }
+        case TargetType::BLE_BEACON:
+        case TargetType::RF_DEVICE:
+        case TargetType::IR_DEVICE:
+            return nullptr;
+        default:
+            return vendor(target.bssid);
+    }
+}
+
+bool OuiLookup::isRandomized(const Target& target) {
+    switch (target.type) {
+        case TargetType::BLE_DEVICE:
+            return target.isRandomAddress;
+        case TargetType::BLE_BEACON:
+        case TargetType::RF_DEVICE:
+        case TargetType::IR_DEVICE:
+            return false;
+        default:
+            return isLocal(target.bssid);
+    }
+}
+
+const char* OuiLookup::find(const uint8_t* table, size_t count, const char* pool, uint32_t oui) {
+    size_t lo = 0;
+    size_t hi = count;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const uint8_t* rec = table + mid * OUI_RECORD_BYTES;
+        uint32_t key = get24(rec);
+
+        if (key == oui) return pool + get24(rec + 3);
+        if (key < oui) lo = mid + 1;
+        else hi = mid;
+    }
+    return nullptr;
+}
+
+} // namespace Vanguard
@@ -0,0 +1,93 @@
+#ifndef VANGUARD_OUI_LOOKUP_H
+#define VANGUARD_OUI_LOOKUP_H
+
+/**
+ * @file OuiLookup.h
+ * @brief MAC prefix (OUI) to vendor name
+ *
+ * The table is generated by tools/gen_oui.py into OuiData.cpp as two
+ * const arrays, so it lives in flash rodata and is searched in place -
+ * nothing is copied to RAM:
+ *
+ *   OUI_TABLE: 6-byte records, OUI (3) | name offset (3), sorted by OUI
+ *   OUI_POOL:  NUL-separated vendor names, each stored once
+ *
+ * Lookup is a binary search over the records: ~16 probes for the full
+ * IEEE registry.
+ *
+ * Works for WiFi BSSIDs, station MACs and public BLE addresses - all are
+ * IEEE-assigned. Locally administered MACs (randomised stations) and BLE
+ * random addresses have no vendor and return nullptr. BLE addresses are
+ * stored least significant byte first, as NimBLE delivers them; the
+ * Target overloads read each type's address the way it is stored.
+ *
+ * @example
+ * const char* vendor = OuiLookup::vendor(target);
+ * if (vendor) renderInfoField(y, "Vendor:", vendor);
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t OUI_RECORD_BYTES = 6;
+constexpr size_t OUI_VENDOR_MAX   = 20;   // Names are shortened to fit the UI
+
+// Generated (OuiData.cpp)
+extern const uint8_t OUI_TABLE[];
+extern const char    OUI_POOL[];
+extern const size_t  OUI_COUNT;
+extern const size_t  OUI_POOL_BYTES;
+
+// =============================================================================
+// OuiLookup Class
+// =============================================================================
+
+class OuiLookup {
+public:
+    /**
+     * @brief Vendor for a MAC address
+     * @return Name in flash, or nullptr if unknown, multicast or locally administered
+     */
+    static const char* vendor(const uint8_t* mac);
+
+    /**
+     * @brief Vendor for a target's address
+     *
+     * Reverses BLE addresses first and skips random ones. Beacons are
+     * keyed by a hash of what they broadcast and have no vendor.
+     */
+    static const char* vendor(const Target& target);
+
+    /**
+     * @brief Locally administered bit set (randomised or assigned by software)
+     */
+    static bool isLocal(const uint8_t* mac) { return (mac[0] & 0x02) != 0; }
+
+    /**
+     * @brief Target's address is randomised
+     *
+     * WiFi: the locally administered bit. BLE: the advertised address
+     * type, since the bit means nothing there.
+     */
+    static bool isRandomized(const Target& target);
+
+    /**
+     * @brief Search a table laid out like OUI_TABLE
+     */
+    static const char* find(const uint8_t* table, size_t count, const char* pool, uint32_t oui);
+
+    /**
+     * @brief Generated table size
+     */
+    static size_t count() { return OUI_COUNT; }
+    static size_t flashBytes() { return OUI_COUNT * OUI_RECORD_BYTES + OUI_POOL_BYTES; }
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_OUI_LOOKUP_H
@@ -3,45 +3,54 @@
 
 namespace Vanguard {
 
-PCAPWriter::PCAPWriter(const char* filename) 
-    : m_headerWritten(false) 
+PCAPWriter::PCAPWriter(const char* tag, const CapturePolicy& policy)
+    : m_headerWritten(false)
+    , m_fileBytes(0)
+    , m_lastFlushMs(0)
+    , m_rotation(policy)
 {
-    strncpy(m_filename, filename, sizeof(m_filename) - 1);
+    strncpy(m_tag, tag, sizeof(m_tag) - 1);
+    m_tag[sizeof(m_tag) - 1] = '\0';
+
+    // Accept legacy "/captures/name.pcap" paths: keep just "name"
+    const char* slash = strrchr(m_tag, '/');
+    if (slash) memmove(m_tag, slash + 1, strlen(slash + 1) + 1);
+    char* ext = strstr(m_tag, ".pcap");
+    if (ext) *ext = '\0';
+
+    m_path[0] = '\0';
 }
 
 bool PCAPWriter::open() {
-    // If file exists, we don't overwrite global header
-    bool exists = SD.exists(m_filename);
-    
-    m_file = SD.open(m_filename, FILE_APPEND);
-    if (!m_file) return false;
+    if (!SDManager::getInstance().isAvailable()) return false;
 
-    if (!exists) {
-        pcap_global_header header;
-        header.magic_number = 0xa1b2c3d4;
-        header.version_major = 2;
-        header.version_minor = 4;
-        header.thiszone = 0;
-        header.sigfigs = 0;
-        header.snaplen = 65535;
-        header.network = 105; // IEEE 802.11
-
-        m_file.write((uint8_t*)&header, sizeof(header));
-        m_file.flush();
-    }
-    
-    m_headerWritten = true;
-    return true;
+    SDManager::getInstance().ensureDirectory(CAPTURE_DIR);
+    m_rotation.begin(m_tag, SDManager::getInstance().nextSessionId(), millis());
+    loadLedger();
+
+    return openNext();
 }
 
 bool PCAPWriter::writePacket(const uint8_t* data, uint16_t len) {
+    return writePacket(data, len, millis());
+}
+
+bool PCAPWriter::writePacket(const uint8_t* data, uint16_t len, uint32_t timestampMs) {
     if (!m_headerWritten && !open()) return false;
     if (!m_file) return false;
 
-    pcap_packet_header pktHeader;
     uint32_t now = millis();
-    pktHeader.ts_sec = now / 1000;
-    pktHeader.ts_usec = (now % 1000) * 1000;
+    uint32_t recordLen = sizeof(pcap_packet_header) + len;
+
+    // Rotate before the write that would cross the size limit
+    if (m_rotation.shouldRotate(m_fileBytes + recordLen, now)) {
+        closeCurrent();
+        if (!openNext()) return false;
+    }
+
+    pcap_packet_header pktHeader;
+    pktHeader.ts_sec = timestampMs / 1000;
+    pktHeader.ts_usec = (timestampMs % 1000) * 1000;
     pktHeader.incl_len = len;
     pktHeader.orig_len = len;
 
@@ -49,21 +58,18 @@ bool PCAPWriter::writePacket(const uint8_t* data, uint16_t len) {
     // But we manually flush only when needed to avoid blocking
     m_file.write((uint8_t*)&pktHeader, sizeof(pktHeader));
     m_file.write(data, len);
+    m_fileBytes += recordLen;
 
-    static uint32_t lastFlush = 0;
-    if (millis() - lastFlush > 500) { // Flush every 500ms to avoid blocking but ensure data persistence
+    if (now - m_lastFlushMs > 500) { // Flush every 500ms to avoid blocking but ensure data persistence
         m_file.flush();
-        lastFlush = millis();
+        m_lastFlushMs = now;
     }
 
     return true;
 }
 
 void PCAPWriter::close() {
-    if (m_file) {
-        m_file.flush();
-        m_file.close();
-    }
+    closeCurrent();
     m_headerWritten = false;
 }
 
@@ -71,4 +77,97 @@ void PCAPWriter::flush() {
     if (m_file) m_file.flush();
 }
 
+// =============================================================================
+// ROTATION
+// =============================================================================
+
+bool PCAPWriter::openNext() {
+    const CapturePolicy& policy = m_rotation.policy();
+    uint32_t reserve = policy.preallocate ? policy.maxFileBytes : 0;
+
+    enforceQuota(reserve);
+    m_rotation.nextPath(m_path, sizeof(m_path), millis());
+
+    m_file = SD.open(m_path, FILE_WRITE);
+    if (!m_file) {
+        if (Serial) Serial.printf("[PCAP] ERROR: Failed to open %s\n", m_path);
+        m_headerWritten = false;
+        return false;
+    }
+
+    // Extend the file to its final size once so FAT allocates the
+    // clusters in one go, then write sequentially from the start
+    if (reserve > 0) {
+        if (m_file.seek(reserve - 1)) {
+            uint8_t zero = 0;
+            m_file.write(&zero, 1);
+            m_file.flush();
+        }
+        m_file.seek(0);
+    }
+
+    pcap_global_header header;
+    header.magic_number = 0xa1b2c3d4;
+    header.version_major = 2;
+    header.version_minor = 4;
+    header.thiszone = 0;
+    header.sigfigs = 0;
+    header.snaplen = 65535;
+    header.network = 105; // IEEE 802.11
+
+    m_file.write((uint8_t*)&header, sizeof(header));
+    m_file.flush();
+
+    m_fileBytes = sizeof(header);
+    m_lastFlushMs = millis();
+    m_headerWritten = true;
+
+    // Count the reservation against the quota until we know the real size
+    m_rotation.track(m_path, reserve > m_fileBytes ? reserve : m_fileBytes);
+
+    if (Serial) Serial.printf("[PCAP] Writing %s\n", m_path);
+    return true;
+}
+
+void PCAPWriter::closeCurrent() {
+    if (!m_file) return;
+
+    m_file.flush();
+    m_file.close();
+
+    if (m_rotation.policy().preallocate) {
+        SDManager::getInstance().truncateFile(m_path, m_fileBytes);
+    }
+    m_rotation.track(m_path, m_fileBytes);
+}
+
+void PCAPWriter::enforceQuota(uint32_t reserveBytes) {
+    char victim[CAPTURE_PATH_LEN];
+    while (m_rotation.nextEviction(reserveBytes, m_path, victim, sizeof(victim))) {
+        if (Serial) Serial.printf("[PCAP] Quota: deleting %s\n", victim);
+        SDManager::getInstance().removeFile(victim);
+        m_rotation.untrack(victim);
+    }
+}
+
+void PCAPWriter::loadLedger() {
+    File dir = SD.open(CAPTURE_DIR);
+    if (!dir || !dir.isDirectory()) return;
+
+    File entry = dir.openNextFile();
+    while (entry) {
+        const char* path = entry.path();
+        if (!entry.isDirectory() && strstr(path, ".pcap")) {
+            // Ledger full: the oldest is evicted before we open anything
+            if (!m_rotation.track(path, entry.size())) {
+                enforceQuota(0);
+                m_rotation.track(path, entry.size());
+            }
+        }
+        entry.close();
+        entry = dir.openNextFile();
+    }
+    dir.close();
+}
+
 } // namespace Vanguard
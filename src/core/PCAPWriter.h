@@ -4,10 +4,17 @@
 /**
  * @file PCAPWriter.h
  * @brief Simple libpcap file serializer
+ *
+ * Writes a capture session as a series of rotated files (see
+ * CaptureRotation). Each file is preallocated to the rotation size when
+ * opened so the FAT allocator hands out one contiguous run and writes
+ * stay sequential; the unused tail is truncated away on close. Oldest
+ * captures are deleted to keep /captures under the space cap.
  */
 
 #include <Arduino.h>
 #include "SDManager.h"
+#include "CaptureRotation.h"
 
 namespace Vanguard {
 
@@ -30,19 +37,39 @@ struct pcap_packet_header {
 
 class PCAPWriter {
 public:
-    PCAPWriter(const char* filename);
-    
+    /**
+     * @param tag Short label for filenames, e.g. "hs_AABBCC"
+     */
+    PCAPWriter(const char* tag, const CapturePolicy& policy = CapturePolicy::defaults());
+
     bool open();
     bool writePacket(const uint8_t* data, uint16_t len);
+
+    /**
+     * @brief Write a frame captured earlier (e.g. queued in a PacketRing)
+     * @param timestampMs millis() when the frame was received
+     */
+    bool writePacket(const uint8_t* data, uint16_t len, uint32_t timestampMs);
     void close();
 
+    /**
+     * @brief Path of the file currently being written
+     */
+    const char* currentPath() const { return m_path; }
+
 private:
-    char m_filename[64];
+    char m_tag[CAPTURE_TAG_LEN];
+    char m_path[CAPTURE_PATH_LEN];
     bool m_headerWritten;
     File m_file;
-    uint8_t m_buffer[2048]; // 2KB write buffer
-    size_t m_bufferPos = 0;
+    uint32_t m_fileBytes;       // Bytes written to the current file
+    uint32_t m_lastFlushMs;
+    CaptureRotation m_rotation;
 
+    bool openNext();
+    void closeCurrent();
+    void enforceQuota(uint32_t reserveBytes);
+    void loadLedger();
     void flush();
 };
 
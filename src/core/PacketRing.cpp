@@ -0,0 +1,123 @@
+/**
+ * @file PacketRing.cpp
+ * @brief SPSC variable-length frame ring
+ */
+
+#include "PacketRing.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace Vanguard {
+
+// Records are 4-byte aligned; a header that doesn't fit before the end
+// of the buffer is implied, otherwise an explicit marker says "wrap"
+static const uint16_t RECORD_WRAP = 0xFFFF;
+static const uint32_t RECORD_ALIGN = 4;
+
+PacketRing::PacketRing(size_t capacity)
+    : m_buffer(nullptr)
+    , m_capacity(64)
+    , m_mask(0)
+    , m_head(0)
+    , m_tail(0)
+    , m_highWater(0)
+{
+    while (m_capacity < capacity) m_capacity <<= 1;
+    m_mask = m_capacity - 1;
+    m_buffer = (uint8_t*)malloc(m_capacity);
+    if (!m_buffer) m_capacity = 0;
+}
+
+PacketRing::~PacketRing() {
+    free(m_buffer);
+}
+
+// =============================================================================
+// PRODUCER
+// =============================================================================
+
+bool PacketRing::push(const uint8_t* data, uint16_t len, uint8_t channel,
+                      int8_t rssi, uint32_t timestampMs) {
+    if (!m_buffer || len == RECORD_WRAP) return false;
+
+    uint32_t head = m_head.load(std::memory_order_relaxed);
+    uint32_t tail = m_tail.load(std::memory_order_acquire);
+    uint32_t need = recordSize(len);
+    uint32_t pos = head & m_mask;
+    uint32_t toEnd = m_capacity - pos;
+
+    // Records never straddle the end: skip the remainder if needed
+    uint32_t skip = (toEnd < need) ? toEnd : 0;
+    if (m_capacity - (head - tail) < skip + need) return false;
+
+    if (skip) {
+        if (skip >= sizeof(PacketRecordHeader)) {
+            PacketRecordHeader marker;
+            marker.len = RECORD_WRAP;
+            memcpy(m_buffer + pos, &marker, sizeof(marker.len));
+        }
+        pos = 0;
+    }
+
+    PacketRecordHeader header;
+    header.len = len;
+    header.channel = channel;
+    header.rssi = rssi;
+    header.timestampMs = timestampMs;
+    memcpy(m_buffer + pos, &header, sizeof(header));
+    memcpy(m_buffer + pos + sizeof(header), data, len);
+
+    uint32_t newHead = head + skip + need;
+    m_head.store(newHead, std::memory_order_release);
+
+    uint32_t inUse = newHead - tail;
+    if (inUse > m_highWater) m_highWater = inUse;
+    return true;
+}
+
+// =============================================================================
+// CONSUMER
+// =============================================================================
+
+bool PacketRing::pop(PacketRecordHeader& header, uint8_t* out, size_t outLen) {
+    uint32_t tail = m_tail.load(std::memory_order_relaxed);
+    uint32_t head = m_head.load(std::memory_order_acquire);
+    if (tail == head) return false;
+
+    uint32_t pos = tail & m_mask;
+    uint32_t toEnd = m_capacity - pos;
+
+    if (toEnd < sizeof(PacketRecordHeader)) {
+        tail += toEnd;
+        pos = 0;
+    } else {
+        uint16_t len;
+        memcpy(&len, m_buffer + pos, sizeof(len));
+        if (len == RECORD_WRAP) {
+            tail += toEnd;
+            pos = 0;
+        }
+    }
+
+    memcpy(&header, m_buffer + pos, sizeof(header));
+    size_t copy = header.len < outLen ? header.len : outLen;
+    if (out && copy) memcpy(out, m_buffer + pos + sizeof(header), copy);
+
+    m_tail.store(tail + recordSize(header.len), std::memory_order_release);
+    return true;
+}
+
+void PacketRing::clear() {
+    m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+size_t PacketRing::used() const {
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+}
+
+uint32_t PacketRing::recordSize(uint16_t len) {
+    uint32_t size = sizeof(PacketRecordHeader) + len;
+    return (size + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1);
+}
+
+} // namespace Vanguard
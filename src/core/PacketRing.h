@@ -0,0 +1,96 @@
+#ifndef VANGUARD_PACKET_RING_H
+#define VANGUARD_PACKET_RING_H
+
+/**
+ * @file PacketRing.h
+ * @brief Lock-free single-producer/single-consumer frame buffer
+ *
+ * Decouples the promiscuous callback (producer, WiFi task) from SD
+ * writes (consumer, SystemTask). Frames are stored back to back as
+ * variable-length records, so a 32KB ring holds hundreds of short
+ * management frames or a dozen full-size data frames. When the ring is
+ * full, push() fails and the caller counts a drop - the radio is never
+ * blocked on the SD card.
+ *
+ * @example
+ * PacketRing ring(32768);
+ * // rx callback:
+ * if (!ring.push(payload, len, channel, rssi, millis())) drops++;
+ * // SystemTask:
+ * PacketRecordHeader hdr;
+ * while (ring.pop(hdr, buf, sizeof(buf))) writer.writePacket(buf, hdr.len, hdr.timestampMs);
+ */
+
+#include "VanguardTypes.h"
+#include <atomic>
+
+namespace Vanguard {
+
+/**
+ * @brief Metadata stored in front of each frame
+ */
+struct PacketRecordHeader {
+    uint16_t len;            // Frame bytes following this header
+    uint8_t  channel;
+    int8_t   rssi;
+    uint32_t timestampMs;
+};
+
+// =============================================================================
+// PacketRing Class
+// =============================================================================
+
+class PacketRing {
+public:
+    /**
+     * @param capacity Buffer size in bytes (rounded up to a power of two)
+     */
+    explicit PacketRing(size_t capacity);
+    ~PacketRing();
+
+    // Owns its buffer
+    PacketRing(const PacketRing&) = delete;
+    PacketRing& operator=(const PacketRing&) = delete;
+
+    /**
+     * @brief Append a frame (producer side only)
+     * @return false if there isn't room; nothing is written
+     */
+    bool push(const uint8_t* data, uint16_t len, uint8_t channel,
+              int8_t rssi, uint32_t timestampMs);
+
+    /**
+     * @brief Remove the oldest frame (consumer side only)
+     * @param out Receives up to outLen frame bytes; longer frames are cut
+     * @return false if the ring is empty
+     */
+    bool pop(PacketRecordHeader& header, uint8_t* out, size_t outLen);
+
+    /**
+     * @brief Discard everything queued (consumer side only)
+     */
+    void clear();
+
+    size_t capacity() const { return m_capacity; }
+    size_t used() const;
+
+    /**
+     * @brief Peak bytes in use since construction or resetHighWater()
+     */
+    size_t highWater() const { return m_highWater; }
+    void   resetHighWater()  { m_highWater = used(); }
+
+private:
+    uint8_t*              m_buffer;
+    uint32_t              m_capacity;    // Power of two
+    uint32_t              m_mask;
+    std::atomic<uint32_t> m_head;        // Free-running write position
+    std::atomic<uint32_t> m_tail;        // Free-running read position
+    volatile uint32_t     m_highWater;
+
+    static uint32_t recordSize(uint16_t len);
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_PACKET_RING_H
@@ -0,0 +1,144 @@
+/**
+ * @file ProbeTable.cpp
+ * @brief Probing stations, their PNLs, and the MAC index
+ */
+
+#include "ProbeTable.h"
+#include <cstring>
+
+namespace Vanguard {
+
+static_assert(PROBE_INDEX_SLOTS >= MAX_PROBING_STATIONS * 2, "index too small");
+
+ProbeTable::ProbeTable()
+    : m_count(0)
+    , m_evictions(0)
+{
+    clear();
+}
+
+// =============================================================================
+// PUBLIC
+// =============================================================================
+
+bool ProbeTable::observe(const uint8_t* mac, const char* ssid, uint8_t len,
+                         int8_t rssi, uint8_t channel, uint32_t now) {
+    if (len == 0 || len > SSID_MAX_LEN) return false;
+
+    int idx = indexOf(mac);
+    if (idx < 0) {
+        if (m_count >= MAX_PROBING_STATIONS) evictOldest();
+
+        idx = (int)m_count++;
+        ProbingStation& s = m_stations[idx];
+        memset(&s, 0, sizeof(ProbingStation));
+        memcpy(s.mac, mac, 6);
+        s.firstSeenMs = now;
+        m_index.insert(idx, mac);
+    }
+
+    ProbingStation& s = m_stations[idx];
+    s.lastSeenMs = now;
+    s.rssi = rssi;
+    if (channel != 0) s.channel = channel;
+    if (s.probeCount < 0xFFFF) s.probeCount++;
+
+    // Already in the PNL: move it to the most recent end
+    uint16_t known = m_pool.find(ssid, len);
+    for (uint8_t i = 0; known != SSID_NONE && i < s.ssidCount; i++) {
+        if (s.ssids[i] != known) continue;
+        memmove(&s.ssids[i], &s.ssids[i + 1], (s.ssidCount - i - 1) * sizeof(uint16_t));
+        s.ssids[s.ssidCount - 1] = known;
+        return false;
+    }
+
+    uint16_t id = m_pool.intern(ssid, len);
+    if (id == SSID_NONE) return false;     // Pool full: keep what we have
+
+    if (s.ssidCount >= PNL_MAX_SSIDS) {
+        m_pool.release(s.ssids[0]);
+        memmove(&s.ssids[0], &s.ssids[1], (PNL_MAX_SSIDS - 1) * sizeof(uint16_t));
+        s.ssidCount--;
+    }
+    s.ssids[s.ssidCount++] = id;
+    return true;
+}
+
+const ProbingStation* ProbeTable::find(const uint8_t* mac) const {
+    int idx = indexOf(mac);
+    return (idx >= 0) ? &m_stations[idx] : nullptr;
+}
+
+size_t ProbeTable::ssidsOf(const uint8_t* mac, const char** out, size_t max) const {
+    const ProbingStation* s = find(mac);
+    if (!s) return 0;
+
+    size_t n = 0;
+    for (int i = (int)s->ssidCount - 1; i >= 0 && n < max; i--) {
+        out[n++] = m_pool.get(s->ssids[i]);
+    }
+    return n;
+}
+
+size_t ProbeTable::stationsProbing(const char* ssid, uint8_t len) const {
+    uint16_t id = m_pool.find(ssid, len);
+    return (id != SSID_NONE) ? m_pool.refs(id) : 0;
+}
+
+size_t ProbeTable::pruneStale(uint32_t now, uint32_t maxAgeMs) {
+    size_t removed = 0;
+    size_t i = 0;
+    while (i < m_count) {
+        if (now - m_stations[i].lastSeenMs > maxAgeMs) {
+            removeAt(i);            // Last entry moves into i; look again
+            removed++;
+        } else {
+            i++;
+        }
+    }
+    return removed;
+}
+
+void ProbeTable::clear() {
+    m_count = 0;
+    m_index.clear();
+    m_pool.clear();
+}
+
+// =============================================================================
+// MAC INDEX
+// =============================================================================
+
+int ProbeTable::indexOf(const uint8_t* mac) const {
+    return m_index.find(mac, [this](size_t e) { return m_stations[e].mac; });
+}
+
+// =============================================================================
+// REMOVAL
+// =============================================================================
+
+void ProbeTable::removeAt(size_t entry) {
+    ProbingStation& s = m_stations[entry];
+    for (uint8_t i = 0; i < s.ssidCount; i++) m_pool.release(s.ssids[i]);
+    m_index.erase(entry, [this](size_t e) { return m_stations[e].mac; });
+
+    size_t last = m_count - 1;
+    if (entry != last) {
+        m_stations[entry] = m_stations[last];
+        m_index.repoint(m_stations[entry].mac, last, entry);
+    }
+    m_count--;
+}
+
+void ProbeTable::evictOldest() {
+    if (m_count == 0) return;
+
+    size_t oldest = 0;
+    for (size_t i = 1; i < m_count; i++) {
+        if ((int32_t)(m_stations[i].lastSeenMs - m_stations[oldest].lastSeenMs) < 0) oldest = i;
+    }
+    removeAt(oldest);
+    m_evictions++;
+}
+
+} // namespace Vanguard
@@ -0,0 +1,118 @@
+#ifndef VANGUARD_PROBE_TABLE_H
+#define VANGUARD_PROBE_TABLE_H
+
+/**
+ * @file ProbeTable.h
+ * @brief Per-station preferred network lists from probe requests
+ *
+ * A directed probe request names a network the station has joined
+ * before. Collected per station, that's its preferred network list
+ * (PNL): where the device's owner lives, works and travels.
+ *
+ * Each station keeps up to PNL_MAX_SSIDS ids into a shared SsidPool,
+ * most recently probed last; when full, the least recently probed SSID
+ * is dropped. The pool's refcount of an SSID is the number of stations
+ * probing for it.
+ *
+ * Storage follows StationTable: packed entries with swap-remove, an
+ * open-addressing MAC index, and the station heard least recently is
+ * evicted when full.
+ *
+ * @example
+ * ProbeTable probes;
+ * probes.observe(info.station, info.ssid, info.ssidLen, info.rssi, info.channel, millis());
+ * const char* pnl[PNL_MAX_SSIDS];
+ * size_t n = probes.ssidsOf(stationMac, pnl, PNL_MAX_SSIDS);
+ */
+
+#include "VanguardTypes.h"
+#include "SsidPool.h"
+#include "MacIndex.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t   MAX_PROBING_STATIONS = 256;
+constexpr size_t   PNL_MAX_SSIDS        = 8;
+constexpr size_t   PROBE_INDEX_SLOTS    = 512;      // Power of two, load <= 0.5
+constexpr uint32_t PROBE_AGE_TIMEOUT_MS = 600000;   // Phones probe rarely when idle
+
+/**
+ * @brief A station that has sent directed probe requests
+ */
+struct ProbingStation {
+    uint8_t  mac[6];
+    uint16_t ssids[PNL_MAX_SSIDS];   // SsidPool ids, oldest first
+    uint8_t  ssidCount;
+    int8_t   rssi;
+    uint8_t  channel;
+    uint16_t probeCount;             // Saturates at 65535
+    uint32_t firstSeenMs;
+    uint32_t lastSeenMs;
+};
+
+// =============================================================================
+// ProbeTable Class
+// =============================================================================
+
+class ProbeTable {
+public:
+    ProbeTable();
+
+    /**
+     * @brief A directed probe request was seen
+     * @param ssid Probed SSID, len bytes (wildcard probes are ignored)
+     * @return true if this SSID is new for this station
+     */
+    bool observe(const uint8_t* mac, const char* ssid, uint8_t len,
+                 int8_t rssi, uint8_t channel, uint32_t now);
+
+    const ProbingStation* find(const uint8_t* mac) const;
+
+    /**
+     * @brief A station's PNL, most recently probed first
+     * @return Number written to out; strings are valid until the next observe()
+     */
+    size_t ssidsOf(const uint8_t* mac, const char** out, size_t max) const;
+
+    /**
+     * @brief Stations probing for this SSID
+     */
+    size_t stationsProbing(const char* ssid, uint8_t len) const;
+
+    /**
+     * @brief Drop stations not heard for maxAgeMs
+     * @return Number removed
+     */
+    size_t pruneStale(uint32_t now, uint32_t maxAgeMs = PROBE_AGE_TIMEOUT_MS);
+
+    void clear();
+
+    const ProbingStation* data() const { return m_stations; }
+    size_t count() const { return m_count; }
+    const SsidPool& pool() const { return m_pool; }
+
+    /**
+     * @brief Stations dropped to make room
+     */
+    uint32_t evictions() const { return m_evictions; }
+
+private:
+    ProbingStation m_stations[MAX_PROBING_STATIONS];
+    size_t         m_count;
+    MacIndex<PROBE_INDEX_SLOTS> m_index;
+    SsidPool       m_pool;
+    uint32_t       m_evictions;
+
+    int  indexOf(const uint8_t* mac) const;
+
+    void removeAt(size_t entry);
+    void evictOldest();
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_PROBE_TABLE_H
@@ -1,5 +1,6 @@
 #include "RadioWarden.h"
 #include <WiFi.h>
+#include <esp_coexist.h>
 #include "../adapters/BruceBLE.h"
 
 namespace Vanguard {
@@ -14,6 +15,12 @@ RadioWarden::RadioWarden() {}
 bool RadioWarden::requestRadio(RadioOwner owner) {
     if (m_currentOwner == owner) return true;
 
+    // Coex already runs both stacks
+    if (m_currentOwner == RadioOwner::OWNER_COEX &&
+        (owner == RadioOwner::OWNER_WIFI_STA || owner == RadioOwner::OWNER_BLE)) {
+        return true;
+    }
+
     if (Serial) {
         Serial.printf("[Warden] Requesting handover: %d -> %d\n", (int)m_currentOwner, (int)owner);
     }
@@ -31,6 +38,9 @@ bool RadioWarden::requestRadio(RadioOwner owner) {
         case RadioOwner::OWNER_BLE:
             success = initBLE();
             break;
+        case RadioOwner::OWNER_COEX:
+            success = initCoex();
+            break;
         default:
             success = true; // NONE
             break;
@@ -53,7 +63,8 @@ void RadioWarden::shutdownCurrent() {
     if (Serial) Serial.println("[Warden] Shutting down current radio...");
 
     // WiFi Cleanup
-    if (m_currentOwner == RadioOwner::OWNER_WIFI_STA || m_currentOwner == RadioOwner::OWNER_WIFI_PROMISCUOUS) {
+    if (m_currentOwner == RadioOwner::OWNER_WIFI_STA || m_currentOwner == RadioOwner::OWNER_WIFI_PROMISCUOUS ||
+        m_currentOwner == RadioOwner::OWNER_COEX) {
         esp_wifi_set_promiscuous(false);
         ::WiFi.disconnect(true);
         ::WiFi.mode(WIFI_OFF);
@@ -63,7 +74,7 @@ void RadioWarden::shutdownCurrent() {
     }
 
     // BLE Cleanup - we don't deinit NimBLE, just stop activities
-    if (m_currentOwner == RadioOwner::OWNER_BLE) {
+    if (m_currentOwner == RadioOwner::OWNER_BLE || m_currentOwner == RadioOwner::OWNER_COEX) {
         BruceBLE::getInstance().stopHardwareActivities();
     }
 }
@@ -86,4 +97,13 @@ bool RadioWarden::initBLE() {
     return BruceBLE::getInstance().init();
 }
 
+bool RadioWarden::initCoex() {
+    // Both stacks up at once; the coex arbiter time-slices the antenna so
+    // a combined scan can alternate WiFi and BLE without a teardown
+    if (!initWiFiSTA()) return false;
+    if (!initBLE()) return false;
+    esp_coex_preference_set(ESP_COEX_PREFER_BALANCE);
+    return true;
+}
+
 } // namespace Vanguard
@@ -11,6 +11,7 @@ enum class RadioOwner {
     OWNER_WIFI_STA,
     OWNER_WIFI_PROMISCUOUS,
     OWNER_BLE,
+    OWNER_COEX,  // WiFi STA + BLE together, time-shared by the coex scheduler
     OWNER_LORA // Future proofing
 };
 
@@ -25,6 +26,10 @@ public:
 
     /**
      * @brief Request the radio for a specific protocol.
+     *
+     * While OWNER_COEX holds the radio, requests for OWNER_WIFI_STA or
+     * OWNER_BLE are already satisfied and don't trigger a handover.
+     *
      * @return true if access granted and radio initialized for that mode.
      */
     bool requestRadio(RadioOwner owner);
@@ -46,6 +51,7 @@ private:
     bool initWiFiSTA();
     bool initWiFiPromiscuous();
     bool initBLE();
+    bool initCoex();
     void shutdownCurrent();
 };
 
@@ -0,0 +1,90 @@
+/**
+ * @file RollingScan.cpp
+ * @brief Continuous per-channel scan scheduling
+ */
+
+#include "RollingScan.h"
+
+namespace Vanguard {
+
+// Non-overlapping channels first, then the rest spread across the band
+static const uint8_t SWEEP_ORDER[WIFI_CHANNEL_MAX] = {
+    1, 6, 11, 2, 7, 12, 3, 8, 13, 4, 9, 5, 10, 14
+};
+
+RollingScan::RollingScan()
+    : m_orderLen(0)
+    , m_position(0)
+    , m_inFlight(0)
+    , m_active(false)
+    , m_stepStartMs(0)
+    , m_lastDoneMs(0)
+    , m_sweeps(0)
+{
+}
+
+void RollingScan::start(uint32_t now, uint16_t mask) {
+    mask &= SCHED_BAND_CHANNELS;
+    if (mask == 0) mask = SCHED_ALL_CHANNELS;
+
+    m_orderLen = 0;
+    for (uint8_t i = 0; i < WIFI_CHANNEL_MAX; i++) {
+        uint8_t ch = SWEEP_ORDER[i];
+        if (mask & (1 << ch)) m_order[m_orderLen++] = ch;
+    }
+
+    m_position = 0;
+    m_inFlight = 0;
+    m_sweeps = 0;
+    m_stepStartMs = now;
+    m_lastDoneMs = now - ROLLING_GAP_MS;   // First step is due immediately
+    m_active = true;
+}
+
+void RollingScan::stop() {
+    m_active = false;
+    m_inFlight = 0;
+}
+
+// =============================================================================
+// STEPPING
+// =============================================================================
+
+uint8_t RollingScan::nextStep(uint32_t now) {
+    if (!m_active || m_orderLen == 0) return 0;
+
+    if (m_inFlight) {
+        if (now - m_stepStartMs < ROLLING_STEP_TIMEOUT_MS) return 0;
+        finishStep(now);     // Lost completion: move on
+    }
+    if (now - m_lastDoneMs < ROLLING_GAP_MS) return 0;
+
+    m_inFlight = m_order[m_position];
+    m_stepStartMs = now;
+    return m_inFlight;
+}
+
+bool RollingScan::completeStep(uint32_t now, uint8_t channel) {
+    if (!m_inFlight || channel != m_inFlight) return false;
+    return finishStep(now);
+}
+
+bool RollingScan::finishStep(uint32_t now) {
+    m_inFlight = 0;
+    m_lastDoneMs = now;
+    m_position++;
+
+    if (m_position >= m_orderLen) {
+        m_position = 0;
+        m_sweeps++;
+        return true;
+    }
+    return false;
+}
+
+uint8_t RollingScan::sweepProgress() const {
+    if (m_orderLen == 0) return 0;
+    return (uint8_t)((uint32_t)m_position * 100 / m_orderLen);
+}
+
+} // namespace Vanguard
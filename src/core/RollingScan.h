@@ -0,0 +1,113 @@
+#ifndef VANGUARD_ROLLING_SCAN_H
+#define VANGUARD_ROLLING_SCAN_H
+
+/**
+ * @file RollingScan.h
+ * @brief Schedule for continuous, incremental WiFi scanning
+ *
+ * Instead of one blocking sweep of every channel, a rolling scan asks the
+ * driver for one channel at a time (a bounded ~120 ms passive dwell),
+ * merges the results, and rests ROLLING_GAP_MS before the next step so
+ * the UI and event queue keep moving. Channels are visited in an
+ * interleaved order (1, 6, 11 first) so the busiest bands refresh early
+ * in every sweep.
+ *
+ * Pure scheduling logic - VanguardEngine sends the scan requests.
+ *
+ * @example
+ * RollingScan rolling;
+ * rolling.start(millis());
+ * // tick:
+ * uint8_t ch = rolling.nextStep(millis());
+ * if (ch) requestScan(ch);
+ * // on scan complete (even after the step timed out):
+ * if (rolling.completeStep(millis(), ch)) table.age(millis(), AgingPolicy::defaults());
+ */
+
+#include "VanguardTypes.h"
+#include "ChannelScheduler.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr uint32_t ROLLING_GAP_MS          = 250;   // Rest between steps
+constexpr uint32_t ROLLING_STEP_TIMEOUT_MS = 2000;  // Assume a lost completion after this
+
+// =============================================================================
+// RollingScan Class
+// =============================================================================
+
+class RollingScan {
+public:
+    RollingScan();
+
+    /**
+     * @brief Start sweeping
+     * @param mask Bit N = channel N (0 = SCHED_ALL_CHANNELS, 1-13)
+     */
+    void start(uint32_t now, uint16_t mask = SCHED_ALL_CHANNELS);
+
+    void stop();
+    bool isActive() const { return m_active; }
+
+    /**
+     * @brief Channel to scan now, if a step is due
+     *
+     * Marks the step as in flight; completeStep() ends it. A step that
+     * never completes is abandoned after ROLLING_STEP_TIMEOUT_MS.
+     *
+     * @return Channel, or 0 if nothing should start yet
+     */
+    uint8_t nextStep(uint32_t now);
+
+    /**
+     * @brief Results for a step have been merged
+     *
+     * A completion for any channel but the one in flight is ignored: it
+     * belongs to a step that already timed out, and must not end the
+     * step that replaced it.
+     *
+     * @param channel Channel the results are for
+     * @return true if that step finished a full sweep
+     */
+    bool completeStep(uint32_t now, uint8_t channel);
+
+    /**
+     * @brief Check if a step is waiting for results
+     */
+    bool inFlight() const { return m_inFlight != 0; }
+
+    /**
+     * @brief Channel currently being scanned (0 if none)
+     */
+    uint8_t currentChannel() const { return m_inFlight; }
+
+    /**
+     * @brief Completed sweeps since start()
+     */
+    uint32_t sweeps() const { return m_sweeps; }
+
+    /**
+     * @brief Progress through the current sweep, 0-100
+     */
+    uint8_t sweepProgress() const;
+
+private:
+    bool finishStep(uint32_t now);
+
+    uint8_t  m_order[WIFI_CHANNEL_MAX];
+    uint8_t  m_orderLen;
+    uint8_t  m_position;        // Next index into m_order
+    uint8_t  m_inFlight;        // Channel being scanned, 0 if idle
+    bool     m_active;
+    uint32_t m_stepStartMs;
+    uint32_t m_lastDoneMs;
+    uint32_t m_sweeps;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_ROLLING_SCAN_H
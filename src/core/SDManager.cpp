@@ -1,5 +1,6 @@
 #include "SDManager.h"
 #include <M5Cardputer.h>
+#include <unistd.h>
 
 namespace Vanguard {
 
@@ -52,6 +53,7 @@ void SDManager::createFolderStructure() {
     ensureDirectory("/evil_portal");
     ensureDirectory("/evil_portal/templates");
     ensureDirectory("/logs");
+    ensureDirectory("/state");
 }
 
 bool SDManager::appendToFile(const char* path, const char* data) {
@@ -68,6 +70,20 @@ bool SDManager::appendToFile(const char* path, const char* data) {
     return success;
 }
 
+bool SDManager::appendBytes(const char* path, const uint8_t* data, size_t len) {
+    if (!m_initialized) return false;
+
+    File file = SD.open(path, FILE_APPEND);
+    if (!file) {
+        if (Serial) Serial.printf("[SD] ERROR: Failed to open %s for append\n", path);
+        return false;
+    }
+
+    size_t written = file.write(data, len);
+    file.close();
+    return written == len;
+}
+
 String SDManager::readFile(const char* path) {
     if (!m_initialized) return "";
 
@@ -86,6 +102,41 @@ bool SDManager::fileExists(const char* path) {
     return SD.exists(path);
 }
 
+bool SDManager::removeFile(const char* path) {
+    if (!m_initialized) return false;
+    return SD.remove(path);
+}
+
+bool SDManager::truncateFile(const char* path, uint32_t size) {
+    if (!m_initialized) return false;
+
+    // Arduino's File has no truncate; go through the VFS instead
+    char vfsPath[96];
+    snprintf(vfsPath, sizeof(vfsPath), "%s%s", SD_MOUNT_POINT, path);
+    if (::truncate(vfsPath, (off_t)size) != 0) {
+        if (Serial) Serial.printf("[SD] ERROR: Failed to truncate %s\n", path);
+        return false;
+    }
+    return true;
+}
+
+uint32_t SDManager::nextSessionId() {
+    static const char* SESSION_FILE = "/captures/.session";
+    if (!m_initialized) return millis();  // Still unique enough within this boot
+
+    uint32_t id = 1;
+    if (fileExists(SESSION_FILE)) {
+        id = (uint32_t)strtoul(readFile(SESSION_FILE).c_str(), nullptr, 10) + 1;
+    }
+
+    File file = SD.open(SESSION_FILE, FILE_WRITE);
+    if (file) {
+        file.print(id);
+        file.close();
+    }
+    return id;
+}
+
 bool SDManager::logCredential(const char* ssid, const char* user, const char* pass, const char* mac) {
     char entry[256];
     // Format: Timestamp,SSID,User,Pass,ClientMac
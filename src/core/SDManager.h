@@ -12,6 +12,9 @@
 
 namespace Vanguard {
 
+// VFS mount point used by SD.begin(); POSIX calls need it prefixed
+constexpr const char* SD_MOUNT_POINT = "/sd";
+
 class SDManager {
 public:
     static SDManager& getInstance();
@@ -25,8 +28,24 @@ public:
 
     // File operations
     bool appendToFile(const char* path, const char* data);
+
+    /**
+     * @brief Append raw bytes (no newline)
+     */
+    bool appendBytes(const char* path, const uint8_t* data, size_t len);
     String readFile(const char* path);
     bool fileExists(const char* path);
+    bool removeFile(const char* path);
+
+    /**
+     * @brief Shrink a file to its written length (drops preallocated tail)
+     */
+    bool truncateFile(const char* path, uint32_t size);
+
+    /**
+     * @brief Persistent, monotonically increasing capture session number
+     */
+    uint32_t nextSessionId();
     
     // Logging helpers
     bool logCredential(const char* ssid, const char* user, const char* pass, const char* mac);
@@ -0,0 +1,170 @@
+/**
+ * @file ScanCoordinator.cpp
+ * @brief Interleaved WiFi/BLE slice scheduling
+ */
+
+#include "ScanCoordinator.h"
+
+namespace Vanguard {
+
+// Same spread as RollingScan: the busy non-overlapping channels land first
+static const uint8_t SLICE_ORDER[WIFI_CHANNEL_MAX] = {
+    1, 6, 11, 2, 7, 12, 3, 8, 13, 4, 9, 5, 10, 14
+};
+
+ScanCoordinator::ScanCoordinator(const ScanSlicePolicy& policy)
+    : m_policy(policy)
+    , m_orderLen(0)
+    , m_position(0)
+    , m_slice(ScanSliceType::NONE)
+    , m_sliceLeft(0)
+    , m_inFlight(false)
+    , m_stepStartMs(0)
+    , m_stepDurationMs(0)
+    , m_bleTotalMs(0)
+    , m_bleQuiet(0)
+    , m_useWifi(false)
+    , m_useBle(false)
+    , m_wifiDone(true)
+    , m_bleDone(true)
+    , m_active(false)
+{
+    if (m_policy.wifiChannelsPerSlice == 0) m_policy.wifiChannelsPerSlice = 1;
+    if (m_policy.bleSliceMs == 0) m_policy.bleSliceMs = 1;
+}
+
+void ScanCoordinator::start(uint32_t now, uint16_t channelMask, bool wifi, bool ble) {
+    channelMask &= SCHED_BAND_CHANNELS;
+    if (channelMask == 0) channelMask = SCHED_ALL_CHANNELS;
+
+    m_orderLen = 0;
+    for (uint8_t i = 0; i < WIFI_CHANNEL_MAX; i++) {
+        uint8_t ch = SLICE_ORDER[i];
+        if (channelMask & (1 << ch)) m_order[m_orderLen++] = ch;
+    }
+
+    m_position = 0;
+    m_slice = ScanSliceType::NONE;
+    m_sliceLeft = 0;
+    m_inFlight = false;
+    m_stepStartMs = now;
+    m_stepDurationMs = 0;
+    m_bleTotalMs = 0;
+    m_bleQuiet = 0;
+    m_useWifi = wifi && m_orderLen > 0;
+    m_useBle = ble && m_policy.bleMaxMs > 0;
+    m_wifiDone = !m_useWifi;
+    m_bleDone = !m_useBle;
+    m_active = true;
+}
+
+void ScanCoordinator::stop() {
+    m_active = false;
+    m_inFlight = false;
+    m_slice = ScanSliceType::NONE;
+}
+
+// =============================================================================
+// STEPPING
+// =============================================================================
+
+ScanStep ScanCoordinator::next(uint32_t now) {
+    ScanStep step = { ScanSliceType::NONE, 0, 0 };
+    if (!m_active) return step;
+
+    if (m_inFlight) {
+        // Write off a request whose completion got lost
+        if (m_slice == ScanSliceType::WIFI) {
+            if (now - m_stepStartMs < COORD_WIFI_STEP_TIMEOUT_MS) return step;
+            wifiStepDone(now);
+        } else {
+            if (now - m_stepStartMs < m_stepDurationMs + COORD_BLE_GRACE_MS) return step;
+            bleSliceDone(now, 0);
+        }
+    }
+
+    if (m_wifiDone && m_bleDone) {
+        m_active = false;
+        m_slice = ScanSliceType::DONE;
+        step.type = ScanSliceType::DONE;
+        return step;
+    }
+
+    bool wantWifi;
+    if (m_wifiDone)                          wantWifi = false;
+    else if (m_bleDone)                      wantWifi = true;
+    else if (m_slice == ScanSliceType::WIFI) wantWifi = (m_sliceLeft > 0);
+    else                                     wantWifi = true;   // Open, or BLE just ended
+
+    return wantWifi ? wifiStep(now) : bleStep(now);
+}
+
+ScanStep ScanCoordinator::wifiStep(uint32_t now) {
+    if (m_slice != ScanSliceType::WIFI || m_sliceLeft == 0) {
+        m_slice = ScanSliceType::WIFI;
+        m_sliceLeft = m_policy.wifiChannelsPerSlice;
+    }
+
+    m_inFlight = true;
+    m_stepStartMs = now;
+    m_stepDurationMs = 0;
+
+    ScanStep step = { ScanSliceType::WIFI, m_order[m_position], 0 };
+    return step;
+}
+
+ScanStep ScanCoordinator::bleStep(uint32_t now) {
+    uint32_t remaining = m_policy.bleMaxMs - m_bleTotalMs;
+
+    m_slice = ScanSliceType::BLE;
+    m_inFlight = true;
+    m_stepStartMs = now;
+    m_stepDurationMs = (m_policy.bleSliceMs < remaining) ? m_policy.bleSliceMs : remaining;
+
+    ScanStep step = { ScanSliceType::BLE, 0, m_stepDurationMs };
+    return step;
+}
+
+void ScanCoordinator::wifiStepDone(uint32_t now) {
+    (void)now;
+    if (!m_inFlight || m_slice != ScanSliceType::WIFI) return;
+
+    m_inFlight = false;
+    if (m_sliceLeft) m_sliceLeft--;
+    m_position++;
+    if (m_position >= m_orderLen) m_wifiDone = true;
+}
+
+void ScanCoordinator::bleSliceDone(uint32_t now, uint16_t newDevices) {
+    (void)now;
+    if (!m_inFlight || m_slice != ScanSliceType::BLE) return;
+
+    m_inFlight = false;
+    m_bleTotalMs += m_stepDurationMs;
+    m_bleQuiet = newDevices ? 0 : (uint8_t)(m_bleQuiet + 1);
+
+    if (m_bleTotalMs >= m_policy.bleMaxMs) {
+        m_bleDone = true;
+    } else if (m_bleTotalMs >= m_policy.bleMinMs && m_bleQuiet >= m_policy.bleQuietSlices) {
+        m_bleDone = true;   // Nothing new turning up
+    }
+}
+
+uint8_t ScanCoordinator::progress() const {
+    if (m_slice == ScanSliceType::DONE) return 100;
+
+    // Each included radio is an equal share
+    uint32_t total = 0;
+    uint8_t parts = 0;
+    if (m_useWifi) {
+        total += m_wifiDone ? 100 : (uint32_t)m_position * 100 / m_orderLen;
+        parts++;
+    }
+    if (m_useBle) {
+        total += m_bleDone ? 100 : m_bleTotalMs * 100 / m_policy.bleMaxMs;
+        parts++;
+    }
+    return parts ? (uint8_t)(total / parts) : 0;
+}
+
+} // namespace Vanguard
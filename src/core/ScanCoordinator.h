@@ -0,0 +1,163 @@
+#ifndef VANGUARD_SCAN_COORDINATOR_H
+#define VANGUARD_SCAN_COORDINATOR_H
+
+/**
+ * @file ScanCoordinator.h
+ * @brief Slice policy for combined WiFi + BLE scans
+ *
+ * The radio runs WiFi and BLE side by side under the coexistence
+ * scheduler, so a combined scan no longer tears WiFi down before BLE
+ * starts. Instead it alternates short windows: a WiFi slice scans a few
+ * channels (one request each), then a BLE slice listens for a fraction
+ * of a second, and so on. Both halves of the picture fill in together.
+ *
+ * BLE stops early once it goes quiet: after bleMinMs of listening, a run
+ * of slices with no new devices ends it, capped at bleMaxMs (the old
+ * fixed BLE duration). WiFi ends after one pass over the channel mask.
+ * Only the first BLE slice starts a scan; later ones resume it, keeping
+ * the scanner's dedup state (bleListenedMs() > 0 tells them apart).
+ *
+ * Pure policy - VanguardEngine issues the radio requests and reports
+ * results back; tests drive it with a simulated clock.
+ *
+ * @example
+ * ScanCoordinator coord;
+ * coord.start(millis());
+ * // tick:
+ * ScanStep step = coord.next(millis());
+ * if (step.type == ScanSliceType::WIFI) requestWifiScan(step.channel);
+ * if (step.type == ScanSliceType::BLE)  requestBleScan(step.durationMs);
+ * // on results:
+ * coord.wifiStepDone(millis());
+ * coord.bleSliceDone(millis(), newDevices);
+ */
+
+#include "VanguardTypes.h"
+#include "ChannelScheduler.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr uint32_t COORD_WIFI_STEP_TIMEOUT_MS = 2000;  // Lost WiFi completion
+constexpr uint32_t COORD_BLE_GRACE_MS         = 1000;  // Past slice length
+
+/**
+ * @brief What the radio should be doing
+ */
+enum class ScanSliceType : uint8_t {
+    NONE,    // Waiting on an in-flight request
+    WIFI,
+    BLE,
+    DONE
+};
+
+/**
+ * @brief Tunables for interleaving
+ */
+struct ScanSlicePolicy {
+    uint8_t  wifiChannelsPerSlice;  // Channels per WiFi window
+    uint32_t bleSliceMs;            // Length of one BLE window
+    uint32_t bleMinMs;              // Always listen at least this long in total
+    uint32_t bleMaxMs;              // Never listen longer than this in total
+    uint8_t  bleQuietSlices;        // Stop after this many slices with no new device
+
+    static ScanSlicePolicy defaults() {
+        ScanSlicePolicy p = { 3, 800, 3000, 10000, 2 };
+        return p;
+    }
+};
+
+/**
+ * @brief One radio request
+ */
+struct ScanStep {
+    ScanSliceType type;
+    uint8_t       channel;      // WIFI: channel to scan
+    uint32_t      durationMs;   // BLE: window length
+};
+
+// =============================================================================
+// ScanCoordinator Class
+// =============================================================================
+
+class ScanCoordinator {
+public:
+    explicit ScanCoordinator(const ScanSlicePolicy& policy = ScanSlicePolicy::defaults());
+
+    /**
+     * @brief Begin a combined scan
+     * @param channelMask WiFi channels (bit N = channel N, 0 = SCHED_ALL_CHANNELS)
+     * @param wifi Include WiFi
+     * @param ble Include BLE
+     */
+    void start(uint32_t now, uint16_t channelMask = SCHED_ALL_CHANNELS,
+               bool wifi = true, bool ble = true);
+
+    void stop();
+    bool isActive() const { return m_active; }
+
+    /**
+     * @brief Next request to issue
+     *
+     * Returns NONE while a request is in flight, DONE once (then the
+     * coordinator goes inactive). A request whose result never arrives
+     * is written off after a timeout.
+     */
+    ScanStep next(uint32_t now);
+
+    /**
+     * @brief Results for the in-flight WiFi channel have been merged
+     */
+    void wifiStepDone(uint32_t now);
+
+    /**
+     * @brief The in-flight BLE window ended
+     * @param newDevices Devices first seen during the window
+     */
+    void bleSliceDone(uint32_t now, uint16_t newDevices);
+
+    /**
+     * @brief Type of the current/most recent window
+     */
+    ScanSliceType currentSlice() const { return m_slice; }
+
+    bool wifiDone() const { return m_wifiDone; }
+    bool bleDone() const { return m_bleDone; }
+    uint32_t bleListenedMs() const { return m_bleTotalMs; }
+
+    /**
+     * @brief Combined progress, 0-100
+     */
+    uint8_t progress() const;
+
+private:
+    ScanSlicePolicy m_policy;
+
+    uint8_t  m_order[WIFI_CHANNEL_MAX];
+    uint8_t  m_orderLen;
+    uint8_t  m_position;
+
+    ScanSliceType m_slice;
+    uint8_t  m_sliceLeft;          // WiFi channels left in this window
+    bool     m_inFlight;
+    uint32_t m_stepStartMs;
+    uint32_t m_stepDurationMs;
+
+    uint32_t m_bleTotalMs;
+    uint8_t  m_bleQuiet;
+    bool     m_useWifi;
+    bool     m_useBle;
+    bool     m_wifiDone;
+    bool     m_bleDone;
+    bool     m_active;
+
+    ScanStep wifiStep(uint32_t now);
+    ScanStep bleStep(uint32_t now);
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_SCAN_COORDINATOR_H
@@ -0,0 +1,74 @@
+/**
+ * @file ScanIngest.cpp
+ * @brief Scan record buffer and record-to-target mapping
+ */
+
+#include "ScanIngest.h"
+#include <cstring>
+
+namespace Vanguard {
+
+static const char HIDDEN_SSID_LABEL[] = "[Hidden]";
+
+ScanIngest::ScanIngest()
+    : m_count(0)
+{
+    memset(m_records, 0, sizeof(m_records));
+    memset(m_targets, 0, sizeof(m_targets));
+}
+
+void ScanIngest::begin() {
+    m_count = 0;
+}
+
+ApRecord* ScanIngest::slotFor(int8_t rssi) {
+    if (m_count < SCAN_INGEST_MAX) return &m_records[m_count++];
+
+    size_t weakest = 0;
+    for (size_t i = 1; i < m_count; i++) {
+        if (m_records[i].rssi < m_records[weakest].rssi) weakest = i;
+    }
+    return (rssi > m_records[weakest].rssi) ? &m_records[weakest] : nullptr;
+}
+
+const Target* ScanIngest::map(uint32_t now) {
+    for (size_t i = 0; i < m_count; i++) {
+        const ApRecord& rec = m_records[i];
+        Target& t = m_targets[i];
+
+        // Only fields that vary per AP; the rest stay zero from construction
+        memcpy(t.bssid, rec.bssid, 6);
+        t.isHidden = (rec.ssid[0] == '\0');
+        if (t.isHidden) {
+            memcpy(t.ssid, HIDDEN_SSID_LABEL, sizeof(HIDDEN_SSID_LABEL));
+        } else {
+            memcpy(t.ssid, rec.ssid, sizeof(t.ssid));
+            t.ssid[SSID_MAX_LEN] = '\0';
+        }
+
+        t.type = TargetType::ACCESS_POINT;
+        t.channel = rec.channel;
+        t.rssi = rec.rssi;
+        t.security = securityFromAuthMode(rec.authMode);
+        t.firstSeenMs = now;
+        t.lastSeenMs = now;
+        t.beaconCount = 1;
+    }
+    return m_targets;
+}
+
+SecurityType ScanIngest::securityFromAuthMode(uint8_t authMode) {
+    switch (authMode) {
+        case AP_AUTH_OPEN:            return SecurityType::OPEN;
+        case AP_AUTH_WEP:             return SecurityType::WEP;
+        case AP_AUTH_WPA_PSK:         return SecurityType::WPA_PSK;
+        case AP_AUTH_WPA2_PSK:
+        case AP_AUTH_WPA_WPA2_PSK:
+        case AP_AUTH_WPA2_WPA3_PSK:   return SecurityType::WPA2_PSK;   // PSK still attackable
+        case AP_AUTH_WPA2_ENTERPRISE: return SecurityType::WPA2_ENTERPRISE;
+        case AP_AUTH_WPA3_PSK:        return SecurityType::WPA3_SAE;
+        default:                      return SecurityType::UNKNOWN;
+    }
+}
+
+} // namespace Vanguard
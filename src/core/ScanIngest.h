@@ -0,0 +1,105 @@
+#ifndef VANGUARD_SCAN_INGEST_H
+#define VANGUARD_SCAN_INGEST_H
+
+/**
+ * @file ScanIngest.h
+ * @brief Allocation-free bulk path from WiFi scan results to targets
+ *
+ * Scan records are copied once into a preallocated buffer straight from
+ * the driver's AP records (no String, no per-field WiFi.* lookups), then
+ * mapped into a reusable Target array for TargetTable::upsertBatch().
+ * Target fields the mapper never writes (client list, handshake flag)
+ * are zeroed once at construction instead of once per entry.
+ *
+ * When a scan returns more APs than the table can hold, the buffer keeps
+ * the strongest, same as the table's own eviction would.
+ *
+ * @example
+ * ScanIngest ingest;
+ * ingest.begin();
+ * for (each ap) {
+ *     ApRecord* rec = ingest.slotFor(ap.rssi);
+ *     if (rec) fill(rec, ap);
+ * }
+ * table.upsertBatch(ingest.map(millis()), ingest.size());
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t SCAN_INGEST_MAX = MAX_TARGETS;
+
+// Raw auth modes as reported by the driver (wifi_auth_mode_t). Kept as
+// plain numbers so this stays host-testable; BruceWiFi checks they match.
+constexpr uint8_t AP_AUTH_OPEN            = 0;
+constexpr uint8_t AP_AUTH_WEP             = 1;
+constexpr uint8_t AP_AUTH_WPA_PSK         = 2;
+constexpr uint8_t AP_AUTH_WPA2_PSK        = 3;
+constexpr uint8_t AP_AUTH_WPA_WPA2_PSK    = 4;
+constexpr uint8_t AP_AUTH_WPA2_ENTERPRISE = 5;
+constexpr uint8_t AP_AUTH_WPA3_PSK        = 6;
+constexpr uint8_t AP_AUTH_WPA2_WPA3_PSK   = 7;
+
+/**
+ * @brief One AP from a scan, in driver terms
+ */
+struct ApRecord {
+    uint8_t bssid[6];
+    char    ssid[SSID_MAX_LEN + 1];   // Null-terminated, empty if hidden
+    uint8_t channel;
+    int8_t  rssi;
+    uint8_t authMode;                 // AP_AUTH_*
+};
+
+// =============================================================================
+// ScanIngest Class
+// =============================================================================
+
+class ScanIngest {
+public:
+    ScanIngest();
+
+    /**
+     * @brief Start a new batch (keeps the buffers)
+     */
+    void begin();
+
+    /**
+     * @brief Get a record slot for an AP with this signal
+     *
+     * Returns the next free slot, or once full, the weakest held record
+     * if this AP is stronger.
+     *
+     * @return Slot to fill, or nullptr to skip this AP
+     */
+    ApRecord* slotFor(int8_t rssi);
+
+    size_t size() const { return m_count; }
+    const ApRecord& record(size_t i) const { return m_records[i]; }
+
+    /**
+     * @brief Map every record into the target buffer
+     * @param now Timestamp for first/last seen
+     * @return size() targets, valid until the next map()
+     */
+    const Target* map(uint32_t now);
+
+    /**
+     * @brief Map a driver auth mode to our security type
+     */
+    static SecurityType securityFromAuthMode(uint8_t authMode);
+
+private:
+    ApRecord m_records[SCAN_INGEST_MAX];
+    Target   m_targets[SCAN_INGEST_MAX];
+    size_t   m_count;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_SCAN_INGEST_H
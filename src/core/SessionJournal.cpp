@@ -0,0 +1,185 @@
+/**
+ * @file SessionJournal.cpp
+ * @brief Journal record encoding and reading
+ */
+
+#include "SessionJournal.h"
+#include <cstring>
+
+namespace Vanguard {
+
+// Packed target payload
+static const size_t TGT_BSSID    = 0;
+static const size_t TGT_TYPE     = 6;
+static const size_t TGT_CHANNEL  = 7;
+static const size_t TGT_RSSI     = 8;
+static const size_t TGT_SECURITY = 9;
+static const size_t TGT_FLAGS    = 10;
+static const size_t TGT_CLIENTS  = 11;
+static const size_t TGT_SSIDLEN  = 12;
+static const size_t TGT_SSID     = 13;
+
+static const uint8_t FLAG_HIDDEN    = 0x01;
+static const uint8_t FLAG_HANDSHAKE = 0x02;
+
+static void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+SessionJournal::SessionJournal()
+    : m_used(0)
+    , m_dropped(0)
+{
+}
+
+void SessionJournal::begin() {
+    put32(m_buffer, JOURNAL_MAGIC);
+    m_buffer[4] = (uint8_t)JOURNAL_VERSION;
+    m_buffer[5] = (uint8_t)(JOURNAL_VERSION >> 8);
+    m_buffer[6] = 0;
+    m_buffer[7] = 0;
+    m_used = JOURNAL_HEADER_SIZE;
+    m_dropped = 0;
+}
+
+void SessionJournal::append(JournalEvent event, uint32_t now, const uint8_t* payload, uint8_t length) {
+    size_t need = JOURNAL_RECORD_HEAD + length;
+    if (m_used + need > JOURNAL_BUFFER_BYTES) {
+        m_dropped++;
+        return;
+    }
+
+    uint8_t* rec = m_buffer + m_used;
+    rec[0] = length;
+    rec[1] = (uint8_t)event;
+    put32(rec + 2, now);
+    if (length) memcpy(rec + JOURNAL_RECORD_HEAD, payload, length);
+    m_used += need;
+}
+
+// =============================================================================
+// EVENTS
+// =============================================================================
+
+void SessionJournal::targetAdded(uint32_t now, const Target& target) {
+    uint8_t payload[TGT_SSID + SSID_MAX_LEN];
+    append(JournalEvent::TARGET_ADDED, now, payload, encodeTarget(payload, target));
+}
+
+void SessionJournal::targetUpdated(uint32_t now, const Target& target) {
+    uint8_t payload[TGT_SSID + SSID_MAX_LEN];
+    append(JournalEvent::TARGET_UPDATED, now, payload, encodeTarget(payload, target));
+}
+
+void SessionJournal::targetRemoved(uint32_t now, const uint8_t* bssid) {
+    append(JournalEvent::TARGET_REMOVED, now, bssid, 6);
+}
+
+void SessionJournal::association(uint32_t now, const uint8_t* station, const uint8_t* bssid) {
+    uint8_t payload[12];
+    memcpy(payload, station, 6);
+    memcpy(payload + 6, bssid, 6);
+    append(JournalEvent::ASSOCIATION, now, payload, sizeof(payload));
+}
+
+void SessionJournal::scanPhase(uint32_t now, ScanState state, uint8_t progress) {
+    uint8_t payload[2] = { (uint8_t)state, progress };
+    append(JournalEvent::SCAN_PHASE, now, payload, sizeof(payload));
+}
+
+void SessionJournal::actionStart(uint32_t now, ActionType action, const uint8_t* bssid) {
+    uint8_t payload[7];
+    payload[0] = (uint8_t)action;
+    memcpy(payload + 1, bssid, 6);
+    append(JournalEvent::ACTION_START, now, payload, sizeof(payload));
+}
+
+void SessionJournal::actionStop(uint32_t now, ActionResult result) {
+    uint8_t payload = (uint8_t)result;
+    append(JournalEvent::ACTION_STOP, now, &payload, 1);
+}
+
+void SessionJournal::tableCleared(uint32_t now) {
+    append(JournalEvent::TABLE_CLEARED, now, nullptr, 0);
+}
+
+// =============================================================================
+// PAYLOAD CODEC
+// =============================================================================
+
+uint8_t SessionJournal::encodeTarget(uint8_t* out, const Target& target) {
+    uint8_t ssidLen = (uint8_t)strnlen(target.ssid, SSID_MAX_LEN);
+
+    memcpy(out + TGT_BSSID, target.bssid, 6);
+    out[TGT_TYPE] = (uint8_t)target.type;
+    out[TGT_CHANNEL] = target.channel;
+    out[TGT_RSSI] = (uint8_t)target.rssi;
+    out[TGT_SECURITY] = (uint8_t)target.security;
+    out[TGT_FLAGS] = (target.isHidden ? FLAG_HIDDEN : 0) |
+                     (target.hasHandshake ? FLAG_HANDSHAKE : 0);
+    out[TGT_CLIENTS] = target.clientCount;
+    out[TGT_SSIDLEN] = ssidLen;
+    memcpy(out + TGT_SSID, target.ssid, ssidLen);
+    return (uint8_t)(TGT_SSID + ssidLen);
+}
+
+bool SessionJournal::decodeTarget(const uint8_t* payload, uint8_t length, Target& out) {
+    if (length < TGT_SSID) return false;
+    uint8_t ssidLen = payload[TGT_SSIDLEN];
+    if (ssidLen > SSID_MAX_LEN || TGT_SSID + ssidLen > length) return false;
+
+    memset(&out, 0, sizeof(Target));
+    memcpy(out.bssid, payload + TGT_BSSID, 6);
+    out.type = (TargetType)payload[TGT_TYPE];
+    out.channel = payload[TGT_CHANNEL];
+    out.rssi = (int8_t)payload[TGT_RSSI];
+    out.security = (SecurityType)payload[TGT_SECURITY];
+    out.isHidden = (payload[TGT_FLAGS] & FLAG_HIDDEN) != 0;
+    out.hasHandshake = (payload[TGT_FLAGS] & FLAG_HANDSHAKE) != 0;
+    out.clientCount = payload[TGT_CLIENTS];
+    if (out.clientCount > MAX_CLIENTS_PER_AP) out.clientCount = MAX_CLIENTS_PER_AP;
+    memcpy(out.ssid, payload + TGT_SSID, ssidLen);
+    out.ssid[ssidLen] = '\0';
+    return true;
+}
+
+// =============================================================================
+// JournalReader
+// =============================================================================
+
+JournalReader::JournalReader(const uint8_t* data, size_t length)
+    : m_data(data)
+    , m_length(length)
+    , m_offset(JOURNAL_HEADER_SIZE)
+    , m_valid(false)
+{
+    if (length >= JOURNAL_HEADER_SIZE && get32(data) == JOURNAL_MAGIC) {
+        uint16_t version = (uint16_t)(data[4] | (data[5] << 8));
+        m_valid = (version == JOURNAL_VERSION);
+    }
+}
+
+bool JournalReader::next(JournalRecord& record) {
+    if (!m_valid) return false;
+    if (m_offset + JOURNAL_RECORD_HEAD > m_length) return false;
+
+    const uint8_t* rec = m_data + m_offset;
+    size_t need = JOURNAL_RECORD_HEAD + rec[0];
+    if (m_offset + need > m_length) return false;   // Torn final write
+
+    record.length = rec[0];
+    record.event = (JournalEvent)rec[1];
+    record.timestampMs = get32(rec + 2);
+    record.payload = rec + JOURNAL_RECORD_HEAD;
+    m_offset += need;
+    return true;
+}
+
+} // namespace Vanguard
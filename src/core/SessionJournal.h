@@ -0,0 +1,163 @@
+#ifndef VANGUARD_SESSION_JOURNAL_H
+#define VANGUARD_SESSION_JOURNAL_H
+
+/**
+ * @file SessionJournal.h
+ * @brief Append-only binary log of engine events
+ *
+ * Every target add/update/remove, association, scan phase change and
+ * action start/stop is appended as a small length-prefixed record:
+ *
+ *   file:   magic "VGJ1" | version (u16) | reserved (u16)
+ *   record: payload length (u8) | event (u8) | timestamp ms (u32) | payload
+ *
+ * All integers are little-endian. Unknown event types can be skipped by
+ * length, so newer journals still replay on older readers.
+ *
+ * SessionJournal only fills a fixed RAM buffer; the engine drains it to
+ * SD once a second. JournalReader walks a journal image and stops
+ * cleanly at a torn tail. JournalReplay (separate file) applies one to
+ * a TargetTable on the host.
+ *
+ * @example
+ * SessionJournal journal;
+ * journal.begin();
+ * journal.targetAdded(millis(), target);
+ * if (journal.size()) { appendToSd(journal.data(), journal.size()); journal.drain(); }
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr uint32_t JOURNAL_MAGIC         = 0x314A4756;  // "VGJ1" little-endian
+constexpr uint16_t JOURNAL_VERSION       = 1;
+constexpr size_t   JOURNAL_HEADER_SIZE   = 8;
+constexpr size_t   JOURNAL_RECORD_HEAD   = 6;      // len + event + timestamp
+constexpr size_t   JOURNAL_BUFFER_BYTES  = 4096;   // RAM between flushes
+constexpr uint32_t JOURNAL_FLUSH_MS      = 1000;
+
+/**
+ * @brief Journal record types (values are part of the file format)
+ */
+enum class JournalEvent : uint8_t {
+    TARGET_ADDED    = 1,   // Payload: packed target
+    TARGET_UPDATED  = 2,   // Payload: packed target
+    TARGET_REMOVED  = 3,   // Payload: bssid[6]
+    ASSOCIATION     = 4,   // Payload: station[6] bssid[6]
+    SCAN_PHASE      = 5,   // Payload: ScanState, progress
+    ACTION_START    = 6,   // Payload: ActionType, bssid[6]
+    ACTION_STOP     = 7,   // Payload: ActionResult
+    TABLE_CLEARED   = 8    // No payload
+};
+
+/**
+ * @brief One decoded record (payload points into the journal image)
+ */
+struct JournalRecord {
+    JournalEvent   event;
+    uint32_t       timestampMs;
+    const uint8_t* payload;
+    uint8_t        length;
+};
+
+// =============================================================================
+// SessionJournal Class
+// =============================================================================
+
+class SessionJournal {
+public:
+    SessionJournal();
+
+    /**
+     * @brief Start a new journal (the file header goes into the buffer)
+     */
+    void begin();
+
+    void targetAdded(uint32_t now, const Target& target);
+    void targetUpdated(uint32_t now, const Target& target);
+    void targetRemoved(uint32_t now, const uint8_t* bssid);
+    void association(uint32_t now, const uint8_t* station, const uint8_t* bssid);
+    void scanPhase(uint32_t now, ScanState state, uint8_t progress);
+    void actionStart(uint32_t now, ActionType action, const uint8_t* bssid);
+    void actionStop(uint32_t now, ActionResult result);
+    void tableCleared(uint32_t now);
+
+    /**
+     * @brief Bytes waiting to be written
+     */
+    const uint8_t* data() const { return m_buffer; }
+    size_t size() const { return m_used; }
+
+    /**
+     * @brief The buffered bytes have been written out
+     */
+    void drain() { m_used = 0; }
+
+    /**
+     * @brief Buffer is filling up; flush before the next interval
+     */
+    bool wantsFlush() const { return m_used > JOURNAL_BUFFER_BYTES * 3 / 4; }
+
+    /**
+     * @brief Records lost because the buffer was full
+     */
+    uint32_t dropped() const { return m_dropped; }
+
+    // -------------------------------------------------------------------------
+    // Payload codec
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Pack the fields addOrUpdate() cares about
+     * @param out At least 13 + SSID_MAX_LEN bytes
+     * @return Bytes written
+     */
+    static uint8_t encodeTarget(uint8_t* out, const Target& target);
+
+    /**
+     * @brief Unpack a target payload (timestamps left zero)
+     */
+    static bool decodeTarget(const uint8_t* payload, uint8_t length, Target& out);
+
+private:
+    uint8_t  m_buffer[JOURNAL_BUFFER_BYTES];
+    size_t   m_used;
+    uint32_t m_dropped;
+
+    void append(JournalEvent event, uint32_t now, const uint8_t* payload, uint8_t length);
+};
+
+// =============================================================================
+// JournalReader Class
+// =============================================================================
+
+class JournalReader {
+public:
+    JournalReader(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Check the file header
+     */
+    bool valid() const { return m_valid; }
+
+    /**
+     * @brief Next record
+     * @return false at the end, or at a truncated final record
+     */
+    bool next(JournalRecord& record);
+
+private:
+    const uint8_t* m_data;
+    size_t         m_length;
+    size_t         m_offset;
+    bool           m_valid;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_SESSION_JOURNAL_H
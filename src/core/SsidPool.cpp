@@ -0,0 +1,143 @@
+/**
+ * @file SsidPool.cpp
+ * @brief SSID interning with an arena and a hash index
+ */
+
+#include "SsidPool.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Vanguard {
+
+static_assert(SSID_POOL_SLOTS >= SSID_POOL_ENTRIES * 2, "index too small");
+static_assert(SSID_POOL_BYTES <= 0xFFFF && SSID_POOL_ENTRIES < SSID_NONE, "16-bit offsets and ids");
+
+SsidPool::SsidPool() {
+    clear();
+}
+
+// =============================================================================
+// PUBLIC
+// =============================================================================
+
+uint16_t SsidPool::intern(const char* ssid, uint8_t len) {
+    if (len == 0 || len > SSID_MAX_LEN) return SSID_NONE;
+
+    uint16_t id = find(ssid, len);
+    if (id != SSID_NONE) {
+        if (m_entries[id].refs < 0xFFFF) m_entries[id].refs++;
+        return id;
+    }
+
+    if (m_count >= SSID_POOL_ENTRIES) return SSID_NONE;
+    size_t need = (size_t)len + 1;
+    if (m_top + need > SSID_POOL_BYTES) {
+        if (m_live + need > SSID_POOL_BYTES) return SSID_NONE;
+        compactBytes();
+    }
+
+    // New SSIDs are rare next to repeats; a linear search for a free id is fine
+    for (id = 0; m_entries[id].refs != 0; id++) {}
+
+    Entry& e = m_entries[id];
+    e.hash = hashOf(ssid, len);
+    e.offset = (uint16_t)m_top;
+    e.len = len;
+    e.refs = 1;
+    memcpy(m_bytes + m_top, ssid, len);
+    m_bytes[m_top + len] = '\0';
+    m_top += need;
+    m_live += need;
+    m_count++;
+
+    m_index.insert(m_index.slot(e.hash), id);
+    return id;
+}
+
+uint16_t SsidPool::find(const char* ssid, uint8_t len) const {
+    uint32_t h = hashOf(ssid, len);
+    int id = m_index.find(m_index.slot(h), [&](size_t i) {
+        const Entry& e = m_entries[i];
+        return e.hash == h && e.len == len && memcmp(m_bytes + e.offset, ssid, len) == 0;
+    });
+    return (id >= 0) ? (uint16_t)id : SSID_NONE;
+}
+
+void SsidPool::retain(uint16_t id) {
+    if (valid(id) && m_entries[id].refs < 0xFFFF) m_entries[id].refs++;
+}
+
+void SsidPool::release(uint16_t id) {
+    if (!valid(id)) return;
+
+    Entry& e = m_entries[id];
+    if (--e.refs > 0) return;
+
+    m_index.erase(m_index.slot(e.hash), id,
+                  [this](size_t i) { return m_index.slot(m_entries[i].hash); });
+    m_live -= (size_t)e.len + 1;
+    m_count--;
+    if (m_count == 0) m_top = 0;          // Cheap full reset
+}
+
+const char* SsidPool::get(uint16_t id) const {
+    return valid(id) ? m_bytes + m_entries[id].offset : "";
+}
+
+uint8_t SsidPool::length(uint16_t id) const {
+    return valid(id) ? m_entries[id].len : 0;
+}
+
+uint16_t SsidPool::refs(uint16_t id) const {
+    return valid(id) ? m_entries[id].refs : 0;
+}
+
+void SsidPool::clear() {
+    memset(m_entries, 0, sizeof(m_entries));
+    m_index.clear();
+    m_count = 0;
+    m_top = 0;
+    m_live = 0;
+}
+
+// =============================================================================
+// PRIVATE
+// =============================================================================
+
+uint32_t SsidPool::hashOf(const char* ssid, uint8_t len) {
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (uint8_t i = 0; i < len; i++) {
+        h ^= (uint8_t)ssid[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+bool SsidPool::valid(uint16_t id) const {
+    return id < SSID_POOL_ENTRIES && m_entries[id].refs != 0;
+}
+
+void SsidPool::compactBytes() {
+    // Slide live strings down in arena order; ids don't change
+    uint16_t order[SSID_POOL_ENTRIES];
+    size_t n = 0;
+    for (size_t i = 0; i < SSID_POOL_ENTRIES; i++) {
+        if (m_entries[i].refs != 0) order[n++] = (uint16_t)i;
+    }
+    std::sort(order, order + n, [this](uint16_t a, uint16_t b) {
+        return m_entries[a].offset < m_entries[b].offset;
+    });
+
+    size_t top = 0;
+    for (size_t k = 0; k < n; k++) {
+        Entry& e = m_entries[order[k]];
+        size_t size = (size_t)e.len + 1;
+        if (e.offset != top) memmove(m_bytes + top, m_bytes + e.offset, size);
+        e.offset = (uint16_t)top;
+        top += size;
+    }
+    m_top = top;
+}
+
+} // namespace Vanguard
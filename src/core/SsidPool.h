@@ -0,0 +1,104 @@
+#ifndef VANGUARD_SSID_POOL_H
+#define VANGUARD_SSID_POOL_H
+
+/**
+ * @file SsidPool.h
+ * @brief Interned, reference-counted SSID strings
+ *
+ * Probing stations mostly ask for the same handful of networks. Each
+ * distinct SSID is stored once and handed out as a 16-bit id; holders
+ * retain/release it and the bytes are reclaimed when the last one lets
+ * go. A thousand phones probing "eduroam" cost one string plus two
+ * bytes each.
+ *
+ * Fixed-size and allocation-free:
+ *   - entries: offset/length/refcount/hash, addressed by id (stable)
+ *   - bytes: one arena, NUL-terminated strings; freed space is
+ *     reclaimed by sliding live strings down when the arena fills
+ *   - index: open addressing on the hash, backward-shift deletion
+ *
+ * @example
+ * SsidPool pool;
+ * uint16_t id = pool.intern(ssid, len);     // refs = 1
+ * pool.retain(id);                          // refs = 2
+ * Serial.println(pool.get(id));
+ * pool.release(id);
+ */
+
+#include "VanguardTypes.h"
+#include "MacIndex.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t   SSID_POOL_ENTRIES = 256;
+constexpr size_t   SSID_POOL_BYTES   = 4096;     // ~16 bytes per SSID on average
+constexpr size_t   SSID_POOL_SLOTS   = 512;      // Power of two, load <= 0.5
+constexpr uint16_t SSID_NONE         = 0xFFFF;
+
+// =============================================================================
+// SsidPool Class
+// =============================================================================
+
+class SsidPool {
+public:
+    SsidPool();
+
+    /**
+     * @brief Look up or add an SSID, taking a reference
+     * @param len 1..SSID_MAX_LEN bytes (need not be NUL-terminated)
+     * @return Id, or SSID_NONE if the pool is full or len is out of range
+     */
+    uint16_t intern(const char* ssid, uint8_t len);
+
+    /**
+     * @brief Look up without taking a reference
+     */
+    uint16_t find(const char* ssid, uint8_t len) const;
+
+    void retain(uint16_t id);
+    void release(uint16_t id);
+
+    /**
+     * @brief NUL-terminated SSID; valid until the next intern()
+     */
+    const char* get(uint16_t id) const;
+    uint8_t     length(uint16_t id) const;
+    uint16_t    refs(uint16_t id) const;
+
+    void clear();
+
+    size_t count() const { return m_count; }
+
+    /**
+     * @brief Arena bytes held by live strings (including terminators)
+     */
+    size_t bytesUsed() const { return m_live; }
+
+private:
+    struct Entry {
+        uint32_t hash;
+        uint16_t offset;
+        uint16_t refs;          // 0 = free
+        uint8_t  len;
+    };
+
+    Entry    m_entries[SSID_POOL_ENTRIES];
+    char     m_bytes[SSID_POOL_BYTES];
+    MacIndex<SSID_POOL_SLOTS> m_index;      // Keyed by hash, not MAC
+    size_t   m_count;
+    size_t   m_top;                          // Arena high-water mark
+    size_t   m_live;
+
+    static uint32_t hashOf(const char* ssid, uint8_t len);
+
+    bool valid(uint16_t id) const;
+    void compactBytes();
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_SSID_POOL_H
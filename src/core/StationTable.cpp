@@ -0,0 +1,224 @@
+/**
+ * @file StationTable.cpp
+ * @brief Station storage with MAC and per-AP indexes
+ */
+
+#include "StationTable.h"
+#include <cstring>
+
+namespace Vanguard {
+
+static_assert(STATION_INDEX_SLOTS >= MAX_STATIONS * 2, "index too small");
+static_assert(MAX_STATIONS < 0x7FFF, "chain links are int16_t");
+
+static const size_t SLOT_MASK = STATION_INDEX_SLOTS - 1;
+
+static bool isZeroMac(const uint8_t* mac) {
+    for (int i = 0; i < 6; i++) if (mac[i]) return false;
+    return true;
+}
+
+StationTable::StationTable()
+    : m_count(0)
+    , m_evictions(0)
+{
+    clear();
+}
+
+// =============================================================================
+// PUBLIC
+// =============================================================================
+
+bool StationTable::observe(const uint8_t* mac, const uint8_t* bssid, int8_t rssi,
+                           uint8_t channel, uint32_t now) {
+    if (bssid && (isZeroMac(bssid) || memcmp(bssid, mac, 6) == 0)) bssid = nullptr;
+
+    bool changed = false;
+    int idx = indexOf(mac);
+
+    if (idx < 0) {
+        if (m_count >= MAX_STATIONS) evictOldest();
+
+        idx = (int)m_count++;
+        Station& s = m_stations[idx];
+        memset(&s, 0, sizeof(Station));
+        memcpy(s.mac, mac, 6);
+        s.firstSeenMs = now;
+        s.prevInAp = -1;
+        s.nextInAp = -1;
+        m_index.insert(idx, mac);
+        changed = true;
+    }
+
+    Station& s = m_stations[idx];
+    s.lastSeenMs = now;
+    s.frameCount++;
+    if (rssi != 0) s.rssi = rssi;
+    if (channel != 0) s.channel = channel;
+
+    if (bssid && memcmp(s.bssid, bssid, 6) != 0) {
+        unlink(idx);                     // Roamed
+        memcpy(s.bssid, bssid, 6);
+        link(idx);
+        changed = true;
+    }
+    return changed;
+}
+
+const Station* StationTable::find(const uint8_t* mac) const {
+    int idx = indexOf(mac);
+    return (idx >= 0) ? &m_stations[idx] : nullptr;
+}
+
+size_t StationTable::clientCount(const uint8_t* bssid) const {
+    int slot = apSlot(bssid);
+    return (slot >= 0) ? m_aps[slot].clients : 0;
+}
+
+size_t StationTable::clientsOf(const uint8_t* bssid, const Station** out, size_t max) const {
+    int slot = apSlot(bssid);
+    if (slot < 0) return 0;
+
+    size_t n = 0;
+    for (int16_t i = m_aps[slot].head; i >= 0 && n < max; i = m_stations[i].nextInAp) {
+        out[n++] = &m_stations[i];
+    }
+    return n;
+}
+
+bool StationTable::remove(const uint8_t* mac) {
+    int idx = indexOf(mac);
+    if (idx < 0) return false;
+    removeAt(idx);
+    return true;
+}
+
+size_t StationTable::pruneStale(uint32_t now, uint32_t maxAgeMs) {
+    size_t removed = 0;
+    size_t i = 0;
+    while (i < m_count) {
+        if (now - m_stations[i].lastSeenMs > maxAgeMs) {
+            removeAt(i);            // Last entry moves into i; look again
+            removed++;
+        } else {
+            i++;
+        }
+    }
+    return removed;
+}
+
+void StationTable::clear() {
+    m_count = 0;
+    m_index.clear();
+    memset(m_aps, 0, sizeof(m_aps));
+}
+
+// =============================================================================
+// MAC INDEX
+// =============================================================================
+
+int StationTable::indexOf(const uint8_t* mac) const {
+    return m_index.find(mac, [this](size_t e) { return m_stations[e].mac; });
+}
+
+// =============================================================================
+// AP INDEX
+// =============================================================================
+
+int StationTable::apSlot(const uint8_t* bssid) const {
+    for (size_t i = m_index.home(bssid); m_aps[i].clients != 0; i = (i + 1) & SLOT_MASK) {
+        if (memcmp(m_aps[i].bssid, bssid, 6) == 0) return (int)i;
+    }
+    return -1;
+}
+
+void StationTable::apErase(size_t hole) {
+    size_t j = hole;
+    while (true) {
+        j = (j + 1) & SLOT_MASK;
+        if (m_aps[j].clients == 0) break;
+        if (canBackShift(hole, j, m_index.home(m_aps[j].bssid))) {
+            m_aps[hole] = m_aps[j];
+            hole = j;
+        }
+    }
+    memset(&m_aps[hole], 0, sizeof(ApHead));
+}
+
+// =============================================================================
+// CLIENT CHAINS
+// =============================================================================
+
+void StationTable::link(size_t entry) {
+    Station& s = m_stations[entry];
+    if (!s.hasAp()) return;
+
+    int found = apSlot(s.bssid);
+    size_t slot;
+    if (found >= 0) {
+        slot = (size_t)found;
+    } else {
+        slot = m_index.home(s.bssid);
+        while (m_aps[slot].clients != 0) slot = (slot + 1) & SLOT_MASK;
+        memcpy(m_aps[slot].bssid, s.bssid, 6);
+        m_aps[slot].head = -1;
+    }
+
+    ApHead& ap = m_aps[slot];
+    s.prevInAp = -1;
+    s.nextInAp = ap.head;
+    if (ap.head >= 0) m_stations[ap.head].prevInAp = (int16_t)entry;
+    ap.head = (int16_t)entry;
+    ap.clients++;
+}
+
+void StationTable::unlink(size_t entry) {
+    Station& s = m_stations[entry];
+    if (!s.hasAp()) return;
+
+    int slot = apSlot(s.bssid);
+    if (slot < 0) return;
+
+    if (s.prevInAp >= 0) m_stations[s.prevInAp].nextInAp = s.nextInAp;
+    else                 m_aps[slot].head = s.nextInAp;
+    if (s.nextInAp >= 0) m_stations[s.nextInAp].prevInAp = s.prevInAp;
+
+    s.prevInAp = -1;
+    s.nextInAp = -1;
+    if (--m_aps[slot].clients == 0) apErase(slot);
+}
+
+void StationTable::removeAt(size_t entry) {
+    unlink(entry);
+    m_index.erase(entry, [this](size_t e) { return m_stations[e].mac; });
+
+    size_t last = m_count - 1;
+    if (entry != last) {
+        // Move the last station into the hole and fix everything pointing at it
+        m_stations[entry] = m_stations[last];
+        Station& moved = m_stations[entry];
+        m_index.repoint(moved.mac, last, entry);
+
+        if (moved.prevInAp >= 0) {
+            m_stations[moved.prevInAp].nextInAp = (int16_t)entry;
+        } else if (moved.hasAp()) {
+            int slot = apSlot(moved.bssid);
+            if (slot >= 0) m_aps[slot].head = (int16_t)entry;
+        }
+        if (moved.nextInAp >= 0) m_stations[moved.nextInAp].prevInAp = (int16_t)entry;
+    }
+    m_count--;
+}
+
+void StationTable::evictOldest() {
+    if (m_count == 0) return;
+
+    size_t oldest = 0;
+    for (size_t i = 1; i < m_count; i++) {
+        if ((int32_t)(m_stations[i].lastSeenMs - m_stations[oldest].lastSeenMs) < 0) oldest = i;
+    }
+    removeAt(oldest);
+    m_evictions++;
+}
+
+} // namespace Vanguard
@@ -0,0 +1,141 @@
+#ifndef VANGUARD_STATION_TABLE_H
+#define VANGUARD_STATION_TABLE_H
+
+/**
+ * @file StationTable.h
+ * @brief WiFi client stations, indexed by MAC and by AP
+ *
+ * Every station heard in a data frame gets its own entry: last seen,
+ * RSSI (when the station itself transmitted), frame count, and the AP
+ * it was last seen with. Unlike Target::clientMacs there is no per-AP
+ * cap; the only limit is MAX_STATIONS overall, after which the station
+ * heard least recently is evicted.
+ *
+ * Storage is fixed-size and allocation-free:
+ *   - stations live packed in one array (removal swaps the last one in)
+ *   - an open-addressing index maps station MAC -> entry
+ *   - a second one maps AP BSSID -> head of that AP's client chain,
+ *     threaded through the entries (prev/next), with a client count
+ *
+ * Lookup by MAC and per-AP client counts are O(1); listing an AP's
+ * clients is O(clients).
+ *
+ * @example
+ * StationTable stations;
+ * stations.observe(clientMac, bssid, rssi, channel, millis());
+ * const Station* list[8];
+ * size_t n = stations.clientsOf(bssid, list, 8);
+ */
+
+#include "VanguardTypes.h"
+#include "MacIndex.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t   MAX_STATIONS            = 256;
+constexpr size_t   STATION_INDEX_SLOTS     = 512;      // Power of two, load <= 0.5
+constexpr uint32_t STATION_AGE_TIMEOUT_MS  = 120000;   // Clients doze; give them longer than APs
+
+/**
+ * @brief One client station
+ */
+struct Station {
+    uint8_t  mac[6];
+    uint8_t  bssid[6];          // AP last seen with; all zero if none
+    int8_t   rssi;              // 0 until heard transmitting
+    uint8_t  channel;
+    uint32_t firstSeenMs;
+    uint32_t lastSeenMs;
+    uint32_t frameCount;
+    int16_t  prevInAp;          // Client chain of bssid's AP, -1 at the ends
+    int16_t  nextInAp;
+
+    bool hasAp() const {
+        for (int i = 0; i < 6; i++) if (bssid[i]) return true;
+        return false;
+    }
+};
+
+// =============================================================================
+// StationTable Class
+// =============================================================================
+
+class StationTable {
+public:
+    StationTable();
+
+    /**
+     * @brief A frame to or from a station was seen
+     * @param bssid AP it was talking to, or nullptr to leave unchanged
+     * @param rssi 0 if the station wasn't the transmitter
+     * @param channel 0 if unknown
+     * @return true if this station is new, or new to this AP
+     */
+    bool observe(const uint8_t* mac, const uint8_t* bssid, int8_t rssi,
+                 uint8_t channel, uint32_t now);
+
+    const Station* find(const uint8_t* mac) const;
+
+    /**
+     * @brief Clients currently attributed to an AP
+     */
+    size_t clientCount(const uint8_t* bssid) const;
+
+    /**
+     * @brief List an AP's clients, most recently joined first
+     * @return Number written to out
+     */
+    size_t clientsOf(const uint8_t* bssid, const Station** out, size_t max) const;
+
+    bool remove(const uint8_t* mac);
+
+    /**
+     * @brief Drop stations not heard for maxAgeMs
+     * @return Number removed
+     */
+    size_t pruneStale(uint32_t now, uint32_t maxAgeMs = STATION_AGE_TIMEOUT_MS);
+
+    void clear();
+
+    /**
+     * @brief All stations, packed (order changes on removal)
+     */
+    const Station* data() const { return m_stations; }
+    size_t count() const { return m_count; }
+
+    /**
+     * @brief Stations dropped to make room
+     */
+    uint32_t evictions() const { return m_evictions; }
+
+private:
+    struct ApHead {
+        uint8_t  bssid[6];
+        int16_t  head;
+        uint16_t clients;       // 0 = empty slot
+    };
+
+    Station  m_stations[MAX_STATIONS];
+    size_t   m_count;
+    MacIndex<STATION_INDEX_SLOTS> m_index;
+    ApHead   m_aps[STATION_INDEX_SLOTS];    // Probed the same way, keyed by BSSID
+    uint32_t m_evictions;
+
+    int  indexOf(const uint8_t* mac) const;
+
+    int  apSlot(const uint8_t* bssid) const;
+    void apErase(size_t slot);
+
+    void link(size_t entry);
+    void unlink(size_t entry);
+    void removeAt(size_t entry);
+    void evictOldest();
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_STATION_TABLE_H
@@ -1,5 +1,7 @@
 #include "SystemTask.h"
 #include "RadioWarden.h"
+#include "SDManager.h"
+#include "CaptureStats.h"
 #include "../adapters/BruceWiFi.h"
 #include "../adapters/BruceBLE.h"
 #include "../adapters/BruceIR.h"
@@ -21,11 +23,11 @@ SystemTask::SystemTask() :
     m_lastProgressTime(0)
 {
     // Create Queues
-    // Request Queue: UI -> System (Capacity 10)
-    m_reqQueue = xQueueCreate(10, sizeof(SystemRequest));
+    // Request Queue: UI -> System
+    m_reqQueue = xQueueCreate(SYSTEM_REQUEST_QUEUE_LEN, sizeof(SystemRequest));
     
-    // Event Queue: System -> UI (Capacity 20 - events can be bursty)
-    m_evtQueue = xQueueCreate(20, sizeof(SystemEvent));
+    // Event Queue: System -> UI
+    m_evtQueue = xQueueCreate(SYSTEM_EVENT_QUEUE_LEN, sizeof(SystemEvent));
 }
 
 void SystemTask::start() {
@@ -81,6 +83,12 @@ void SystemTask::run() {
         
         // IR Tick
         BruceIR::getInstance().tick();
+
+        // Capture pipeline health (1 Hz while logging)
+        CaptureStatsSnapshot captureStats;
+        if (BruceWiFi::getInstance().pollCaptureStats(captureStats)) {
+            publishCaptureStats(captureStats);
+        }
         
         // 3. Monitor Status changes and emit events
         if (m_actionActive) {
@@ -114,7 +122,7 @@ void SystemTask::run() {
                  finalProg->result = result;
                  finalProg->packetsSent = BruceWiFi::getInstance().getPacketsSent();
                  finalProg->statusText = statusText;
-                 sendEvent(SysEventType::ACTION_PROGRESS, finalProg, sizeof(ActionProgress), true);
+                 sendOwned(SysEventType::ACTION_PROGRESS, finalProg);
              } else if (now - m_lastProgressTime > 500) {
                   // Send progress update
                   ActionProgress* prog = new ActionProgress();
@@ -140,7 +148,7 @@ void SystemTask::run() {
                   }
                   
                   prog->startTimeMs = m_actionStartTime;
-                  sendEvent(SysEventType::ACTION_PROGRESS, prog, sizeof(ActionProgress), true);
+                  sendOwned(SysEventType::ACTION_PROGRESS, prog);
                   m_lastProgressTime = now;
              }
         }
@@ -150,6 +158,21 @@ void SystemTask::run() {
     }
 }
 
+void SystemTask::publishCaptureStats(const CaptureStatsSnapshot& stats) {
+    sendOwned(SysEventType::CAPTURE_STATS, new CaptureStatsSnapshot(stats));
+
+    SDManager& sd = SDManager::getInstance();
+    if (!sd.isAvailable()) return;
+
+    char line[256];
+    if (!sd.fileExists(CAPTURE_STATS_LOG)) {
+        CaptureStats::formatCsvHeader(line, sizeof(line));
+        sd.appendToFile(CAPTURE_STATS_LOG, line);
+    }
+    CaptureStats::formatCsv(stats, line, sizeof(line));
+    sd.appendToFile(CAPTURE_STATS_LOG, line);
+}
+
 bool SystemTask::sendRequest(const SystemRequest& req) {
     if (!m_running) return false;
     return xQueueSend(m_reqQueue, &req, 0) == pdTRUE;
@@ -160,14 +183,15 @@ bool SystemTask::receiveEvent(SystemEvent& evt) {
     return xQueueReceive(m_evtQueue, &evt, 0) == pdTRUE;
 }
 
-void SystemTask::sendEvent(SysEventType type, void* data, size_t len, bool isPtr) {
+bool SystemTask::sendEvent(SysEventType type, void* data, size_t len, bool isPtr) {
     SystemEvent evt;
     evt.type = type;
     evt.data = data;
     evt.dataLen = len;
     evt.isPointer = isPtr;
     
-    xQueueSend(m_evtQueue, &evt, 0);
+    // Zero timeout: a full queue drops the event, never stalls the radios
+    return xQueueSend(m_evtQueue, &evt, 0) == pdTRUE;
 }
 
 // =============================================================================
@@ -177,26 +201,43 @@ void SystemTask::sendEvent(SysEventType type, void* data, size_t len, bool isPtr
 void SystemTask::handleRequest(const SystemRequest& req) {
     switch (req.cmd) {
         case SysCommand::WIFI_SCAN_START:
-            handleWiFiScanStart();
+            handleWiFiScanStart((uint8_t)((uintptr_t)req.payload));
             break;
         case SysCommand::WIFI_SCAN_STOP:
             handleWiFiScanStop();
             break;
+        case SysCommand::WIFI_PASSIVE_START:
+            handleWiFiPassiveStart((uint8_t)((uintptr_t)req.payload));
+            break;
+        case SysCommand::WIFI_PASSIVE_STOP:
+            handleWiFiPassiveStop();
+            break;
         case SysCommand::BLE_SCAN_START:
             {
                uint32_t duration = (uint32_t)((uintptr_t)req.payload);
-               handleBleScanStart(duration);
+               handleBleScanStart(duration, false);
             }
             break;
+        case SysCommand::BLE_SCAN_RESUME:
+            handleBleScanStart((uint32_t)((uintptr_t)req.payload), true);
+            break;
         case SysCommand::BLE_SCAN_STOP:
             handleBleScanStop();
             break;
+        case SysCommand::BLE_SET_PROFILE:
+            BruceBLE::getInstance().setScanProfile((BLEScanProfileId)((uintptr_t)req.payload));
+            break;
         case SysCommand::ACTION_START:
             handleActionStart((ActionRequest*)req.payload);
             break;
         case SysCommand::ACTION_STOP:
             handleActionStop();
             break;
+        case SysCommand::RADIO_COEX_START:
+            if (!RadioWarden::getInstance().requestRadio(RadioOwner::OWNER_COEX)) {
+                if (Serial) Serial.println("[System] Coex radio init failed");
+            }
+            break;
         case SysCommand::SYSTEM_SHUTDOWN:
             RadioWarden::getInstance().releaseRadio();
             break;
@@ -205,23 +246,31 @@ void SystemTask::handleRequest(const SystemRequest& req) {
     }
 }
 
-void SystemTask::handleWiFiScanStart() {
-    if (Serial) Serial.println("[System] Starting WiFi Scan...");
+void SystemTask::handleWiFiScanStart(uint8_t channel) {
+    if (Serial) Serial.printf("[System] Starting WiFi Scan (ch %u)...\n", channel);
     
-    // Wire up callback to send event back to UI
-    BruceWiFi::getInstance().onScanComplete([this](int count) {
-        sendEvent(SysEventType::WIFI_SCAN_COMPLETE, (void*)(intptr_t)count, 0, false);
+    // Wire up callback to send event back to UI. The channel tags the
+    // result: a new scan replaces this callback, so a late completion still
+    // names the channel it was for.
+    BruceWiFi::getInstance().onScanComplete([this, channel](int count) {
+        ScanCompleteEvent* evt = new ScanCompleteEvent();
+        evt->count = count;
+        evt->channel = channel;
+        sendOwned(SysEventType::WIFI_SCAN_COMPLETE, evt);
     });
     
     // Wire up Association callback
-    BruceWiFi::getInstance().onAssociation([this](const uint8_t* client, const uint8_t* bssid) {
+    BruceWiFi::getInstance().onAssociation([this](const uint8_t* client, const uint8_t* bssid,
+                                                int8_t rssi, uint8_t channel) {
         AssociationEvent* evt = new AssociationEvent();
         memcpy(evt->bssid, bssid, 6);
         memcpy(evt->station, client, 6);
-        sendEvent(SysEventType::ASSOCIATION_FOUND, evt, sizeof(AssociationEvent), true);
+        evt->rssi = rssi;
+        evt->channel = channel;
+        sendOwned(SysEventType::ASSOCIATION_FOUND, evt);
     });
     
-    BruceWiFi::getInstance().beginScan();
+    BruceWiFi::getInstance().beginScan(channel);
     sendEvent(SysEventType::WIFI_SCAN_STARTED);
 }
 
@@ -229,19 +278,69 @@ void SystemTask::handleWiFiScanStop() {
     BruceWiFi::getInstance().stopScan();
 }
 
-void SystemTask::handleBleScanStart(uint32_t duration) {
-    if (Serial) Serial.printf("[System] Starting BLE Scan (%ums)...\n", duration);
+void SystemTask::handleWiFiPassiveStart(uint8_t channel) {
+    if (Serial) Serial.printf("[System] Starting passive discovery (ch %u)...\n", channel);
+
+    BruceWiFi& wifi = BruceWiFi::getInstance();
+
+    // Runs in the promiscuous callback; BeaconThrottle keeps this to ~1/s per AP
+    wifi.onApObserved([this](const BeaconInfo& info) {
+        BeaconInfo* copy = new BeaconInfo(info);
+        sendOwned(SysEventType::AP_OBSERVED, copy);
+    });
+
+    // ProbeThrottle: once per station + SSID per sweep
+    wifi.onProbeRequest([this](const ProbeInfo& info) {
+        ProbeInfo* copy = new ProbeInfo(info);
+        sendOwned(SysEventType::PROBE_OBSERVED, copy);
+    });
+
+    wifi.onAssociation([this](const uint8_t* client, const uint8_t* bssid,
+                              int8_t rssi, uint8_t channel) {
+        AssociationEvent* evt = new AssociationEvent();
+        memcpy(evt->bssid, bssid, 6);
+        memcpy(evt->station, client, 6);
+        evt->rssi = rssi;
+        evt->channel = channel;
+        sendOwned(SysEventType::ASSOCIATION_FOUND, evt);
+    });
+
+    if (!wifi.beginPassiveDiscovery(channel)) {
+        if (Serial) Serial.println("[System] Passive discovery failed to start");
+    }
+}
+
+void SystemTask::handleWiFiPassiveStop() {
+    BruceWiFi::getInstance().stopMonitor();
+}
+
+void SystemTask::handleBleScanStart(uint32_t duration, bool resume) {
+    if (Serial) Serial.printf("[System] %s BLE Scan (%ums)...\n", resume ? "Resuming" : "Starting", duration);
     
     BruceBLE::getInstance().onDeviceFound([this](const BLEDeviceInfo& device) {
         BLEDeviceInfo* copy = new BLEDeviceInfo(device);
-        sendEvent(SysEventType::BLE_DEVICE_FOUND, copy, sizeof(BLEDeviceInfo), true);
+        sendOwned(SysEventType::BLE_DEVICE_FOUND, copy);
     });
     
+    BruceBLE::getInstance().onBeaconSeen([this](const BLEBeaconInfo& beacon) {
+        BLEBeaconInfo* copy = new BLEBeaconInfo(beacon);
+        sendOwned(SysEventType::BLE_BEACON_SEEN, copy);
+    });
+
+    BruceBLE::getInstance().onTrackerAlert([this](const TrackerAlert& alert) {
+        TrackerAlert* copy = new TrackerAlert(alert);
+        sendOwned(SysEventType::BLE_TRACKER_ALERT, copy);
+    });
+
     BruceBLE::getInstance().onScanComplete([this](int count) {
         sendEvent(SysEventType::BLE_SCAN_COMPLETE, (void*)(intptr_t)count, 0, false);
     });
     
-    BruceBLE::getInstance().beginScan(duration);
+    if (resume) {
+        BruceBLE::getInstance().resumeScan(duration);
+    } else {
+        BruceBLE::getInstance().beginScan(duration);
+    }
     sendEvent(SysEventType::BLE_SCAN_STARTED);
 }
 
@@ -288,14 +387,17 @@ void SystemTask::handleActionStart(ActionRequest* req) {
 
         case ActionType::CAPTURE_HANDSHAKE:
              if (wifi.init()) {
-                 // 1. Start Capture (BruceWiFi handles PCAP internally if captureHandshake is called)
-                 // But we want to ensure it's logged to our specific filename
-                 char filename[64];
-                 snprintf(filename, sizeof(filename), "/captures/hs_%02X%02X%02X.pcap", 
-                          t.bssid[3], t.bssid[4], t.bssid[5]);
-                 wifi.setPcapLogging(true, filename);
-                 
                  success = wifi.captureHandshake(t.bssid, t.channel, true);
+
+                 // Start logging after captureHandshake(): it resets hardware
+                 // activities, which closes any open capture. Files rotate as
+                 // /captures/<session>_<seq>_hs_XXXXXX.pcap
+                 if (success) {
+                     char tag[16];
+                     snprintf(tag, sizeof(tag), "hs_%02X%02X%02X",
+                              t.bssid[3], t.bssid[4], t.bssid[5]);
+                     wifi.setPcapLogging(true, tag);
+                 }
              }
              break;
 
@@ -9,6 +9,8 @@
 
 namespace Vanguard {
 
+struct CaptureStatsSnapshot;
+
 /**
  * @brief Manages the Background System Task (Core 0)
  * 
@@ -54,15 +56,28 @@ private:
     
     // Handlers
     void handleRequest(const SystemRequest& req);
-    void handleWiFiScanStart();
+    void handleWiFiScanStart(uint8_t channel);
     void handleWiFiScanStop();
-    void handleBleScanStart(uint32_t duration);
+    void handleWiFiPassiveStart(uint8_t channel);
+    void handleWiFiPassiveStop();
+    void handleBleScanStart(uint32_t duration, bool resume);
     void handleBleScanStop();
     void handleActionStart(ActionRequest* req);
     void handleActionStop();
+    void publishCaptureStats(const CaptureStatsSnapshot& stats);
     
     // Helpers
-    void sendEvent(SysEventType type, void* data = nullptr, size_t len = 0, bool isPtr = false);
+    bool sendEvent(SysEventType type, void* data = nullptr, size_t len = 0, bool isPtr = false);
+
+    /**
+     * @brief Send a heap payload; frees it if the queue is full
+     */
+    template <typename T>
+    bool sendOwned(SysEventType type, T* payload) {
+        if (sendEvent(type, payload, sizeof(T), true)) return true;
+        delete payload;
+        return false;
+    }
     
     // State
     bool m_running;
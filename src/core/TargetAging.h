@@ -0,0 +1,70 @@
+#ifndef VANGUARD_TARGET_AGING_H
+#define VANGUARD_TARGET_AGING_H
+
+/**
+ * @file TargetAging.h
+ * @brief How long each kind of target is kept after it was last heard
+ *
+ * One flat timeout fits nothing well. A phone on a random address drops
+ * it every few minutes and never comes back under it, so its entry is
+ * dead weight soon after it goes quiet; a public-address device or a
+ * beacon will be heard again; an AP is fixed infrastructure that a
+ * rolling scan may take a while to revisit. Virtual targets (IR, RF
+ * remotes) are never heard at all and must not expire.
+ *
+ * The same policy drives the adapter's BLERegistry (age since the last
+ * advert) and TargetTable (age since the last report), so the two agree
+ * on what counts as gone. BLE ages must stay longer than the gap between
+ * scans: the table only hears about a device when a scan reports it.
+ *
+ * @example
+ * AgingPolicy policy = AgingPolicy::defaults();
+ * table.age(millis(), policy);
+ * registry.pruneStale(millis(), policy);
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/**
+ * @brief Maximum age per target kind, in ms; 0 = never expires
+ */
+struct AgingPolicy {
+    uint32_t accessPointMs;
+    uint32_t stationMs;
+    uint32_t bleRandomMs;       // Resolvable/non-resolvable private or static random
+    uint32_t blePublicMs;
+    uint32_t bleBeaconMs;       // Keyed by beacon identity, not address
+    uint32_t otherMs;           // RF, IR and virtual targets
+
+    static AgingPolicy defaults() {
+        AgingPolicy p = { 300000, 120000, 45000, 180000, 120000, 0 };
+        return p;
+    }
+};
+
+// =============================================================================
+// LOOKUP
+// =============================================================================
+
+/**
+ * @brief Maximum age for one target under a policy, 0 = never expires
+ */
+inline uint32_t agingTimeoutMs(const AgingPolicy& policy, TargetType type, bool randomAddress) {
+    switch (type) {
+        case TargetType::ACCESS_POINT: return policy.accessPointMs;
+        case TargetType::STATION:      return policy.stationMs;
+        case TargetType::BLE_DEVICE:   return randomAddress ? policy.bleRandomMs : policy.blePublicMs;
+        case TargetType::BLE_BEACON:   return policy.bleBeaconMs;
+        default:                       return policy.otherMs;
+    }
+}
+
+} // namespace Vanguard
+
+#endif // VANGUARD_TARGET_AGING_H
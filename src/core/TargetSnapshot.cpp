@@ -0,0 +1,193 @@
+/**
+ * @file TargetSnapshot.cpp
+ * @brief Target snapshot encoding and decoding
+ */
+
+#include "TargetSnapshot.h"
+#include <cstring>
+#include <cstdio>
+
+namespace Vanguard {
+
+// Record layout (offsets into the 148-byte record)
+static const size_t REC_BSSID    = 0;
+static const size_t REC_SSID     = 6;     // SSID_MAX_LEN + 1, zero padded
+static const size_t REC_TYPE     = 39;
+static const size_t REC_CHANNEL  = 40;
+static const size_t REC_RSSI     = 41;
+static const size_t REC_SECURITY = 42;
+static const size_t REC_CLIENTS  = 43;
+static const size_t REC_FLAGS    = 44;    // 45 is padding
+static const size_t REC_BEACONS  = 46;
+static const size_t REC_LASTSEEN = 48;
+static const size_t REC_MACS     = 52;    // MAX_CLIENTS_PER_AP * 6
+
+static const uint8_t FLAG_HIDDEN    = 0x01;
+static const uint8_t FLAG_HANDSHAKE = 0x02;
+static const uint8_t FLAG_RANDOM    = 0x04;   // BLE random address
+
+static_assert(REC_MACS + MAX_CLIENTS_PER_AP * 6 == SNAPSHOT_RECORD_SIZE,
+              "snapshot record layout out of sync");
+
+static void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc) {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+TargetSnapshot::TargetSnapshot()
+    : m_committed(0)
+{
+    memset(m_slotCrc, 0, sizeof(m_slotCrc));
+    memset(m_pendingCrc, 0, sizeof(m_pendingCrc));
+}
+
+bool TargetSnapshot::shouldPersist(const Target& target) {
+    static const uint8_t ZERO[6] = {0};
+    return memcmp(target.bssid, ZERO, 6) != 0;
+}
+
+// =============================================================================
+// ENCODING
+// =============================================================================
+
+bool TargetSnapshot::encodeSlot(size_t index, const Target& target, uint8_t* out) {
+    memset(out, 0, SNAPSHOT_SLOT_SIZE);
+
+    memcpy(out + REC_BSSID, target.bssid, 6);
+    memcpy(out + REC_SSID, target.ssid, strnlen(target.ssid, SSID_MAX_LEN));
+    out[REC_TYPE] = (uint8_t)target.type;
+    out[REC_CHANNEL] = target.channel;
+    out[REC_RSSI] = (uint8_t)target.rssi;
+    out[REC_SECURITY] = (uint8_t)target.security;
+
+    uint8_t clients = target.clientCount;
+    if (clients > MAX_CLIENTS_PER_AP) clients = MAX_CLIENTS_PER_AP;
+    out[REC_CLIENTS] = clients;
+    memcpy(out + REC_MACS, target.clientMacs, (size_t)clients * 6);
+
+    out[REC_FLAGS] = (target.isHidden ? FLAG_HIDDEN : 0) |
+                     (target.hasHandshake ? FLAG_HANDSHAKE : 0) |
+                     (target.isRandomAddress ? FLAG_RANDOM : 0);
+    put16(out + REC_BEACONS, target.beaconCount);
+    put32(out + REC_LASTSEEN, target.lastSeenMs);
+
+    uint32_t crc = crc32(out, SNAPSHOT_RECORD_SIZE);
+    put32(out + SNAPSHOT_RECORD_SIZE, crc);
+
+    if (index >= MAX_TARGETS) return true;
+    m_pendingCrc[index] = crc;
+    return index >= m_committed || m_slotCrc[index] != crc;
+}
+
+void TargetSnapshot::encodeHeader(uint8_t* out, uint16_t count, uint32_t savedAtMs) {
+    put32(out, SNAPSHOT_MAGIC);
+    put16(out + 4, SNAPSHOT_VERSION);
+    put16(out + 6, (uint16_t)SNAPSHOT_RECORD_SIZE);
+    put16(out + 8, count);
+    put16(out + 10, 0);
+    put32(out + 12, savedAtMs);
+    put32(out + 16, crc32(out, 16));
+}
+
+void TargetSnapshot::commit(size_t count) {
+    if (count > MAX_TARGETS) count = MAX_TARGETS;
+    memcpy(m_slotCrc, m_pendingCrc, count * sizeof(uint32_t));
+    m_committed = count;
+}
+
+void TargetSnapshot::invalidate() {
+    m_committed = 0;
+}
+
+// =============================================================================
+// DECODING
+// =============================================================================
+
+size_t TargetSnapshot::decode(const uint8_t* data, size_t len, Target* out, size_t maxOut,
+                              uint32_t now) {
+    if (len < SNAPSHOT_HEADER_SIZE) return 0;
+    if (get32(data + 16) != crc32(data, 16)) return 0;
+    if (get32(data) != SNAPSHOT_MAGIC) return 0;
+    if (get16(data + 4) != SNAPSHOT_VERSION) return 0;
+    if (get16(data + 6) != SNAPSHOT_RECORD_SIZE) return 0;
+
+    size_t count = get16(data + 8);
+    uint32_t savedAtMs = get32(data + 12);
+
+    size_t present = (len - SNAPSHOT_HEADER_SIZE) / SNAPSHOT_SLOT_SIZE;
+    if (count > present) count = present;
+
+    size_t n = 0;
+    for (size_t i = 0; i < count && n < maxOut; i++) {
+        const uint8_t* rec = data + SNAPSHOT_HEADER_SIZE + i * SNAPSHOT_SLOT_SIZE;
+        if (get32(rec + SNAPSHOT_RECORD_SIZE) != crc32(rec, SNAPSHOT_RECORD_SIZE)) continue;
+        if (rec[REC_TYPE] > (uint8_t)TargetType::IR_DEVICE) continue;
+
+        Target& t = out[n];
+        memset(&t, 0, sizeof(Target));
+        memcpy(t.bssid, rec + REC_BSSID, 6);
+        memcpy(t.ssid, rec + REC_SSID, SSID_MAX_LEN);
+        t.ssid[SSID_MAX_LEN] = '\0';
+        t.type = (TargetType)rec[REC_TYPE];
+        t.channel = rec[REC_CHANNEL];
+        t.rssi = (int8_t)rec[REC_RSSI];
+        t.security = (rec[REC_SECURITY] <= (uint8_t)SecurityType::UNKNOWN)
+                         ? (SecurityType)rec[REC_SECURITY] : SecurityType::UNKNOWN;
+        t.clientCount = rec[REC_CLIENTS];
+        if (t.clientCount > MAX_CLIENTS_PER_AP) t.clientCount = MAX_CLIENTS_PER_AP;
+        memcpy(t.clientMacs, rec + REC_MACS, (size_t)t.clientCount * 6);
+        t.isHidden = (rec[REC_FLAGS] & FLAG_HIDDEN) != 0;
+        t.hasHandshake = (rec[REC_FLAGS] & FLAG_HANDSHAKE) != 0;
+        t.isRandomAddress = (rec[REC_FLAGS] & FLAG_RANDOM) != 0;
+        t.beaconCount = get16(rec + REC_BEACONS);
+
+        // Same age as at save time, on this boot's clock (wraps harmlessly)
+        uint32_t age = savedAtMs - get32(rec + REC_LASTSEEN);
+        t.lastSeenMs = now - age;
+        t.firstSeenMs = t.lastSeenMs;
+        t.isRestored = true;
+        n++;
+    }
+    return n;
+}
+
+void TargetSnapshot::formatAge(char* buf, size_t len, uint32_t ageMs) {
+    uint32_t mins = ageMs / 60000;
+    if (mins == 0) {
+        snprintf(buf, len, "<1m ago");
+    } else if (mins < 60) {
+        snprintf(buf, len, "%um ago", (unsigned)mins);
+    } else if (mins < 48 * 60) {
+        snprintf(buf, len, "%uh ago", (unsigned)(mins / 60));
+    } else {
+        snprintf(buf, len, "%ud ago", (unsigned)(mins / (24 * 60)));
+    }
+}
+
+} // namespace Vanguard
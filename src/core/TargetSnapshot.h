@@ -0,0 +1,129 @@
+#ifndef VANGUARD_TARGET_SNAPSHOT_H
+#define VANGUARD_TARGET_SNAPSHOT_H
+
+/**
+ * @file TargetSnapshot.h
+ * @brief Binary snapshot format for the target table
+ *
+ * A snapshot is a 20-byte header followed by fixed-size record slots,
+ * one per target, in table order:
+ *
+ *   header: magic "VGTS" | version | record size | count | reserved |
+ *           saved-at (uptime ms) | CRC32 of the preceding 16 bytes
+ *   slot:   148-byte little-endian record | CRC32 of the record
+ *
+ * Every slot carries its own CRC, so a slot can be rewritten in place
+ * and a torn write costs one target rather than the whole file. The
+ * encoder remembers each slot's CRC from the last save; only slots
+ * whose bytes changed need writing (see encodeSlot()).
+ *
+ * There is no RTC, so records store lastSeenMs against the uptime in
+ * the header. On load, ages are rebased onto the current uptime: time
+ * spent powered off isn't counted.
+ *
+ * Pure encoding - TargetStore does the SD I/O.
+ *
+ * @example
+ * TargetSnapshot snap;
+ * uint8_t slot[SNAPSHOT_SLOT_SIZE];
+ * for (size_t i = 0; i < n; i++) {
+ *     if (snap.encodeSlot(i, targets[i], slot)) writeAt(snap.slotOffset(i), slot);
+ * }
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr uint32_t SNAPSHOT_MAGIC        = 0x53544756;  // "VGTS" little-endian
+constexpr uint16_t SNAPSHOT_VERSION      = 1;
+constexpr size_t   SNAPSHOT_HEADER_SIZE  = 20;
+constexpr size_t   SNAPSHOT_RECORD_SIZE  = 148;
+constexpr size_t   SNAPSHOT_SLOT_SIZE    = SNAPSHOT_RECORD_SIZE + 4;
+constexpr size_t   SNAPSHOT_MAX_BYTES    = SNAPSHOT_HEADER_SIZE + MAX_TARGETS * SNAPSHOT_SLOT_SIZE;
+
+/**
+ * @brief CRC-32 (IEEE 802.3, reflected)
+ * @param crc Previous value to continue a running CRC
+ */
+uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc = 0);
+
+// =============================================================================
+// TargetSnapshot Class
+// =============================================================================
+
+class TargetSnapshot {
+public:
+    TargetSnapshot();
+
+    /**
+     * @brief Only real radios are saved (virtual targets have no BSSID)
+     */
+    static bool shouldPersist(const Target& target);
+
+    /**
+     * @brief Encode one slot
+     * @param index Slot number (persisted targets in table order)
+     * @param out SNAPSHOT_SLOT_SIZE bytes
+     * @return true if the bytes differ from what was last committed there
+     */
+    bool encodeSlot(size_t index, const Target& target, uint8_t* out);
+
+    /**
+     * @brief Encode the header
+     * @param out SNAPSHOT_HEADER_SIZE bytes
+     */
+    static void encodeHeader(uint8_t* out, uint16_t count, uint32_t savedAtMs);
+
+    /**
+     * @brief File offset of a slot
+     */
+    static uint32_t slotOffset(size_t index) {
+        return (uint32_t)(SNAPSHOT_HEADER_SIZE + index * SNAPSHOT_SLOT_SIZE);
+    }
+
+    /**
+     * @brief Record that slots [0, count) as encoded are now on disk
+     */
+    void commit(size_t count);
+
+    /**
+     * @brief Forget what's on disk; the next save rewrites every slot
+     */
+    void invalidate();
+
+    /**
+     * @brief Slots written by the last commit (0 after invalidate)
+     */
+    size_t committedCount() const { return m_committed; }
+
+    /**
+     * @brief Decode a whole snapshot image
+     *
+     * Bad slots are skipped; a bad header, magic, version or record size
+     * rejects the image.
+     *
+     * @param now Current uptime; ages are rebased onto it
+     * @return Targets written to out, or 0
+     */
+    static size_t decode(const uint8_t* data, size_t len, Target* out, size_t maxOut,
+                         uint32_t now);
+
+    /**
+     * @brief "3m ago" style label for a last-seen age
+     */
+    static void formatAge(char* buf, size_t len, uint32_t ageMs);
+
+private:
+    uint32_t m_slotCrc[MAX_TARGETS];   // CRC of each slot as last committed
+    uint32_t m_pendingCrc[MAX_TARGETS];
+    size_t   m_committed;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_TARGET_SNAPSHOT_H
@@ -0,0 +1,129 @@
+/**
+ * @file TargetStore.cpp
+ * @brief Target snapshot load/save on SD
+ */
+
+#include "TargetStore.h"
+#include "SDManager.h"
+
+namespace Vanguard {
+
+TargetStore::TargetStore() {}
+
+// =============================================================================
+// LOAD
+// =============================================================================
+
+size_t TargetStore::load(TargetTable& table, uint32_t now) {
+    SDManager& sd = SDManager::getInstance();
+    if (!sd.isAvailable() || !sd.fileExists(TARGET_SNAPSHOT_PATH)) return 0;
+
+    File file = SD.open(TARGET_SNAPSHOT_PATH, FILE_READ);
+    if (!file) return 0;
+
+    size_t len = file.size();
+    if (len > SNAPSHOT_MAX_BYTES) len = SNAPSHOT_MAX_BYTES;
+
+    uint8_t* image = new uint8_t[len];
+    size_t got = file.read(image, len);   // Single read of the whole image
+    file.close();
+
+    Target* targets = new Target[MAX_TARGETS];
+    size_t n = TargetSnapshot::decode(image, got, targets, MAX_TARGETS, now);
+    delete[] image;
+
+    if (n > 0) table.restore(targets, n);
+    delete[] targets;
+
+    // Ages were rebased onto this boot, so every slot is stale on disk
+    m_snapshot.invalidate();
+
+    if (Serial) Serial.printf("[Store] Restored %u targets (%u bytes)\n", (unsigned)n, (unsigned)got);
+    return n;
+}
+
+// =============================================================================
+// SAVE
+// =============================================================================
+
+size_t TargetStore::save(const TargetTable& table, uint32_t now) {
+    if (!SDManager::getInstance().isAvailable()) return 0;
+
+    const std::vector<Target>& targets = table.getAll();
+    size_t count = 0;
+    for (size_t i = 0; i < targets.size(); i++) {
+        if (TargetSnapshot::shouldPersist(targets[i])) count++;
+    }
+
+    if (m_snapshot.committedCount() == 0) return writeFull(targets, count, now);
+    return writeChanged(targets, count, now);
+}
+
+size_t TargetStore::writeFull(const std::vector<Target>& targets, size_t count, uint32_t now) {
+    SDManager& sd = SDManager::getInstance();
+    sd.ensureDirectory(TARGET_SNAPSHOT_DIR);
+
+    // Fresh image beside the old one, swapped in once complete
+    File file = SD.open(TARGET_SNAPSHOT_TMP, FILE_WRITE);
+    if (!file) {
+        if (Serial) Serial.printf("[Store] ERROR: Failed to open %s\n", TARGET_SNAPSHOT_TMP);
+        return 0;
+    }
+
+    uint8_t header[SNAPSHOT_HEADER_SIZE];
+    TargetSnapshot::encodeHeader(header, (uint16_t)count, now);
+    file.write(header, sizeof(header));
+
+    uint8_t slot[SNAPSHOT_SLOT_SIZE];
+    size_t n = 0;
+    for (size_t i = 0; i < targets.size(); i++) {
+        if (!TargetSnapshot::shouldPersist(targets[i])) continue;
+        m_snapshot.encodeSlot(n++, targets[i], slot);
+        file.write(slot, sizeof(slot));
+    }
+    file.close();
+
+    sd.removeFile(TARGET_SNAPSHOT_PATH);
+    if (!SD.rename(TARGET_SNAPSHOT_TMP, TARGET_SNAPSHOT_PATH)) {
+        if (Serial) Serial.println("[Store] ERROR: Failed to replace snapshot");
+        return 0;
+    }
+
+    m_snapshot.commit(n);
+    return n;
+}
+
+size_t TargetStore::writeChanged(const std::vector<Target>& targets, size_t count, uint32_t now) {
+    File file = SD.open(TARGET_SNAPSHOT_PATH, "r+");
+    if (!file) {
+        m_snapshot.invalidate();   // Rewrite from scratch next time
+        return 0;
+    }
+
+    // Changed slots first, header last: a torn save leaves the old count.
+    // The header goes out every time so saved-at tracks the clock even
+    // when no target changed
+    uint8_t slot[SNAPSHOT_SLOT_SIZE];
+    size_t n = 0;
+    size_t written = 0;
+    for (size_t i = 0; i < targets.size(); i++) {
+        if (!TargetSnapshot::shouldPersist(targets[i])) continue;
+        if (m_snapshot.encodeSlot(n, targets[i], slot)) {
+            file.seek(TargetSnapshot::slotOffset(n));
+            file.write(slot, sizeof(slot));
+            written++;
+        }
+        n++;
+    }
+
+    uint8_t header[SNAPSHOT_HEADER_SIZE];
+    TargetSnapshot::encodeHeader(header, (uint16_t)count, now);
+    file.seek(0);
+    file.write(header, sizeof(header));
+    file.close();
+
+    m_snapshot.commit(n);
+    return written;
+}
+
+} // namespace Vanguard
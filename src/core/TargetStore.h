@@ -0,0 +1,67 @@
+#ifndef VANGUARD_TARGET_STORE_H
+#define VANGUARD_TARGET_STORE_H
+
+/**
+ * @file TargetStore.h
+ * @brief Keeps the target table on SD across reboots
+ *
+ * load() reads the whole snapshot in one go and bulk-copies it into the
+ * table at boot. save() is called periodically: the first save of a boot
+ * writes a fresh file and renames it over the old one, later saves only
+ * rewrite the slots whose bytes changed (plus the 20-byte header) in
+ * place.
+ *
+ * Format and CRCs live in TargetSnapshot; this class only moves bytes.
+ *
+ * @example
+ * TargetStore store;
+ * store.load(table, millis());
+ * // every TARGET_SNAPSHOT_INTERVAL_MS:
+ * store.save(table, millis());
+ */
+
+#include <Arduino.h>
+#include "TargetTable.h"
+#include "TargetSnapshot.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr const char* TARGET_SNAPSHOT_DIR  = "/state";
+constexpr const char* TARGET_SNAPSHOT_PATH = "/state/targets.bin";
+constexpr const char* TARGET_SNAPSHOT_TMP  = "/state/targets.tmp";
+constexpr uint32_t TARGET_SNAPSHOT_INTERVAL_MS = 30000;
+
+// =============================================================================
+// TargetStore Class
+// =============================================================================
+
+class TargetStore {
+public:
+    TargetStore();
+
+    /**
+     * @brief Replace the table's contents with the saved snapshot
+     * @return Targets restored (0 if there is no usable snapshot)
+     */
+    size_t load(TargetTable& table, uint32_t now);
+
+    /**
+     * @brief Write whatever changed since the last save
+     * @return Slots written (0 if nothing changed or the card is missing)
+     */
+    size_t save(const TargetTable& table, uint32_t now);
+
+private:
+    TargetSnapshot m_snapshot;
+
+    size_t writeFull(const std::vector<Target>& targets, size_t count, uint32_t now);
+    size_t writeChanged(const std::vector<Target>& targets, size_t count, uint32_t now);
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_TARGET_STORE_H
@@ -5,6 +5,8 @@
 
 #include "TargetTable.h"
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
 
 namespace Vanguard {
 
@@ -24,46 +26,40 @@ bool TargetTable::addOrUpdate(const Target& target) {
     int idx = findIndex(target.bssid);
 
     if (idx >= 0) {
-        // Update existing
-        Target& existing = m_targets[idx];
-        existing.rssi = target.rssi;
-        existing.lastSeenMs = target.lastSeenMs;
-        existing.beaconCount++;
-
-        // Update client count if provided
-        if (target.clientCount > 0) {
-            existing.clientCount = target.clientCount;
-        }
-
-        if (m_onUpdated) {
-            m_onUpdated(existing);
-        }
+        merge(m_targets[idx], target);
         return false;  // Not new
     }
+    return insert(target);
+}
 
-    // Add new target
-    if (m_targets.size() >= MAX_TARGETS) {
-        // Remove weakest signal to make room
-        auto weakest = std::min_element(m_targets.begin(), m_targets.end(),
-            [](const Target& a, const Target& b) {
-                return a.rssi < b.rssi;
-            });
-        if (weakest != m_targets.end() && weakest->rssi < target.rssi) {
-            if (m_onRemoved) {
-                m_onRemoved(*weakest);
-            }
-            m_targets.erase(weakest);
-        } else {
-            return false;  // Can't add, weaker than all existing
-        }
-    }
+size_t TargetTable::upsertBatch(const Target* targets, size_t count) {
+    // Key existing rows once so each lookup compares integers, not 6-byte
+    // memcmps across the whole vector
+    uint64_t keys[MAX_TARGETS];
+    size_t keyCount = rebuildKeys(keys);
+    size_t added = 0;
 
-    m_targets.push_back(target);
+    for (size_t i = 0; i < count; i++) {
+        const Target& target = targets[i];
+        uint64_t key = bssidKey(target.bssid);
 
-    if (m_onAdded) {
-        m_onAdded(target);
+        size_t idx = 0;
+        while (idx < keyCount && keys[idx] != key) idx++;
+
+        if (idx < keyCount) {
+            merge(m_targets[idx], target);
+            continue;
+        }
+
+        bool full = m_targets.size() >= MAX_TARGETS;
+        if (insert(target)) {
+            added++;
+            // Eviction reshuffles rows; otherwise the new row is last
+            if (full) keyCount = rebuildKeys(keys);
+            else      keys[keyCount++] = key;
+        }
     }
-    return true;  // New target added
+    return added;
 }
 
 const Target* TargetTable::findByBssid(const uint8_t* bssid) const {
@@ -71,27 +67,73 @@ const Target* TargetTable::findByBssid(const uint8_t* bssid) const {
     return (idx >= 0) ? &m_targets[idx] : nullptr;
 }
 
+bool TargetTable::remove(const uint8_t* bssid) {
+    int idx = findIndex(bssid);
+    if (idx < 0) return false;
+
+    if (m_onRemoved) {
+        m_onRemoved(m_targets[idx]);
+    }
+    m_targets.erase(m_targets.begin() + idx);
+    return true;
+}
+
 size_t TargetTable::pruneStale(uint32_t now) {
-    size_t removed = 0;
+    m_stations.pruneStale(now);
+    return pruneWhere(now, true, TargetType::UNKNOWN, nullptr);
+}
+
+size_t TargetTable::pruneStale(uint32_t now, TargetType type) {
+    if (type == TargetType::STATION) {
+        return m_stations.pruneStale(now);
+    }
+    return pruneWhere(now, false, type, nullptr);
+}
+
+size_t TargetTable::age(uint32_t now, const AgingPolicy& policy) {
+    if (policy.stationMs != 0) m_stations.pruneStale(now, policy.stationMs);
+    return pruneWhere(now, true, TargetType::UNKNOWN, &policy);
+}
+
+size_t TargetTable::pruneWhere(uint32_t now, bool anyType, TargetType type, const AgingPolicy* policy) {
+    // One pass: survivors slide down over removed rows, in order
+    size_t kept = 0;
+    for (size_t i = 0; i < m_targets.size(); i++) {
+        const Target& t = m_targets[i];
+        bool expired;
+        if (policy) {
+            uint32_t maxAge = agingTimeoutMs(*policy, t.type, t.isRandomAddress);
+            expired = !t.isRestored && maxAge != 0 && now - t.lastSeenMs > maxAge;
+        } else {
+            expired = (anyType || t.type == type) && t.isStale(now);
+        }
 
-    auto it = m_targets.begin();
-    while (it != m_targets.end()) {
-        if (it->isStale(now)) {
+        if (expired) {
             if (m_onRemoved) {
-                m_onRemoved(*it);
+                m_onRemoved(t);
             }
-            it = m_targets.erase(it);
-            removed++;
-        } else {
-            ++it;
+            continue;
         }
+        if (kept != i) m_targets[kept] = t;
+        kept++;
     }
 
+    size_t removed = m_targets.size() - kept;
+    m_targets.erase(m_targets.begin() + kept, m_targets.end());
     return removed;
 }
 
 void TargetTable::clear() {
     m_targets.clear();
+    m_stations.clear();
+    m_associations.clear();
+    m_probes.clear();
+}
+
+size_t TargetTable::restore(const Target* targets, size_t count) {
+    if (count > MAX_TARGETS) count = MAX_TARGETS;
+    m_targets.assign(targets, targets + count);
+    return count;
 }
 
 bool TargetTable::addVirtualTarget(const char* name, TargetType type) {
@@ -128,17 +170,58 @@ bool TargetTable::addVirtualTarget(const char* name, TargetType type) {
 }
 
 bool TargetTable::addAssociation(const uint8_t* clientMac, const uint8_t* apMac) {
+    return addAssociation(clientMac, apMac, 0, 0, millis());
+}
+
+bool TargetTable::addAssociation(const uint8_t* clientMac, const uint8_t* apMac,
+                                 int8_t rssi, uint8_t channel, uint32_t now) {
+    bool isNew = m_stations.observe(clientMac, apMac, rssi, channel, now);
+    m_associations.observe(clientMac, apMac, now);
+
     int idx = findIndex(apMac);
-    if (idx < 0) return false; // AP not in table yet
+    if (idx < 0) return isNew; // AP not in table yet
 
     Target& ap = m_targets[idx];
-    if (ap.type != TargetType::ACCESS_POINT) return false;
+    if (ap.type != TargetType::ACCESS_POINT) return isNew;
 
-    bool added = ap.addClientMac(clientMac);
-    if (added && m_onUpdated) {
+    if (ap.addClientMac(clientMac) && m_onUpdated) {
         m_onUpdated(ap);
     }
-    return added;
+    return isNew;
+}
+
+size_t TargetTable::pruneAssociations(uint32_t now) {
+    return m_associations.expire(now);
+}
+
+bool TargetTable::addProbe(const uint8_t* station, const char* ssid, uint8_t len,
+                           int8_t rssi, uint8_t channel, uint32_t now) {
+    return m_probes.observe(station, ssid, len, rssi, channel, now);
+}
+
+size_t TargetTable::pruneProbes(uint32_t now) {
+    return m_probes.pruneStale(now);
+}
+
+bool TargetTable::addBeacon(const BLEBeaconInfo& beacon) {
+    if (beacon.format == BLEBeaconFormat::NONE) return false;
+
+    Target target;
+    memset(&target, 0, sizeof(Target));
+    target.type = TargetType::BLE_BEACON;
+    memcpy(target.bssid, beacon.key, 6);
+    target.rssi = beacon.rssi;
+    target.security = SecurityType::UNKNOWN;
+    target.firstSeenMs = beacon.seenMs;
+    target.lastSeenMs = beacon.seenMs;
+    target.beaconCount = 1;
+
+    if (beacon.format == BLEBeaconFormat::EDDYSTONE_TLM) {
+        if (findIndex(target.bssid) < 0) return false;
+    } else {
+        formatBeaconName(beacon, target.ssid, sizeof(target.ssid));
+    }
+    return addOrUpdate(target);
 }
 
 // =============================================================================
@@ -152,26 +235,22 @@ const std::vector<Target>& TargetTable::getAll() const {
 std::vector<Target> TargetTable::getFiltered(const TargetFilter& filter,
                                               SortOrder order) const {
     std::vector<Target> result;
-    result.reserve(m_targets.size());
+    result.reserve(m_targets.size() + (filter.showStations ? m_stations.count() : 0));
 
     // Apply filters
     for (const auto& t : m_targets) {
-        // Type filter
-        if (t.type == TargetType::ACCESS_POINT && !filter.showAccessPoints) continue;
-        if (t.type == TargetType::STATION && !filter.showStations) continue;
-        if (t.type == TargetType::BLE_DEVICE && !filter.showBLE) continue;
-
-        // Hidden filter
-        if (t.isHidden && !filter.showHidden) continue;
-
-        // Security filter
-        if (t.isOpen() && !filter.showOpen) continue;
-        if (!t.isOpen() && !filter.showSecured) continue;
-
-        // Signal filter
-        if (t.rssi < filter.minRssi) continue;
+        if (passes(filter, t)) result.push_back(t);
+    }
 
-        result.push_back(t);
+    // Stations live in the station table, not among the targets
+    if (filter.showStations) {
+        bool stationTargets = countByType(TargetType::STATION) > 0;
+        const Station* stations = m_stations.data();
+        for (size_t i = 0; i < m_stations.count(); i++) {
+            if (stationTargets && findIndex(stations[i].mac) >= 0) continue;
+            Target t = stationTarget(stations[i]);
+            if (passes(filter, t)) result.push_back(t);
+        }
     }
 
     // Sort
@@ -215,6 +294,25 @@ std::vector<Target> TargetTable::getFiltered(const TargetFilter& filter,
     return result;
 }
 
+Target TargetTable::stationTarget(const Station& station) const {
+    Target t;
+    memset(&t, 0, sizeof(Target));
+    t.type = TargetType::STATION;
+    memcpy(t.bssid, station.mac, 6);
+    snprintf(t.ssid, sizeof(t.ssid), "%02X:%02X:%02X:%02X:%02X:%02X",
+             station.mac[0], station.mac[1], station.mac[2],
+             station.mac[3], station.mac[4], station.mac[5]);
+    t.rssi = station.rssi ? station.rssi : -100;   // Never heard transmitting: sorts last
+    t.channel = station.channel;
+    t.security = SecurityType::UNKNOWN;
+    t.firstSeenMs = station.firstSeenMs;
+    t.lastSeenMs = station.lastSeenMs;
+
+    size_t aps = m_associations.apCount(station.mac);
+    t.clientCount = (uint8_t)(aps > 255 ? 255 : aps);
+    return t;
+}
+
 size_t TargetTable::count() const {
     return m_targets.size();
 }
@@ -224,6 +322,23 @@ size_t TargetTable::countByType(TargetType type) const {
         [type](const Target& t) { return t.type == type; });
 }
 
+bool TargetTable::passes(const TargetFilter& filter, const Target& t) {
+    // Type filter
+    if (t.type == TargetType::ACCESS_POINT && !filter.showAccessPoints) return false;
+    if (t.type == TargetType::STATION && !filter.showStations) return false;
+    if ((t.type == TargetType::BLE_DEVICE || t.type == TargetType::BLE_BEACON) && !filter.showBLE) return false;
+
+    // Hidden filter
+    if (t.isHidden && !filter.showHidden) return false;
+
+    // Security filter
+    if (t.isOpen() && !filter.showOpen) return false;
+    if (!t.isOpen() && !filter.showSecured) return false;
+
+    // Signal filter
+    return t.rssi >= filter.minRssi;
+}
+
 const Target* TargetTable::getStrongest() const {
     if (m_targets.empty()) return nullptr;
 
@@ -255,6 +370,73 @@ void TargetTable::onTargetRemoved(TargetRemovedCallback cb) {
 // PRIVATE
 // =============================================================================
 
+void TargetTable::merge(Target& existing, const Target& target) {
+    existing.rssi = target.rssi;
+    existing.lastSeenMs = target.lastSeenMs;
+    existing.beaconCount++;
+    existing.isRestored = false;
+
+    // Update client count if provided
+    if (target.clientCount > 0) {
+        existing.clientCount = target.clientCount;
+    }
+
+    // APs can move channel and probe responses can reveal hidden SSIDs
+    if (target.channel != 0) {
+        existing.channel = target.channel;
+    }
+    if (target.security != SecurityType::UNKNOWN) {
+        existing.security = target.security;
+    }
+    if (existing.isHidden && !target.isHidden && target.ssid[0] != '\0') {
+        memcpy(existing.ssid, target.ssid, sizeof(existing.ssid));
+        existing.isHidden = false;
+    }
+
+    if (m_onUpdated) {
+        m_onUpdated(existing);
+    }
+}
+
+bool TargetTable::insert(const Target& target) {
+    if (m_targets.size() >= MAX_TARGETS) {
+        // Remove weakest signal to make room
+        auto weakest = std::min_element(m_targets.begin(), m_targets.end(),
+            [](const Target& a, const Target& b) {
+                return a.rssi < b.rssi;
+            });
+        if (weakest != m_targets.end() && weakest->rssi < target.rssi) {
+            if (m_onRemoved) {
+                m_onRemoved(*weakest);
+            }
+            m_targets.erase(weakest);
+        } else {
+            return false;  // Can't add, weaker than all existing
+        }
+    }
+
+    m_targets.push_back(target);
+
+    if (m_onAdded) {
+        m_onAdded(target);
+    }
+    return true;  // New target added
+}
+
+size_t TargetTable::rebuildKeys(uint64_t* keys) const {
+    size_t n = m_targets.size() < MAX_TARGETS ? m_targets.size() : MAX_TARGETS;
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = bssidKey(m_targets[i].bssid);
+    }
+    return n;
+}
+
+uint64_t TargetTable::bssidKey(const uint8_t* bssid) {
+    uint64_t key = 0;
+    for (int i = 0; i < 6; i++) key = (key << 8) | bssid[i];
+    return key;
+}
+
 int TargetTable::findIndex(const uint8_t* bssid) const {
     for (size_t i = 0; i < m_targets.size(); i++) {
         if (memcmp(m_targets[i].bssid, bssid, 6) == 0) {
@@ -18,6 +18,11 @@
  */
 
 #include "VanguardTypes.h"
+#include "StationTable.h"
+#include "AssociationGraph.h"
+#include "ProbeTable.h"
+#include "BLEBeacon.h"
+#include "TargetAging.h"
 #include <vector>
 #include <functional>
 
@@ -81,11 +86,25 @@ public:
 
     /**
      * @brief Add a new target or update if BSSID exists
+     *
+     * Updates refresh RSSI and last-seen, and take the channel, security
+     * and (for hidden APs) SSID from the incoming target when it knows them.
+     *
      * @param target The target to add/update
      * @return true if new target added, false if updated existing
      */
     bool addOrUpdate(const Target& target);
 
+    /**
+     * @brief addOrUpdate() for a whole scan's worth of targets
+     *
+     * Same merge and eviction rules, but looks rows up through a packed
+     * BSSID key built once per batch.
+     *
+     * @return Number of new targets added
+     */
+    size_t upsertBatch(const Target* targets, size_t count);
+
     /**
      * @brief Find a target by BSSID
      * @param bssid 6-byte MAC address
@@ -93,6 +112,12 @@ public:
      */
     const Target* findByBssid(const uint8_t* bssid) const;
 
+    /**
+     * @brief Remove one target
+     * @return true if it was in the table
+     */
+    bool remove(const uint8_t* bssid);
+
     /**
      * @brief Remove targets not seen within timeout
      * @param now Current millis()
@@ -100,6 +125,25 @@ public:
      */
     size_t pruneStale(uint32_t now);
 
+    /**
+     * @brief Remove stale targets of one type only
+     *
+     * For rolling scans, which refresh APs but shouldn't age out BLE or
+     * virtual targets they never see.
+     */
+    size_t pruneStale(uint32_t now, TargetType type);
+
+    /**
+     * @brief Expire targets and stations per an aging policy
+     *
+     * One pass over the table, each target judged by the policy's age
+     * for its type (and, for BLE, address type). Targets restored from
+     * the boot snapshot are kept until seen live or cleared.
+     *
+     * @return Number of targets removed
+     */
+    size_t age(uint32_t now, const AgingPolicy& policy);
+
     /**
      * @brief Add a virtual/static target (e.g. Universal Remote)
      */
@@ -107,10 +151,20 @@ public:
 
     /**
      * @brief Associate a client MAC with an Access Point MAC
+     *
+     * The station is always recorded in stations(), whether or not the AP
+     * is in the table yet. The AP's clientMacs keeps the first
+     * MAX_CLIENTS_PER_AP for the UI and actions.
+     *
      * @param clientMac Client's MAC address
      * @param apMac AP's BSSID
-     * @return true if association was new, false if already tracked
+     * @param rssi Station's signal, 0 if it wasn't the transmitter
+     * @param channel 0 if unknown
+     * @param now Current millis()
+     * @return true if the station is new, or new to this AP
      */
+    bool addAssociation(const uint8_t* clientMac, const uint8_t* apMac,
+                        int8_t rssi, uint8_t channel, uint32_t now);
     bool addAssociation(const uint8_t* clientMac, const uint8_t* apMac);
 
     /**
@@ -118,6 +172,15 @@ public:
      */
     void clear();
 
+    /**
+     * @brief Replace the table with saved targets in one bulk copy
+     *
+     * Used at boot to load the last snapshot; no per-target callbacks.
+     *
+     * @return Number of targets loaded (capped at MAX_TARGETS)
+     */
+    size_t restore(const Target* targets, size_t count);
+
     // -------------------------------------------------------------------------
     // Queries
     // -------------------------------------------------------------------------
@@ -129,6 +192,10 @@ public:
 
     /**
      * @brief Get filtered and sorted targets
+     *
+     * With showStations, every station in stations() is listed too, as a
+     * STATION row built by stationTarget().
+     *
      * @param filter Which targets to include
      * @param order How to sort results
      * @return Filtered/sorted copy of targets
@@ -151,6 +218,57 @@ public:
      */
     const Target* getStrongest() const;
 
+    /**
+     * @brief Client stations seen in data frames
+     */
+    const StationTable& stations() const { return m_stations; }
+
+    /**
+     * @brief A station as a list row
+     *
+     * Named by its MAC; clientCount is the number of APs the association
+     * graph has seen it with. RSSI is -100 until it has transmitted.
+     */
+    Target stationTarget(const Station& station) const;
+
+    /**
+     * @brief Every station <-> AP link seen, with timestamps
+     */
+    const AssociationGraph& associations() const { return m_associations; }
+
+    /**
+     * @brief Expire idle links and repack the graph (call every GRAPH_COMPACT_MS)
+     */
+    size_t pruneAssociations(uint32_t now);
+
+    /**
+     * @brief Record a directed probe request in the station's PNL
+     * @return true if the SSID is new for this station
+     */
+    bool addProbe(const uint8_t* station, const char* ssid, uint8_t len,
+                  int8_t rssi, uint8_t channel, uint32_t now);
+
+    /**
+     * @brief Preferred network lists from probe requests
+     */
+    const ProbeTable& probes() const { return m_probes; }
+
+    /**
+     * @brief Drop probing stations not heard for PROBE_AGE_TIMEOUT_MS
+     */
+    size_t pruneProbes(uint32_t now);
+
+    /**
+     * @brief Add or refresh a BLE_BEACON target, keyed by beacon identity
+     *
+     * Identity frames create the target (named by formatBeaconName) or
+     * refresh it whatever address they came from; TLM frames only
+     * refresh a beacon that is already listed.
+     *
+     * @return true if a new target was added
+     */
+    bool addBeacon(const BLEBeaconInfo& beacon);
+
     // -------------------------------------------------------------------------
     // Callbacks
     // -------------------------------------------------------------------------
@@ -161,6 +279,9 @@ public:
 
 private:
     std::vector<Target> m_targets;
+    StationTable        m_stations;
+    AssociationGraph    m_associations;
+    ProbeTable          m_probes;
 
     TargetAddedCallback   m_onAdded;
     TargetUpdatedCallback m_onUpdated;
@@ -171,6 +292,13 @@ private:
      * @return Index or -1 if not found
      */
     int findIndex(const uint8_t* bssid) const;
+
+    static bool passes(const TargetFilter& filter, const Target& t);
+    size_t pruneWhere(uint32_t now, bool anyType, TargetType type, const AgingPolicy* policy);
+    void merge(Target& existing, const Target& target);
+    bool insert(const Target& target);
+    size_t rebuildKeys(uint64_t* keys) const;
+    static uint64_t bssidKey(const uint8_t* bssid);
 };
 
 } // namespace Vanguard
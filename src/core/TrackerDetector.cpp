@@ -0,0 +1,318 @@
+/**
+ * @file TrackerDetector.cpp
+ * @brief Tracker classification, address-to-track correlation and the
+ *        per-track streaming statistics
+ */
+
+#include "TrackerDetector.h"
+#include <cstring>
+
+namespace Vanguard {
+
+static const uint8_t FMDN_FRAME_MIN = 0x40;      // 0x40 normal, 0x41 unwanted-tracking mode
+static const uint8_t FMDN_FRAME_MAX = 0x41;
+
+static inline uint32_t fnv1a(uint32_t h, uint8_t b) {
+    return (h ^ b) * 0x01000193u;
+}
+
+static inline bool silentFor(uint32_t now, uint32_t since, uint32_t ms) {
+    return (uint32_t)(now - since) > ms;
+}
+
+// =============================================================================
+// CLASSIFICATION
+// =============================================================================
+
+TrackerKind classifyTracker(const RawAdvert& adv, const AdvertFields& fields) {
+    if (fields.has(ADV_HAS_MANUFACTURER) && fields.manufacturerId == 0x004C &&
+        fields.manufacturerData.len >= 2 &&
+        AdvertFields::bytes(adv.payload, fields.manufacturerData)[0] == FINDMY_TYPE) {
+        return TrackerKind::FIND_MY;
+    }
+
+    for (uint8_t i = 0; i < fields.serviceDataCount; i++) {
+        uint16_t uuid = fields.serviceDataUuid[i];
+        const ADSpan& data = fields.serviceData[i];
+        if (uuid == UUID16_SMARTTAG) return TrackerKind::SMARTTAG;
+        if (uuid == UUID16_TILE || uuid == UUID16_TILE_ALT) return TrackerKind::TILE;
+        if (uuid == UUID16_FMDN && data.len >= 1) {
+            uint8_t frame = AdvertFields::bytes(adv.payload, data)[0];
+            if (frame >= FMDN_FRAME_MIN && frame <= FMDN_FRAME_MAX) return TrackerKind::FMDN;
+        }
+    }
+
+    for (uint8_t i = 0; i < fields.uuid16Count; i++) {
+        if (fields.uuid16[i] == UUID16_TILE || fields.uuid16[i] == UUID16_TILE_ALT) {
+            return TrackerKind::TILE;
+        }
+    }
+    return TrackerKind::NONE;
+}
+
+uint32_t trackerFingerprint(const RawAdvert& adv, const AdvertFields& fields, TrackerKind kind) {
+    uint32_t h = 0x811C9DC5u;
+    h = fnv1a(h, (uint8_t)kind);
+    h = fnv1a(h, adv.len);
+
+    // Layout: which AD structures, in what order, how long
+    size_t len = (adv.len < BLE_ADV_MAX_LEN) ? adv.len : BLE_ADV_MAX_LEN;
+    ADIterator it(adv.payload, len);
+    while (it.next()) {
+        h = fnv1a(h, it.type());
+        h = fnv1a(h, it.length());
+    }
+
+    // Status bytes; everything after them is rotating key material
+    const uint8_t* d = nullptr;
+    size_t n = 0;
+    switch (kind) {
+        case TrackerKind::FIND_MY:          // Type, length, status (battery, maintained)
+            d = AdvertFields::bytes(adv.payload, fields.manufacturerData);
+            n = (fields.manufacturerData.len < 3) ? fields.manufacturerData.len : 3;
+            break;
+        case TrackerKind::SMARTTAG:         // Version and state
+        case TrackerKind::FMDN:             // Frame type
+            for (uint8_t i = 0; i < fields.serviceDataCount; i++) {
+                uint16_t uuid = fields.serviceDataUuid[i];
+                if ((uuid == UUID16_SMARTTAG || uuid == UUID16_FMDN) && fields.serviceData[i].len >= 1) {
+                    d = AdvertFields::bytes(adv.payload, fields.serviceData[i]);
+                    n = 1;
+                    break;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    for (size_t i = 0; i < n; i++) h = fnv1a(h, d[i]);
+    return h;
+}
+
+const char* trackerKindName(TrackerKind kind) {
+    switch (kind) {
+        case TrackerKind::FIND_MY:  return "Find My";
+        case TrackerKind::SMARTTAG: return "SmartTag";
+        case TrackerKind::TILE:     return "Tile";
+        case TrackerKind::FMDN:     return "Find My Device";
+        default:                    return "None";
+    }
+}
+
+// =============================================================================
+// TrackerDetector
+// =============================================================================
+
+TrackerDetector::TrackerDetector() {
+    reset();
+}
+
+void TrackerDetector::reset() {
+    memset(m_addresses, 0, sizeof(m_addresses));
+    memset(m_tracks, 0, sizeof(m_tracks));
+    m_rotations = 0;
+}
+
+bool TrackerDetector::observe(const RawAdvert& adv, const AdvertFields& fields, TrackerAlert& alert) {
+    TrackerKind kind = classifyTracker(adv, fields);
+    if (kind == TrackerKind::NONE) return false;
+
+    uint32_t now = adv.timestampMs;
+    int slot = findAddress(adv.address);
+    int track;
+
+    if (slot >= 0) {
+        track = m_addresses[slot].track;
+        m_addresses[slot].lastSeenMs = now;
+
+        // An earlier address of the track is still advertising, so the
+        // one that joined after it belongs to a different device
+        TrackerTrack& t = m_tracks[track];
+        if (memcmp(t.address, adv.address, 6) != 0) {
+            int newer = findAddress(t.address);
+            if (newer >= 0 && !silentFor(now, m_addresses[newer].lastSeenMs, aliveFor(t))) {
+                splitAddress(newer, now);
+            }
+        }
+    } else {
+        uint32_t fp = trackerFingerprint(adv, fields, kind);
+        track = handoffTrack(kind, fp, now);
+        if (track >= 0) {
+            TrackerTrack& t = m_tracks[track];
+            if (t.addresses < 0xFFFF) t.addresses++;
+            m_rotations++;
+        } else {
+            track = newTrack(kind, fp, now);
+        }
+        linkAddress(adv.address, track, now);
+    }
+
+    TrackerTrack& t = m_tracks[track];
+    memcpy(t.address, adv.address, 6);
+    update(t, adv.rssi, now);
+
+    if (!shouldAlert(t, now)) return false;
+    t.alerted = true;
+    t.lastAlertMs = now;
+
+    alert.kind = t.kind;
+    memcpy(alert.address, t.address, 6);
+    alert.rssi = t.rssi;
+    alert.rssiTrend = rssiTrend(t);
+    alert.windows = presenceWindows(t);
+    alert.addresses = t.addresses;
+    alert.followingMs = now - t.firstSeenMs;
+    alert.intervalMs = t.intervalMs;
+    return true;
+}
+
+const TrackerTrack* TrackerDetector::find(const uint8_t* address) const {
+    int slot = findAddress(address);
+    return (slot >= 0) ? &m_tracks[m_addresses[slot].track] : nullptr;
+}
+
+size_t TrackerDetector::trackCount() const {
+    size_t n = 0;
+    for (size_t i = 0; i < TRACKER_MAX_TRACKS; i++) {
+        if (m_tracks[i].used) n++;
+    }
+    return n;
+}
+
+uint8_t TrackerDetector::presenceWindows(const TrackerTrack& track) {
+    uint32_t v = track.presence;
+    uint8_t n = 0;
+    while (v) {
+        v &= v - 1;
+        n++;
+    }
+    return n;
+}
+
+int8_t TrackerDetector::rssiTrend(const TrackerTrack& track) {
+    return (int8_t)((track.rssiFast - track.rssiSlow) / 16);
+}
+
+// =============================================================================
+// CORRELATION
+// =============================================================================
+
+int TrackerDetector::findAddress(const uint8_t* address) const {
+    for (size_t i = 0; i < TRACKER_MAX_ADDRESSES; i++) {
+        if (m_addresses[i].used && memcmp(m_addresses[i].address, address, 6) == 0) return (int)i;
+    }
+    return -1;
+}
+
+uint32_t TrackerDetector::aliveFor(const TrackerTrack& t) {
+    uint32_t ms = t.intervalMs * 4;
+    return (ms < TRACKER_MIN_SILENCE_MS) ? TRACKER_MIN_SILENCE_MS : ms;
+}
+
+int TrackerDetector::handoffTrack(TrackerKind kind, uint32_t fingerprint, uint32_t now) const {
+    // The same-looking track heard most recently among those that have
+    // missed their latest slot; a rotated address turns up one interval
+    // after the old one's last advert
+    int best = -1;
+    for (size_t i = 0; i < TRACKER_MAX_TRACKS; i++) {
+        const TrackerTrack& t = m_tracks[i];
+        if (!t.used || t.kind != kind || t.fingerprint != fingerprint) continue;
+        if ((uint32_t)(now - t.lastSeenMs) < t.intervalMs * 3 / 4) continue;
+        if (silentFor(now, t.lastSeenMs, TRACKER_HANDOFF_MS)) continue;
+
+        if (best < 0 || (int32_t)(t.lastSeenMs - m_tracks[best].lastSeenMs) > 0) best = (int)i;
+    }
+    return best;
+}
+
+int TrackerDetector::newTrack(TrackerKind kind, uint32_t fingerprint, uint32_t now) {
+    // Free slot, else the track heard least recently
+    int idx = 0;
+    for (size_t i = 0; i < TRACKER_MAX_TRACKS; i++) {
+        if (!m_tracks[i].used) { idx = (int)i; break; }
+        if ((int32_t)(m_tracks[i].lastSeenMs - m_tracks[idx].lastSeenMs) < 0) idx = (int)i;
+    }
+
+    // Addresses still pointing at an evicted track would join the new one
+    if (m_tracks[idx].used) {
+        for (size_t i = 0; i < TRACKER_MAX_ADDRESSES; i++) {
+            if (m_addresses[i].used && m_addresses[i].track == idx) m_addresses[i].used = false;
+        }
+    }
+
+    TrackerTrack& t = m_tracks[idx];
+    memset(&t, 0, sizeof(t));
+    t.used = true;
+    t.kind = kind;
+    t.fingerprint = fingerprint;
+    t.addresses = 1;
+    t.firstSeenMs = now;
+    t.lastSeenMs = now;
+    return idx;
+}
+
+void TrackerDetector::splitAddress(int slot, uint32_t now) {
+    TrackerTrack& from = m_tracks[m_addresses[slot].track];
+    if (from.addresses > 1) from.addresses--;
+    if (m_rotations) m_rotations--;
+
+    // Its adverts so far stay in the old track's statistics
+    int track = newTrack(from.kind, from.fingerprint, now);
+    m_addresses[slot].track = (uint8_t)track;
+    memcpy(m_tracks[track].address, m_addresses[slot].address, 6);
+}
+
+void TrackerDetector::linkAddress(const uint8_t* address, int track, uint32_t now) {
+    size_t idx = 0;
+    for (size_t i = 0; i < TRACKER_MAX_ADDRESSES; i++) {
+        if (!m_addresses[i].used) { idx = i; break; }
+        if ((int32_t)(m_addresses[i].lastSeenMs - m_addresses[idx].lastSeenMs) < 0) idx = i;
+    }
+
+    AddressSlot& a = m_addresses[idx];
+    memcpy(a.address, address, 6);
+    a.track = (uint8_t)track;
+    a.used = true;
+    a.lastSeenMs = now;
+}
+
+// =============================================================================
+// STATISTICS
+// =============================================================================
+
+void TrackerDetector::update(TrackerTrack& t, int8_t rssi, uint32_t now) {
+    int16_t sample = (int16_t)(rssi * 16);
+
+    if (t.adverts == 0) {
+        t.rssiFast = t.rssiSlow = sample;
+        t.presence = 1;
+        t.window = now / TRACKER_WINDOW_MS;
+    } else {
+        uint32_t gap = now - t.lastSeenMs;
+        if (gap > 0 && gap < TRACKER_GAP_MS) {
+            t.intervalMs = t.intervalMs ? t.intervalMs + ((int32_t)(gap - t.intervalMs) / 8) : gap;
+        }
+
+        t.rssiFast = (int16_t)(t.rssiFast + (sample - t.rssiFast) / 4);
+        t.rssiSlow = (int16_t)(t.rssiSlow + (sample - t.rssiSlow) / 32);
+
+        uint32_t window = now / TRACKER_WINDOW_MS;
+        uint32_t shift = window - t.window;
+        t.presence = (shift >= 32) ? 0 : (t.presence << shift);
+        t.presence |= 1;
+        t.window = window;
+    }
+
+    t.rssi = rssi;
+    t.lastSeenMs = now;
+    t.adverts++;
+}
+
+bool TrackerDetector::shouldAlert(const TrackerTrack& t, uint32_t now) const {
+    if (presenceWindows(t) < TRACKER_ALERT_WINDOWS) return false;
+    if (now - t.firstSeenMs < TRACKER_ALERT_SPAN_MS) return false;
+    if (rssiTrend(t) < -TRACKER_FADING_DB) return false;
+    return !t.alerted || now - t.lastAlertMs >= TRACKER_REALERT_MS;
+}
+
+} // namespace Vanguard
@@ -0,0 +1,184 @@
+#ifndef VANGUARD_TRACKER_DETECTOR_H
+#define VANGUARD_TRACKER_DETECTOR_H
+
+/**
+ * @file TrackerDetector.h
+ * @brief Flags item trackers (AirTag, SmartTag, Tile...) that stay with us
+ *
+ * A tracker in someone else's bag rotates its random address (and the key
+ * in its payload) every few minutes, so no single address is around for
+ * long. Detection therefore works on tracks: one physical device, linked
+ * across addresses.
+ *
+ * Per track, in constant memory:
+ *   - advert interval, an EWMA of the gaps between adverts
+ *   - presence, a bitmap of the last 32 one-minute windows it was heard in
+ *   - RSSI trend, a fast EWMA minus a slow one (negative = falling away)
+ *
+ * Correlation: an address we haven't seen continues the track with the
+ * same payload fingerprint (tracker kind plus the bytes that don't rotate)
+ * that has missed its latest advert slot. If every such track advertised
+ * too recently, the newcomer is a second device and gets its own track.
+ * A wrong guess shows up later as the track's previous address still
+ * advertising; the newcomer is then split off into a track of its own.
+ *
+ * A track alerts once it has been heard in TRACKER_ALERT_WINDOWS windows
+ * over at least TRACKER_ALERT_SPAN_MS and isn't fading, then again every
+ * TRACKER_REALERT_MS while that holds.
+ *
+ * @example
+ * TrackerAlert alert;
+ * if (detector.observe(adv, fields, alert)) {
+ *     warn(alert);   // Same tracker for 15+ minutes
+ * }
+ */
+
+#include "BLEAdvert.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr uint16_t UUID16_SMARTTAG  = 0xFD5A;    // Samsung SmartThings Find
+constexpr uint16_t UUID16_TILE      = 0xFEED;
+constexpr uint16_t UUID16_TILE_ALT  = 0xFEEC;
+constexpr uint16_t UUID16_FMDN      = 0xFEAA;    // Shared with Eddystone
+constexpr uint8_t  FINDMY_TYPE      = 0x12;      // Apple offline finding
+
+constexpr size_t   TRACKER_MAX_ADDRESSES  = 48;       // Address -> track, least recent evicted
+constexpr size_t   TRACKER_MAX_TRACKS     = 16;
+constexpr uint32_t TRACKER_WINDOW_MS      = 60000;    // One presence bit
+constexpr uint32_t TRACKER_GAP_MS         = 10000;    // Longer gaps are absences, not intervals
+constexpr uint32_t TRACKER_MIN_SILENCE_MS = 3000;     // Floor for "still advertising"
+constexpr uint32_t TRACKER_HANDOFF_MS     = 120000;   // Longest silence a new address may bridge
+constexpr uint8_t  TRACKER_ALERT_WINDOWS  = 10;
+constexpr uint32_t TRACKER_ALERT_SPAN_MS  = 900000;   // 15 minutes
+constexpr uint32_t TRACKER_REALERT_MS     = 1800000;
+constexpr int8_t   TRACKER_FADING_DB      = 6;        // Trend below -6 dB: being left behind
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+enum class TrackerKind : uint8_t {
+    NONE,
+    FIND_MY,        // AirTag and other Find My accessories, separated mode
+    SMARTTAG,
+    TILE,
+    FMDN            // Google Find My Device network
+};
+
+/**
+ * @brief One physical tracker, across the addresses it has used
+ */
+struct TrackerTrack {
+    TrackerKind kind;
+    bool     used;
+    bool     alerted;
+    uint8_t  address[6];         // Most recent
+    uint16_t addresses;          // Addresses linked so far
+    uint32_t fingerprint;
+    uint32_t adverts;
+    uint32_t firstSeenMs;
+    uint32_t lastSeenMs;
+    uint32_t lastAlertMs;
+    uint32_t intervalMs;         // 0 until two adverts inside TRACKER_GAP_MS
+    uint32_t presence;           // Bit i: heard in window (window - i)
+    uint32_t window;             // now / TRACKER_WINDOW_MS at the last advert
+    int16_t  rssiFast;           // dBm * 16, EWMA over ~4 adverts
+    int16_t  rssiSlow;           // dBm * 16, EWMA over ~32 adverts
+    int8_t   rssi;
+};
+
+struct TrackerAlert {
+    TrackerKind kind;
+    uint8_t  address[6];         // Current address
+    int8_t   rssi;
+    int8_t   rssiTrend;          // dB
+    uint8_t  windows;            // Presence windows of the last 32
+    uint16_t addresses;
+    uint32_t followingMs;        // First to latest advert
+    uint32_t intervalMs;
+};
+
+// =============================================================================
+// CLASSIFICATION
+// =============================================================================
+
+/**
+ * @brief Which tracker family, if any, sent this advert
+ */
+TrackerKind classifyTracker(const RawAdvert& adv, const AdvertFields& fields);
+
+/**
+ * @brief Hash of the advert parts that survive an address rotation
+ *
+ * Kind, payload length, AD structure layout and the kind's status
+ * bytes; never the address or rotating key material.
+ */
+uint32_t trackerFingerprint(const RawAdvert& adv, const AdvertFields& fields, TrackerKind kind);
+
+const char* trackerKindName(TrackerKind kind);
+
+// =============================================================================
+// TrackerDetector Class
+// =============================================================================
+
+class TrackerDetector {
+public:
+    TrackerDetector();
+
+    /**
+     * @brief Feed one decoded advertisement
+     *
+     * Non-tracker adverts return immediately.
+     *
+     * @param alert Filled when this advert tips its track into an alert
+     * @return true if an alert fired
+     */
+    bool observe(const RawAdvert& adv, const AdvertFields& fields, TrackerAlert& alert);
+
+    /**
+     * @brief Track an address currently belongs to, nullptr if none
+     */
+    const TrackerTrack* find(const uint8_t* address) const;
+
+    size_t trackCount() const;
+
+    void reset();
+
+    /**
+     * @brief New addresses that continued an existing track
+     */
+    uint32_t rotations() const { return m_rotations; }
+
+    static uint8_t presenceWindows(const TrackerTrack& track);
+    static int8_t rssiTrend(const TrackerTrack& track);
+
+private:
+    struct AddressSlot {
+        uint8_t  address[6];
+        uint8_t  track;
+        bool     used;
+        uint32_t lastSeenMs;
+    };
+
+    AddressSlot  m_addresses[TRACKER_MAX_ADDRESSES];
+    TrackerTrack m_tracks[TRACKER_MAX_TRACKS];
+    uint32_t     m_rotations;
+
+    int  findAddress(const uint8_t* address) const;
+    int  handoffTrack(TrackerKind kind, uint32_t fingerprint, uint32_t now) const;
+    int  newTrack(TrackerKind kind, uint32_t fingerprint, uint32_t now);
+    void linkAddress(const uint8_t* address, int track, uint32_t now);
+    void splitAddress(int slot, uint32_t now);
+    static uint32_t aliveFor(const TrackerTrack& t);
+    static void update(TrackerTrack& t, int8_t rssi, uint32_t now);
+    bool shouldAlert(const TrackerTrack& t, uint32_t now) const;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_TRACKER_DETECTOR_H
@@ -0,0 +1,49 @@
+/**
+ * @file TrackerWatch.cpp
+ * @brief Background BLE listen scheduling
+ */
+
+#include "TrackerWatch.h"
+
+namespace Vanguard {
+
+TrackerWatch::TrackerWatch()
+    : m_active(false)
+    , m_listening(false)
+    , m_listenStartMs(0)
+    , m_lastDoneMs(0)
+    , m_listens(0)
+{
+}
+
+void TrackerWatch::start(uint32_t now) {
+    m_active = true;
+    m_listens = 0;
+    m_lastDoneMs = now - TRACKER_WATCH_REST_MS;   // First listen is due immediately
+}
+
+void TrackerWatch::stop() {
+    m_active = false;
+}
+
+uint32_t TrackerWatch::nextListen(uint32_t now, bool radioFree) {
+    if (m_listening) {
+        if (now - m_listenStartMs < TRACKER_WATCH_LISTEN_MS + TRACKER_WATCH_SLACK_MS) return 0;
+        listenDone(now);   // Lost completion: carry on
+    }
+    if (!m_active || !radioFree) return 0;
+    if (now - m_lastDoneMs < TRACKER_WATCH_REST_MS) return 0;
+
+    m_listening = true;
+    m_listenStartMs = now;
+    m_listens++;
+    return TRACKER_WATCH_LISTEN_MS;
+}
+
+void TrackerWatch::listenDone(uint32_t now) {
+    if (!m_listening) return;
+    m_listening = false;
+    m_lastDoneMs = now;
+}
+
+} // namespace Vanguard
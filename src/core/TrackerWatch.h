@@ -0,0 +1,103 @@
+#ifndef VANGUARD_TRACKER_WATCH_H
+#define VANGUARD_TRACKER_WATCH_H
+
+/**
+ * @file TrackerWatch.h
+ * @brief Duty-cycled background BLE listening for tracker detection
+ *
+ * TrackerDetector needs a tracker heard in TRACKER_ALERT_WINDOWS separate
+ * minutes over TRACKER_ALERT_SPAN_MS, with no silence longer than
+ * TRACKER_HANDOFF_MS across an address rotation. One-shot scans a few
+ * seconds long never give it that. The watch keeps the scanner coming
+ * back: TRACKER_WATCH_LISTEN_MS on, TRACKER_WATCH_REST_MS off. Every
+ * one-minute window gets heard, no rest comes near the handoff limit,
+ * and the radio idles half the time.
+ *
+ * Foreground scans and actions come first: a listen only starts while
+ * the radio is free, and the cycle picks up again once it is.
+ *
+ * Pure scheduling logic - VanguardEngine sends the listen requests.
+ *
+ * @example
+ * TrackerWatch watch;
+ * watch.start(millis());
+ * // tick:
+ * uint32_t ms = watch.nextListen(millis(), radioFree);
+ * if (ms) resumeBleScan(ms);
+ * // on BLE scan complete:
+ * if (watch.isListening()) watch.listenDone(millis());
+ */
+
+#include "VanguardTypes.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr uint32_t TRACKER_WATCH_LISTEN_MS = 15000;
+constexpr uint32_t TRACKER_WATCH_REST_MS   = 15000;   // Under TRACKER_WINDOW_MS and the handoff
+constexpr uint32_t TRACKER_WATCH_SLACK_MS  = 5000;    // Assume a lost completion after listen + this
+
+// =============================================================================
+// TrackerWatch Class
+// =============================================================================
+
+class TrackerWatch {
+public:
+    TrackerWatch();
+
+    /**
+     * @brief Start the cycle; the first listen is due immediately
+     */
+    void start(uint32_t now);
+
+    /**
+     * @brief Stop starting listens
+     *
+     * A listen already running still ends through listenDone() (or the
+     * timeout), so its completion isn't mistaken for someone else's.
+     */
+    void stop();
+
+    bool isActive() const { return m_active; }
+
+    /**
+     * @brief Length of the listen to start now, if one is due
+     *
+     * Marks the listen as running; listenDone() ends it. A listen that
+     * never completes is dropped after its length plus
+     * TRACKER_WATCH_SLACK_MS.
+     *
+     * @param radioFree No foreground scan or action is using the radio
+     * @return Duration in ms, or 0 if nothing should start yet
+     */
+    uint32_t nextListen(uint32_t now, bool radioFree);
+
+    /**
+     * @brief The running listen ended (completed, stopped or superseded)
+     */
+    void listenDone(uint32_t now);
+
+    /**
+     * @brief Check if a listen is waiting for its completion
+     */
+    bool isListening() const { return m_listening; }
+
+    /**
+     * @brief Listens started since start()
+     */
+    uint32_t listens() const { return m_listens; }
+
+private:
+    bool     m_active;
+    bool     m_listening;
+    uint32_t m_listenStartMs;
+    uint32_t m_lastDoneMs;
+    uint32_t m_listens;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_TRACKER_WATCH_H
@@ -5,6 +5,7 @@
 
 #include "VanguardEngine.h"
 #include "SystemTask.h"
+#include "BeaconParser.h"
 #include "../adapters/BruceWiFi.h"
 #include "../adapters/BruceBLE.h"
 #include "../adapters/EvilPortal.h"
@@ -36,17 +37,24 @@ VanguardEngine::VanguardEngine()
     , m_scanProgress(0)
     , m_actionActive(false)
     , m_combinedScan(false)
+    , m_hasCaptureStats(false)
+    , m_journaledState(ScanState::IDLE)
     , m_onScanProgress(nullptr)
     , m_onActionProgress(nullptr)
     , m_scanStartMs(0)
     , m_actionStartMs(0)
-    , m_transitionStep(0)
-    , m_transitionStartMs(0)
-    , m_bleInitAttempts(0)
+    , m_lastSnapshotMs(0)
+    , m_lastJournalMs(0)
+    , m_lastGraphMs(0)
+    , m_restoredCount(0)
+    , m_bleCountAtSlice(0)
+    , m_bleProfile(BLEScanProfileId::BALANCED)
 {
     m_actionProgress.type = ActionType::NONE;
     m_actionProgress.result = ActionResult::SUCCESS;
     m_actionProgress.packetsSent = 0;
+    memset(&m_captureStats, 0, sizeof(m_captureStats));
+    m_journalPath[0] = '\0';
 }
 
 VanguardEngine::~VanguardEngine() {
@@ -79,12 +87,18 @@ bool VanguardEngine::init() {
     // Step 5: Initialize SD Card
     SDManager::getInstance().init();
 
+    // Step 6: Warm start from the last saved table
+    m_restoredCount = m_store.load(m_targetTable, millis());
+    m_lastSnapshotMs = millis();
+    startJournal();
+
     // Step 7: Add virtual targets
     m_targetTable.addVirtualTarget("Universal Remote", TargetType::IR_DEVICE);
 
     // Wire up BruceWiFi associations
-    BruceWiFi::getInstance().onAssociation([this](const uint8_t* client, const uint8_t* ap) {
-        if (this->m_targetTable.addAssociation(client, ap)) {
+    BruceWiFi::getInstance().onAssociation([this](const uint8_t* client, const uint8_t* ap,
+                                                  int8_t rssi, uint8_t channel) {
+        if (this->m_targetTable.addAssociation(client, ap, rssi, channel, millis())) {
              FeedbackManager::getInstance().pulse(50); // Feedback on client discovery
         }
     });
@@ -108,16 +122,81 @@ void VanguardEngine::tick() {
     // Poll for events from System Task (Core 0)
     SystemEvent evt;
     while (SystemTask::getInstance().receiveEvent(evt)) {
-        handleSystemEvent(evt);
-        
-        // Free pointer data if owned
-        if (evt.isPointer && evt.data) {
-            if (evt.type == SysEventType::BLE_DEVICE_FOUND) {
-                delete (BLEDeviceInfo*)evt.data;
-            }
-            // Add other types as needed
-        }
+        handleSystemEvent(evt);     // Frees the payloads it owns
     }
+
+    tickCombined();
+    tickRolling();
+    tickWatch();
+    tickSnapshot();
+    tickJournal();
+    tickAssociations();
+}
+
+void VanguardEngine::tickAssociations() {
+    uint32_t now = millis();
+    if (now - m_lastGraphMs < GRAPH_COMPACT_MS) return;
+    m_lastGraphMs = now;
+
+    m_targetTable.pruneAssociations(now);
+    m_targetTable.pruneProbes(now);
+
+    // Same policy BruceBLE ages its device registry by
+    m_targetTable.age(now, AgingPolicy::defaults());
+}
+
+// =============================================================================
+// SESSION JOURNAL
+// =============================================================================
+
+void VanguardEngine::startJournal() {
+    SDManager& sd = SDManager::getInstance();
+    if (!sd.isAvailable()) return;
+
+    snprintf(m_journalPath, sizeof(m_journalPath), "/logs/%08lX.vgj",
+             (unsigned long)sd.nextSessionId());
+    m_journal.begin();
+
+    // Starting state, so a replay begins where this session did
+    uint32_t now = millis();
+    for (const auto& t : m_targetTable.getAll()) {
+        m_journal.targetAdded(now, t);
+    }
+
+    m_targetTable.onTargetAdded([this](const Target& t) { m_journal.targetAdded(millis(), t); });
+    m_targetTable.onTargetUpdated([this](const Target& t) { m_journal.targetUpdated(millis(), t); });
+    m_targetTable.onTargetRemoved([this](const Target& t) { m_journal.targetRemoved(millis(), t.bssid); });
+
+    if (Serial) Serial.printf("[Engine] Journal: %s\n", m_journalPath);
+}
+
+void VanguardEngine::tickJournal() {
+    if (!m_journalPath[0]) return;
+
+    uint32_t now = millis();
+    if (m_scanState != m_journaledState) {
+        m_journal.scanPhase(now, m_scanState, m_scanProgress);
+        m_journaledState = m_scanState;
+    }
+
+    if (m_journal.size() == 0) return;
+    if (now - m_lastJournalMs < JOURNAL_FLUSH_MS && !m_journal.wantsFlush()) return;
+    m_lastJournalMs = now;
+
+    SDManager::getInstance().appendBytes(m_journalPath, m_journal.data(), m_journal.size());
+    m_journal.drain();   // On a write failure the batch is dropped, not retried
+}
+
+void VanguardEngine::tickSnapshot() {
+    uint32_t now = millis();
+    if (now - m_lastSnapshotMs < TARGET_SNAPSHOT_INTERVAL_MS) return;
+    m_lastSnapshotMs = now;
+
+    // Mid-scan tables are partial, and captures own the card during actions
+    if (m_actionActive) return;
+    if (m_scanState != ScanState::IDLE && m_scanState != ScanState::COMPLETE) return;
+
+    m_store.save(m_targetTable, now);
 }
 
 // =============================================================================
@@ -127,23 +206,73 @@ void VanguardEngine::tick() {
 void VanguardEngine::beginScan() {
     if (Serial) Serial.println("[Scan] === BEGIN COMBINED SCAN ===");
 
-    m_targetTable.clear();
+    m_rolling.stop();
+    yieldWatch();
+    clearTable();
     m_scanProgress = 0;
     m_scanStartMs = millis();
     m_combinedScan = true;
     m_scanState = ScanState::WIFI_SCANNING;
 
-    // Send Request: Start WiFi Scan
+    // Both stacks stay up for the whole scan; slices are issued from tick()
     SystemRequest req;
-    req.cmd = SysCommand::WIFI_SCAN_START;
-    req.payload = nullptr;
+    req.cmd = SysCommand::WIFI_PASSIVE_STOP;
+    SystemTask::getInstance().sendRequest(req);
+    req.cmd = SysCommand::RADIO_COEX_START;
     SystemTask::getInstance().sendRequest(req);
+
+    m_coordinator.start(m_scanStartMs);
     
     if (m_onScanProgress) m_onScanProgress(m_scanState, m_scanProgress);
 }
 
+void VanguardEngine::tickCombined() {
+    if (!m_coordinator.isActive()) return;
+
+    ScanStep step = m_coordinator.next(millis());
+    SystemRequest req;
+
+    switch (step.type) {
+        case ScanSliceType::WIFI:
+            m_scanState = ScanState::WIFI_SCANNING;
+            req.cmd = SysCommand::WIFI_SCAN_START;
+            req.payload = (void*)(uintptr_t)step.channel;
+            SystemTask::getInstance().sendRequest(req);
+            break;
+
+        case ScanSliceType::BLE:
+            m_scanState = ScanState::BLE_SCANNING;
+            m_bleCountAtSlice = m_targetTable.countByType(TargetType::BLE_DEVICE);
+            // Later slices pick up where the last one paused, so known
+            // devices aren't reported again and no restart is paid for
+            req.cmd = m_coordinator.bleListenedMs() ? SysCommand::BLE_SCAN_RESUME
+                                                    : SysCommand::BLE_SCAN_START;
+            req.payload = (void*)(uintptr_t)step.durationMs;
+            SystemTask::getInstance().sendRequest(req);
+            break;
+
+        case ScanSliceType::DONE:
+            if (Serial) {
+                Serial.printf("[Scan] Combined scan done in %ums (BLE %ums)\n",
+                              (unsigned)(millis() - m_scanStartMs),
+                              (unsigned)m_coordinator.bleListenedMs());
+            }
+            m_combinedScan = false;
+            m_scanState = ScanState::COMPLETE;
+            m_scanProgress = 100;
+            if (m_onScanProgress) m_onScanProgress(m_scanState, m_scanProgress);
+            break;
+
+        default:
+            break;
+    }
+}
+
 void VanguardEngine::beginWiFiScan() {
-    m_targetTable.clear();
+    m_rolling.stop();
+    m_coordinator.stop();
+    yieldWatch();
+    clearTable();
     m_scanProgress = 0;
     m_scanStartMs = millis();
     m_combinedScan = false;
@@ -157,25 +286,38 @@ void VanguardEngine::beginWiFiScan() {
 }
 
 void VanguardEngine::beginBLEScan() {
-    m_targetTable.clear();
+    m_rolling.stop();
+    m_coordinator.stop();
+    yieldWatch();
+    clearTable();
     m_scanProgress = 0;
     m_scanStartMs = millis();
     m_combinedScan = false;
     m_scanState = ScanState::BLE_SCANNING;
 
     SystemRequest req;
+    req.cmd = SysCommand::WIFI_PASSIVE_STOP;
+    req.payload = nullptr;
+    SystemTask::getInstance().sendRequest(req);
+
     req.cmd = SysCommand::BLE_SCAN_START;
-    req.payload = (void*)(uintptr_t)10000; // 10 sec duration
+    req.payload = (void*)(uintptr_t)getBleScanProfile(m_bleProfile).durationMs;
     SystemTask::getInstance().sendRequest(req);
     
     if (m_onScanProgress) m_onScanProgress(m_scanState, m_scanProgress);
 }
 
 void VanguardEngine::stopScan() {
+    m_rolling.stop();
+    m_coordinator.stop();
+
     SystemRequest req;
     req.cmd = SysCommand::WIFI_SCAN_STOP;
     SystemTask::getInstance().sendRequest(req);
     
+    req.cmd = SysCommand::WIFI_PASSIVE_STOP;
+    SystemTask::getInstance().sendRequest(req);
+
     req.cmd = SysCommand::BLE_SCAN_STOP;
     SystemTask::getInstance().sendRequest(req);
     
@@ -183,6 +325,102 @@ void VanguardEngine::stopScan() {
     m_combinedScan = false;
 }
 
+void VanguardEngine::setBleScanProfile(BLEScanProfileId id) {
+    if (id == m_bleProfile) return;
+    m_bleProfile = id;
+
+    // Queued ahead of any scan request that follows
+    SystemRequest req;
+    req.cmd = SysCommand::BLE_SET_PROFILE;
+    req.payload = (void*)(uintptr_t)id;
+    SystemTask::getInstance().sendRequest(req);
+
+    if (Serial) Serial.printf("[Engine] BLE scan profile: %s\n", getBleScanProfile(id).name);
+}
+
+BLEScanProfileId VanguardEngine::getBleScanProfile() const {
+    return m_bleProfile;
+}
+
+void VanguardEngine::setTrackerWatch(bool enabled) {
+    if (enabled == m_watch.isActive()) return;
+
+    if (enabled) {
+        m_watch.start(millis());
+    } else {
+        m_watch.stop();
+        yieldWatch();
+    }
+    if (Serial) Serial.printf("[Engine] Tracker watch %s\n", enabled ? "on" : "off");
+}
+
+bool VanguardEngine::isTrackerWatch() const {
+    return m_watch.isActive();
+}
+
+void VanguardEngine::tickWatch() {
+    bool radioFree = !m_actionActive && !m_rolling.isActive() && !m_coordinator.isActive() &&
+                     m_scanState != ScanState::WIFI_SCANNING &&
+                     m_scanState != ScanState::TRANSITIONING_TO_BLE &&
+                     m_scanState != ScanState::BLE_SCANNING;
+
+    uint32_t listenMs = m_watch.nextListen(millis(), radioFree);
+    if (!listenMs) return;
+
+    // Resume, never restart: the registry a foreground scan built stays
+    SystemRequest req;
+    req.cmd = SysCommand::BLE_SCAN_RESUME;
+    req.payload = (void*)(uintptr_t)listenMs;
+    SystemTask::getInstance().sendRequest(req);
+}
+
+void VanguardEngine::yieldWatch() {
+    if (!m_watch.isListening()) return;
+
+    // The listen stays open until this stop's BLE_SCAN_COMPLETE comes
+    // back, so that completion isn't taken for the next scan's
+    SystemRequest req;
+    req.cmd = SysCommand::BLE_SCAN_STOP;
+    SystemTask::getInstance().sendRequest(req);
+}
+
+void VanguardEngine::beginRollingScan(uint16_t channelMask) {
+    if (Serial) Serial.println("[Scan] === BEGIN ROLLING SCAN ===");
+
+    // Active per-channel scans own the radio: passive hopping and BLE
+    // scanning would fight them for it
+    SystemRequest req;
+    req.cmd = SysCommand::WIFI_PASSIVE_STOP;
+    SystemTask::getInstance().sendRequest(req);
+    req.cmd = SysCommand::BLE_SCAN_STOP;
+    SystemTask::getInstance().sendRequest(req);
+
+    // The table stays browsable the whole time
+    m_coordinator.stop();
+    m_combinedScan = false;
+    m_scanState = ScanState::COMPLETE;
+    m_scanProgress = 100;
+    m_rolling.start(millis(), channelMask);
+}
+
+bool VanguardEngine::isRollingScan() const {
+    return m_rolling.isActive();
+}
+
+uint8_t VanguardEngine::getRollingChannel() const {
+    return m_rolling.currentChannel();
+}
+
+void VanguardEngine::tickRolling() {
+    uint8_t channel = m_rolling.nextStep(millis());
+    if (!channel) return;
+
+    SystemRequest req;
+    req.cmd = SysCommand::WIFI_SCAN_START;
+    req.payload = (void*)(uintptr_t)channel;
+    SystemTask::getInstance().sendRequest(req);
+}
+
 // =============================================================================
 // EVENT HANDLING (From Core 0)
 // =============================================================================
@@ -191,24 +429,61 @@ void VanguardEngine::handleSystemEvent(const SystemEvent& evt) {
     switch (evt.type) {
         case SysEventType::WIFI_SCAN_COMPLETE:
         {
-            int count = (int)(intptr_t)evt.data;
+            ScanCompleteEvent* done = (ScanCompleteEvent*)evt.data;
+            int count = done->count;
+            uint8_t channel = done->channel;
+            if (evt.isPointer) delete done;
+
+            // Rolling step: merge this channel and keep going. A step that
+            // outlived its timeout still lands here, never in the one-shot
+            // path below, which would start hopping under the sweep; its
+            // results are gone (the next step's scan replaced them), so it
+            // is dropped rather than credited to the step in flight.
+            if (m_rolling.isActive()) {
+                if (channel != m_rolling.currentChannel()) break;
+                processScanResults(count);
+                uint32_t now = millis();
+                if (m_rolling.completeStep(now, channel)) {
+                    // Per-type ages, and restored targets survive, as in maintenance
+                    size_t pruned = m_targetTable.age(now, AgingPolicy::defaults());
+                    if (Serial && pruned) Serial.printf("[Scan] Sweep done, aged out %u targets\n", (unsigned)pruned);
+                }
+                break;
+            }
+
+            // Combined slice: merge this channel, coordinator picks what's next
+            if (m_coordinator.isActive()) {
+                processScanResults(count);
+                m_coordinator.wifiStepDone(millis());
+                m_scanProgress = m_coordinator.progress();
+                break;
+            }
+
             if (Serial) Serial.printf("[Engine] WiFi Scan Complete: %d\n", count);
             
             // Process results (using Core 1 WiFi API access - safe here?)
             // We assume SystemTask is NOT calling scanDelete yet.
             processScanResults(count);
-            
-            // If combined, start BLE scan
-            if (m_combinedScan) {
-                m_scanState = ScanState::BLE_SCANNING;
-                SystemRequest req;
-                req.cmd = SysCommand::BLE_SCAN_START;
-                req.payload = (void*)(uintptr_t)10000; // 10s
-                SystemTask::getInstance().sendRequest(req);
-            } else {
-                m_scanState = ScanState::COMPLETE;
-                m_scanProgress = 100;
-            }
+            m_scanState = ScanState::COMPLETE;
+            m_scanProgress = 100;
+            startPassiveDiscovery();
+            break;
+        }
+
+        case SysEventType::AP_OBSERVED:
+        {
+            BeaconInfo* info = (BeaconInfo*)evt.data;
+            ingestBeacon(*info);
+            if (evt.isPointer) delete info;
+            break;
+        }
+
+        case SysEventType::PROBE_OBSERVED:
+        {
+            ProbeInfo* probe = (ProbeInfo*)evt.data;
+            m_targetTable.addProbe(probe->station, probe->ssid, probe->ssidLen,
+                                   probe->rssi, probe->channel, millis());
+            if (evt.isPointer) delete probe;
             break;
         }
         
@@ -221,6 +496,7 @@ void VanguardEngine::handleSystemEvent(const SystemEvent& evt) {
             memset(&target, 0, sizeof(Target));
             target.type = TargetType::BLE_DEVICE;
             memcpy(target.bssid, dev->address, 6);
+            target.isRandomAddress = dev->isRandomAddress;
             strncpy(target.ssid, dev->name, SSID_MAX_LEN);
             target.rssi = dev->rssi;
             target.firstSeenMs = dev->lastSeenMs;
@@ -231,8 +507,43 @@ void VanguardEngine::handleSystemEvent(const SystemEvent& evt) {
             break;
         }
         
+        case SysEventType::BLE_BEACON_SEEN:
+        {
+            BLEBeaconInfo* beacon = (BLEBeaconInfo*)evt.data;
+            m_targetTable.addBeacon(*beacon);
+            if (evt.isPointer) delete beacon;
+            break;
+        }
+
+        case SysEventType::BLE_TRACKER_ALERT:
+        {
+            TrackerAlert* alert = (TrackerAlert*)evt.data;
+            FeedbackManager::getInstance().alert();
+            if (Serial) {
+                Serial.printf("[BLE] %s tracker following for %u min (%u addresses, %d dBm)\n",
+                              trackerKindName(alert->kind), (unsigned)(alert->followingMs / 60000),
+                              (unsigned)alert->addresses, alert->rssi);
+            }
+            if (evt.isPointer) delete alert;
+            break;
+        }
+
         case SysEventType::BLE_SCAN_COMPLETE:
         {
+            // A background listen ended (or was stopped for a foreground scan)
+            if (m_watch.isListening()) {
+                m_watch.listenDone(millis());
+                break;
+            }
+
+            if (m_coordinator.isActive()) {
+                size_t bleCount = m_targetTable.countByType(TargetType::BLE_DEVICE);
+                size_t found = (bleCount > m_bleCountAtSlice) ? bleCount - m_bleCountAtSlice : 0;
+                m_coordinator.bleSliceDone(millis(), (uint16_t)found);
+                m_scanProgress = m_coordinator.progress();
+                break;
+            }
+
             if (Serial) Serial.println("[Engine] BLE Scan Complete");
             m_scanState = ScanState::COMPLETE;
             m_scanProgress = 100;
@@ -242,7 +553,9 @@ void VanguardEngine::handleSystemEvent(const SystemEvent& evt) {
         case SysEventType::ASSOCIATION_FOUND:
         {
             AssociationEvent* assoc = (AssociationEvent*)evt.data;
-            if (m_targetTable.addAssociation(assoc->station, assoc->bssid)) {
+            if (m_targetTable.addAssociation(assoc->station, assoc->bssid,
+                                             assoc->rssi, assoc->channel, millis())) {
+                m_journal.association(millis(), assoc->station, assoc->bssid);
                 FeedbackManager::getInstance().pulse(50);
             }
             if (evt.isPointer) delete assoc;
@@ -262,14 +575,25 @@ void VanguardEngine::handleSystemEvent(const SystemEvent& evt) {
         {
             m_actionActive = false;
             m_actionProgress.result = (ActionResult)(intptr_t)evt.data;
+            m_journal.actionStop(millis(), m_actionProgress.result);
             if (m_onActionProgress) m_onActionProgress(m_actionProgress);
             break;
         }
+
+        case SysEventType::CAPTURE_STATS:
+        {
+            CaptureStatsSnapshot* stats = (CaptureStatsSnapshot*)evt.data;
+            m_captureStats = *stats;
+            m_hasCaptureStats = true;
+            if (evt.isPointer) delete stats;
+            break;
+        }
         
         case SysEventType::ERROR_OCCURRED:
         {
             const char* msg = (const char*)evt.data;
             if (Serial) Serial.printf("[Engine] ERROR: %s\n", msg);
+            if (m_actionActive) m_journal.actionStop(millis(), ActionResult::FAILED_HARDWARE);
             m_actionActive = false;
             m_actionProgress.result = ActionResult::FAILED_HARDWARE;
             m_actionProgress.statusText = msg;
@@ -305,214 +629,53 @@ void VanguardEngine::tickScan() {
 }
 
 void VanguardEngine::processScanResults(int count) {
-    for (int i = 0; i < count; i++) {
-        Target target;
-        memset(&target, 0, sizeof(Target));
-
-        // Get BSSID
-        uint8_t* bssid = WiFi.BSSID(i);
-        if (bssid) {
-            memcpy(target.bssid, bssid, 6);
-        }
-
-        // Get SSID
-        String ssid = WiFi.SSID(i);
-        strncpy(target.ssid, ssid.c_str(), SSID_MAX_LEN);
-        target.ssid[SSID_MAX_LEN] = '\0';
-
-        target.type = TargetType::ACCESS_POINT;
-        target.channel = WiFi.channel(i);
-        target.rssi = WiFi.RSSI(i);
-
-        // Map encryption
-        wifi_auth_mode_t enc = WiFi.encryptionType(i);
-        switch (enc) {
-            case WIFI_AUTH_OPEN:
-                target.security = SecurityType::OPEN;
-                break;
-            case WIFI_AUTH_WEP:
-                target.security = SecurityType::WEP;
-                break;
-            case WIFI_AUTH_WPA_PSK:
-                target.security = SecurityType::WPA_PSK;
-                break;
-            case WIFI_AUTH_WPA2_PSK:
-            case WIFI_AUTH_WPA_WPA2_PSK:
-                target.security = SecurityType::WPA2_PSK;
-                break;
-            case WIFI_AUTH_WPA2_ENTERPRISE:
-                target.security = SecurityType::WPA2_ENTERPRISE;
-                break;
-            case WIFI_AUTH_WPA3_PSK:
-                target.security = SecurityType::WPA3_SAE;
-                break;
-            default:
-                target.security = SecurityType::UNKNOWN;
-        }
+    // One pass over the driver's records into preallocated buffers, then
+    // a single batched upsert - no String or per-entry Target setup
+    size_t n = BruceWiFi::getInstance().collectScanRecords(m_scanIngest);
+    m_targetTable.upsertBatch(m_scanIngest.map(millis()), n);
 
-        target.isHidden = (strlen(target.ssid) == 0);
-        if (target.isHidden) {
-            strcpy(target.ssid, "[Hidden]");
-        }
-
-        target.firstSeenMs = millis();
-        target.lastSeenMs = millis();
-        target.beaconCount = 1;
-        target.clientCount = 0;
-
-        m_targetTable.addOrUpdate(target);
+    if (Serial && (int)n < count) {
+        Serial.printf("[Scan] Kept strongest %u of %d APs\n", (unsigned)n, count);
     }
 
     WiFi.scanDelete();  // Free memory
-
-    // If combined scan, start NON-BLOCKING transition to BLE
-    if (m_combinedScan) {
-        if (Serial) {
-            Serial.println("[Scan] WiFi done, starting BLE transition...");
-        }
-
-        // Start the transition state machine
-        m_scanState = ScanState::TRANSITIONING_TO_BLE;
-        m_transitionStep = 0;
-        m_transitionStartMs = millis();
-        m_bleInitAttempts = 0;
-        m_scanProgress = 46;  // Just past WiFi
-
-        if (m_onScanProgress) {
-            m_onScanProgress(m_scanState, m_scanProgress);
-        }
-    } else {
-        m_scanState = ScanState::COMPLETE;
-        m_scanProgress = 100;
-
-        if (m_onScanProgress) {
-            m_onScanProgress(m_scanState, m_scanProgress);
-        }
-    }
 }
 
 // =============================================================================
-// NON-BLOCKING WIFI→BLE TRANSITION
+// PASSIVE DISCOVERY
 // =============================================================================
 
-void VanguardEngine::tickTransition() {
-    // State machine for WiFi→BLE transition
-    // Each step does minimal work and returns, next tick continues
-    uint32_t elapsed = millis() - m_transitionStartMs;
-
-    switch (m_transitionStep) {
-        case 0:
-            // Step 0: Stop WiFi activity
-            BruceWiFi::getInstance().onDisable();
-            m_transitionStep = 2; // Warden makes transition faster, jump to BLE
-            m_transitionStartMs = millis();
-            m_scanProgress = 46;
-            if (Serial) Serial.println("[Trans] Step 0: WiFi disable");
-            break;
-
-
-        case 2:
-            // Step 2: Wait 100ms for radio to fully stop
-            if (elapsed >= 100) {
-                BruceBLE& ble = BruceBLE::getInstance();
-                ble.shutdown();
-                m_transitionStep = 3;
-                m_transitionStartMs = millis();
-                m_scanProgress = 48;
-                if (Serial) Serial.println("[Trans] Step 2: BLE shutdown");
-            }
-            break;
+void VanguardEngine::startPassiveDiscovery() {
+    if (Serial) Serial.println("[Scan] Handing off to passive discovery");
 
-        case 3:
-            // Step 3: Wait 50ms, then try BLE init
-            if (elapsed >= 50) {
-                m_transitionStep = 4;
-                m_transitionStartMs = millis();
-                m_bleInitAttempts = 0;
-                if (Serial) Serial.println("[Trans] Step 3: Ready for BLE init");
-            }
-            break;
-
-        case 4:
-            // Step 4: Try BLE init (one attempt per tick)
-            {
-                BruceBLE& ble = BruceBLE::getInstance();
-                m_bleInitAttempts++;
-
-                if (Serial) {
-                    Serial.printf("[Trans] Step 4: BLE init attempt %d\n", m_bleInitAttempts);
-                }
-
-                bool initOk = ble.init();
-
-                if (initOk) {
-                    // Success! Start BLE scan
-                    m_transitionStep = 5;
-                    m_transitionStartMs = millis();
-                    m_scanProgress = 49;
-                    if (Serial) Serial.println("[Trans] BLE init SUCCESS");
-                } else if (m_bleInitAttempts >= 3) {
-                    // Failed after 3 attempts, complete without BLE
-                    if (Serial) Serial.println("[Trans] BLE init FAILED, completing without BLE");
-                    m_scanState = ScanState::COMPLETE;
-                    m_scanProgress = 100;
-                    if (m_onScanProgress) {
-                        m_onScanProgress(m_scanState, m_scanProgress);
-                    }
-                } else {
-                    // Wait before retry
-                    m_transitionStep = 100;  // Wait state
-                    m_transitionStartMs = millis();
-                }
-            }
-            break;
-
-        case 5:
-            // Step 5: Start BLE scan
-            {
-                BruceBLE& ble = BruceBLE::getInstance();
-                ble.beginScan(3000);
-
-                m_scanState = ScanState::BLE_SCANNING;
-                m_scanProgress = 50;
-                m_scanStartMs = millis();
-
-                if (Serial) Serial.println("[Trans] Step 5: BLE scan started");
-
-                if (m_onScanProgress) {
-                    m_onScanProgress(m_scanState, m_scanProgress);
-                }
-            }
-            break;
+    SystemRequest req;
+    req.cmd = SysCommand::WIFI_PASSIVE_START;
+    req.payload = (void*)(uintptr_t)0;  // Hop all channels
+    req.freeCb = nullptr;
+    SystemTask::getInstance().sendRequest(req);
+}
 
-        case 100:
-            // Wait state: wait 100ms before retrying BLE init
-            if (elapsed >= 100) {
-                m_transitionStep = 4;
-                m_transitionStartMs = millis();
-            }
-            break;
+void VanguardEngine::ingestBeacon(const BeaconInfo& info) {
+    Target target;
+    memset(&target, 0, sizeof(Target));
 
-        default:
-            // Shouldn't happen, force complete
-            m_scanState = ScanState::COMPLETE;
-            m_scanProgress = 100;
-            break;
+    memcpy(target.bssid, info.bssid, 6);
+    memcpy(target.ssid, info.ssid, sizeof(target.ssid));
+    target.type = TargetType::ACCESS_POINT;
+    target.channel = info.channel;
+    target.rssi = info.rssi;
+    target.security = info.security;
+    target.isHidden = info.isHidden;
+    if (target.isHidden) {
+        strcpy(target.ssid, "[Hidden]");
     }
 
-    // Safety timeout for entire transition: 5 seconds
-    if (m_scanState == ScanState::TRANSITIONING_TO_BLE) {
-        // Check total transition time (from first step)
-        // We can't easily track this without another var, so use a generous per-step timeout
-        if (elapsed > 2000) {
-            if (Serial) Serial.println("[Trans] Step timeout, completing without BLE");
-            m_scanState = ScanState::COMPLETE;
-            m_scanProgress = 100;
-            if (m_onScanProgress) {
-                m_onScanProgress(m_scanState, m_scanProgress);
-            }
-        }
-    }
+    uint32_t now = millis();
+    target.firstSeenMs = now;
+    target.lastSeenMs = now;
+    target.beaconCount = 1;
+
+    m_targetTable.addOrUpdate(target);
 }
 
 void VanguardEngine::processBLEScanResults() {
@@ -535,6 +698,7 @@ void VanguardEngine::processBLEScanResults() {
         target.ssid[SSID_MAX_LEN] = '\0';
 
         target.type = TargetType::BLE_DEVICE;
+        target.isRandomAddress = device.isRandomAddress;
         target.channel = 0;  // BLE doesn't use WiFi channels
         target.rssi = device.rssi;
         target.security = SecurityType::UNKNOWN;  // BLE security is different
@@ -585,7 +749,36 @@ const Target* VanguardEngine::findTarget(const uint8_t* bssid) const {
 }
 
 void VanguardEngine::clearTargets() {
+    clearTable();
+}
+
+void VanguardEngine::clearTable() {
     m_targetTable.clear();
+    m_journal.tableCleared(millis());
+}
+
+size_t VanguardEngine::getRestoredCount() const {
+    return m_restoredCount;
+}
+
+size_t VanguardEngine::getClientCount(const uint8_t* bssid) const {
+    return m_targetTable.stations().clientCount(bssid);
+}
+
+size_t VanguardEngine::getClients(const uint8_t* bssid, AssociationEdge* out, size_t max) const {
+    return m_targetTable.associations().stationsOf(bssid, out, max);
+}
+
+size_t VanguardEngine::getApsFor(const uint8_t* station, AssociationEdge* out, size_t max) const {
+    return m_targetTable.associations().apsOf(station, out, max);
+}
+
+const Station* VanguardEngine::getStation(const uint8_t* mac) const {
+    return m_targetTable.stations().find(mac);
+}
+
+size_t VanguardEngine::getProbedSsids(const uint8_t* station, const char** out, size_t max) const {
+    return m_targetTable.probes().ssidsOf(station, out, max);
 }
 
 // =============================================================================
@@ -603,6 +796,11 @@ bool VanguardEngine::executeAction(ActionType action, const Target& target, cons
     m_actionProgress.packetsSent = 0;
     m_actionProgress.elapsedMs = 0;
     m_actionProgress.statusText = "Starting...";
+    m_hasCaptureStats = false;
+    m_rolling.stop();   // Attacks need the radio
+    m_coordinator.stop();
+    yieldWatch();
+    m_combinedScan = false;
     m_actionStartMs = millis();
     m_actionActive = true;
 
@@ -614,6 +812,8 @@ bool VanguardEngine::executeAction(ActionType action, const Target& target, cons
         return false;
     }
 
+    m_journal.actionStart(m_actionStartMs, action, target.bssid);
+
     // Allocate Request Payload
     ActionRequest* req = new ActionRequest();
     req->type = action;
@@ -662,6 +862,12 @@ void VanguardEngine::onActionProgress(ActionProgressCallback cb) {
     m_onActionProgress = cb;
 }
 
+bool VanguardEngine::getCaptureStats(CaptureStatsSnapshot& out) const {
+    if (!m_hasCaptureStats) return false;
+    out = m_captureStats;
+    return true;
+}
+
 void VanguardEngine::tickAction() {
     // Logic moved to System Task (Core 0)
     // We update via IPC events now.
@@ -30,6 +30,14 @@
 #include "TargetTable.h"
 #include "TargetTable.h"
 #include "ActionResolver.h"
+#include "CaptureStats.h"
+#include "ScanIngest.h"
+#include "RollingScan.h"
+#include "ScanCoordinator.h"
+#include "TrackerWatch.h"
+#include "TargetStore.h"
+#include "SessionJournal.h"
+#include "BLEScanProfile.h"
 #include "IPC.h"
 #include <functional>
 
@@ -39,6 +47,7 @@ namespace Vanguard {
 class BruceWiFi;
 class BruceBLE;
 class BruceIR;
+struct BeaconInfo;
 
 /**
  * @brief Callback for scan progress updates
@@ -92,8 +101,9 @@ public:
 
     /**
      * @brief Start a full scan (WiFi + BLE)
-     * Non-blocking. WiFi scans first, then BLE automatically chains.
-     * Check getScanState() for progress.
+     * Non-blocking. WiFi and BLE share the radio under coexistence and
+     * alternate short slices (see ScanCoordinator); BLE stops early once
+     * it stops finding new devices. Check getScanState() for progress.
      */
     void beginScan();
 
@@ -107,6 +117,27 @@ public:
      */
     void beginBLEScan();
 
+    /**
+     * @brief Keep re-scanning WiFi one channel at a time
+     *
+     * Merges each channel's results into the existing table (nothing is
+     * cleared) and ages out APs not seen for TARGET_AGE_TIMEOUT after
+     * every full sweep. Any other scan, stopScan() or an action ends it.
+     *
+     * @param channelMask Bit N = channel N (0 = all channels)
+     */
+    void beginRollingScan(uint16_t channelMask = 0);
+
+    /**
+     * @brief Check if a rolling scan is running
+     */
+    bool isRollingScan() const;
+
+    /**
+     * @brief Channel the rolling scan is on (0 if between steps)
+     */
+    uint8_t getRollingChannel() const;
+
     /**
      * @brief Check if this is a combined scan that will include BLE
      */
@@ -132,6 +163,28 @@ public:
      */
     void onScanProgress(ScanProgressCallback cb);
 
+    /**
+     * @brief Choose the BLE scan duty cycle
+     *
+     * Applies from the next BLE scan or slice; a standalone BLE scan
+     * runs for the profile's durationMs.
+     */
+    void setBleScanProfile(BLEScanProfileId id);
+    BLEScanProfileId getBleScanProfile() const;
+
+    /**
+     * @brief Keep listening for BLE trackers in the background
+     *
+     * Duty-cycled BLE listens (see TrackerWatch) whenever no scan or
+     * action has the radio, so TrackerDetector hears a tracker often
+     * enough to tell that it's following us. Devices heard land in the
+     * table like any other scan's; nothing is cleared. The idle radio
+     * goes to BLE, so passive WiFi discovery after a scan ends at the
+     * first listen.
+     */
+    void setTrackerWatch(bool enabled);
+    bool isTrackerWatch() const;
+
     // -------------------------------------------------------------------------
     // Targets
     // -------------------------------------------------------------------------
@@ -162,6 +215,39 @@ public:
      */
     void clearTargets();
 
+    /**
+     * @brief Targets loaded from the boot snapshot
+     * They stay marked Target::isRestored until seen live again.
+     */
+    size_t getRestoredCount() const;
+
+    /**
+     * @brief Stations last seen talking to this AP (not capped at MAX_CLIENTS_PER_AP)
+     */
+    size_t getClientCount(const uint8_t* bssid) const;
+
+    /**
+     * @brief Stations seen with this AP, most recently seen first
+     * @return Number copied to out
+     */
+    size_t getClients(const uint8_t* bssid, AssociationEdge* out, size_t max) const;
+
+    /**
+     * @brief APs this station has been seen with, most recently seen first
+     */
+    size_t getApsFor(const uint8_t* station, AssociationEdge* out, size_t max) const;
+
+    /**
+     * @brief Station table entry, nullptr if not tracked
+     */
+    const Station* getStation(const uint8_t* mac) const;
+
+    /**
+     * @brief Networks this station has probed for, most recent first
+     * @return Number written to out; strings valid until the next tick()
+     */
+    size_t getProbedSsids(const uint8_t* station, const char** out, size_t max) const;
+
     // -------------------------------------------------------------------------
     // Actions
     // -------------------------------------------------------------------------
@@ -202,6 +288,12 @@ public:
      */
     void onActionProgress(ActionProgressCallback cb);
 
+    /**
+     * @brief Latest capture pipeline counters (1 Hz while logging)
+     * @return false if no sample has arrived for the current action
+     */
+    bool getCaptureStats(CaptureStatsSnapshot& out) const;
+
     // -------------------------------------------------------------------------
     // Hardware Status
     // -------------------------------------------------------------------------
@@ -236,11 +328,21 @@ private:
     uint8_t        m_scanProgress;
     bool           m_actionActive;
     ActionProgress m_actionProgress;
-    bool           m_combinedScan;  // true if BLE should chain after WiFi
+    bool           m_combinedScan;  // true while the coordinator drives the scan
+    CaptureStatsSnapshot m_captureStats;
+    bool           m_hasCaptureStats;
 
     // Components
     TargetTable    m_targetTable;
     ActionResolver m_actionResolver;
+    ScanIngest     m_scanIngest;     // Reused by every scan
+    RollingScan    m_rolling;
+    ScanCoordinator m_coordinator;   // Combined WiFi/BLE slicing
+    TrackerWatch   m_watch;          // Background BLE listens
+    TargetStore    m_store;          // Table snapshot on SD
+    SessionJournal m_journal;        // Event log, drained to SD each second
+    char           m_journalPath[32];
+    ScanState      m_journaledState;
 
     // Adapters (lazy-initialized)
     // BruceWiFiAdapter* m_wifiAdapter;
@@ -253,16 +355,26 @@ private:
     // Timing
     uint32_t m_scanStartMs;
     uint32_t m_actionStartMs;
+    uint32_t m_lastSnapshotMs;
+    uint32_t m_lastJournalMs;
+    uint32_t m_lastGraphMs;
+    size_t   m_restoredCount;
 
-    // BLE transition state machine (non-blocking)
-    uint8_t  m_transitionStep;     // Current step in WiFi→BLE transition
-    uint32_t m_transitionStartMs;  // When current step started
-    uint8_t  m_bleInitAttempts;    // Number of BLE init retry attempts
+    size_t   m_bleCountAtSlice;    // BLE targets when the current slice began
+    BLEScanProfileId m_bleProfile;
 
     // Internal tick handlers
     void tickScan();
+    void tickRolling();
     void tickAction();
-    void tickTransition();  // Handle WiFi→BLE transition steps
+    void tickCombined();    // Issue the coordinator's next slice
+    void tickWatch();       // Background BLE listen, when the radio is free
+    void yieldWatch();      // A foreground scan or action takes the radio
+    void tickSnapshot();    // Periodic incremental table save
+    void tickJournal();     // Log scan phase changes, flush the journal
+    void tickAssociations(); // Expire idle links, probing stations and aged targets; compact the graph
+    void startJournal();
+    void clearTable();      // Clear + journal it
     void setActionProgressCallback(ActionProgressCallback cb);
 
     /**
@@ -273,6 +385,12 @@ private:
     // Internal helpers
     void processScanResults(int count);
     void processBLEScanResults(); // Replaced by event handling? No, may still use for batching if needed
+
+    /**
+     * @brief Keep the target list live from beacons after a WiFi scan
+     */
+    void startPassiveDiscovery();
+    void ingestBeacon(const BeaconInfo& info);
 };
 
 } // namespace Vanguard
@@ -21,6 +21,7 @@ namespace Vanguard {
 constexpr size_t   MAX_TARGETS          = 64;
 constexpr size_t   SSID_MAX_LEN         = 32;  // Renamed to avoid ESP-IDF conflict
 constexpr size_t   MAX_CLIENTS_PER_AP   = 16;
+constexpr size_t   BLE_DEVICE_MAX_UUIDS = 4;   // 16-bit service UUIDs kept per device
 constexpr uint8_t  WIFI_CHANNEL_MIN     = 1;
 constexpr uint8_t  WIFI_CHANNEL_MAX     = 14;
 constexpr uint32_t SCAN_TIMEOUT_MS      = 15000;
@@ -167,9 +168,20 @@ struct wifi_data_frame_header_t {
 
 // Frame types
 constexpr uint8_t WIFI_TYPE_MGMT = 0x00;
+constexpr uint8_t WIFI_TYPE_CTRL = 0x01;
 constexpr uint8_t WIFI_TYPE_DATA = 0x02;
 
-// Subtypes
+// Management subtypes
+constexpr uint8_t WIFI_SUBTYPE_ASSOC_REQ  = 0x00;
+constexpr uint8_t WIFI_SUBTYPE_ASSOC_RESP = 0x01;
+constexpr uint8_t WIFI_SUBTYPE_PROBE_REQ  = 0x04;
+constexpr uint8_t WIFI_SUBTYPE_PROBE_RESP = 0x05;
+constexpr uint8_t WIFI_SUBTYPE_BEACON     = 0x08;
+constexpr uint8_t WIFI_SUBTYPE_DISASSOC   = 0x0A;
+constexpr uint8_t WIFI_SUBTYPE_AUTH       = 0x0B;
+constexpr uint8_t WIFI_SUBTYPE_DEAUTH     = 0x0C;
+
+// Data subtypes
 constexpr uint8_t WIFI_SUBTYPE_DATA = 0x00;
 constexpr uint8_t WIFI_SUBTYPE_QOS_DATA = 0x08;
 
@@ -188,6 +200,7 @@ struct Target {
     uint8_t      bssid[6];                   // MAC address
     char         ssid[SSID_MAX_LEN + 1];     // Network name (null-terminated)
     TargetType   type;
+    bool         isRandomAddress;            // BLE: random address (see TargetAging.h)
 
     // RF characteristics
     uint8_t      channel;
@@ -201,6 +214,7 @@ struct Target {
     uint8_t      clientMacs[MAX_CLIENTS_PER_AP][6]; // Track specific clients
     bool         isHidden;                   // Hidden SSID
     bool         hasHandshake;               // We captured a handshake
+    bool         isRestored;                 // From the boot snapshot, not seen live yet
 
     // Metadata
     uint32_t     firstSeenMs;
@@ -263,6 +277,35 @@ struct Target {
     }
 };
 
+/**
+ * @brief Discovered BLE device info
+ *
+ * Filled by the BLE adapter from advertisements; kept in BLERegistry.
+ */
+struct BLEDeviceInfo {
+    uint8_t      address[6];     // BLE MAC address
+    bool         isRandomAddress; // Private or static random, not public
+    char         name[32];       // Device name (if advertised)
+    int8_t       rssi;           // Signal strength
+    uint16_t     appearance;     // Device appearance code
+    bool         isConnectable;  // Can we connect?
+    bool         hasServices;    // Advertises services?
+    uint32_t     lastSeenMs;
+
+    // Manufacturer data (for detection)
+    uint16_t     manufacturerId;
+    uint8_t      manufacturerData[32];
+    uint8_t      manufacturerDataLen;
+
+    // Rest of the advertising data (see AdvertFields)
+    uint8_t      flags;          // AD flags, 0 if not advertised
+    int8_t       txPower;        // dBm, 127 if not advertised
+    uint8_t      serviceUuidCount;
+    uint16_t     serviceUuids[BLE_DEVICE_MAX_UUIDS];
+
+    uint8_t      signature;      // BLESignatureSet match at ingest, 0 = none
+};
+
 /**
  * @brief Describes an available action for a target
  *
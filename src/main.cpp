@@ -63,11 +63,30 @@ static uint32_t g_lastKeyMs = 0;  // Debounce
 #include <Wire.h>
 static constexpr uint32_t KEY_DEBOUNCE_MS = 50;
 static bool g_consumeNextInput = false;  // Prevents key "bleed-through" after menu actions
+static bool g_menuOpen = false;          // Menu sprite is over the current screen
+
+/**
+ * Call before anything but the radar draws to M5Cardputer.Display: the
+ * radar's last frame may still be going out by DMA, with LcdSink holding
+ * the write transaction open until the pipeline is fenced.
+ */
+void releaseDisplay() {
+    if (g_radar) {
+        g_radar->fence();
+    }
+}
 
 void setAppState(AppState newState) {
     if (Serial) {
         Serial.printf("[STATE] %d -> %d\n", (int)g_state, (int)newState);
     }
+    // Whatever screen we came from is still on the display
+    if (newState == AppState::RADAR && newState != g_state && g_radar) {
+        g_radar->invalidate();
+    }
+    if (newState != g_state) {
+        releaseDisplay();
+    }
     g_state = newState;
 }
 
@@ -201,6 +220,15 @@ void loop() {
     // Handle keyboard input globally
     handleKeyboardInput();
 
+    // The menu just closed (hidden or selected): its sprite is still on the
+    // panel, and the radar only re-pushes rows it changed
+    if (g_menuOpen && !(g_menu && g_menu->isVisible())) {
+        g_menuOpen = false;
+        if (g_radar) {
+            g_radar->invalidate();
+        }
+    }
+
     // Check for pending menu action FIRST (even if menu closed)
     if (g_menu && g_menu->hasAction()) {
         g_consumeNextInput = true;  // Prevent key "bleed-through" to next state
@@ -235,6 +263,7 @@ void loop() {
 
     // If menu is visible, render it on top
     if (g_menu && g_menu->isVisible()) {
+        releaseDisplay();
         g_menu->tick();
         g_menu->render();
         yield();
@@ -266,6 +295,13 @@ void loop() {
             }
 
             if (g_boot->isComplete()) {
+                // Known targets from the last session: straight to the radar
+                // ('R' rescans, 'Q' opens the Scan Selector)
+                if (g_engine->getRestoredCount() > 0) {
+                    if (Serial) Serial.println(F("[VANGUARD] Boot complete. Showing remembered targets."));
+                    setAppState(AppState::RADAR);
+                    break;
+                }
                 if (Serial) Serial.println(F("[VANGUARD] Boot complete. Showing Scan Selector."));
                 // Transition to scan selection screen
                 g_scanSelector->show();
@@ -387,6 +423,8 @@ void loop() {
                 if (g_settings->wantsBack()) {
                     g_settings->clearBack();
                     g_settings->hide();
+                    g_engine->setBleScanProfile(g_settings->getBleScanProfile());
+                    g_engine->setTrackerWatch(g_settings->getTrackerWatch());
                     setAppState(AppState::RADAR);
                 }
             } else {
@@ -485,6 +523,7 @@ void handleKeyboardInput() {
         if (M5Cardputer.Keyboard.isKeyPressed('m') || M5Cardputer.Keyboard.isKeyPressed('M')) {
             if (g_menu) {
                 g_menu->show();
+                g_menuOpen = true;
             }
             return;
         }
@@ -515,6 +554,16 @@ void handleKeyboardInput() {
             if (Serial) Serial.println(F("[VANGUARD] Rescan triggered"));
             return;
         }
+        // 'L' - Toggle live (rolling) scan, stays on the radar.
+        // Edge-triggered so holding the key doesn't flap the mode
+        if (hasChange && (M5Cardputer.Keyboard.isKeyPressed('l') || M5Cardputer.Keyboard.isKeyPressed('L'))) {
+            if (g_engine->isRollingScan()) {
+                g_engine->stopScan();
+            } else {
+                g_engine->beginRollingScan();
+            }
+            return;
+        }
         // 'Q' - Back to Scan Selector
         if (M5Cardputer.Keyboard.isKeyPressed('q') || M5Cardputer.Keyboard.isKeyPressed('Q')) {
             g_engine->stopScan();
@@ -617,6 +666,10 @@ void handleKeyboardInput() {
             M5Cardputer.Keyboard.isKeyPressed('q') ||
             M5Cardputer.Keyboard.isKeyPressed('`')) {
             g_settings->hide();
+            if (g_engine) {
+                g_engine->setBleScanProfile(g_settings->getBleScanProfile());
+                g_engine->setTrackerWatch(g_settings->getTrackerWatch());
+            }
             setAppState(AppState::RADAR);
         }
     }
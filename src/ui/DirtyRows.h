@@ -0,0 +1,161 @@
+#ifndef VANGUARD_DIRTY_ROWS_H
+#define VANGUARD_DIRTY_ROWS_H
+
+/**
+ * @file DirtyRows.h
+ * @brief Which screen regions changed since the last push
+ *
+ * A full 240x135 RGB565 frame is 64,800 bytes over SPI. Most radar
+ * frames change one RSSI figure, so the view splits into fixed regions
+ * (header, list rows, scroll bar) and keeps a signature of what each one
+ * last showed. A region is redrawn and pushed only when its signature
+ * changes; anything that moves the layout (popup, empty state, another
+ * screen drawn over ours) invalidates the lot and the next frame is full.
+ *
+ * Signatures are FNV-1a over exactly the values a region draws, so a
+ * target re-sorted into another row dirties both rows it touched and
+ * nothing else.
+ *
+ * @example
+ * if (dirty.update(REGION_ROW0 + i, radarRowSignature(t, highlighted, now))) {
+ *     drawRow(i);
+ *     push(rowRect(i));
+ * }
+ * dirty.endFrame(micros() - start);
+ */
+
+#include "../core/VanguardTypes.h"
+#include <cstring>
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t   DIRTY_MAX_REGIONS = 8;
+constexpr uint32_t DIRTY_EMPTY       = 0;     // Signature of a blank region
+constexpr size_t   DIRTY_PIXEL_BYTES = 2;     // RGB565
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+struct DirtyRect {
+    int16_t x, y, w, h;
+
+    uint32_t bytes() const { return (uint32_t)w * (uint32_t)h * DIRTY_PIXEL_BYTES; }
+};
+
+/**
+ * @brief Push traffic since the last reset
+ */
+struct FrameStats {
+    uint32_t frames;
+    uint32_t fullFrames;
+    uint32_t bytes;              // Pixels pushed x 2
+    uint32_t renderUs;           // Compose + push
+
+    uint32_t bytesPerFrame() const { return frames ? bytes / frames : 0; }
+    uint32_t usPerFrame() const { return frames ? renderUs / frames : 0; }
+};
+
+// =============================================================================
+// SIGNATURES
+// =============================================================================
+
+inline uint32_t dirtyHash(uint32_t h, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) h = (h ^ p[i]) * 0x01000193u;
+    return h;
+}
+
+inline uint32_t dirtyHashStr(uint32_t h, const char* s) {
+    return dirtyHash(h, s, strlen(s) + 1);
+}
+
+/**
+ * @brief Signature of one radar list row as drawn
+ *
+ * Remembered targets show their age instead of RSSI; it only changes
+ * once a minute, so that is all the signature sees of it.
+ */
+inline uint32_t radarRowSignature(const Target& t, bool highlighted, uint32_t now) {
+    uint32_t h = 0x811C9DC5u;
+    h = dirtyHash(h, &t.type, sizeof(t.type));
+    h = dirtyHashStr(h, t.ssid);
+    h = dirtyHash(h, &highlighted, sizeof(highlighted));
+    h = dirtyHash(h, &t.isRestored, sizeof(t.isRestored));
+    if (t.isRestored) {
+        uint32_t minutes = (now - t.lastSeenMs) / 60000;
+        h = dirtyHash(h, &minutes, sizeof(minutes));
+    } else {
+        h = dirtyHash(h, &t.rssi, sizeof(t.rssi));
+    }
+    h = dirtyHash(h, &t.security, sizeof(t.security));
+    h = dirtyHash(h, &t.channel, sizeof(t.channel));
+    h = dirtyHash(h, &t.clientCount, sizeof(t.clientCount));
+    return (h == DIRTY_EMPTY) ? 1 : h;
+}
+
+// =============================================================================
+// DirtyRows Class
+// =============================================================================
+
+class DirtyRows {
+public:
+    DirtyRows() {
+        memset(m_shown, 0, sizeof(m_shown));
+        invalidate();
+        resetStats();
+    }
+
+    /**
+     * @brief Forget what is on screen; the next frame is pushed whole
+     */
+    void invalidate() { m_full = true; }
+
+    bool isFull() const { return m_full; }
+
+    /**
+     * @brief Record what a region shows now
+     * @return true if it must be redrawn (changed, or a full frame)
+     */
+    bool update(size_t region, uint32_t signature) {
+        if (region >= DIRTY_MAX_REGIONS) return true;
+        bool changed = m_full || m_shown[region] != signature;
+        m_shown[region] = signature;
+        return changed;
+    }
+
+    /**
+     * @brief Count a pushed rectangle toward this frame
+     */
+    void pushed(const DirtyRect& rect) { m_frameBytes += rect.bytes(); }
+    void pushed(uint32_t bytes) { m_frameBytes += bytes; }
+
+    /**
+     * @brief Close the frame, whether or not anything was pushed
+     */
+    void endFrame(uint32_t renderUs) {
+        m_stats.frames++;
+        if (m_full) m_stats.fullFrames++;
+        m_stats.bytes += m_frameBytes;
+        m_stats.renderUs += renderUs;
+        m_full = false;
+        m_frameBytes = 0;
+    }
+
+    const FrameStats& stats() const { return m_stats; }
+    void resetStats() { memset(&m_stats, 0, sizeof(m_stats)); m_frameBytes = 0; }
+
+private:
+    uint32_t   m_shown[DIRTY_MAX_REGIONS];
+    bool       m_full;
+    uint32_t   m_frameBytes;
+    FrameStats m_stats;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_DIRTY_ROWS_H
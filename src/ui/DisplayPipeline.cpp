@@ -0,0 +1,158 @@
+/**
+ * @file DisplayPipeline.cpp
+ * @brief Strip queue, fence and buffer swap
+ */
+
+#include "DisplayPipeline.h"
+#include <cstring>
+
+namespace Vanguard {
+
+DisplayPipeline::DisplayPipeline(DisplaySink& sink, int16_t width, int16_t height)
+    : m_sink(sink)
+    , m_width(width)
+    , m_height(height)
+    , m_back(0)
+    , m_source(nullptr)
+    , m_stripCount(0)
+    , m_nextStrip(0)
+    , m_active(false)
+{
+    m_buffers[0] = nullptr;
+    m_buffers[1] = nullptr;
+    resetStats();
+}
+
+void DisplayPipeline::attach(uint16_t* first, uint16_t* second) {
+    fence();
+    m_buffers[0] = first;
+    m_buffers[1] = second;
+    m_back = 0;
+}
+
+// =============================================================================
+// FLUSH
+// =============================================================================
+
+uint32_t DisplayPipeline::flush(const DirtyRect* rects, size_t count) {
+    if (!m_buffers[0]) return 0;
+
+    Strip strips[DISPLAY_MAX_STRIPS];
+    size_t n = coalesce(rects, count, strips);
+    if (n == 0) return 0;
+
+    // The fence: the buffer we're about to copy into was the one on its
+    // way to the panel
+    if (m_active && (m_nextStrip < m_stripCount || m_sink.busy())) m_stats.stalls++;
+    fence();
+
+    uint16_t* sent = m_buffers[m_back];
+    uint32_t bytes = 0;
+    for (size_t i = 0; i < n; i++) {
+        m_strips[i] = strips[i];
+        bytes += (uint32_t)strips[i].h * m_width * DIRTY_PIXEL_BYTES;
+    }
+    m_source = sent;
+    m_stripCount = n;
+    m_nextStrip = 0;
+    startNext();
+
+    m_stats.flushes++;
+    m_stats.strips += n;
+    m_stats.bytes += bytes;
+
+    if (!isDoubleBuffered()) {
+        fence();
+        return bytes;
+    }
+
+    // DMA only reads the sent buffer, so bring the other one up to date
+    // alongside it, then compose there next
+    uint16_t* next = m_buffers[m_back ^ 1];
+    for (size_t i = 0; i < n; i++) {
+        size_t offset = (size_t)strips[i].y * m_width;
+        memcpy(next + offset, sent + offset, (size_t)strips[i].h * m_width * sizeof(uint16_t));
+    }
+    m_back ^= 1;
+    return bytes;
+}
+
+void DisplayPipeline::poll() {
+    if (!m_active || m_sink.busy()) return;
+    if (m_nextStrip < m_stripCount) {
+        startNext();
+    } else {
+        m_sink.finish();        // Done: only releases the bus
+        m_active = false;
+    }
+}
+
+void DisplayPipeline::fence() {
+    while (m_active) {
+        m_sink.finish();
+        m_active = false;
+        if (m_nextStrip < m_stripCount) startNext();
+    }
+}
+
+void DisplayPipeline::resetStats() {
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+// =============================================================================
+// STRIPS
+// =============================================================================
+
+size_t DisplayPipeline::coalesce(const DirtyRect* rects, size_t count, Strip* out) const {
+    // Rows [top, bottom), clipped to the screen, sorted by top
+    int16_t top[DIRTY_MAX_REGIONS * 2];
+    int16_t bottom[DIRTY_MAX_REGIONS * 2];
+    size_t n = 0;
+    for (size_t i = 0; i < count && n < DIRTY_MAX_REGIONS * 2; i++) {
+        int16_t t = rects[i].y < 0 ? 0 : rects[i].y;
+        int32_t b = (int32_t)rects[i].y + rects[i].h;
+        if (b > m_height) b = m_height;
+        if (rects[i].w <= 0 || b <= t) continue;
+
+        size_t j = n++;
+        while (j > 0 && top[j - 1] > t) {
+            top[j] = top[j - 1];
+            bottom[j] = bottom[j - 1];
+            j--;
+        }
+        top[j] = t;
+        bottom[j] = (int16_t)b;
+    }
+
+    // Merge what overlaps or touches
+    size_t strips = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (strips > 0 && top[i] <= out[strips - 1].y + out[strips - 1].h) {
+            Strip& s = out[strips - 1];
+            if (bottom[i] > s.y + s.h) s.h = (int16_t)(bottom[i] - s.y);
+            continue;
+        }
+        if (strips == DISPLAY_MAX_STRIPS) {
+            // Too scattered: one strip from the first row to the last
+            int16_t last = 0;
+            for (size_t k = 0; k < n; k++) {
+                if (bottom[k] > last) last = bottom[k];
+            }
+            out[0].y = top[0];
+            out[0].h = (int16_t)(last - top[0]);
+            return 1;
+        }
+        out[strips].y = top[i];
+        out[strips].h = (int16_t)(bottom[i] - top[i]);
+        strips++;
+    }
+    return strips;
+}
+
+void DisplayPipeline::startNext() {
+    const Strip& s = m_strips[m_nextStrip++];
+    m_sink.push(s.y, s.h, m_source + (size_t)s.y * m_width);
+    m_active = true;
+}
+
+} // namespace Vanguard
@@ -0,0 +1,157 @@
+#ifndef VANGUARD_DISPLAY_PIPELINE_H
+#define VANGUARD_DISPLAY_PIPELINE_H
+
+/**
+ * @file DisplayPipeline.h
+ * @brief Double-buffered, asynchronous frame flush
+ *
+ * A blocking push holds the UI loop for the whole SPI transfer, ~13 ms
+ * for a full frame, and input and engine event draining wait behind it.
+ * The pipeline instead keeps two frame buffers:
+ *
+ *   - the UI composes into the back buffer
+ *   - flush() hands the changed strips of it to the sink, which starts a
+ *     DMA transfer and returns; the buffers then swap
+ *   - while the panel is fed from the front buffer, the next frame is
+ *     composed into the other one
+ *
+ * The fence is at the top of the next flush(): it waits for the previous
+ * frame's transfers, so a buffer is never written while DMA reads it.
+ * Only a UI that composes faster than SPI can send ever waits there.
+ *
+ * DMA needs contiguous pixels, so dirty rectangles become full-width
+ * strips (merged where they touch). The strips just sent are copied
+ * into the new back buffer, which keeps both buffers equal to what the
+ * panel shows and lets the next frame redraw only what changes.
+ *
+ * Without a second buffer the pipeline still works, flushing
+ * synchronously from the one it has.
+ *
+ * @example
+ * DisplayPipeline pipe(sink, 240, 135);
+ * pipe.attach(bufferA, bufferB);
+ * draw(pipe.back());
+ * pipe.flush(dirtyRects, count);   // Returns while DMA runs
+ * pipe.poll();                     // Each loop: start the next strip
+ */
+
+#include "DirtyRows.h"
+
+namespace Vanguard {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr size_t DISPLAY_MAX_STRIPS = 6;     // More are merged into one
+
+// =============================================================================
+// TYPES
+// =============================================================================
+
+/**
+ * @brief Where frames go: the panel, or a host test double
+ */
+class DisplaySink {
+public:
+    virtual ~DisplaySink() {}
+
+    /**
+     * @brief Start sending full-width rows [y, y + h); may return at once
+     */
+    virtual void push(int16_t y, int16_t h, const uint16_t* pixels) = 0;
+
+    /**
+     * @brief A transfer is still running
+     */
+    virtual bool busy() = 0;
+
+    /**
+     * @brief Wait for the transfer to end and release the bus
+     */
+    virtual void finish() = 0;
+};
+
+struct PipelineStats {
+    uint32_t flushes;
+    uint32_t strips;
+    uint32_t bytes;
+    uint32_t stalls;             // Flushes that waited on the previous frame
+};
+
+// =============================================================================
+// DisplayPipeline Class
+// =============================================================================
+
+class DisplayPipeline {
+public:
+    DisplayPipeline(DisplaySink& sink, int16_t width, int16_t height);
+
+    /**
+     * @brief Set the frame buffers (width x height RGB565 each)
+     * @param second nullptr to flush synchronously from first alone
+     */
+    void attach(uint16_t* first, uint16_t* second);
+
+    bool isDoubleBuffered() const { return m_buffers[1] != nullptr; }
+
+    /**
+     * @brief Buffer to compose the next frame into, and its index (0/1)
+     */
+    uint16_t* back() const { return m_buffers[m_back]; }
+    size_t backIndex() const { return m_back; }
+
+    /**
+     * @brief Send the changed rectangles of the back buffer, then swap
+     *
+     * Waits only for the previous frame's transfers.
+     *
+     * @return Bytes queued
+     */
+    uint32_t flush(const DirtyRect* rects, size_t count);
+
+    /**
+     * @brief Start the next queued strip once the sink is free (never blocks)
+     */
+    void poll();
+
+    /**
+     * @brief Wait until everything queued is on the panel
+     *
+     * Before anything else draws to the display.
+     */
+    void fence();
+
+    bool inFlight() const { return m_active; }
+
+    const PipelineStats& stats() const { return m_stats; }
+    void resetStats();
+
+private:
+    struct Strip {
+        int16_t y;
+        int16_t h;
+    };
+
+    DisplaySink&    m_sink;
+    int16_t         m_width;
+    int16_t         m_height;
+    uint16_t*       m_buffers[2];
+    size_t          m_back;
+
+    // Strips of the front buffer still to send
+    const uint16_t* m_source;
+    Strip           m_strips[DISPLAY_MAX_STRIPS];
+    size_t          m_stripCount;
+    size_t          m_nextStrip;
+    bool            m_active;
+
+    PipelineStats   m_stats;
+
+    size_t coalesce(const DirtyRect* rects, size_t count, Strip* out) const;
+    void startNext();
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_DISPLAY_PIPELINE_H
@@ -29,6 +29,13 @@ void FeedbackManager::pulse(uint32_t duration) {
     M5Cardputer.Speaker.tone(100, duration);
 }
 
+void FeedbackManager::alert() {
+    if (!m_enabled) return;
+    // Second tone queues behind the first on the same channel
+    M5Cardputer.Speaker.tone(2600, 150, 0, true);
+    M5Cardputer.Speaker.tone(1800, 250, 0, false);
+}
+
 void FeedbackManager::updateGeiger(int8_t rssi) {
     if (!m_enabled || rssi == 0) return;
 
@@ -29,6 +29,11 @@ public:
      */
     void pulse(uint32_t duration = 100);
 
+    /**
+     * @brief Two-tone warning, e.g. a tracker following us
+     */
+    void alert();
+
     /**
      * @brief Update Geiger Counter sound based on RSSI
      * 
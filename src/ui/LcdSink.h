@@ -0,0 +1,51 @@
+#ifndef VANGUARD_LCD_SINK_H
+#define VANGUARD_LCD_SINK_H
+
+/**
+ * @file LcdSink.h
+ * @brief DisplayPipeline sink that DMAs strips to the Cardputer panel
+ *
+ * LovyanGFX waits for the DMA when a write transaction ends, so the sink
+ * keeps the transaction open from the first push until finish(). The
+ * pixels go out as stored: sprite buffers already hold byte-swapped
+ * RGB565, the panel's order.
+ */
+
+#include <M5Cardputer.h>
+#include "DisplayPipeline.h"
+#include "Theme.h"
+
+namespace Vanguard {
+
+class LcdSink : public DisplaySink {
+public:
+    LcdSink() : m_writing(false) {}
+
+    void push(int16_t y, int16_t h, const uint16_t* pixels) override {
+        if (!m_writing) {
+            M5Cardputer.Display.startWrite();
+            m_writing = true;
+        }
+        M5Cardputer.Display.pushImageDMA(0, y, Theme::SCREEN_WIDTH, h,
+                                         (const lgfx::swap565_t*)pixels);
+    }
+
+    bool busy() override {
+        return M5Cardputer.Display.dmaBusy();
+    }
+
+    void finish() override {
+        M5Cardputer.Display.waitDMA();
+        if (m_writing) {
+            M5Cardputer.Display.endWrite();
+            m_writing = false;
+        }
+    }
+
+private:
+    bool m_writing;
+};
+
+} // namespace Vanguard
+
+#endif // VANGUARD_LCD_SINK_H
@@ -42,15 +42,20 @@ void SettingsPanel::initSettings() {
         1       // step
     });
 
-    // BLE scan duration (seconds)
+    // BLE scan profile (duty cycle and duration)
+    static const char* profileNames[BLE_SCAN_PROFILE_COUNT];
+    for (size_t i = 0; i < BLE_SCAN_PROFILE_COUNT; i++) {
+        profileNames[i] = Vanguard::getBleScanProfile((BLEScanProfileId)i).name;
+    }
     m_settings.push_back({
-        "BLE Scan Time",
-        "Scan duration in seconds",
-        SettingType::NUMBER,
-        3,      // default 3 sec
-        1,      // min
-        10,     // max
-        1       // step
+        "BLE Scan Profile",
+        "Discovery speed vs power",
+        SettingType::CHOICE,
+        (int)BLEScanProfileId::BALANCED,
+        0,
+        (int)BLE_SCAN_PROFILE_COUNT - 1,
+        1,
+        profileNames
     });
 
     // Deauth packet count
@@ -81,6 +86,15 @@ void SettingsPanel::initSettings() {
         1,      // default ON
         0, 1, 1
     });
+
+    // Background BLE listening for trackers following us
+    m_settings.push_back({
+        "Tracker Watch",
+        "Listen for AirTags while idle",
+        SettingType::TOGGLE,
+        0,      // default OFF (takes the idle radio)
+        0, 1, 1
+    });
 }
 
 void SettingsPanel::show() {
@@ -121,9 +135,10 @@ void SettingsPanel::render() {
     m_canvas->setTextDatum(TL_DATUM);
     m_canvas->drawString("VANGUARD SETTINGS", 4, 3);
 
-    // Settings list
+    // Settings list, scrolled to keep the highlight on screen
+    size_t first = (m_highlightIndex >= VISIBLE_ITEMS) ? (size_t)(m_highlightIndex - VISIBLE_ITEMS + 1) : 0;
     int16_t y = HEADER_HEIGHT + 2;
-    for (size_t i = 0; i < m_settings.size() && i < VISIBLE_ITEMS; i++) {
+    for (size_t i = first; i < m_settings.size() && i < first + VISIBLE_ITEMS; i++) {
         bool highlighted = ((int)i == m_highlightIndex);
         renderSetting(m_settings[i], y, highlighted);
         y += ITEM_HEIGHT;
@@ -167,7 +182,8 @@ void SettingsPanel::renderSetting(const Setting& setting, int y, bool highlighte
             m_canvas->setTextColor(Theme::COLOR_ACCENT, bgColor);
             break;
         case SettingType::CHOICE:
-            snprintf(valueStr, sizeof(valueStr), "%d", setting.value);
+            if (setting.options) snprintf(valueStr, sizeof(valueStr), "%s", setting.options[setting.value]);
+            else                 snprintf(valueStr, sizeof(valueStr), "%d", setting.value);
             m_canvas->setTextColor(Theme::COLOR_ACCENT, bgColor);
             break;
     }
@@ -223,6 +239,9 @@ void SettingsPanel::select() {
         if (s.type == SettingType::TOGGLE) {
             s.value = !s.value;
             m_needsRedraw = true;
+        } else if (s.type == SettingType::CHOICE) {
+            s.value = (s.value < s.maxVal) ? s.value + 1 : s.minVal;
+            m_needsRedraw = true;
         }
     }
 }
@@ -239,6 +258,10 @@ int SettingsPanel::getScanDurationMs() const {
     return m_settings[0].value * 1000;  // Convert to ms
 }
 
+BLEScanProfileId SettingsPanel::getBleScanProfile() const {
+    return (BLEScanProfileId)m_settings[1].value;
+}
+
 int SettingsPanel::getDeauthPacketCount() const {
     return m_settings[2].value;
 }
@@ -251,4 +274,8 @@ bool SettingsPanel::getSoundEnabled() const {
     return m_settings[4].value != 0;
 }
 
+bool SettingsPanel::getTrackerWatch() const {
+    return m_settings[5].value != 0;
+}
+
 } // namespace Vanguard
@@ -8,6 +8,7 @@
 
 #include <M5Cardputer.h>
 #include "Theme.h"
+#include "../core/BLEScanProfile.h"
 #include <vector>
 
 namespace Vanguard {
@@ -26,6 +27,7 @@ struct Setting {
     int         minVal;     // For NUMBER type
     int         maxVal;     // For NUMBER type
     int         step;       // Increment for NUMBER
+    const char* const* options;  // CHOICE labels, indexed by value
 };
 
 class SettingsPanel {
@@ -63,9 +65,11 @@ public:
 
     // Settings accessors
     int  getScanDurationMs() const;
+    BLEScanProfileId getBleScanProfile() const;
     int  getDeauthPacketCount() const;
     bool getAutoRescan() const;
     bool getSoundEnabled() const;
+    bool getTrackerWatch() const;
 
 private:
     bool         m_visible;
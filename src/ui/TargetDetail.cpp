@@ -6,6 +6,7 @@
  */
 
 #include "TargetDetail.h"
+#include "../core/OuiLookup.h"
 #include <M5Cardputer.h>
 
 namespace Vanguard {
@@ -17,6 +18,8 @@ TargetDetail::TargetDetail(VanguardEngine& engine, const Target& target)
     , m_actionIndex(0)
     , m_selectedClientIndex(-1)
     , m_hasSelectedClient(false)
+    , m_clientCount(0)
+    , m_clientOffset(0)
     , m_wantsBack(false)
     , m_actionConfirmed(false)
     , m_confirmedAction(ActionType::NONE)
@@ -28,6 +31,7 @@ TargetDetail::TargetDetail(VanguardEngine& engine, const Target& target)
 
     // Get available actions for this target
     m_actions = m_engine.getActionsFor(target);
+    refreshClients();
 
     yield();  // Feed watchdog
 
@@ -58,6 +62,9 @@ TargetDetail::~TargetDetail() {
 void TargetDetail::tick() {
     handleInput();
 
+    // The list only moves while nothing in it is selected
+    if (m_state == DetailViewState::INFO) refreshClients();
+
     // Update action progress if executing
     if (m_state == DetailViewState::EXECUTING) {
         m_progress = m_engine.getActionProgress();
@@ -126,6 +133,7 @@ void TargetDetail::navigateUp() {
     } else if (m_state == DetailViewState::CLIENT_SELECT) {
         if (m_selectedClientIndex > 0) {
             m_selectedClientIndex--;
+            scrollToSelection();
         } else {
             transitionTo(DetailViewState::INFO);
         }
@@ -136,13 +144,14 @@ void TargetDetail::navigateDown() {
     if (m_state == DetailViewState::ACTIONS) {
         if (m_actionIndex < (int)m_actions.size() - 1) m_actionIndex++;
     } else if (m_state == DetailViewState::INFO) {
-        if (m_target.clientCount > 0) {
+        if (m_clientCount > 0) {
             m_selectedClientIndex = 0;
             transitionTo(DetailViewState::CLIENT_SELECT);
         }
     } else if (m_state == DetailViewState::CLIENT_SELECT) {
-        if (m_selectedClientIndex < m_target.clientCount - 1 && m_selectedClientIndex < 2) { // 3 clients max for now
+        if (m_selectedClientIndex < (int)m_clientCount - 1) {
             m_selectedClientIndex++;
+            scrollToSelection();
         }
     }
 }
@@ -232,8 +241,8 @@ void TargetDetail::clearActionConfirmation() {
 }
 
 void TargetDetail::getConfirmedStationMac(uint8_t* mac) const {
-    if (m_hasSelectedClient && m_selectedClientIndex >= 0 && m_selectedClientIndex < m_target.clientCount) {
-        memcpy(mac, m_target.clientMacs[m_selectedClientIndex], 6);
+    if (m_hasSelectedClient && m_selectedClientIndex >= 0 && m_selectedClientIndex < (int)m_clientCount) {
+        memcpy(mac, m_clients[m_selectedClientIndex].station, 6);
     } else {
         memset(mac, 0, 6);
     }
@@ -302,6 +311,17 @@ void TargetDetail::renderInfo() {
     renderInfoField(y, "BSSID:", bssidStr);
     y += 12;
 
+    // Vendor (flash table lookup, no RAM copy)
+    const char* vendor = OuiLookup::vendor(m_target);
+    if (vendor) {
+        renderInfoField(y, "Vendor:", vendor);
+        y += 12;
+    } else if (OuiLookup::isRandomized(m_target)) {
+        bool ble = (m_target.type == TargetType::BLE_DEVICE);
+        renderInfoField(y, "Vendor:", ble ? "Random address" : "Randomized MAC");
+        y += 12;
+    }
+
     // Channel with 5GHz warning
     char chanStr[24];
     if (m_target.channel > 14) {
@@ -330,6 +350,7 @@ void TargetDetail::renderInfo() {
     const char* typeStr = (m_target.type == TargetType::ACCESS_POINT) ? "Access Point" :
                           (m_target.type == TargetType::STATION) ? "Client Station" :
                           (m_target.type == TargetType::BLE_DEVICE) ? "BLE Device" : 
+                          (m_target.type == TargetType::BLE_BEACON) ? "BLE Beacon" : 
                           (m_target.type == TargetType::IR_DEVICE) ? "Infrared Remote" : "Unknown";
 
     // If IR, show different info
@@ -349,38 +370,34 @@ void TargetDetail::renderInfo() {
 
     // Clients
     if (m_target.type == TargetType::ACCESS_POINT) {
+        // The station table isn't capped at the AP's 16 tracked MACs
+        size_t clients = m_engine.getClientCount(m_target.bssid);
+        if (clients < m_target.clientCount) clients = m_target.clientCount;
+        if (clients < m_clientCount) clients = m_clientCount;
+
         char cliCountStr[16];
-        snprintf(cliCountStr, sizeof(cliCountStr), "%d detected", m_target.clientCount);
+        snprintf(cliCountStr, sizeof(cliCountStr), "%u detected", (unsigned)clients);
         renderInfoField(y, "Clients:", cliCountStr);
         y += 12;
 
-        if (m_target.clientCount > 0) {
-            m_canvas->setTextSize(1);
-            m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED);
-            m_canvas->setTextDatum(TL_DATUM);
-            
-            // Show up to 3 client MACs
-            for (int i = 0; i < m_target.clientCount && i < 3; i++) {
-                char macStr[20];
-                snprintf(macStr, sizeof(macStr), " %02X:%02X:%02X:%02X:%02X:%02X",
-                         m_target.clientMacs[i][0], m_target.clientMacs[i][1], m_target.clientMacs[i][2],
-                         m_target.clientMacs[i][3], m_target.clientMacs[i][4], m_target.clientMacs[i][5]);
-                
-                if (m_state == DetailViewState::CLIENT_SELECT && i == m_selectedClientIndex) {
-                    m_canvas->setTextColor(Theme::COLOR_ACCENT);
-                    m_canvas->fillRect(68, y-1, Theme::SCREEN_WIDTH - 76, 11, Theme::COLOR_SURFACE_RAISED);
-                } else {
-                    m_canvas->setTextColor(Theme::COLOR_TEXT_PRIMARY);
-                }
-                
-                m_canvas->drawString(macStr, 70, y);
-                y += 10;
-            }
-            if (m_target.clientCount > 3) {
-                m_canvas->drawString(" ...", 70, y);
-                y += 10;
+        if (m_clientCount > 0) {
+            y = renderClientRows(y, clients);
+            if (m_state == DetailViewState::CLIENT_SELECT && m_selectedClientIndex >= 0) {
+                y = renderStationLines(y, m_clients[m_selectedClientIndex]);
             }
         }
+    } else if (m_target.type == TargetType::STATION) {
+        // Roaming history from the association graph
+        char apCountStr[16];
+        snprintf(apCountStr, sizeof(apCountStr), "%u seen", (unsigned)m_clientCount);
+        renderInfoField(y, "APs:", apCountStr);
+        y += 12;
+
+        if (m_clientCount > 0) {
+            y = renderClientRows(y, m_clientCount);
+            bool picked = (m_state == DetailViewState::CLIENT_SELECT && m_selectedClientIndex >= 0);
+            y = renderStationLines(y, m_clients[picked ? m_selectedClientIndex : 0]);
+        }
     }
     y += 4;
 
@@ -428,6 +445,87 @@ void TargetDetail::renderInfoField(int y, const char* label, const char* value)
     m_canvas->drawString(value, 70, y);
 }
 
+int TargetDetail::renderStationLines(int y, const AssociationEdge& client) {
+    // Roaming history and signal of the selected client
+    AssociationEdge aps[8];
+    size_t apCount = m_engine.getApsFor(client.station, aps, 8);
+    const Station* st = m_engine.getStation(client.station);
+
+    char line[40];
+    uint32_t ageS = (millis() - client.lastSeenMs) / 1000;
+    int n = snprintf(line, sizeof(line), " %u AP%s, %lus ago", (unsigned)apCount,
+                     apCount == 1 ? "" : "s", (unsigned long)ageS);
+    if (st && st->rssi != 0 && n > 0 && n < (int)sizeof(line)) {
+        snprintf(line + n, sizeof(line) - n, ", %ddBm", st->rssi);
+    }
+
+    m_canvas->setTextSize(1);
+    m_canvas->setTextDatum(TL_DATUM);
+    m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED);
+    m_canvas->drawString(line, 70, y);
+    y += 10;
+
+    // Preferred networks, as far as fit on one line
+    const char* pnl[PNL_MAX_SSIDS];
+    size_t probed = m_engine.getProbedSsids(client.station, pnl, PNL_MAX_SSIDS);
+    if (probed > 0) {
+        char list[40];
+        size_t len = snprintf(list, sizeof(list), " Probes:");
+        for (size_t i = 0; i < probed && len < sizeof(list) - 1; i++) {
+            len += snprintf(list + len, sizeof(list) - len, "%s%s", i ? ", " : " ", pnl[i]);
+        }
+        m_canvas->drawString(list, 70, y);
+        y += 10;
+    }
+    return y;
+}
+
+int TargetDetail::renderClientRows(int y, size_t total) {
+    m_canvas->setTextSize(1);
+    m_canvas->setTextDatum(TL_DATUM);
+
+    bool stationView = (m_target.type == TargetType::STATION);
+    size_t end = m_clientOffset + VISIBLE_CLIENTS;
+    if (end > m_clientCount) end = m_clientCount;
+
+    for (size_t i = m_clientOffset; i < end; i++) {
+        // A client by MAC; an AP by SSID when it's in the table
+        const uint8_t* mac = stationView ? m_clients[i].bssid : m_clients[i].station;
+        const Target* ap = stationView ? m_engine.findTarget(mac) : nullptr;
+        char row[24];
+        if (ap && ap->ssid[0]) {
+            snprintf(row, sizeof(row), " %.20s", ap->ssid);
+        } else {
+            snprintf(row, sizeof(row), " %02X:%02X:%02X:%02X:%02X:%02X",
+                     mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+        }
+
+        if (m_state == DetailViewState::CLIENT_SELECT && (int)i == m_selectedClientIndex) {
+            m_canvas->setTextColor(Theme::COLOR_ACCENT);
+            m_canvas->fillRect(68, y-1, Theme::SCREEN_WIDTH - 76, 11, Theme::COLOR_SURFACE_RAISED);
+        } else {
+            m_canvas->setTextColor(Theme::COLOR_TEXT_PRIMARY);
+        }
+
+        m_canvas->drawString(row, 70, y);
+        y += 10;
+    }
+
+    // Where the window sits in the whole list
+    if (m_clientOffset > 0 || total > end) {
+        char more[24];
+        if (m_state == DetailViewState::CLIENT_SELECT) {
+            snprintf(more, sizeof(more), " %u/%u", (unsigned)(m_selectedClientIndex + 1), (unsigned)total);
+        } else {
+            snprintf(more, sizeof(more), " +%u more", (unsigned)(total - end));
+        }
+        m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED);
+        m_canvas->drawString(more, 70, y);
+        y += 10;
+    }
+    return y;
+}
+
 void TargetDetail::renderActions() {
     int16_t y = Theme::HEADER_HEIGHT + 4;
 
@@ -558,6 +656,41 @@ void TargetDetail::renderExecuting() {
     // Stop hint
     m_canvas->setTextColor(Theme::COLOR_WARNING);
     m_canvas->drawString("[Q] Stop Attack", centerX, centerY + 40);
+
+    renderCaptureStats();
+}
+
+void TargetDetail::renderCaptureStats() {
+    CaptureStatsSnapshot stats;
+    if (!m_engine.getCaptureStats(stats)) return;
+
+    int16_t x = 4;
+    int16_t y = Theme::SCREEN_HEIGHT - 18;
+
+    m_canvas->setTextSize(1);
+    m_canvas->setTextDatum(TL_DATUM);
+
+    // Frame flow: received, filtered out, queued, dropped (ring full)
+    char line[48];
+    uint8_t busiest = stats.busiestChannel();
+    int n = snprintf(line, sizeof(line), "rx %u flt %u q %u drop %u",
+                     (unsigned)stats.rxPerSec, (unsigned)stats.filteredPerSec,
+                     (unsigned)stats.enqueuedPerSec, (unsigned)stats.droppedPerSec);
+    if (busiest && n > 0 && (size_t)n < sizeof(line)) {
+        snprintf(line + n, sizeof(line) - n, " ch%u:%u",
+                 (unsigned)busiest, (unsigned)stats.rxByChannel[busiest]);
+    }
+    m_canvas->setTextColor(stats.droppedPerSec ? Theme::COLOR_WARNING : Theme::COLOR_TEXT_MUTED);
+    m_canvas->drawString(line, x, y);
+
+    // SD side: throughput, write latency avg/max, ring fill
+    snprintf(line, sizeof(line), "SD %uKB/s lat %u.%u/%ums ring %u/%uK",
+             (unsigned)(stats.bytesPerSec / 1024),
+             (unsigned)(stats.writeAvgUs / 1000), (unsigned)((stats.writeAvgUs % 1000) / 100),
+             (unsigned)(stats.writeMaxUs / 1000),
+             (unsigned)stats.ringPeak, (unsigned)stats.ringCapacity);
+    m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED);
+    m_canvas->drawString(line, x, y + 9);
 }
 
 void TargetDetail::renderResult() {
@@ -605,6 +738,42 @@ void TargetDetail::handleInput() {
     // Keyboard input is now handled in main.cpp handleKeyboardInput()
 }
 
+// =============================================================================
+// CLIENTS
+// =============================================================================
+
+void TargetDetail::refreshClients() {
+    m_clientCount = 0;
+    bool isAp = (m_target.type == TargetType::ACCESS_POINT);
+    if (!isAp && m_target.type != TargetType::STATION) return;
+
+    // The whole list, however long: grow until it fits (the graph bounds it)
+    if (m_clients.size() < MAX_CLIENTS_PER_AP) m_clients.resize(MAX_CLIENTS_PER_AP);
+    for (;;) {
+        m_clientCount = isAp ? m_engine.getClients(m_target.bssid, m_clients.data(), m_clients.size())
+                             : m_engine.getApsFor(m_target.bssid, m_clients.data(), m_clients.size());
+        if (m_clientCount < m_clients.size() || m_clients.size() >= GRAPH_MAX_EDGES) break;
+        m_clients.resize(m_clients.size() * 2);
+    }
+    if (m_clientCount > 0 || !isAp) return;
+
+    // Restored from a snapshot: only the target's own MAC list is known
+    for (size_t i = 0; i < m_target.clientCount && i < MAX_CLIENTS_PER_AP; i++) {
+        memset(&m_clients[i], 0, sizeof(AssociationEdge));
+        memcpy(m_clients[i].station, m_target.clientMacs[i], 6);
+        memcpy(m_clients[i].bssid, m_target.bssid, 6);
+        m_clients[i].lastSeenMs = m_target.lastSeenMs;
+        m_clientCount++;
+    }
+}
+
+void TargetDetail::scrollToSelection() {
+    if (m_selectedClientIndex < 0) return;
+    size_t sel = (size_t)m_selectedClientIndex;
+    if (sel < m_clientOffset) m_clientOffset = sel;
+    if (sel >= m_clientOffset + VISIBLE_CLIENTS) m_clientOffset = sel - VISIBLE_CLIENTS + 1;
+}
+
 // =============================================================================
 // STATE TRANSITIONS
 // =============================================================================
@@ -616,6 +785,7 @@ void TargetDetail::transitionTo(DetailViewState newState) {
     if (newState == DetailViewState::INFO) {
         m_selectedClientIndex = -1;
         m_hasSelectedClient = false;
+        m_clientOffset = 0;
     }
     
     m_state = newState;
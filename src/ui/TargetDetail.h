@@ -149,6 +149,8 @@ public:
     const Target& getTarget() const;
 
 private:
+    static constexpr size_t     VISIBLE_CLIENTS = 3;     // Rows on screen; the list scrolls
+
     VanguardEngine&             m_engine;
     Target                      m_target;
 
@@ -158,6 +160,9 @@ private:
     int                         m_actionIndex;
     int                         m_selectedClientIndex;
     bool                        m_hasSelectedClient;
+    std::vector<AssociationEdge> m_clients;   // From the association graph; grows to fit
+    size_t                      m_clientCount;
+    size_t                      m_clientOffset;   // First visible row
     bool                        m_wantsBack;
     bool                        m_actionConfirmed;
     ActionType                  m_confirmedAction;
@@ -175,11 +180,19 @@ private:
     void renderActions();
     void renderConfirmation();
     void renderExecuting();
+    void renderCaptureStats();
     void renderResult();
 
     void renderHeader();
     void renderInfoField(int y, const char* label, const char* value);
     void renderActionItem(const AvailableAction& action, int y, bool selected);
+    int  renderStationLines(int y, const AssociationEdge& client);   // Returns next y
+    int  renderClientRows(int y, size_t total);                       // Returns next y
+
+    // Neighbour list, most recently seen first: an AP's clients, or the
+    // APs a station has been seen with
+    void refreshClients();
+    void scrollToSelection();
 
     // Input handling
     void handleInput();
@@ -8,6 +8,7 @@
 #include "TargetRadar.h"
 #include <M5Cardputer.h>
 #include "FeedbackManager.h"
+#include "../core/TargetSnapshot.h"
 
 namespace Vanguard {
 
@@ -25,6 +26,11 @@ TargetRadar::TargetRadar(VanguardEngine& engine)
     , m_show5GHzWarning(false)
     , m_pending5GHzTarget()
     , m_canvas(nullptr)
+    , m_shownWarning(false)
+    , m_shownEmpty(false)
+    , m_lastStatsMs(0)
+    , m_pipeline(m_sink, Theme::SCREEN_WIDTH, Theme::SCREEN_HEIGHT)
+    , m_frameRectCount(0)
 {
     // Default filter: show everything
     m_filter.showAccessPoints = true;
@@ -35,17 +41,32 @@ TargetRadar::TargetRadar(VanguardEngine& engine)
     m_filter.showSecured = true;
     m_filter.minRssi = -100;
 
-    // Create sprite for double buffering
-    m_canvas = new M5Canvas(&M5Cardputer.Display);
-    m_canvas->createSprite(Theme::SCREEN_WIDTH, Theme::SCREEN_HEIGHT);
+    // Two sprites: compose into one while DMA sends the other. Without
+    // room for the second, the pipeline flushes synchronously.
+    for (int i = 0; i < 2; i++) {
+        m_canvases[i] = new M5Canvas(&M5Cardputer.Display);
+        m_canvases[i]->createSprite(Theme::SCREEN_WIDTH, Theme::SCREEN_HEIGHT);
+    }
+    if (!m_canvases[1]->getBuffer()) {
+        if (Serial) Serial.println("[Radar] No memory for a second frame buffer, flushing synchronously");
+        delete m_canvases[1];
+        m_canvases[1] = nullptr;
+    }
+    m_pipeline.attach((uint16_t*)m_canvases[0]->getBuffer(),
+                      m_canvases[1] ? (uint16_t*)m_canvases[1]->getBuffer() : nullptr);
+    m_canvas = m_canvases[m_pipeline.backIndex()];
 }
 
 TargetRadar::~TargetRadar() {
-    if (m_canvas) {
-        m_canvas->deleteSprite();
-        delete m_canvas;
-        m_canvas = nullptr;
+    m_pipeline.fence();
+    for (int i = 0; i < 2; i++) {
+        if (m_canvases[i]) {
+            m_canvases[i]->deleteSprite();
+            delete m_canvases[i];
+            m_canvases[i] = nullptr;
+        }
     }
+    m_canvas = nullptr;
 }
 
 // =============================================================================
@@ -53,6 +74,9 @@ TargetRadar::~TargetRadar() {
 // =============================================================================
 
 void TargetRadar::tick() {
+    // Next strip of the last frame, if the previous one is out
+    m_pipeline.poll();
+
     // Auto-refresh target list
     if (m_autoRefresh) {
         uint32_t now = millis();
@@ -77,92 +101,59 @@ void TargetRadar::render() {
     }
     m_lastRenderMs = now;
     m_needsRedraw = false;
-
-    // Draw everything to sprite first (off-screen)
-    m_canvas->fillScreen(Theme::COLOR_BACKGROUND);
-
-    // Header
-    m_canvas->fillRect(0, 0, Theme::SCREEN_WIDTH, HEADER_HEIGHT, Theme::COLOR_SURFACE);
-    m_canvas->setTextSize(1);
-    m_canvas->setTextColor(Theme::COLOR_ACCENT);
-    m_canvas->setTextDatum(TL_DATUM);
-    m_canvas->drawString("VANGUARD RADAR", 4, 3);
-
-    // Count WiFi and BLE targets
-    int wifiCount = 0, bleCount = 0;
-    for (const auto& t : m_targets) {
-        if (t.type == TargetType::BLE_DEVICE) bleCount++;
-        else wifiCount++;
+    uint32_t start = micros();
+    m_pipeline.poll();
+    m_frameRectCount = 0;
+
+    // Anything that moves the layout repaints the whole frame
+    bool empty = m_targets.empty();
+    if (m_show5GHzWarning != m_shownWarning || empty != m_shownEmpty) {
+        m_dirty.invalidate();
     }
-
-    // Target count on right (WiFi + BLE breakdown)
-    char countStr[24];
-    if (bleCount > 0) {
-        snprintf(countStr, sizeof(countStr), "%dW %dB", wifiCount, bleCount);
-    } else {
-        snprintf(countStr, sizeof(countStr), "%d", wifiCount);
+    m_shownWarning = m_show5GHzWarning;
+    m_shownEmpty = empty;
+    bool full = m_dirty.isFull();
+
+    // The popup is modal: nothing under it changes until it closes
+    if (m_show5GHzWarning && !full) {
+        m_dirty.endFrame(micros() - start);
+        logFrameStats(now);
+        return;
     }
-    m_canvas->setTextDatum(TR_DATUM);
-    m_canvas->setTextColor(Theme::COLOR_ACCENT);
-    m_canvas->drawString(countStr, Theme::SCREEN_WIDTH - 4, 3);
 
-    if (m_targets.empty()) {
-        // Empty state
-        int16_t centerX = Theme::SCREEN_WIDTH / 2;
-        int16_t centerY = Theme::SCREEN_HEIGHT / 2;
+    if (full) {
+        m_canvas->fillScreen(Theme::COLOR_BACKGROUND);
 
+        // Footer hint
         m_canvas->setTextSize(1);
-        m_canvas->setTextColor(Theme::COLOR_WARNING);
-        m_canvas->setTextDatum(MC_DATUM);
-        m_canvas->drawString("No targets found", centerX, centerY - 20);
-
         m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED);
-        m_canvas->drawString("Make sure WiFi is nearby", centerX, centerY);
+        m_canvas->setTextDatum(BC_DATUM);
+        m_canvas->drawString("[;,] Up  [./] Down  [Enter] Select", Theme::SCREEN_WIDTH / 2, Theme::SCREEN_HEIGHT - 2);
+    }
 
-        m_canvas->setTextColor(Theme::COLOR_ACCENT);
-        m_canvas->drawString("[R] Rescan", centerX, centerY + 20);
-        m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED);
-        m_canvas->drawString("[Q] Quit", centerX, centerY + 35);
+    renderHeader();
+    if (empty) {
+        if (full) renderEmptyState();
     } else {
-        // Target list
-        int16_t y = HEADER_HEIGHT + 2;
-        for (int i = 0; i < VISIBLE_ITEMS && (m_scrollOffset + i) < (int)m_targets.size(); i++) {
-            int idx = m_scrollOffset + i;
-            bool highlighted = (idx == m_highlightIndex);
-            renderTargetItemToCanvas(m_targets[idx], y, highlighted);
-            y += ITEM_HEIGHT;
-        }
-
-        // Scroll indicator
-        if (m_targets.size() > VISIBLE_ITEMS) {
-            int16_t barX = Theme::SCREEN_WIDTH - 3;
-            int16_t barY = HEADER_HEIGHT + 2;
-            int16_t barH = Theme::SCREEN_HEIGHT - HEADER_HEIGHT - 4;
-
-            float viewRatio = (float)VISIBLE_ITEMS / m_targets.size();
-            float posRatio = (float)m_scrollOffset / (m_targets.size() - VISIBLE_ITEMS);
-
-            int16_t thumbH = max(10, (int)(barH * viewRatio));
-            int16_t thumbY = barY + (int)((barH - thumbH) * posRatio);
-
-            m_canvas->fillRect(barX, barY, 2, barH, Theme::COLOR_SURFACE);
-            m_canvas->fillRect(barX, thumbY, 2, thumbH, Theme::COLOR_ACCENT);
-        }
+        renderTargetList(now);
+        renderScrollIndicator();
     }
 
-    // Footer hint
-    m_canvas->setTextSize(1);
-    m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED);
-    m_canvas->setTextDatum(BC_DATUM);
-    m_canvas->drawString("[;,] Up  [./] Down  [Enter] Select", Theme::SCREEN_WIDTH / 2, Theme::SCREEN_HEIGHT - 2);
+    if (full) {
+        // Render 5GHz warning popup if active (on top of everything)
+        if (m_show5GHzWarning) {
+            render5GHzWarning();
+        }
 
-    // Render 5GHz warning popup if active (on top of everything)
-    if (m_show5GHzWarning) {
-        render5GHzWarning();
+        // Whole frame in one push (no flicker!)
+        DirtyRect screen = {0, 0, Theme::SCREEN_WIDTH, Theme::SCREEN_HEIGHT};
+        m_frameRects[m_frameRectCount++] = screen;
     }
 
-    // Push sprite to display in one operation (no flicker!)
-    m_canvas->pushSprite(0, 0);
+    // Returns once DMA has started; frame time excludes SPI
+    m_dirty.pushed(flushRects(m_frameRects, m_frameRectCount));
+    m_dirty.endFrame(micros() - start);
+    logFrameStats(now);
 }
 
 void TargetRadar::renderScanning() {
@@ -235,7 +226,24 @@ void TargetRadar::renderScanning() {
     }
 
     // Push to display
-    m_canvas->pushSprite(0, 0);
+    DirtyRect screen = {0, 0, Theme::SCREEN_WIDTH, Theme::SCREEN_HEIGHT};
+    flushRects(&screen, 1);
+
+    // The radar's regions are no longer on screen
+    m_dirty.invalidate();
+}
+
+void TargetRadar::invalidate() {
+    m_dirty.invalidate();
+    m_needsRedraw = true;
+}
+
+void TargetRadar::fence() {
+    m_pipeline.fence();
+}
+
+const FrameStats& TargetRadar::getFrameStats() const {
+    return m_dirty.stats();
 }
 
 // =============================================================================
@@ -257,7 +265,7 @@ void TargetRadar::renderTargetItemToCanvas(const Target& target, int y, bool hig
     }
 
     // Type icon (WiFi or BLE)
-    bool isBLE = (target.type == TargetType::BLE_DEVICE);
+    bool isBLE = (target.type == TargetType::BLE_DEVICE || target.type == TargetType::BLE_BEACON);
     if (isBLE) {
         // BLE icon - simplified "B" shape
         m_canvas->fillRect(x + 6, y + 4, 2, 17, Theme::COLOR_TYPE_BLE);
@@ -292,11 +300,15 @@ void TargetRadar::renderTargetItemToCanvas(const Target& target, int y, bool hig
     }
     m_canvas->drawString(ssidDisplay, x + 24, y + 3);
 
-    // RSSI value (top right)
+    // RSSI value (top right); remembered targets show how old they are instead
     char rssiStr[16];
-    snprintf(rssiStr, sizeof(rssiStr), "%ddB", target.rssi);
-    uint16_t signalColor = Theme::getSignalColor(target.rssi);
-    m_canvas->setTextColor(signalColor, bgColor);
+    if (target.isRestored) {
+        TargetSnapshot::formatAge(rssiStr, sizeof(rssiStr), millis() - target.lastSeenMs);
+        m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED, bgColor);
+    } else {
+        snprintf(rssiStr, sizeof(rssiStr), "%ddB", target.rssi);
+        m_canvas->setTextColor(Theme::getSignalColor(target.rssi), bgColor);
+    }
     m_canvas->setTextDatum(TR_DATUM);
     m_canvas->drawString(rssiStr, w - 4, y + 3);
 
@@ -319,10 +331,11 @@ void TargetRadar::renderTargetItemToCanvas(const Target& target, int y, bool hig
         m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED, bgColor);
         m_canvas->drawString("Remote", x + 44, y + 14);
     } else {
-        // WiFi AP - show security
+        // WiFi AP - show security; a station has none of its own
+        bool isStation = (target.type == TargetType::STATION);
         const char* secLabel;
         uint16_t secColor;
-        switch (target.security) {
+        switch (isStation ? SecurityType::UNKNOWN : target.security) {
             case SecurityType::OPEN:
                 secLabel = "OPEN";
                 secColor = Theme::COLOR_SECURITY_OPEN;
@@ -345,7 +358,7 @@ void TargetRadar::renderTargetItemToCanvas(const Target& target, int y, bool hig
                 secColor = Theme::COLOR_SECURITY_WPA3;
                 break;
             default:
-                secLabel = "???";
+                secLabel = isStation ? "STA" : "???";
                 secColor = Theme::COLOR_TEXT_MUTED;
         }
         m_canvas->setTextColor(secColor, bgColor);
@@ -364,10 +377,10 @@ void TargetRadar::renderTargetItemToCanvas(const Target& target, int y, bool hig
         }
         m_canvas->drawString(chanStr, x + 64, y + 14);
 
-        // Client count
+        // Client count (for a station, the APs it was seen with)
         if (target.clientCount > 0) {
             char cliStr[8];
-            snprintf(cliStr, sizeof(cliStr), "C:%d", target.clientCount);
+            snprintf(cliStr, sizeof(cliStr), isStation ? "AP:%d" : "C:%d", target.clientCount);
             m_canvas->setTextColor(Theme::COLOR_ACCENT, bgColor);
             m_canvas->drawString(cliStr, x + 110, y + 14);
         }
@@ -497,28 +510,161 @@ void TargetRadar::setAutoRefresh(bool enabled) {
 }
 
 // =============================================================================
-// LEGACY RENDERING (kept for compatibility but not used)
+// REGIONS
 // =============================================================================
 
-void TargetRadar::renderHeader() {
-    // Now done in render() directly to canvas
+void TargetRadar::formatHeader(char* liveStr, size_t liveLen, char* countStr, size_t countLen) const {
+    // Rolling scan indicator
+    liveStr[0] = '\0';
+    if (m_engine.isRollingScan()) {
+        uint8_t ch = m_engine.getRollingChannel();
+        if (ch) snprintf(liveStr, liveLen, "LIVE ch%u", (unsigned)ch);
+        else    snprintf(liveStr, liveLen, "LIVE");
+    }
+
+    // Count WiFi and BLE targets
+    int wifiCount = 0, bleCount = 0;
+    for (const auto& t : m_targets) {
+        if (t.type == TargetType::BLE_DEVICE || t.type == TargetType::BLE_BEACON) bleCount++;
+        else wifiCount++;
+    }
+
+    // Target count on right (WiFi + BLE breakdown)
+    if (bleCount > 0) {
+        snprintf(countStr, countLen, "%dW %dB", wifiCount, bleCount);
+    } else {
+        snprintf(countStr, countLen, "%d", wifiCount);
+    }
 }
 
-void TargetRadar::renderTargetList() {
-    // Now done in render() directly to canvas
+void TargetRadar::renderHeader() {
+    char liveStr[12];
+    char countStr[24];
+    formatHeader(liveStr, sizeof(liveStr), countStr, sizeof(countStr));
+
+    uint32_t sig = dirtyHashStr(dirtyHashStr(0x811C9DC5u, liveStr), countStr);
+    if (!m_dirty.update(REGION_HEADER, sig)) return;
+
+    m_canvas->fillRect(0, 0, Theme::SCREEN_WIDTH, HEADER_HEIGHT, Theme::COLOR_SURFACE);
+    m_canvas->setTextSize(1);
+    m_canvas->setTextColor(Theme::COLOR_ACCENT);
+    m_canvas->setTextDatum(TL_DATUM);
+    m_canvas->drawString("VANGUARD RADAR", 4, 3);
+
+    if (liveStr[0]) {
+        m_canvas->setTextColor(Theme::COLOR_SUCCESS);
+        m_canvas->drawString(liveStr, 96, 3);
+    }
+
+    m_canvas->setTextDatum(TR_DATUM);
+    m_canvas->setTextColor(Theme::COLOR_ACCENT);
+    m_canvas->drawString(countStr, Theme::SCREEN_WIDTH - 4, 3);
+
+    DirtyRect rect = {0, 0, Theme::SCREEN_WIDTH, HEADER_HEIGHT};
+    pushRect(rect);
 }
 
-void TargetRadar::renderTargetItem(const Target& target, int y, bool highlighted) {
-    // Delegate to canvas version
-    renderTargetItemToCanvas(target, y, highlighted);
+void TargetRadar::renderTargetList(uint32_t now) {
+    int16_t y = HEADER_HEIGHT + 2;
+    for (int i = 0; i < VISIBLE_ITEMS; i++, y += ITEM_HEIGHT) {
+        int idx = m_scrollOffset + i;
+        bool present = idx < (int)m_targets.size();
+        bool highlighted = (idx == m_highlightIndex);
+
+        uint32_t sig = present ? radarRowSignature(m_targets[idx], highlighted, now) : DIRTY_EMPTY;
+        if (!m_dirty.update(REGION_ROW0 + i, sig)) continue;
+
+        if (present) {
+            renderTargetItemToCanvas(m_targets[idx], y, highlighted);
+        } else {
+            m_canvas->fillRect(0, y, Theme::SCREEN_WIDTH - 6, ITEM_HEIGHT, Theme::COLOR_BACKGROUND);
+        }
+        DirtyRect rect = {0, y, Theme::SCREEN_WIDTH - 6, ITEM_HEIGHT};
+        pushRect(rect);
+    }
 }
 
 void TargetRadar::renderEmptyState() {
-    // Now done in render() directly to canvas
+    int16_t centerX = Theme::SCREEN_WIDTH / 2;
+    int16_t centerY = Theme::SCREEN_HEIGHT / 2;
+
+    m_canvas->setTextSize(1);
+    m_canvas->setTextColor(Theme::COLOR_WARNING);
+    m_canvas->setTextDatum(MC_DATUM);
+    m_canvas->drawString("No targets found", centerX, centerY - 20);
+
+    m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED);
+    m_canvas->drawString("Make sure WiFi is nearby", centerX, centerY);
+
+    m_canvas->setTextColor(Theme::COLOR_ACCENT);
+    m_canvas->drawString("[R] Rescan  [L] Live", centerX, centerY + 20);
+    m_canvas->setTextColor(Theme::COLOR_TEXT_MUTED);
+    m_canvas->drawString("[Q] Quit", centerX, centerY + 35);
 }
 
 void TargetRadar::renderScrollIndicator() {
-    // Now done in render() directly to canvas
+    int16_t barX = Theme::SCREEN_WIDTH - 3;
+    int16_t barY = HEADER_HEIGHT + 2;
+    int16_t barH = Theme::SCREEN_HEIGHT - HEADER_HEIGHT - 4;
+    bool shown = m_targets.size() > VISIBLE_ITEMS;
+
+    uint32_t sig = DIRTY_EMPTY;
+    if (shown) {
+        uint32_t pos[2] = {(uint32_t)m_scrollOffset, (uint32_t)m_targets.size()};
+        sig = dirtyHash(0x811C9DC5u, pos, sizeof(pos));
+    }
+    if (!m_dirty.update(REGION_SCROLL, sig)) return;
+
+    if (shown) {
+        float viewRatio = (float)VISIBLE_ITEMS / m_targets.size();
+        float posRatio = (float)m_scrollOffset / (m_targets.size() - VISIBLE_ITEMS);
+
+        int16_t thumbH = max(10, (int)(barH * viewRatio));
+        int16_t thumbY = barY + (int)((barH - thumbH) * posRatio);
+
+        m_canvas->fillRect(barX, barY, 2, barH, Theme::COLOR_SURFACE);
+        m_canvas->fillRect(barX, thumbY, 2, thumbH, Theme::COLOR_ACCENT);
+    } else {
+        m_canvas->fillRect(barX, barY, 2, barH, Theme::COLOR_BACKGROUND);
+    }
+    DirtyRect rect = {barX, barY, 2, barH};
+    pushRect(rect);
+}
+
+void TargetRadar::pushRect(const DirtyRect& rect) {
+    // A full frame goes out in one push at the end
+    if (m_dirty.isFull()) return;
+    if (m_frameRectCount < DIRTY_MAX_REGIONS) m_frameRects[m_frameRectCount++] = rect;
+}
+
+uint32_t TargetRadar::flushRects(const DirtyRect* rects, size_t count) {
+    uint32_t bytes = m_pipeline.flush(rects, count);
+    m_canvas = m_canvases[m_pipeline.backIndex()];
+    return bytes;
+}
+
+void TargetRadar::logFrameStats(uint32_t now) {
+    if (now - m_lastStatsMs < STATS_INTERVAL_MS) return;
+    m_lastStatsMs = now;
+
+    const FrameStats& s = m_dirty.stats();
+    if (Serial && s.frames) {
+        Serial.printf("[Radar] %u frames (%u full): %u B, %u us per frame; %u waited on DMA\n",
+                      (unsigned)s.frames, (unsigned)s.fullFrames,
+                      (unsigned)s.bytesPerFrame(), (unsigned)s.usPerFrame(),
+                      (unsigned)m_pipeline.stats().stalls);
+    }
+    m_dirty.resetStats();
+    m_pipeline.resetStats();
+}
+
+// =============================================================================
+// LEGACY RENDERING (kept for compatibility but not used)
+// =============================================================================
+
+void TargetRadar::renderTargetItem(const Target& target, int y, bool highlighted) {
+    // Delegate to canvas version
+    renderTargetItemToCanvas(target, y, highlighted);
 }
 
 void TargetRadar::drawSignalIndicator(int x, int y, int8_t rssi) {
@@ -16,6 +16,12 @@
  * - Security badge (OPEN, WPA2, etc.)
  * - Client count (for APs)
  *
+ * Frames are pushed by region: the header, each list row and the scroll
+ * bar are redrawn and sent over SPI only when what they show changed
+ * (see DirtyRows.h). Layout changes push the whole frame. Pushes go
+ * through a DisplayPipeline: the frame is composed into one sprite while
+ * DMA sends the other, so render() returns without waiting on SPI.
+ *
  * @example
  * TargetRadar radar(engine);
  * radar.tick();
@@ -30,6 +36,9 @@
 #include "../core/VanguardTypes.h"
 #include "../core/VanguardEngine.h"
 #include "Theme.h"
+#include "DirtyRows.h"
+#include "DisplayPipeline.h"
+#include "LcdSink.h"
 #include <vector>
 
 namespace Vanguard {
@@ -62,6 +71,23 @@ public:
      */
     void renderScanning();
 
+    /**
+     * @brief Push the whole frame next time (another screen drew over ours)
+     */
+    void invalidate();
+
+    /**
+     * @brief Wait until frames in flight are on the panel
+     *
+     * Call before another screen draws to the display.
+     */
+    void fence();
+
+    /**
+     * @brief SPI traffic and frame time since the last periodic log
+     */
+    const FrameStats& getFrameStats() const;
+
     // -------------------------------------------------------------------------
     // Selection
     // -------------------------------------------------------------------------
@@ -181,8 +207,21 @@ private:
     bool                 m_show5GHzWarning; // Show warning popup for 5GHz limitation
     Target               m_pending5GHzTarget; // Target waiting for user confirmation
 
-    // Double buffer sprite
+    // Sprite being composed into; the other one may be on its way out
     M5Canvas*            m_canvas;
+    M5Canvas*            m_canvases[2];     // [1] nullptr if it didn't fit
+
+    // What the display shows, by region
+    DirtyRows            m_dirty;
+    bool                 m_shownWarning;
+    bool                 m_shownEmpty;
+    uint32_t             m_lastStatsMs;
+
+    // Asynchronous flush of the changed regions
+    LcdSink              m_sink;
+    DisplayPipeline      m_pipeline;
+    DirtyRect            m_frameRects[DIRTY_MAX_REGIONS];
+    size_t               m_frameRectCount;
 
     // Rendering constants
     static constexpr int HEADER_HEIGHT      = Theme::HEADER_HEIGHT;
@@ -190,15 +229,26 @@ private:
     static constexpr int VISIBLE_ITEMS      = Theme::LIST_VISIBLE_ITEMS;
     static constexpr uint32_t REFRESH_INTERVAL_MS = 1000;
     static constexpr uint32_t RENDER_INTERVAL_MS = 50;  // 20 FPS max
+    static constexpr uint32_t STATS_INTERVAL_MS  = 10000;
+
+    // Dirty regions: header, one per visible row, scroll bar
+    static constexpr size_t REGION_HEADER = 0;
+    static constexpr size_t REGION_ROW0   = 1;
+    static constexpr size_t REGION_SCROLL = REGION_ROW0 + VISIBLE_ITEMS;
+    static_assert(REGION_SCROLL < DIRTY_MAX_REGIONS, "radar regions exceed DirtyRows");
 
     // Rendering helpers
     void renderHeader();
-    void renderTargetList();
+    void renderTargetList(uint32_t now);
     void renderTargetItem(const Target& target, int y, bool highlighted);
     void renderTargetItemToCanvas(const Target& target, int y, bool highlighted);
     void renderEmptyState();
     void renderScrollIndicator();
     void render5GHzWarning();  // Warning popup for 5GHz networks
+    void formatHeader(char* liveStr, size_t liveLen, char* countStr, size_t countLen) const;
+    void pushRect(const DirtyRect& rect);
+    uint32_t flushRects(const DirtyRect* rects, size_t count);
+    void logFrameStats(uint32_t now);
 
     // Item rendering details
     void drawSignalIndicator(int x, int y, int8_t rssi);
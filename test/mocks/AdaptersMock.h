@@ -10,7 +10,7 @@ class BruceWiFi {
 public:
     static BruceWiFi& getInstance() { static BruceWiFi i; return i; }
     bool init() { return true; }
-    void onAssociation(std::function<void(const uint8_t*, const uint8_t*)> cb) {}
+    void onAssociation(std::function<void(const uint8_t*, const uint8_t*, int8_t, uint8_t)> cb) {}
 };
 
 class BruceBLE {
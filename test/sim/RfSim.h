@@ -0,0 +1,378 @@
+#ifndef VANGUARD_RF_SIM_H
+#define VANGUARD_RF_SIM_H
+
+/**
+ * @file RfSim.h
+ * @brief Seedable synthetic RF environment for host stress tests
+ *
+ * Simulates a crowd of access points, stations and BLE devices and emits
+ * what the radios would hand the System Task: beacons at each AP's own
+ * interval, BLE adverts, and station-to-AP associations. Signal strength
+ * follows a bounded random walk, stations roam between APs, and every
+ * device eventually leaves and is replaced by a new one with a fresh MAC.
+ *
+ * Everything is driven by one xorshift32 stream, so a seed reproduces the
+ * exact same event sequence on any host. Time only moves when step() is
+ * called; a 10 ms step matches the engine's tick.
+ *
+ * @example
+ * Sim::SimConfig cfg;
+ * cfg.accessPoints = 2000;
+ * Sim::RfSim sim(cfg);
+ * for (uint32_t t = 0; t < 60000; t += 10) {
+ *     sim.step(10, [&](const Sim::SimEvent& e) { ... });
+ * }
+ */
+
+#include "VanguardTypes.h"
+#include "BeaconParser.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace Vanguard {
+namespace Sim {
+
+// =============================================================================
+// CONSTANTS
+// =============================================================================
+
+constexpr int8_t   SIM_RSSI_MIN      = -95;
+constexpr int8_t   SIM_RSSI_MAX      = -30;
+constexpr uint16_t SIM_TU_US         = 1024;   // One 802.11 time unit
+
+/**
+ * @brief Size and behaviour of the simulated environment
+ */
+struct SimConfig {
+    uint32_t seed             = 1;
+    uint16_t accessPoints     = 200;
+    uint16_t stations         = 400;
+    uint16_t bleDevices       = 300;
+    uint8_t  hiddenPercent    = 10;      // APs with a nulled SSID
+    uint32_t bleAdvIntervalMs = 250;     // Mean advertising interval
+    uint32_t stationFrameMs   = 1000;    // A station is heard this often
+    uint32_t meanRoamMs       = 20000;   // Mean time before a station roams
+    uint32_t meanStayMs       = 120000;  // Mean time before a device leaves
+    uint32_t meanAwayMs       = 10000;   // Mean gap before a replacement arrives
+    uint8_t  rssiStepDb       = 2;       // Random walk step per emission
+};
+
+enum class SimEventKind : uint8_t {
+    BEACON,         // AP beacon (see beacon)
+    BLE_ADVERT,     // BLE advert (see mac, rssi)
+    ASSOCIATION,    // Station heard talking to an AP (mac -> bssid)
+    ARRIVAL,        // A device came into range
+    DEPARTURE       // A device left range
+};
+
+/**
+ * @brief One thing the radios saw
+ */
+struct SimEvent {
+    SimEventKind kind;
+    TargetType   deviceType;
+    uint32_t     atMs;
+    uint8_t      mac[6];       // AP bssid, station or BLE address
+    uint8_t      bssid[6];     // ASSOCIATION only
+    int8_t       rssi;
+    BeaconInfo   beacon;       // BEACON only
+};
+
+/**
+ * @brief Running totals, per kind
+ */
+struct SimCounters {
+    uint32_t beacons;
+    uint32_t adverts;
+    uint32_t associations;
+    uint32_t arrivals;
+    uint32_t departures;
+};
+
+// =============================================================================
+// RfSim Class
+// =============================================================================
+
+class RfSim {
+public:
+    explicit RfSim(const SimConfig& config)
+        : m_config(config)
+        , m_rng(config.seed ? config.seed : 1)
+        , m_nowMs(0)
+        , m_nextSerial(0)
+    {
+        memset(&m_counters, 0, sizeof(m_counters));
+
+        size_t total = (size_t)config.accessPoints + config.stations + config.bleDevices;
+        m_devices.reserve(total);
+        for (uint16_t i = 0; i < config.accessPoints; i++) spawn(TargetType::ACCESS_POINT, 0);
+        for (uint16_t i = 0; i < config.stations; i++)     spawn(TargetType::STATION, 0);
+        for (uint16_t i = 0; i < config.bleDevices; i++)   spawn(TargetType::BLE_DEVICE, 0);
+    }
+
+    /**
+     * @brief Advance simulated time, emitting everything due in the window
+     *
+     * Within one step, events come out grouped by device rather than
+     * strictly by time; keep steps at tick size if that matters.
+     */
+    template <typename Callback>
+    void step(uint32_t dtMs, Callback emit) {
+        uint32_t until = m_nowMs + dtMs;
+
+        for (size_t i = 0; i < m_devices.size(); i++) {
+            Device& d = m_devices[i];
+
+            if (!d.present) {
+                if ((int32_t)(until - d.arriveMs) < 0) continue;
+                arrive(d, d.arriveMs);
+                emitPresence(d, SimEventKind::ARRIVAL, emit);
+            }
+
+            while (d.present && (int32_t)(until - d.nextMs) >= 0) {
+                if ((int32_t)(d.nextMs - d.leaveMs) >= 0) {
+                    leave(d);
+                    emitPresence(d, SimEventKind::DEPARTURE, emit);
+                    break;
+                }
+                emitFrom(d, emit);
+            }
+        }
+
+        m_nowMs = until;
+    }
+
+    uint32_t now() const { return m_nowMs; }
+    const SimCounters& counters() const { return m_counters; }
+    const SimConfig& config() const { return m_config; }
+
+    /**
+     * @brief Devices in range right now, by type
+     */
+    size_t present(TargetType type) const {
+        size_t n = 0;
+        for (size_t i = 0; i < m_devices.size(); i++) {
+            if (m_devices[i].present && m_devices[i].type == type) n++;
+        }
+        return n;
+    }
+
+    /**
+     * @brief Beacon as the engine turns it into a table entry
+     */
+    static Target toTarget(const BeaconInfo& b, uint32_t now) {
+        Target t;
+        memset(&t, 0, sizeof(t));
+        memcpy(t.bssid, b.bssid, 6);
+        memcpy(t.ssid, b.ssid, sizeof(t.ssid));
+        t.type = TargetType::ACCESS_POINT;
+        t.channel = b.channel;
+        t.rssi = b.rssi;
+        t.security = b.security;
+        t.isHidden = b.isHidden;
+        t.firstSeenMs = now;
+        t.lastSeenMs = now;
+        t.beaconCount = 1;
+        return t;
+    }
+
+private:
+    struct Device {
+        TargetType   type;
+        uint8_t      mac[6];
+        uint8_t      channel;
+        int8_t       rssi;
+        SecurityType security;
+        bool         hidden;
+        bool         present;
+        uint16_t     intervalTu;    // APs
+        uint32_t     intervalMs;
+        uint32_t     nextMs;        // Next emission
+        uint32_t     leaveMs;
+        uint32_t     arriveMs;      // While away
+        uint32_t     roamMs;        // Stations
+        int32_t      apIndex;       // Stations; -1 if unassociated
+        uint32_t     serial;
+    };
+
+    SimConfig           m_config;
+    uint32_t            m_rng;
+    uint32_t            m_nowMs;
+    uint32_t            m_nextSerial;
+    SimCounters         m_counters;
+    std::vector<Device> m_devices;
+
+    // -------------------------------------------------------------------------
+    // Randomness
+    // -------------------------------------------------------------------------
+
+    uint32_t next() {
+        uint32_t x = m_rng;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        m_rng = x;
+        return x;
+    }
+
+    uint32_t below(uint32_t n) { return n ? next() % n : 0; }
+
+    // Spread around the mean: sum of two uniforms, 1..2x, never zero
+    uint32_t around(uint32_t meanMs) {
+        if (meanMs == 0) return 1;
+        return below(meanMs) + below(meanMs) + 1;
+    }
+
+    // -------------------------------------------------------------------------
+    // Lifecycle
+    // -------------------------------------------------------------------------
+
+    void spawn(TargetType type, uint32_t now) {
+        Device d;
+        memset(&d, 0, sizeof(d));
+        d.type = type;
+        d.apIndex = -1;
+        m_devices.push_back(d);
+        arrive(m_devices.back(), now);
+    }
+
+    void arrive(Device& d, uint32_t now) {
+        d.serial = m_nextSerial++;
+        makeMac(d);
+        d.present = true;
+        d.rssi = (int8_t)(-90 + (int)below(50));
+        d.leaveMs = now + around(m_config.meanStayMs);
+
+        switch (d.type) {
+            case TargetType::ACCESS_POINT: {
+                static const uint8_t channels[] = {1, 6, 11, 1, 6, 11, 2, 3, 4, 5, 7, 8, 9, 10, 12, 13};
+                static const uint16_t intervals[] = {100, 100, 100, 100, 100, 100, 200, 50};
+                d.channel = channels[below(sizeof(channels))];
+                d.intervalTu = intervals[below(sizeof(intervals) / sizeof(intervals[0]))];
+                d.intervalMs = (uint32_t)d.intervalTu * SIM_TU_US / 1000;
+                d.hidden = below(100) < m_config.hiddenPercent;
+                uint32_t r = below(10);
+                d.security = r == 0 ? SecurityType::OPEN :
+                             r == 1 ? SecurityType::WPA3_SAE :
+                             r == 2 ? SecurityType::WPA_PSK : SecurityType::WPA2_PSK;
+                d.nextMs = now + below(d.intervalMs);   // Random TBTT phase
+                break;
+            }
+            case TargetType::STATION:
+                d.intervalMs = m_config.stationFrameMs;
+                d.nextMs = now + below(d.intervalMs);
+                d.roamMs = now + around(m_config.meanRoamMs);
+                d.apIndex = pickAp();
+                break;
+            default:
+                d.intervalMs = m_config.bleAdvIntervalMs;
+                d.nextMs = now + below(d.intervalMs);
+                break;
+        }
+    }
+
+    void leave(Device& d) {
+        d.present = false;
+        d.arriveMs = d.nextMs + around(m_config.meanAwayMs);
+    }
+
+    void makeMac(Device& d) {
+        uint8_t prefix = d.type == TargetType::ACCESS_POINT ? 0x02 :
+                         d.type == TargetType::STATION ? 0x06 : 0x0A;
+        d.mac[0] = prefix;          // Locally administered, unicast
+        d.mac[1] = (uint8_t)(m_config.seed >> 8);
+        d.mac[2] = (uint8_t)(d.serial >> 24);
+        d.mac[3] = (uint8_t)(d.serial >> 16);
+        d.mac[4] = (uint8_t)(d.serial >> 8);
+        d.mac[5] = (uint8_t)d.serial;
+    }
+
+    int32_t pickAp() {
+        if (m_config.accessPoints == 0) return -1;
+        return (int32_t)below(m_config.accessPoints);
+    }
+
+    // -------------------------------------------------------------------------
+    // Emission
+    // -------------------------------------------------------------------------
+
+    void walk(Device& d) {
+        int step = (int)below(2u * m_config.rssiStepDb + 1) - (int)m_config.rssiStepDb;
+        int v = d.rssi + step;
+        if (v < SIM_RSSI_MIN) v = SIM_RSSI_MIN;
+        if (v > SIM_RSSI_MAX) v = SIM_RSSI_MAX;
+        d.rssi = (int8_t)v;
+    }
+
+    SimEvent base(const Device& d, SimEventKind kind, uint32_t at) const {
+        SimEvent e;
+        memset(&e, 0, sizeof(e));
+        e.kind = kind;
+        e.deviceType = d.type;
+        e.atMs = at;
+        memcpy(e.mac, d.mac, 6);
+        e.rssi = d.rssi;
+        return e;
+    }
+
+    template <typename Callback>
+    void emitPresence(const Device& d, SimEventKind kind, Callback& emit) {
+        if (kind == SimEventKind::ARRIVAL) m_counters.arrivals++;
+        else m_counters.departures++;
+        emit(base(d, kind, kind == SimEventKind::ARRIVAL ? d.nextMs : d.arriveMs));
+    }
+
+    template <typename Callback>
+    void emitFrom(Device& d, Callback& emit) {
+        uint32_t at = d.nextMs;
+        walk(d);
+
+        switch (d.type) {
+            case TargetType::ACCESS_POINT: {
+                SimEvent e = base(d, SimEventKind::BEACON, at);
+                BeaconInfo& b = e.beacon;
+                memcpy(b.bssid, d.mac, 6);
+                if (!d.hidden) snprintf(b.ssid, sizeof(b.ssid), "SimNet-%05u", (unsigned)d.serial);
+                b.channel = d.channel;
+                b.rssi = d.rssi;
+                b.security = d.security;
+                b.isHidden = d.hidden;
+                b.beaconIntervalTu = d.intervalTu;
+                m_counters.beacons++;
+                emit(e);
+                d.nextMs = at + d.intervalMs;   // Beacons keep their TBTT
+                break;
+            }
+
+            case TargetType::STATION: {
+                if ((int32_t)(at - d.roamMs) >= 0) {
+                    d.apIndex = pickAp();
+                    d.roamMs = at + around(m_config.meanRoamMs);
+                }
+                const Device* ap = d.apIndex >= 0 ? &m_devices[d.apIndex] : nullptr;
+                if (ap && ap->present) {
+                    SimEvent e = base(d, SimEventKind::ASSOCIATION, at);
+                    memcpy(e.bssid, ap->mac, 6);
+                    m_counters.associations++;
+                    emit(e);
+                }
+                d.nextMs = at + around(d.intervalMs);
+                break;
+            }
+
+            default: {
+                m_counters.adverts++;
+                emit(base(d, SimEventKind::BLE_ADVERT, at));
+                // Adverts carry up to 10 ms of random delay on top of the interval
+                d.nextMs = at + d.intervalMs + below(11);
+                break;
+            }
+        }
+    }
+};
+
+} // namespace Sim
+} // namespace Vanguard
+
+#endif // VANGUARD_RF_SIM_H
@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "AdvertRing.h"
+#include "BLEAdvert.h"
+#include "BLERegistry.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+using namespace Vanguard;
+
+namespace {
+
+const uint8_t ADDR[6] = {0x66, 0x55, 0x44, 0x33, 0x22, 0x11};   // Native order
+
+// Flags, complete name "Charge 5", appearance 0x0841, manufacturer 0x0057
+const uint8_t NAMED_ADV[] = {
+    0x02, 0x01, 0x06,
+    0x09, 0x09, 'C', 'h', 'a', 'r', 'g', 'e', ' ', '5',
+    0x03, 0x19, 0x41, 0x08,
+    0x05, 0xFF, 0x57, 0x00, 0xAA, 0xBB
+};
+
+// iBeacon: flags + Apple manufacturer data, no name
+const uint8_t IBEACON_ADV[] = {
+    0x02, 0x01, 0x06,
+    0x1A, 0xFF, 0x4C, 0x00, 0x02, 0x15,
+    0xE2, 0xC5, 0x6D, 0xB5, 0xDF, 0xFB, 0x48, 0xD2,
+    0xB0, 0x60, 0xD0, 0xF5, 0xA7, 0x10, 0x96, 0xE0,
+    0x00, 0x01, 0x00, 0x02, 0xC5
+};
+
+RawAdvert makeRaw(const uint8_t* payload, size_t len, uint8_t advType = ADV_EVT_IND) {
+    RawAdvert adv;
+    memset(&adv, 0, sizeof(adv));
+    memcpy(adv.address, ADDR, 6);
+    adv.advType = advType;
+    adv.rssi = -55;
+    adv.len = (uint8_t)len;
+    adv.timestampMs = 1234;
+    memcpy(adv.payload, payload, len);
+    return adv;
+}
+
+} // namespace
+
+TEST(AdvertRingTest, FifoAcrossWrap) {
+    AdvertRing ring(4);
+    RawAdvert out;
+    uint8_t payload[3] = {0x02, 0x01, 0x06};
+
+    for (uint32_t round = 0; round < 10; round++) {
+        for (uint32_t i = 0; i < 3; i++) {
+            ASSERT_TRUE(ring.push(ADDR, 1, ADV_EVT_IND, -40, payload, 3, round * 10 + i));
+        }
+        EXPECT_EQ(ring.used(), 3u);
+        for (uint32_t i = 0; i < 3; i++) {
+            ASSERT_TRUE(ring.pop(out));
+            EXPECT_EQ(out.timestampMs, round * 10 + i);
+            EXPECT_EQ(out.addressType, 1u);
+            EXPECT_EQ(out.len, 3u);
+            EXPECT_EQ(memcmp(out.address, ADDR, 6), 0);
+        }
+        EXPECT_FALSE(ring.pop(out));
+    }
+    EXPECT_EQ(ring.drops(), 0u);
+}
+
+TEST(AdvertRingTest, FullRingDropsAndCounts) {
+    AdvertRing ring(3);                      // Rounds up to 4
+    EXPECT_EQ(ring.capacity(), 4u);
+
+    for (uint32_t i = 0; i < 4; i++) EXPECT_TRUE(ring.push(ADDR, 0, 0, -40, nullptr, 0, i));
+    EXPECT_FALSE(ring.push(ADDR, 0, 0, -40, nullptr, 0, 99));
+    EXPECT_EQ(ring.drops(), 1u);
+
+    // The oldest are kept, not the newest
+    RawAdvert out;
+    ASSERT_TRUE(ring.pop(out));
+    EXPECT_EQ(out.timestampMs, 0u);
+
+    ring.clear();
+    EXPECT_EQ(ring.used(), 0u);
+    EXPECT_FALSE(ring.pop(out));
+}
+
+TEST(AdvertRingTest, LongPayloadIsCut) {
+    AdvertRing ring(2);
+    uint8_t big[255];
+    for (size_t i = 0; i < sizeof(big); i++) big[i] = (uint8_t)i;
+
+    ASSERT_TRUE(ring.push(ADDR, 0, 0, -40, big, sizeof(big), 0));
+    RawAdvert out;
+    ASSERT_TRUE(ring.pop(out));
+    EXPECT_EQ(out.len, BLE_ADV_MAX_LEN);
+    EXPECT_EQ(memcmp(out.payload, big, BLE_ADV_MAX_LEN), 0);
+}
+
+TEST(AdvertRingTest, ProducerAndConsumerThreads) {
+    AdvertRing ring(16);
+    const uint32_t COUNT = 200000;
+    uint8_t payload[8];
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < COUNT; i++) {
+            memcpy(payload, &i, sizeof(i));
+            memcpy(payload + 4, &i, sizeof(i));
+            while (!ring.push(ADDR, 0, 0, -40, payload, sizeof(payload), i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    RawAdvert out;
+    uint32_t expected = 0;
+    while (expected < COUNT) {
+        if (!ring.pop(out)) { std::this_thread::yield(); continue; }
+        uint32_t a, b;
+        memcpy(&a, out.payload, 4);
+        memcpy(&b, out.payload + 4, 4);
+        ASSERT_EQ(out.timestampMs, expected);
+        ASSERT_EQ(a, expected);
+        ASSERT_EQ(b, expected);
+        expected++;
+    }
+    producer.join();
+    EXPECT_EQ(ring.used(), 0u);
+}
+
+TEST(BLEAdvertTest, DecodesNamedAdvert) {
+    BLEDeviceInfo info;
+    ASSERT_TRUE(decodeAdvert(makeRaw(NAMED_ADV, sizeof(NAMED_ADV)), info));
+
+    EXPECT_STREQ(info.name, "Charge 5");
+    EXPECT_EQ(info.appearance, 0x0841u);
+    EXPECT_EQ(info.manufacturerId, 0x0057u);
+    EXPECT_EQ(info.manufacturerDataLen, 2u);
+    EXPECT_EQ(info.manufacturerData[1], 0xBBu);
+    EXPECT_EQ(info.rssi, -55);
+    EXPECT_EQ(info.lastSeenMs, 1234u);
+    EXPECT_TRUE(info.isConnectable);
+    EXPECT_FALSE(info.hasServices);
+}
+
+TEST(BLEAdvertTest, DecodesBeaconWithoutName) {
+    BLEDeviceInfo info;
+    ASSERT_TRUE(decodeAdvert(makeRaw(IBEACON_ADV, sizeof(IBEACON_ADV), ADV_EVT_NONCONN_IND), info));
+
+    EXPECT_STREQ(info.name, "");
+    EXPECT_EQ(info.manufacturerId, 0x004Cu);
+    EXPECT_EQ(info.manufacturerDataLen, 23u);
+    EXPECT_EQ(info.manufacturerData[0], 0x02u);
+    EXPECT_FALSE(info.isConnectable);
+
+    char name[32];
+    formatAdvertAddress(info.address, name, sizeof(name));
+    EXPECT_STREQ(name, "11:22:33:44:55:66");
+}
+
+TEST(BLEAdvertTest, CompleteNameBeatsShortAndBadLengthStops) {
+    // Short name, 16-bit service list, complete name, then a structure
+    // claiming more bytes than remain
+    const uint8_t adv[] = {
+        0x04, 0x08, 'B', 'u', 'd',
+        0x03, 0x03, 0x2C, 0xFE,
+        0x06, 0x09, 'B', 'u', 'd', 's', '2',
+        0x08, 0x08, 'x'
+    };
+    BLEDeviceInfo info;
+    EXPECT_FALSE(decodeAdvert(makeRaw(adv, sizeof(adv)), info));
+    EXPECT_STREQ(info.name, "Buds2");
+    EXPECT_TRUE(info.hasServices);
+}
+
+TEST(BLEAdvertTest, ScanResponseNameReplacesPlaceholder) {
+    BLERegistry reg(8);
+    BLEDeviceInfo info;
+
+    decodeAdvert(makeRaw(IBEACON_ADV, sizeof(IBEACON_ADV)), info);
+    formatAdvertAddress(info.address, info.name, sizeof(info.name));
+    EXPECT_TRUE(reg.observe(info));
+
+    decodeAdvert(makeRaw(NAMED_ADV, sizeof(NAMED_ADV)), info);
+    EXPECT_FALSE(reg.observe(info));
+    EXPECT_STREQ(reg.find(ADDR)->name, "Charge 5");
+}
+
+TEST(AdvertRingTest, CallbackAndDrainCost) {
+    AdvertRing ring(ADVERT_RING_SLOTS);
+    BLERegistry reg;
+    RawAdvert adv;
+    BLEDeviceInfo info;
+    uint8_t addr[6];
+    memcpy(addr, ADDR, 6);
+
+    const uint32_t ADVERTS = 200000;
+    double pushNs = 0, drainNs = 0;
+
+    for (uint32_t done = 0; done < ADVERTS; done += ADVERT_DRAIN_BATCH) {
+        // What onResult now does per advert
+        auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < ADVERT_DRAIN_BATCH; i++) {
+            addr[0] = (uint8_t)(done + i);
+            ring.push(addr, 1, ADV_EVT_IND, -60, NAMED_ADV, sizeof(NAMED_ADV), done + i);
+        }
+        // What SystemTask does per tick
+        auto t1 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ADVERT_DRAIN_BATCH && ring.pop(adv); i++) {
+            decodeAdvert(adv, info);
+            reg.observe(info);
+        }
+        auto t2 = std::chrono::steady_clock::now();
+
+        pushNs += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        drainNs += std::chrono::duration<double, std::nano>(t2 - t1).count();
+    }
+
+    printf("[ adverts  ] %.1f ns/advert in the callback, %.1f ns/advert decoded on SystemTask\n",
+           pushNs / ADVERTS, drainNs / ADVERTS);
+    EXPECT_EQ(ring.drops(), 0u);
+    EXPECT_EQ(reg.count(), 256u);
+}
@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "AssociationGraph.h"
+#include "TargetTable.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+using namespace Vanguard;
+
+namespace {
+
+void makeMac(uint8_t* mac, uint8_t prefix, uint16_t id) {
+    mac[0] = prefix;
+    mac[1] = 0x11;
+    mac[2] = 0x22;
+    mac[3] = 0x33;
+    mac[4] = (uint8_t)(id >> 8);
+    mac[5] = (uint8_t)id;
+}
+
+bool hasStation(const AssociationEdge* list, size_t n, const uint8_t* mac) {
+    for (size_t i = 0; i < n; i++) {
+        if (memcmp(list[i].station, mac, 6) == 0) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+TEST(AssociationGraphTest, QueriesBothDirections) {
+    AssociationGraph g;
+    uint8_t sta[6], ap1[6], ap2[6];
+    makeMac(ap1, 0x20, 1);
+    makeMac(ap2, 0x20, 2);
+
+    for (uint16_t i = 0; i < 5; i++) {
+        makeMac(sta, 0x10, i);
+        EXPECT_TRUE(g.observe(sta, ap1, 100 + i));
+    }
+    makeMac(sta, 0x10, 0);
+    EXPECT_TRUE(g.observe(sta, ap2, 200));
+
+    AssociationEdge out[16];
+    EXPECT_EQ(g.stationsOf(ap1, out, 16), 5u);
+    EXPECT_EQ(g.stationsOf(ap2, out, 16), 1u);
+    EXPECT_EQ(memcmp(out[0].station, sta, 6), 0);
+    EXPECT_EQ(memcmp(out[0].bssid, ap2, 6), 0);
+
+    EXPECT_EQ(g.apsOf(sta, out, 16), 2u);
+    EXPECT_EQ(g.apCount(sta), 2u);
+    EXPECT_EQ(g.stationCount(ap1), 5u);
+    EXPECT_EQ(g.edgeCount(), 6u);
+    EXPECT_EQ(g.nodeCount(), 7u);
+
+    // An AP is never its own client
+    EXPECT_FALSE(g.observe(ap1, ap1, 300));
+    EXPECT_EQ(g.stationCount(ap1), 5u);
+}
+
+TEST(AssociationGraphTest, RepeatUpdatesInPlace) {
+    AssociationGraph g;
+    uint8_t sta[6], ap[6];
+    makeMac(sta, 0x10, 1);
+    makeMac(ap, 0x20, 1);
+
+    EXPECT_TRUE(g.observe(sta, ap, 1000));
+    EXPECT_FALSE(g.observe(sta, ap, 1500));
+    EXPECT_FALSE(g.observe(sta, ap, 2000));
+
+    AssociationEdge e;
+    ASSERT_EQ(g.apsOf(sta, &e, 1), 1u);
+    EXPECT_EQ(e.firstSeenMs, 1000u);
+    EXPECT_EQ(e.lastSeenMs, 2000u);
+    EXPECT_EQ(e.frames, 3u);
+    EXPECT_EQ(g.edgeCount(), 1u);
+}
+
+TEST(AssociationGraphTest, MostRecentlySeenFirst) {
+    AssociationGraph g;
+    uint8_t sta[6], ap[6];
+    makeMac(sta, 0x10, 1);
+
+    // Roam through five APs, then go back to the first
+    for (uint16_t i = 0; i < 5; i++) {
+        makeMac(ap, 0x20, i);
+        g.observe(sta, ap, 1000 * (i + 1));
+    }
+    makeMac(ap, 0x20, 0);
+    g.observe(sta, ap, 9000);
+
+    AssociationEdge out[3];
+    ASSERT_EQ(g.apsOf(sta, out, 3), 3u);
+    EXPECT_EQ(memcmp(out[0].bssid, ap, 6), 0);
+    EXPECT_EQ(out[1].lastSeenMs, 5000u);
+    EXPECT_EQ(out[2].lastSeenMs, 4000u);
+    EXPECT_EQ(g.apCount(sta), 5u);
+}
+
+TEST(AssociationGraphTest, ExpireCompactsAndKeepsQueriesRight) {
+    AssociationGraph g;
+    uint8_t sta[6], ap[6];
+
+    // Interleave old and fresh links across APs
+    for (uint16_t i = 0; i < 300; i++) {
+        makeMac(sta, 0x10, i);
+        makeMac(ap, 0x20, i % 9);
+        g.observe(sta, ap, (i % 3) ? 500000 : 1000);
+    }
+    size_t before = g.nodeCount();
+    EXPECT_EQ(g.expire(500000, 100000), 100u);
+    EXPECT_EQ(g.edgeCount(), 200u);
+    // Expired stations freed, and APs 0, 3, 6, which only had those
+    EXPECT_EQ(g.nodeCount(), before - 103);
+
+    AssociationEdge out[64];
+    size_t total = 0;
+    for (uint16_t a = 0; a < 9; a++) {
+        makeMac(ap, 0x20, a);
+        size_t n = g.stationsOf(ap, out, 64);
+        EXPECT_EQ(n, g.stationCount(ap));
+        for (size_t k = 0; k < n; k++) {
+            EXPECT_EQ(memcmp(out[k].bssid, ap, 6), 0);
+            EXPECT_EQ(out[k].lastSeenMs, 500000u);
+        }
+        total += n;
+    }
+    EXPECT_EQ(total, 200u);
+
+    makeMac(sta, 0x10, 0);                       // i % 3 == 0: expired
+    EXPECT_EQ(g.apCount(sta), 0u);
+    makeMac(sta, 0x10, 1);
+    EXPECT_EQ(g.apCount(sta), 1u);
+
+    // Still usable after compaction
+    makeMac(ap, 0x20, 2);
+    EXPECT_TRUE(g.observe(sta, ap, 600000));
+    EXPECT_EQ(g.apCount(sta), 2u);
+    EXPECT_EQ(g.expire(600000, 100000), 0u);
+}
+
+TEST(AssociationGraphTest, EvictsOldestWhenEdgesFull) {
+    AssociationGraph g;
+    uint8_t sta[6], ap[6];
+
+    // Few nodes, many links: 40 stations x 40 APs
+    uint32_t now = 0;
+    for (uint16_t a = 0; a < 40; a++) {
+        makeMac(ap, 0x20, a);
+        for (uint16_t s = 0; s < 40; s++) {
+            makeMac(sta, 0x10, s);
+            g.observe(sta, ap, ++now);
+        }
+    }
+    EXPECT_LE(g.edgeCount(), GRAPH_MAX_EDGES);
+    EXPECT_GT(g.evictions(), 0u);
+
+    // The newest links survived, the oldest didn't
+    makeMac(ap, 0x20, 39);
+    EXPECT_EQ(g.stationCount(ap), 40u);
+    makeMac(ap, 0x20, 0);
+    EXPECT_EQ(g.stationCount(ap), 0u);
+}
+
+TEST(AssociationGraphTest, EvictsWhenNodesFull) {
+    AssociationGraph g;
+    uint8_t sta[6], ap[6];
+
+    // One-off pairs use two nodes per edge
+    for (uint16_t i = 0; i < GRAPH_MAX_NODES; i++) {
+        makeMac(sta, 0x10, i);
+        makeMac(ap, 0x20, i);
+        EXPECT_TRUE(g.observe(sta, ap, 1000 + i));
+    }
+    EXPECT_LE(g.nodeCount(), GRAPH_MAX_NODES);
+    EXPECT_GT(g.evictions(), 0u);
+
+    makeMac(sta, 0x10, GRAPH_MAX_NODES - 1);
+    EXPECT_EQ(g.apCount(sta), 1u);
+    makeMac(sta, 0x10, 0);
+    EXPECT_EQ(g.apCount(sta), 0u);
+
+    g.clear();
+    EXPECT_EQ(g.edgeCount(), 0u);
+    EXPECT_EQ(g.nodeCount(), 0u);
+}
+
+TEST(AssociationGraphTest, TargetTableFeedsGraph) {
+    TargetTable table;
+    uint8_t sta[6], ap1[6], ap2[6];
+    makeMac(sta, 0x10, 1);
+    makeMac(ap1, 0x20, 1);
+    makeMac(ap2, 0x20, 2);
+
+    table.addAssociation(sta, ap1, -50, 1, 1000);
+    table.addAssociation(sta, ap2, -50, 6, 2000);
+
+    // Station table follows the roam; the graph keeps both links
+    EXPECT_EQ(table.stations().clientCount(ap1), 0u);
+    EXPECT_EQ(table.associations().stationCount(ap1), 1u);
+    EXPECT_EQ(table.associations().apCount(sta), 2u);
+
+    AssociationEdge out[4];
+    ASSERT_EQ(table.associations().stationsOf(ap2, out, 4), 1u);
+    EXPECT_TRUE(hasStation(out, 1, sta));
+
+    EXPECT_EQ(table.pruneAssociations(2000 + GRAPH_EDGE_TIMEOUT_MS), 1u);
+    EXPECT_EQ(table.associations().apCount(sta), 1u);
+
+    table.clear();
+    EXPECT_EQ(table.associations().edgeCount(), 0u);
+}
+
+TEST(AssociationGraphTest, QueryCostAtCapacity) {
+    AssociationGraph g;
+    uint8_t sta[6], ap[6];
+
+    // 64 APs, each station seen with two of them
+    uint32_t now = 0;
+    for (uint16_t i = 0; i < GRAPH_MAX_EDGES / 2; i++) {
+        makeMac(sta, 0x10, i);
+        makeMac(ap, 0x20, i % 64);
+        g.observe(sta, ap, ++now);
+        makeMac(ap, 0x20, (i + 1) % 64);
+        g.observe(sta, ap, ++now);
+    }
+    ASSERT_EQ(g.edgeCount(), GRAPH_MAX_EDGES);
+
+    const uint32_t N = 200000;
+    AssociationEdge out[8];
+    size_t found = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N; i++) {
+        makeMac(ap, 0x20, (uint16_t)(i % 64));
+        found += g.stationsOf(ap, out, 8);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    auto c0 = std::chrono::steady_clock::now();
+    g.compact();
+    auto c1 = std::chrono::steady_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / N;
+    double us = std::chrono::duration<double, std::micro>(c1 - c0).count();
+    printf("[ graph    ] %u edges, %u nodes, %u bytes, %.1f ns/query, %.1f us/compact\n",
+           (unsigned)g.edgeCount(), (unsigned)g.nodeCount(),
+           (unsigned)sizeof(AssociationGraph), ns, us);
+    EXPECT_EQ(found, (size_t)N * 8);
+}
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "Arduino.h"
+#include "BeaconParser.h"
+
+using namespace Vanguard;
+
+namespace {
+
+const uint8_t AP_MAC[6] = {0x10, 0x20, 0x30, 0x40, 0x50, 0x60};
+
+// RSN: version 1, CCMP group, 1x CCMP pairwise, 1x AKM (type filled in)
+std::vector<uint8_t> rsnIe(uint8_t akm) {
+    std::vector<uint8_t> ie = {
+        IE_RSN, 20,
+        0x01, 0x00,
+        0x00, 0x0F, 0xAC, 0x04,
+        0x01, 0x00, 0x00, 0x0F, 0xAC, 0x04,
+        0x01, 0x00, 0x00, 0x0F, 0xAC, akm,
+        0x00, 0x00
+    };
+    return ie;
+}
+
+std::vector<uint8_t> wpaIe() {
+    std::vector<uint8_t> ie = {
+        IE_VENDOR, 22,
+        0x00, 0x50, 0xF2, 0x01,
+        0x01, 0x00,
+        0x00, 0x50, 0xF2, 0x02,
+        0x01, 0x00, 0x00, 0x50, 0xF2, 0x02,
+        0x01, 0x00, 0x00, 0x50, 0xF2, 0x02
+    };
+    return ie;
+}
+
+std::vector<uint8_t> mgmtFrame(uint8_t subtype, const char* ssid, uint8_t channel,
+                               bool privacy, const std::vector<uint8_t>& extra) {
+    std::vector<uint8_t> f = {
+        (uint8_t)(subtype << 4), 0x00, 0x00, 0x00,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+    };
+    f.insert(f.end(), AP_MAC, AP_MAC + 6);
+    f.insert(f.end(), AP_MAC, AP_MAC + 6);
+    f.push_back(0x00); f.push_back(0x00);
+
+    // Timestamp, interval (100 TU), capability
+    for (int i = 0; i < 8; i++) f.push_back(0x00);
+    f.push_back(0x64); f.push_back(0x00);
+    f.push_back(privacy ? 0x11 : 0x01); f.push_back(0x00);
+
+    size_t ssidLen = strlen(ssid);
+    f.push_back(IE_SSID);
+    f.push_back((uint8_t)ssidLen);
+    f.insert(f.end(), ssid, ssid + ssidLen);
+
+    if (channel) {
+        f.push_back(IE_DS_PARAMS); f.push_back(1); f.push_back(channel);
+    }
+    f.insert(f.end(), extra.begin(), extra.end());
+    return f;
+}
+
+bool parseFrame(const std::vector<uint8_t>& raw, BeaconInfo& info) {
+    FrameView view;
+    if (!FrameDispatcher::parse(raw.data(), (uint16_t)raw.size(), -55, 1, view)) return false;
+    return BeaconParser::parse(view, info);
+}
+
+} // namespace
+
+TEST(IEIteratorTest, WalksElements) {
+    const uint8_t ies[] = {0x00, 0x02, 'h', 'i', 0x03, 0x01, 0x06};
+    IEIterator it(ies, sizeof(ies));
+
+    ASSERT_TRUE(it.next());
+    EXPECT_EQ(it.id(), 0);
+    EXPECT_EQ(it.length(), 2);
+    EXPECT_EQ(it.data()[1], 'i');
+
+    ASSERT_TRUE(it.next());
+    EXPECT_EQ(it.id(), 3);
+    EXPECT_EQ(it.data()[0], 6);
+
+    EXPECT_FALSE(it.next());
+}
+
+TEST(IEIteratorTest, StopsAtTruncatedElement) {
+    const uint8_t ies[] = {0x00, 0x01, 'a', 0x30, 0x10, 0x01};
+    IEIterator it(ies, sizeof(ies));
+
+    ASSERT_TRUE(it.next());
+    EXPECT_FALSE(it.next());
+}
+
+TEST(BeaconParserTest, OpenNetworkWithDsChannel) {
+    BeaconInfo info;
+    ASSERT_TRUE(parseFrame(mgmtFrame(WIFI_SUBTYPE_BEACON, "CoffeeShop", 11, false, {}), info));
+
+    EXPECT_STREQ(info.ssid, "CoffeeShop");
+    EXPECT_FALSE(info.isHidden);
+    EXPECT_EQ(info.channel, 11);   // DS IE wins over rx channel
+    EXPECT_EQ(info.rssi, -55);
+    EXPECT_EQ(info.security, SecurityType::OPEN);
+    EXPECT_EQ(info.beaconIntervalTu, 100);
+    EXPECT_EQ(memcmp(info.bssid, AP_MAC, 6), 0);
+    EXPECT_FALSE(info.isProbeResponse);
+}
+
+TEST(BeaconParserTest, SecurityClassification) {
+    BeaconInfo info;
+
+    ASSERT_TRUE(parseFrame(mgmtFrame(WIFI_SUBTYPE_BEACON, "wep", 1, true, {}), info));
+    EXPECT_EQ(info.security, SecurityType::WEP);
+
+    ASSERT_TRUE(parseFrame(mgmtFrame(WIFI_SUBTYPE_BEACON, "wpa", 1, true, wpaIe()), info));
+    EXPECT_EQ(info.security, SecurityType::WPA_PSK);
+
+    ASSERT_TRUE(parseFrame(mgmtFrame(WIFI_SUBTYPE_BEACON, "wpa2", 1, true, rsnIe(2)), info));
+    EXPECT_EQ(info.security, SecurityType::WPA2_PSK);
+
+    ASSERT_TRUE(parseFrame(mgmtFrame(WIFI_SUBTYPE_BEACON, "sae", 1, true, rsnIe(8)), info));
+    EXPECT_EQ(info.security, SecurityType::WPA3_SAE);
+
+    ASSERT_TRUE(parseFrame(mgmtFrame(WIFI_SUBTYPE_BEACON, "corp", 1, true, rsnIe(1)), info));
+    EXPECT_EQ(info.security, SecurityType::WPA2_ENTERPRISE);
+
+    // RSN takes precedence over a WPA1 element in mixed mode
+    std::vector<uint8_t> mixed = wpaIe();
+    std::vector<uint8_t> rsn = rsnIe(2);
+    mixed.insert(mixed.end(), rsn.begin(), rsn.end());
+    ASSERT_TRUE(parseFrame(mgmtFrame(WIFI_SUBTYPE_BEACON, "mixed", 1, true, mixed), info));
+    EXPECT_EQ(info.security, SecurityType::WPA2_PSK);
+}
+
+TEST(BeaconParserTest, RejectsOversizedPairwiseCount) {
+    // 0x4000 pairwise suites would wrap a 16-bit offset back onto the
+    // suite list, which here looks like one PSK AKM
+    const uint8_t rsn[] = {
+        0x01, 0x00,
+        0x00, 0x0F, 0xAC, 0x04,
+        0x00, 0x40,
+        0x01, 0x00, 0x00, 0x0F, 0xAC, 0x02
+    };
+    EXPECT_EQ(BeaconParser::securityFromRsn(rsn, sizeof(rsn)), SecurityType::UNKNOWN);
+}
+
+TEST(BeaconParserTest, HiddenAndProbeResponse) {
+    BeaconInfo info;
+    ASSERT_TRUE(parseFrame(mgmtFrame(WIFI_SUBTYPE_BEACON, "", 6, false, {}), info));
+    EXPECT_TRUE(info.isHidden);
+    EXPECT_STREQ(info.ssid, "");
+
+    ASSERT_TRUE(parseFrame(mgmtFrame(WIFI_SUBTYPE_PROBE_RESP, "Revealed", 6, false, {}), info));
+    EXPECT_FALSE(info.isHidden);
+    EXPECT_TRUE(info.isProbeResponse);
+    EXPECT_STREQ(info.ssid, "Revealed");
+}
+
+TEST(BeaconParserTest, RejectsOtherFramesAndTruncatedBodies) {
+    BeaconInfo info;
+    EXPECT_FALSE(parseFrame(mgmtFrame(WIFI_SUBTYPE_PROBE_REQ, "x", 1, false, {}), info));
+
+    std::vector<uint8_t> raw = mgmtFrame(WIFI_SUBTYPE_BEACON, "x", 1, false, {});
+    raw.resize(24 + BEACON_FIXED_LEN - 1);
+    EXPECT_FALSE(parseFrame(raw, info));
+}
+
+TEST(BeaconThrottleTest, LimitsPerBssid) {
+    BeaconThrottle throttle;
+    BeaconInfo a;
+    memset(&a, 0, sizeof(a));
+    memcpy(a.bssid, AP_MAC, 6);
+    a.isHidden = true;
+
+    EXPECT_TRUE(throttle.admit(a, 1000));
+    EXPECT_FALSE(throttle.admit(a, 1500));
+    EXPECT_TRUE(throttle.admit(a, 2000));
+
+    // SSID reveal always gets through once
+    a.isHidden = false;
+    EXPECT_TRUE(throttle.admit(a, 2100));
+    EXPECT_FALSE(throttle.admit(a, 2200));
+
+    BeaconInfo b = a;
+    b.bssid[5] = 0x61;
+    EXPECT_TRUE(throttle.admit(b, 2200));
+}
+
+TEST(BeaconThrottleTest, EvictsOldestWhenFull) {
+    BeaconThrottle throttle;
+    BeaconInfo info;
+    memset(&info, 0, sizeof(info));
+
+    for (size_t i = 0; i < BEACON_THROTTLE_SLOTS; i++) {
+        info.bssid[5] = (uint8_t)i;
+        EXPECT_TRUE(throttle.admit(info, 100 + i));
+    }
+
+    // New AP evicts bssid 0 (oldest), which is then treated as new again
+    info.bssid[5] = 0xFE;
+    EXPECT_TRUE(throttle.admit(info, 200));
+    info.bssid[5] = 0;
+    EXPECT_TRUE(throttle.admit(info, 201));
+}
+
+namespace {
+
+const uint8_t STA_MAC[6] = {0x3C, 0x22, 0xFB, 0x01, 0x02, 0x03};
+
+std::vector<uint8_t> probeRequest(const uint8_t* sender, const char* ssid, size_t ssidLen) {
+    std::vector<uint8_t> f = {
+        (uint8_t)(WIFI_SUBTYPE_PROBE_REQ << 4), 0x00, 0x00, 0x00,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+    };
+    f.insert(f.end(), sender, sender + 6);
+    for (int i = 0; i < 6; i++) f.push_back(0xFF);
+    f.push_back(0x00); f.push_back(0x00);
+
+    // No fixed fields: SSID then supported rates
+    f.push_back(IE_SSID);
+    f.push_back((uint8_t)ssidLen);
+    f.insert(f.end(), ssid, ssid + ssidLen);
+    f.push_back(0x01); f.push_back(0x02); f.push_back(0x82); f.push_back(0x84);
+    return f;
+}
+
+bool parseProbe(const std::vector<uint8_t>& raw, ProbeInfo& info) {
+    FrameView view;
+    if (!FrameDispatcher::parse(raw.data(), (uint16_t)raw.size(), -61, 6, view)) return false;
+    return BeaconParser::parseProbeRequest(view, info);
+}
+
+} // namespace
+
+TEST(BeaconParserTest, ProbeRequest) {
+    ProbeInfo info;
+    ASSERT_TRUE(parseProbe(probeRequest(STA_MAC, "HomeNet", 7), info));
+    EXPECT_STREQ(info.ssid, "HomeNet");
+    EXPECT_EQ(info.ssidLen, 7);
+    EXPECT_EQ(info.rssi, -61);
+    EXPECT_EQ(info.channel, 6);
+    EXPECT_EQ(memcmp(info.station, STA_MAC, 6), 0);
+
+    // Wildcard probe parses, but names nothing
+    ASSERT_TRUE(parseProbe(probeRequest(STA_MAC, "", 0), info));
+    EXPECT_EQ(info.ssidLen, 0);
+    EXPECT_STREQ(info.ssid, "");
+
+    // Group-address sender, or not a probe request at all
+    uint8_t group[6] = {0x01, 0x00, 0x5E, 0x00, 0x00, 0x01};
+    EXPECT_FALSE(parseProbe(probeRequest(group, "HomeNet", 7), info));
+    BeaconInfo beacon;
+    EXPECT_FALSE(parseFrame(probeRequest(STA_MAC, "HomeNet", 7), beacon));
+    EXPECT_FALSE(parseProbe(mgmtFrame(WIFI_SUBTYPE_BEACON, "HomeNet", 1, false, {}), info));
+
+    // Truncated SSID element
+    std::vector<uint8_t> raw = probeRequest(STA_MAC, "HomeNet", 7);
+    raw.resize(24 + 2 + 3);
+    EXPECT_FALSE(parseProbe(raw, info));
+}
+
+TEST(ProbeThrottleTest, OncePerStationAndSsidPerSweep) {
+    ProbeThrottle throttle;
+    ProbeInfo a;
+    ASSERT_TRUE(parseProbe(probeRequest(STA_MAC, "HomeNet", 7), a));
+    ProbeInfo b;
+    ASSERT_TRUE(parseProbe(probeRequest(STA_MAC, "Office", 6), b));
+
+    EXPECT_TRUE(throttle.admit(a, 1000));
+    EXPECT_FALSE(throttle.admit(a, 1100));         // Same burst, next channel
+    EXPECT_TRUE(throttle.admit(b, 1100));          // Other SSID, same station
+    EXPECT_TRUE(throttle.admit(a, 1000 + PROBE_THROTTLE_MS));
+
+    ProbeInfo c = a;
+    c.station[5] ^= 0x01;
+    EXPECT_TRUE(throttle.admit(c, 1200));
+}
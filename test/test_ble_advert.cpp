@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "BLEAdvert.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace Vanguard;
+
+namespace {
+
+// Captured advertisements (payload only, advert + scan response)
+
+// Eddystone-UID: flags, 16-bit UUID list {FEAA}, service data FEAA
+const uint8_t EDDYSTONE_UID[] = {
+    0x02, 0x01, 0x06,
+    0x03, 0x03, 0xAA, 0xFE,
+    0x17, 0x16, 0xAA, 0xFE, 0x00, 0xE7,
+    0xED, 0xD5, 0x0F, 0x5B, 0x2C, 0x3A, 0x10, 0xA1, 0x6C, 0x33,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00
+};
+
+// Fitness band: flags, 128-bit service, TX power, appearance, then
+// a scan response with the complete name
+const uint8_t FITNESS_BAND[] = {
+    0x02, 0x01, 0x06,
+    0x11, 0x07, 0x9E, 0xCA, 0xDC, 0x24, 0x0E, 0xE5, 0xA9, 0xE0,
+                0x93, 0xF3, 0xA3, 0xB5, 0x01, 0x00, 0x40, 0x6E,
+    0x02, 0x0A, 0xF4,
+    0x03, 0x19, 0xC1, 0x03,
+    0x0A, 0x09, 'M', 'i', ' ', 'B', 'a', 'n', 'd', ' ', '7'
+};
+
+// Samsung SmartTag: flags, service data FD5A (offline finding)
+const uint8_t SMARTTAG[] = {
+    0x02, 0x01, 0x06,
+    0x11, 0x16, 0x5A, 0xFD, 0x11, 0xB2, 0x4F, 0x6C, 0x3D, 0x90,
+                0x21, 0x8E, 0x04, 0x7A, 0xC3, 0x00, 0x51, 0x0C
+};
+
+// AirTag (Find My, separated): Apple manufacturer data, no flags
+const uint8_t AIRTAG[] = {
+    0x1E, 0xFF, 0x4C, 0x00, 0x12, 0x19, 0x10,
+    0xA4, 0x3E, 0x77, 0x01, 0x9C, 0xD2, 0x45, 0x6F, 0xE0, 0x18, 0x3B,
+    0x62, 0x0D, 0xAF, 0x91, 0x55, 0xC7, 0x2A, 0xE8, 0x13, 0x74, 0x4D,
+    0x01, 0x00
+};
+
+} // namespace
+
+TEST(ADIteratorTest, WalksStructuresInPlace) {
+    ADIterator it(EDDYSTONE_UID, sizeof(EDDYSTONE_UID));
+
+    ASSERT_TRUE(it.next());
+    EXPECT_EQ(it.type(), AD_TYPE_FLAGS);
+    EXPECT_EQ(it.length(), 1u);
+    EXPECT_EQ(it.data(), EDDYSTONE_UID + 2);
+
+    ASSERT_TRUE(it.next());
+    EXPECT_EQ(it.type(), AD_TYPE_UUID16_COMPLETE);
+    EXPECT_EQ(it.offset(), 5u);
+
+    ASSERT_TRUE(it.next());
+    EXPECT_EQ(it.type(), AD_TYPE_SERVICE_DATA16);
+    EXPECT_EQ(it.length(), 22u);
+
+    EXPECT_FALSE(it.next());
+    EXPECT_FALSE(it.malformed());
+}
+
+TEST(ADIteratorTest, PaddingEndsAndOverrunIsMalformed) {
+    const uint8_t padded[] = {0x02, 0x01, 0x06, 0x00, 0x05, 0xFF};
+    ADIterator a(padded, sizeof(padded));
+    EXPECT_TRUE(a.next());
+    EXPECT_FALSE(a.next());
+    EXPECT_FALSE(a.malformed());
+
+    const uint8_t overrun[] = {0x02, 0x01, 0x06, 0x05, 0xFF, 0x4C};
+    ADIterator b(overrun, sizeof(overrun));
+    EXPECT_TRUE(b.next());
+    EXPECT_FALSE(b.next());
+    EXPECT_TRUE(b.malformed());
+
+    ADIterator empty(overrun, 0);
+    EXPECT_FALSE(empty.next());
+    EXPECT_FALSE(empty.malformed());
+}
+
+TEST(AdvertFieldsTest, EddystoneServiceData) {
+    AdvertFields f;
+    ASSERT_TRUE(parseAdvertFields(EDDYSTONE_UID, sizeof(EDDYSTONE_UID), f));
+
+    EXPECT_TRUE(f.has(ADV_HAS_FLAGS));
+    EXPECT_EQ(f.flags, 0x06u);
+    EXPECT_TRUE(f.has(ADV_HAS_SERVICES));
+    ASSERT_EQ(f.uuid16Count, 1u);
+    EXPECT_EQ(f.uuid16[0], 0xFEAAu);
+
+    ASSERT_EQ(f.serviceDataCount, 1u);
+    EXPECT_EQ(f.serviceDataUuid[0], 0xFEAAu);
+    EXPECT_EQ(f.serviceData[0].len, 20u);
+    const uint8_t* frame = AdvertFields::bytes(EDDYSTONE_UID, f.serviceData[0]);
+    EXPECT_EQ(frame[0], 0x00u);              // UID frame
+    EXPECT_EQ((int8_t)frame[1], -25);        // Ranging data
+
+    EXPECT_EQ(f.txPower, ADV_TX_POWER_NONE);
+    EXPECT_FALSE(f.has(ADV_HAS_NAME));
+    EXPECT_FALSE(f.has(ADV_HAS_MANUFACTURER));
+}
+
+TEST(AdvertFieldsTest, Uuid128TxPowerAppearanceAndName) {
+    AdvertFields f;
+    ASSERT_TRUE(parseAdvertFields(FITNESS_BAND, sizeof(FITNESS_BAND), f));
+
+    ASSERT_EQ(f.uuid128Count, 1u);
+    EXPECT_EQ(f.uuid128[0].len, 16u);
+    EXPECT_EQ(AdvertFields::bytes(FITNESS_BAND, f.uuid128[0])[15], 0x6Eu);   // Nordic UART base
+    EXPECT_EQ(f.uuid16Count, 0u);
+
+    EXPECT_TRUE(f.has(ADV_HAS_TX_POWER));
+    EXPECT_EQ(f.txPower, -12);
+    EXPECT_EQ(f.appearance, 0x03C1u);
+    ASSERT_TRUE(f.nameComplete);
+    EXPECT_EQ(std::string((const char*)AdvertFields::bytes(FITNESS_BAND, f.name), f.name.len),
+              "Mi Band 7");
+}
+
+TEST(AdvertFieldsTest, TrackersAndDeviceInfo) {
+    AdvertFields f;
+    ASSERT_TRUE(parseAdvertFields(SMARTTAG, sizeof(SMARTTAG), f));
+    ASSERT_EQ(f.serviceDataCount, 1u);
+    EXPECT_EQ(f.serviceDataUuid[0], 0xFD5Au);
+    EXPECT_FALSE(f.has(ADV_HAS_SERVICES));   // Service data alone isn't a UUID list
+
+    ASSERT_TRUE(parseAdvertFields(AIRTAG, sizeof(AIRTAG), f));
+    EXPECT_FALSE(f.has(ADV_HAS_FLAGS));
+    EXPECT_EQ(f.manufacturerId, 0x004Cu);
+    EXPECT_EQ(f.manufacturerData.len, 27u);
+    EXPECT_EQ(AdvertFields::bytes(AIRTAG, f.manufacturerData)[0], 0x12u);
+
+    // The same fields reach BLEDeviceInfo
+    RawAdvert adv;
+    memset(&adv, 0, sizeof(adv));
+    adv.len = sizeof(EDDYSTONE_UID);
+    memcpy(adv.payload, EDDYSTONE_UID, sizeof(EDDYSTONE_UID));
+    BLEDeviceInfo info;
+    ASSERT_TRUE(decodeAdvert(adv, info));
+    EXPECT_EQ(info.flags, 0x06u);
+    EXPECT_EQ(info.txPower, ADV_TX_POWER_NONE);
+    ASSERT_EQ(info.serviceUuidCount, 1u);
+    EXPECT_EQ(info.serviceUuids[0], 0xFEAAu);
+    EXPECT_TRUE(info.hasServices);    EXPECT_FALSE(info.isRandomAddress);
+
+    adv.addressType = 3;                     // Random, identity resolved
+    decodeAdvert(adv, info);
+    EXPECT_TRUE(info.isRandomAddress);
+}
+
+TEST(AdvertFieldsTest, LimitsCountOverflow) {
+    // Eleven 16-bit UUIDs in one list, four service data entries
+    uint8_t adv[BLE_ADV_MAX_LEN];
+    size_t n = 0;
+    adv[n++] = 1 + 22;
+    adv[n++] = AD_TYPE_UUID16_COMPLETE;
+    for (int i = 0; i < 11; i++) { adv[n++] = (uint8_t)i; adv[n++] = 0x18; }
+    for (int i = 0; i < 4; i++) {
+        adv[n++] = 3;
+        adv[n++] = AD_TYPE_SERVICE_DATA16;
+        adv[n++] = (uint8_t)i;
+        adv[n++] = 0xFE;
+    }
+
+    AdvertFields f;
+    ASSERT_TRUE(parseAdvertFields(adv, n, f));
+    EXPECT_EQ(f.uuid16Count, ADV_MAX_UUID16);
+    EXPECT_EQ(f.uuid16[7], 0x1807u);
+    EXPECT_EQ(f.serviceDataCount, ADV_MAX_SERVICE_DATA);
+    EXPECT_EQ(f.serviceData[0].len, 0u);
+    EXPECT_EQ(f.overflow, 3u + 1u);
+}
+
+TEST(AdvertFieldsTest, ParseCost) {
+    const uint8_t* vectors[] = {EDDYSTONE_UID, FITNESS_BAND, SMARTTAG, AIRTAG};
+    const size_t   lengths[] = {sizeof(EDDYSTONE_UID), sizeof(FITNESS_BAND),
+                                sizeof(SMARTTAG), sizeof(AIRTAG)};
+    const uint32_t ADVERTS = 1000000;
+    AdvertFields f;
+    uint32_t sink = 0;
+
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t c0 = __rdtsc();
+#endif
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < ADVERTS; i++) {
+        parseAdvertFields(vectors[i & 3], lengths[i & 3], f);
+        sink += f.present + f.uuid16Count;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / ADVERTS;
+
+#if defined(__x86_64__) || defined(__i386__)
+    double cycles = (double)(__rdtsc() - c0) / ADVERTS;
+    printf("[ ad parse ] %.1f ns, %.0f TSC cycles per advert; record is %u bytes\n",
+           ns, cycles, (unsigned)sizeof(AdvertFields));
+#else
+    printf("[ ad parse ] %.1f ns per advert; record is %u bytes\n",
+           ns, (unsigned)sizeof(AdvertFields));
+#endif
+    EXPECT_GT(sink, 0u);
+    EXPECT_LE(sizeof(AdvertFields), 64u);
+}
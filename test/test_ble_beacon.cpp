@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "BLEBeacon.h"
+#include "TargetTable.h"
+#include <cstdio>
+#include <cstring>
+
+using namespace Vanguard;
+
+namespace {
+
+// iBeacon E2C56DB5-DFFB-48D2-B060-D0F5A71096E0, major 1, minor 2, -59 dBm
+const uint8_t IBEACON[] = {
+    0x02, 0x01, 0x06,
+    0x1A, 0xFF, 0x4C, 0x00, 0x02, 0x15,
+    0xE2, 0xC5, 0x6D, 0xB5, 0xDF, 0xFB, 0x48, 0xD2,
+    0xB0, 0x60, 0xD0, 0xF5, 0xA7, 0x10, 0x96, 0xE0,
+    0x00, 0x01, 0x00, 0x02, 0xC5
+};
+
+// AltBeacon from Radius Networks (0x0118), ref RSSI -65
+const uint8_t ALTBEACON[] = {
+    0x1B, 0xFF, 0x18, 0x01, 0xBE, 0xAC,
+    0x2F, 0x23, 0x44, 0x54, 0xCF, 0x6D, 0x4A, 0x0F,
+    0xAD, 0xF2, 0xF4, 0x91, 0x1B, 0xA9, 0xFF, 0xA6,
+    0x00, 0x01, 0x00, 0x02, 0xBF, 0x00
+};
+
+// Eddystone-UID, -25 dBm at 0 m
+const uint8_t EDDYSTONE_UID[] = {
+    0x02, 0x01, 0x06,
+    0x03, 0x03, 0xAA, 0xFE,
+    0x17, 0x16, 0xAA, 0xFE, 0x00, 0xE7,
+    0xED, 0xD5, 0x0F, 0x5B, 0x2C, 0x3A, 0x10, 0xA1, 0x6C, 0x33,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00
+};
+
+// Eddystone-URL https://www.example.com/
+const uint8_t EDDYSTONE_URL[] = {
+    0x03, 0x03, 0xAA, 0xFE,
+    0x0E, 0x16, 0xAA, 0xFE, 0x10, 0xEB, 0x01, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0x00
+};
+
+// Eddystone-TLM: 3000 mV, 23.5 degC, 1000 adverts, 1 h up
+const uint8_t EDDYSTONE_TLM[] = {
+    0x03, 0x03, 0xAA, 0xFE,
+    0x11, 0x16, 0xAA, 0xFE, 0x20, 0x00,
+    0x0B, 0xB8, 0x17, 0x80,
+    0x00, 0x00, 0x03, 0xE8,
+    0x00, 0x00, 0x8C, 0xA0
+};
+
+RawAdvert makeRaw(const uint8_t* payload, size_t len, uint8_t addrLow, uint32_t now) {
+    RawAdvert adv;
+    memset(&adv, 0, sizeof(adv));
+    const uint8_t addr[6] = {addrLow, 0x10, 0x20, 0x30, 0x40, 0xC0};
+    memcpy(adv.address, addr, 6);
+    adv.rssi = -70;
+    adv.len = (uint8_t)len;
+    adv.timestampMs = now;
+    memcpy(adv.payload, payload, len);
+    return adv;
+}
+
+bool decode(const uint8_t* payload, size_t len, BLEBeaconInfo& out,
+            uint8_t addrLow = 1, uint32_t now = 1000) {
+    RawAdvert adv = makeRaw(payload, len, addrLow, now);
+    AdvertFields f;
+    parseAdvertFields(adv.payload, adv.len, f);
+    return decodeBeacon(adv, f, out);
+}
+
+} // namespace
+
+TEST(BLEBeaconTest, DecodesIBeacon) {
+    BLEBeaconInfo b;
+    ASSERT_TRUE(decode(IBEACON, sizeof(IBEACON), b));
+    EXPECT_EQ(b.format, BLEBeaconFormat::IBEACON);
+    EXPECT_EQ(b.major, 1u);
+    EXPECT_EQ(b.minor, 2u);
+    EXPECT_EQ(b.measuredPower, -59);
+    EXPECT_EQ(b.id[0], 0xE2u);
+    EXPECT_EQ(b.key[0] & 0x03, 0x02);        // Locally administered, unicast
+
+    char name[SSID_MAX_LEN + 1];
+    formatBeaconName(b, name, sizeof(name));
+    EXPECT_STREQ(name, "iBeacon E2C56DB5 1.2");
+}
+
+TEST(BLEBeaconTest, DecodesAltBeaconAndEddystone) {
+    BLEBeaconInfo b;
+    char name[SSID_MAX_LEN + 1];
+
+    ASSERT_TRUE(decode(ALTBEACON, sizeof(ALTBEACON), b));
+    EXPECT_EQ(b.format, BLEBeaconFormat::ALTBEACON);
+    EXPECT_EQ(b.measuredPower, -65);
+    formatBeaconName(b, name, sizeof(name));
+    EXPECT_STREQ(name, "AltBeacon 2F234454");
+
+    ASSERT_TRUE(decode(EDDYSTONE_UID, sizeof(EDDYSTONE_UID), b));
+    EXPECT_EQ(b.format, BLEBeaconFormat::EDDYSTONE_UID);
+    EXPECT_EQ(b.measuredPower, -25);
+    EXPECT_EQ(b.idLen, 16u);
+    formatBeaconName(b, name, sizeof(name));
+    EXPECT_STREQ(name, "Eddystone EDD50F5B/0001");
+
+    ASSERT_TRUE(decode(EDDYSTONE_URL, sizeof(EDDYSTONE_URL), b));
+    EXPECT_EQ(b.format, BLEBeaconFormat::EDDYSTONE_URL);
+    EXPECT_STREQ(b.url, "https://www.example.com/");
+    formatBeaconName(b, name, sizeof(name));
+    EXPECT_STREQ(name, "example.com/");
+
+    ASSERT_TRUE(decode(EDDYSTONE_TLM, sizeof(EDDYSTONE_TLM), b));
+    EXPECT_EQ(b.format, BLEBeaconFormat::EDDYSTONE_TLM);
+    EXPECT_EQ(b.batteryMv, 3000u);
+    EXPECT_EQ(b.temperature, 0x1780);        // 23.5 * 256
+    EXPECT_EQ(b.advCount, 1000u);
+    EXPECT_EQ(b.uptimeDs, 36000u);
+}
+
+TEST(BLEBeaconTest, RejectsOtherAdverts) {
+    // Apple but not iBeacon (Find My), truncated iBeacon, encrypted TLM
+    const uint8_t findMy[] = {0x07, 0xFF, 0x4C, 0x00, 0x12, 0x19, 0x10, 0xA4};
+    const uint8_t shortIBeacon[] = {0x08, 0xFF, 0x4C, 0x00, 0x02, 0x15, 0xE2, 0xC5, 0x6D};
+    const uint8_t etlm[] = {0x07, 0x16, 0xAA, 0xFE, 0x20, 0x01, 0x00, 0x00};
+
+    BLEBeaconInfo b;
+    EXPECT_FALSE(decode(findMy, sizeof(findMy), b));
+    EXPECT_FALSE(decode(shortIBeacon, sizeof(shortIBeacon), b));
+    EXPECT_FALSE(decode(etlm, sizeof(etlm), b));
+}
+
+TEST(BLEBeaconTest, KeyFollowsIdentityNotAddress) {
+    BLEBeaconInfo a, b, c;
+    ASSERT_TRUE(decode(IBEACON, sizeof(IBEACON), a, 1));
+    ASSERT_TRUE(decode(IBEACON, sizeof(IBEACON), b, 2));
+    EXPECT_EQ(memcmp(a.key, b.key, 6), 0);
+
+    // A different minor is a different beacon
+    uint8_t other[sizeof(IBEACON)];
+    memcpy(other, IBEACON, sizeof(other));
+    other[28] = 0x03;
+    ASSERT_TRUE(decode(other, sizeof(other), c, 1));
+    EXPECT_NE(memcmp(a.key, c.key, 6), 0);
+}
+
+TEST(BeaconTrackerTest, ThrottlesAndFollowsRotation) {
+    BeaconTracker tracker;
+    BLEBeaconInfo b;
+
+    decode(IBEACON, sizeof(IBEACON), b, 1, 1000);
+    EXPECT_TRUE(tracker.admit(b, 1000));                           // New
+    EXPECT_FALSE(tracker.admit(b, 1100));                          // Too soon
+    EXPECT_TRUE(tracker.admit(b, 1000 + BLE_BEACON_REPORT_MS));    // Periodic refresh
+
+    decode(IBEACON, sizeof(IBEACON), b, 2, 2100);
+    EXPECT_TRUE(tracker.admit(b, 2100));                           // Rotated
+    EXPECT_EQ(tracker.rotations(), 1u);
+}
+
+TEST(BeaconTrackerTest, TlmJoinsTheIdentityOnItsAddress) {
+    BeaconTracker tracker;
+    BLEBeaconInfo uid, tlm;
+
+    // TLM before any UID from that address: nothing to attach it to
+    decode(EDDYSTONE_TLM, sizeof(EDDYSTONE_TLM), tlm, 5, 1000);
+    EXPECT_FALSE(tracker.admit(tlm, 1000));
+
+    decode(EDDYSTONE_UID, sizeof(EDDYSTONE_UID), uid, 5, 1000);
+    EXPECT_TRUE(tracker.admit(uid, 1000));
+
+    decode(EDDYSTONE_TLM, sizeof(EDDYSTONE_TLM), tlm, 5, 1200);
+    EXPECT_TRUE(tracker.admit(tlm, 1200));
+    EXPECT_EQ(memcmp(tlm.key, uid.key, 6), 0);
+    EXPECT_FALSE(tracker.admit(tlm, 1300));
+}
+
+TEST(BeaconTrackerTest, RotatingBeaconsStayOneTargetEach) {
+    BeaconTracker tracker;
+    TargetTable table;
+    BLEBeaconInfo b;
+    uint32_t reports = 0;
+    uint32_t adverts = 0;
+
+    // Three beacons, ten adverts a second for a minute, new address every 15 s
+    uint8_t payloads[3][sizeof(IBEACON)];
+    for (int k = 0; k < 3; k++) {
+        memcpy(payloads[k], IBEACON, sizeof(IBEACON));
+        payloads[k][28] = (uint8_t)(10 + k);
+    }
+    for (uint32_t now = 0; now < 60000; now += 100) {
+        for (int k = 0; k < 3; k++) {
+            uint8_t addr = (uint8_t)(k * 16 + now / 15000);
+            decode(payloads[k], sizeof(IBEACON), b, addr, now);
+            adverts++;
+            if (tracker.admit(b, now)) {
+                reports++;
+                table.addBeacon(b);
+            }
+        }
+    }
+
+    EXPECT_EQ(table.countByType(TargetType::BLE_BEACON), 3u);
+    EXPECT_EQ(table.count(), 3u);
+    EXPECT_EQ(tracker.rotations(), 3u * 3u);
+    EXPECT_LE(reports, 3u * 60u + 3u * 4u);
+    printf("[ beacons  ] %u adverts from 12 addresses -> %u reports, %u targets\n",
+           (unsigned)adverts, (unsigned)reports, (unsigned)table.count());
+
+    // TLM for an identity that isn't listed adds nothing
+    TargetTable empty;
+    decode(EDDYSTONE_TLM, sizeof(EDDYSTONE_TLM), b);
+    EXPECT_FALSE(empty.addBeacon(b));
+    EXPECT_EQ(empty.count(), 0u);
+}
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "BLERegistry.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace Vanguard;
+
+namespace {
+
+BLEDeviceInfo makeDevice(uint32_t id, uint32_t now) {
+    BLEDeviceInfo d;
+    memset(&d, 0, sizeof(d));
+    d.address[0] = 0xC0 | (uint8_t)(id >> 24 & 0x3F);   // Random static
+    d.address[1] = 0x5A;
+    d.address[2] = (uint8_t)(id >> 16);
+    d.address[3] = (uint8_t)(id >> 8);
+    d.address[4] = (uint8_t)id;
+    d.address[5] = 0x42;
+    d.rssi = -70;
+    d.lastSeenMs = now;
+    return d;
+}
+
+// Every device findable through the index
+void checkConsistent(const BLERegistry& reg) {
+    for (size_t i = 0; i < reg.count(); i++) {
+        const BLEDeviceInfo& d = reg.devices()[i];
+        ASSERT_EQ(reg.find(d.address), &d) << "entry " << i;
+    }
+}
+
+// What BruceBLE did before: linear scan of an unbounded vector
+bool linearObserve(std::vector<BLEDeviceInfo>& devices, const BLEDeviceInfo& info) {
+    for (auto& existing : devices) {
+        if (memcmp(existing.address, info.address, 6) == 0) {
+            existing.rssi = info.rssi;
+            existing.lastSeenMs = info.lastSeenMs;
+            return false;
+        }
+    }
+    devices.push_back(info);
+    return true;
+}
+
+} // namespace
+
+TEST(BLERegistryTest, ObserveRefreshesKnownDevices) {
+    BLERegistry reg(8);
+    BLEDeviceInfo d = makeDevice(1, 1000);
+
+    EXPECT_TRUE(reg.observe(d));
+    d.rssi = -40;
+    d.lastSeenMs = 2000;
+    strcpy(d.name, "Tag");
+    EXPECT_FALSE(reg.observe(d));
+
+    const BLEDeviceInfo* found = reg.find(d.address);
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found->rssi, -40);
+    EXPECT_EQ(found->lastSeenMs, 2000u);
+    EXPECT_STREQ(found->name, "Tag");       // Filled in once known
+    EXPECT_EQ(reg.count(), 1u);
+
+    // A nameless advert doesn't erase the name
+    d.name[0] = '\0';
+    reg.observe(d);
+    EXPECT_STREQ(reg.find(d.address)->name, "Tag");
+}
+
+TEST(BLERegistryTest, EvictsLeastRecentlySeen) {
+    BLERegistry reg(4);
+    for (uint32_t i = 0; i < 4; i++) reg.observe(makeDevice(i, 100 + i));
+
+    // Refresh device 0, so device 1 is now the stalest
+    reg.observe(makeDevice(0, 200));
+    EXPECT_TRUE(reg.observe(makeDevice(9, 201)));
+
+    EXPECT_EQ(reg.count(), 4u);
+    EXPECT_EQ(reg.evictions(), 1u);
+    EXPECT_EQ(reg.find(makeDevice(1, 0).address), nullptr);
+    EXPECT_NE(reg.find(makeDevice(0, 0).address), nullptr);
+    checkConsistent(reg);
+}
+
+TEST(BLERegistryTest, PruneStaleStopsAtFirstFreshDevice) {
+    BLERegistry reg(64);
+    for (uint32_t i = 0; i < 50; i++) reg.observe(makeDevice(i, 1000 + i * 100));
+
+    // Seen at 1000..5900; now 10000 with 5000 ms max age drops < 5000
+    EXPECT_EQ(reg.pruneStale(10000, 5000), 40u);
+    EXPECT_EQ(reg.count(), 10u);
+    EXPECT_EQ(reg.pruneStale(10000, 5000), 0u);
+    checkConsistent(reg);
+
+    EXPECT_TRUE(reg.remove(makeDevice(45, 0).address));
+    EXPECT_FALSE(reg.remove(makeDevice(45, 0).address));
+    checkConsistent(reg);
+
+    reg.clear();
+    EXPECT_EQ(reg.count(), 0u);
+    EXPECT_TRUE(reg.observe(makeDevice(1, 0)));
+}
+
+TEST(BLERegistryTest, PolicyAgesRandomAddressesFirst) {
+    AgingPolicy policy = AgingPolicy::defaults();
+    BLERegistry reg(64);
+
+    // Alternating public and random, oldest first
+    for (uint32_t i = 0; i < 20; i++) {
+        BLEDeviceInfo d = makeDevice(i, i * 100);
+        d.isRandomAddress = (i % 2 == 0);
+        reg.observe(d);
+    }
+
+    // Randoms seen before 1000 expire from among the public devices
+    EXPECT_EQ(reg.pruneStale(policy.bleRandomMs + 1000, policy), 5u);
+    EXPECT_EQ(reg.count(), 15u);
+    EXPECT_EQ(reg.find(makeDevice(0, 0).address), nullptr);
+    EXPECT_NE(reg.find(makeDevice(1, 0).address), nullptr);
+    checkConsistent(reg);
+
+    EXPECT_EQ(reg.pruneStale(policy.blePublicMs + 2000, policy), 15u);
+    EXPECT_EQ(reg.count(), 0u);
+}
+
+TEST(BLERegistryTest, PolicyReachesSteadyStateUnderChurn) {
+    AgingPolicy policy = AgingPolicy::defaults();
+    BLERegistry reg(4096);
+    uint32_t id = 0;
+    size_t atTen = 0, peak = 0;
+
+    // A crowd: each second 20 new phones on fresh random addresses show
+    // up and advertise for 10 s; one public device in 50. Pruned once a
+    // second, as BruceBLE's tick would.
+    for (uint32_t now = 0; now <= 20 * 60000; now += 1000) {
+        for (int k = 0; k < 20; k++, id++) {
+            BLEDeviceInfo d = makeDevice(id, now);
+            d.isRandomAddress = (id % 50 != 0);
+            reg.observe(d);
+        }
+        for (uint32_t back = 1; back < 10 && back * 20 <= id; back++) {
+            for (uint32_t k = 0; k < 20; k++) {
+                BLEDeviceInfo d = makeDevice(id - back * 20 - k - 1, now);
+                d.isRandomAddress = ((id - back * 20 - k - 1) % 50 != 0);
+                reg.observe(d);
+            }
+        }
+        reg.pruneStale(now, policy);
+        if (now == 10 * 60000) atTen = reg.count();
+        if (reg.count() > peak) peak = reg.count();
+    }
+
+    // Plateaus well under capacity: 24,000 devices passed through
+    EXPECT_EQ(reg.evictions(), 0u);
+    EXPECT_EQ(reg.count(), atTen);
+    EXPECT_LT(peak, reg.capacity());
+    checkConsistent(reg);
+    printf("[ ble aging ] %u devices seen, steady at %u (peak %u)\n",
+           (unsigned)id, (unsigned)reg.count(), (unsigned)peak);
+}
+
+TEST(BLERegistryTest, ChurnKeepsIndexAndListIntact) {
+    BLERegistry reg(100);
+    uint32_t state = 12345;
+    uint32_t now = 0;
+
+    for (int i = 0; i < 20000; i++) {
+        state ^= state << 13; state ^= state >> 17; state ^= state << 5;
+        now += 3;
+        uint32_t id = state % 300;
+        if (state % 17 == 0) reg.remove(makeDevice(id, 0).address);
+        else                 reg.observe(makeDevice(id, now));
+        if (i % 1000 == 0) reg.pruneStale(now, 400);
+    }
+    EXPECT_LE(reg.count(), 100u);
+    checkConsistent(reg);
+}
+
+TEST(BLERegistryTest, CapacityIsClamped) {
+    EXPECT_EQ(BLERegistry(0).capacity(), 1u);
+    EXPECT_EQ(BLERegistry(100000).capacity(), BLE_REGISTRY_MAX);
+    EXPECT_EQ(BLERegistry().capacity(), BLE_REGISTRY_CAPACITY);
+}
+
+TEST(BLERegistryTest, LookupCostVsLinearScan) {
+    const size_t sizes[] = {100, 1000, 5000};
+
+    for (size_t n : sizes) {
+        BLERegistry reg(n);
+        std::vector<BLEDeviceInfo> linear;
+        for (uint32_t i = 0; i < n; i++) {
+            reg.observe(makeDevice(i, i));
+            linearObserve(linear, makeDevice(i, i));
+        }
+
+        // Steady state: every advert is from a known device
+        const uint32_t ADVERTS = 200000;
+        auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < ADVERTS; i++) {
+            reg.observe(makeDevice((i * 7919) % n, n + i));
+        }
+        auto t1 = std::chrono::steady_clock::now();
+
+        uint32_t linearAdverts = (uint32_t)(ADVERTS * 100 / n);   // Keep it quick
+        auto l0 = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < linearAdverts; i++) {
+            linearObserve(linear, makeDevice((i * 7919) % n, n + i));
+        }
+        auto l1 = std::chrono::steady_clock::now();
+
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / ADVERTS;
+        double linNs = std::chrono::duration<double, std::nano>(l1 - l0).count() / linearAdverts;
+        printf("[ ble reg  ] %5u devices: %.1f ns/advert hashed, %.1f ns/advert linear\n",
+               (unsigned)n, ns, linNs);
+        EXPECT_EQ(reg.count(), n);
+        EXPECT_EQ(reg.evictions(), 0u);
+    }
+}
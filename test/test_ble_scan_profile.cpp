@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "BLEScanProfile.h"
+#include "sim/BleScanSim.h"
+#include <cstdio>
+#include <cstring>
+
+using namespace Vanguard;
+using namespace Vanguard::Sim;
+
+namespace {
+
+const BLEScanProfile& profile(size_t i) {
+    return getBleScanProfile((BLEScanProfileId)i);
+}
+
+void formatMs(uint32_t ms, char* out, size_t len) {
+    if (ms == SIM_NOT_FOUND) snprintf(out, len, "    -");
+    else                     snprintf(out, len, "%5u", (unsigned)ms);
+}
+
+} // namespace
+
+TEST(BLEScanProfileTest, ProfilesTradeDutyForPower) {
+    const BLEScanProfile& fast = getBleScanProfile(BLEScanProfileId::FAST);
+    const BLEScanProfile& balanced = getBleScanProfile(BLEScanProfileId::BALANCED);
+    const BLEScanProfile& low = getBleScanProfile(BLEScanProfileId::LOW_POWER);
+
+    EXPECT_EQ(bleScanDutyPercent(fast), 100u);
+    EXPECT_GT(bleScanDutyPercent(fast), bleScanDutyPercent(balanced));
+    EXPECT_GT(bleScanDutyPercent(balanced), bleScanDutyPercent(low));
+    EXPECT_FALSE(low.active);
+    EXPECT_TRUE(low.filterDuplicates);
+    EXPECT_EQ(balanced.durationMs, 10000u);          // The old fixed scan
+
+    for (size_t i = 0; i < BLE_SCAN_PROFILE_COUNT; i++) {
+        EXPECT_LE(profile(i).windowMs, profile(i).intervalMs);
+        EXPECT_GT(profile(i).durationMs, 0u);
+        for (size_t j = i + 1; j < BLE_SCAN_PROFILE_COUNT; j++) {
+            EXPECT_STRNE(profile(i).name, profile(j).name);
+        }
+    }
+
+    // Out of range falls back to the default
+    EXPECT_EQ(&getBleScanProfile((BLEScanProfileId)7), &balanced);
+}
+
+TEST(BLEScanProfileTest, SimulationIsReproducible) {
+    BleScanSimConfig cfg;
+    cfg.seed = 42;
+    BleScanSim a(cfg), b(cfg);
+
+    const BLEScanProfile& p = getBleScanProfile(BLEScanProfileId::BALANCED);
+    DiscoveryResult ra = a.run(p), rb = b.run(p);
+    EXPECT_EQ(ra.p50Ms, rb.p50Ms);
+    EXPECT_EQ(ra.allMs, rb.allMs);
+    EXPECT_EQ(ra.reports, rb.reports);
+
+    cfg.seed = 43;
+    BleScanSim c(cfg);
+    EXPECT_NE(c.run(p).reports, ra.reports);
+}
+
+TEST(BLEScanProfileTest, DiscoveryLatencyBenchmark) {
+    BleScanSimConfig cfg;
+    cfg.devices = 100;
+    BleScanSim sim(cfg);
+
+    DiscoveryResult r[BLE_SCAN_PROFILE_COUNT];
+    for (size_t i = 0; i < BLE_SCAN_PROFILE_COUNT; i++) {
+        const BLEScanProfile& p = profile(i);
+        r[i] = sim.run(p);
+
+        char p50[12], p90[12], all[12];
+        formatMs(r[i].p50Ms, p50, sizeof(p50));
+        formatMs(r[i].p90Ms, p90, sizeof(p90));
+        formatMs(r[i].allMs, all, sizeof(all));
+        printf("[ ble scan ] %-9s %3u%% duty: 50%% %s ms, 90%% %s ms, all %s ms, %3u/%u in %2us, %5u reports\n",
+               p.name, (unsigned)bleScanDutyPercent(p), p50, p90, all,
+               (unsigned)r[i].found, (unsigned)cfg.devices, (unsigned)(p.durationMs / 1000),
+               (unsigned)r[i].reports);
+    }
+
+    const DiscoveryResult& fast = r[(size_t)BLEScanProfileId::FAST];
+    const DiscoveryResult& balanced = r[(size_t)BLEScanProfileId::BALANCED];
+    const DiscoveryResult& low = r[(size_t)BLEScanProfileId::LOW_POWER];
+
+    // More listening finds devices sooner
+    EXPECT_LE(fast.p90Ms, balanced.p90Ms);
+    EXPECT_LE(balanced.p90Ms, low.p90Ms);
+    EXPECT_EQ(fast.found, cfg.devices);
+    EXPECT_LE(fast.allMs, 5000u);
+
+    // The longer low-power scan still finds most devices, and duplicate
+    // filtering caps host work at one report each
+    EXPECT_GE(low.found, cfg.devices * 3 / 4);
+    EXPECT_LE(low.reports, (uint32_t)cfg.devices);
+    EXPECT_GT(balanced.reports, balanced.found);
+}
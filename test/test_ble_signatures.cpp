@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "BLESignatures.h"
+#include "BLERegistry.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Vanguard;
+
+namespace {
+
+BLEDeviceInfo makeDevice(const char* name, bool connectable = false) {
+    BLEDeviceInfo d;
+    memset(&d, 0, sizeof(d));
+    d.address[5] = 0x42;
+    strncpy(d.name, name, sizeof(d.name) - 1);
+    d.isConnectable = connectable;
+    return d;
+}
+
+size_t loadStr(BLESignatureSet& sigs, const std::string& text) {
+    return sigs.load(text.data(), text.size());
+}
+
+// What a rule list costs evaluated one rule at a time
+struct NaiveRule {
+    std::string prefix;
+    uint16_t    mfg;
+};
+
+int naiveMatch(const std::vector<NaiveRule>& rules, const BLEDeviceInfo& d) {
+    for (size_t i = 0; i < rules.size(); i++) {
+        const NaiveRule& r = rules[i];
+        if (!r.prefix.empty() && strncmp(d.name, r.prefix.c_str(), r.prefix.size()) != 0) continue;
+        if (r.mfg && d.manufacturerId != r.mfg) continue;
+        return (int)i + 1;
+    }
+    return 0;
+}
+
+} // namespace
+
+TEST(BLESignaturesTest, DefaultsCoverTheOldSkimmerChecks) {
+    BLESignatureSet sigs;
+    sigs.loadDefaults();
+    EXPECT_GE(sigs.count(), 3u);
+    EXPECT_EQ(sigs.rejected(), 0u);
+
+    uint8_t id = sigs.match(makeDevice("HC-05 door"));
+    ASSERT_NE(id, 0u);
+    EXPECT_STREQ(sigs.label(id), "HC-05 serial module");
+    EXPECT_NE(sigs.match(makeDevice("HC-06")), 0u);
+    EXPECT_EQ(sigs.match(makeDevice("HC-0")), 0u);            // Shorter than the prefix
+    EXPECT_EQ(sigs.match(makeDevice("Pixel 8")), 0u);
+
+    // Nameless, connectable, no services
+    EXPECT_NE(sigs.match(makeDevice("", true)), 0u);
+    EXPECT_EQ(sigs.match(makeDevice("", false)), 0u);
+    BLEDeviceInfo withServices = makeDevice("", true);
+    withServices.hasServices = true;
+    EXPECT_EQ(sigs.match(withServices), 0u);
+}
+
+TEST(BLESignaturesTest, ParsesFilesAndSkipsBadLines) {
+    BLESignatureSet sigs;
+    std::string text =
+        "# comment\r\n"
+        "\n"
+        "Galaxy Buds: name=\"Galaxy Buds\" mfg=0075\r\n"
+        "Tile: uuid=FEED\n"
+        "Flagged: flags=06 connectable\n"
+        "no colon here\n"
+        "Unknown key: colour=red\n"
+        "Bad hex: mfg=XYZ\n"
+        "Empty:\n"
+        "   # indented comment\n";
+
+    EXPECT_EQ(loadStr(sigs, text), 3u);
+    EXPECT_EQ(sigs.rejected(), 4u);
+
+    BLEDeviceInfo buds = makeDevice("Galaxy Buds2 Pro");
+    EXPECT_EQ(sigs.match(buds), 0u);                          // Name alone isn't enough
+    buds.manufacturerId = 0x0075;
+    buds.manufacturerDataLen = 4;
+    EXPECT_STREQ(sigs.label(sigs.match(buds)), "Galaxy Buds");
+
+    BLEDeviceInfo tile = makeDevice("");
+    tile.serviceUuids[0] = 0x180F;
+    tile.serviceUuids[1] = 0xFEED;
+    tile.serviceUuidCount = 2;
+    EXPECT_STREQ(sigs.label(sigs.match(tile)), "Tile");
+
+    BLEDeviceInfo flagged = makeDevice("x", true);
+    flagged.flags = 0x02;
+    EXPECT_EQ(sigs.match(flagged), 0u);                       // 0x04 missing
+    flagged.flags = 0x06;
+    EXPECT_STREQ(sigs.label(sigs.match(flagged)), "Flagged");
+}
+
+TEST(BLESignaturesTest, EarliestRuleWinsAndCapacityHolds) {
+    BLESignatureSet sigs;
+    loadStr(sigs, "Broad: name=HC\nNarrow: name=HC-05\n");
+    EXPECT_STREQ(sigs.label(sigs.match(makeDevice("HC-05"))), "Broad");
+
+    sigs.clear();
+    std::string text;
+    for (size_t i = 0; i < BLE_SIG_MAX_RULES + 1; i++) {
+        text += "Rule " + std::to_string(i) + ": name=DEV" + std::to_string(i) + "-\n";
+    }
+    EXPECT_EQ(loadStr(sigs, text), BLE_SIG_MAX_RULES);
+    EXPECT_EQ(sigs.rejected(), 1u);
+    EXPECT_STREQ(sigs.label(sigs.match(makeDevice("DEV63-A"))), "Rule 63");
+    EXPECT_STREQ(sigs.label(0), "");
+}
+
+TEST(BLESignaturesTest, RegistryKeepsSignatureWithName) {
+    BLESignatureSet sigs;
+    sigs.loadDefaults();
+    BLERegistry reg(8);
+
+    BLEDeviceInfo d = makeDevice("");
+    d.signature = sigs.match(d);
+    EXPECT_EQ(d.signature, 0u);
+    strcpy(d.name, "40:22:..");                              // Placeholder
+    reg.observe(d);
+
+    // Scan response reveals the name: re-matched with it
+    BLEDeviceInfo named = makeDevice("HC-05");
+    named.signature = sigs.match(named);
+    reg.observe(named);
+    EXPECT_NE(reg.find(d.address)->signature, 0u);
+
+    // Same name again, nothing re-matched: signature stays
+    BLEDeviceInfo again = makeDevice("HC-05");
+    reg.observe(again);
+    EXPECT_NE(reg.find(d.address)->signature, 0u);
+}
+
+TEST(BLESignaturesTest, MatchCostIsFlatInRuleCount) {
+    const size_t ruleCounts[] = {4, 16, 64};
+    const uint32_t DEVICES = 200000;
+
+    std::vector<BLEDeviceInfo> devices;
+    for (int i = 0; i < 64; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "Phone %d", i);         // Misses every rule
+        BLEDeviceInfo d = makeDevice(name);
+        d.manufacturerId = (uint16_t)(0x100 + i);
+        d.manufacturerDataLen = 2;
+        devices.push_back(d);
+    }
+
+    for (size_t n : ruleCounts) {
+        BLESignatureSet sigs;
+        std::vector<NaiveRule> naive;
+        std::string text;
+        for (size_t i = 0; i < n; i++) {
+            std::string prefix = "DEV" + std::to_string(i);
+            uint16_t mfg = (uint16_t)(0x2000 + i);
+            char line[64];
+            snprintf(line, sizeof(line), "R%u: name=%s mfg=%04X\n", (unsigned)i, prefix.c_str(), mfg);
+            text += line;
+            naive.push_back(NaiveRule{prefix, mfg});
+        }
+        ASSERT_EQ(loadStr(sigs, text), n);
+
+        uint32_t hits = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < DEVICES; i++) hits += sigs.match(devices[i & 63]);
+        auto t1 = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < DEVICES; i++) hits += naiveMatch(naive, devices[i & 63]);
+        auto t2 = std::chrono::steady_clock::now();
+
+        printf("[ ble sigs ] %2u rules: %.1f ns/device compiled, %.1f ns/device rule by rule\n",
+               (unsigned)n,
+               std::chrono::duration<double, std::nano>(t1 - t0).count() / DEVICES,
+               std::chrono::duration<double, std::nano>(t2 - t1).count() / DEVICES);
+        EXPECT_EQ(hits, 0u);
+    }
+}
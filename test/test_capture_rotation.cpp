@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "CaptureRotation.h"
+
+using namespace Vanguard;
+
+namespace {
+
+CapturePolicy smallPolicy() {
+    CapturePolicy p = { 1000, 60000, 3500, true };
+    return p;
+}
+
+} // namespace
+
+TEST(CaptureRotationTest, NamesLeadWithSessionAndSequence) {
+    CaptureRotation rot;
+    rot.begin("hs_AABBCC", 0x2A, 0);
+
+    char path[CAPTURE_PATH_LEN];
+    rot.nextPath(path, sizeof(path), 0);
+    EXPECT_STREQ(path, "/captures/0000002A_0000_hs_AABBCC.pcap");
+    rot.nextPath(path, sizeof(path), 0);
+    EXPECT_STREQ(path, "/captures/0000002A_0001_hs_AABBCC.pcap");
+    EXPECT_EQ(rot.sequence(), 2);
+}
+
+TEST(CaptureRotationTest, RotatesOnSizeAndAge) {
+    CaptureRotation rot(smallPolicy());
+    rot.begin("mon", 1, 1000);
+
+    char path[CAPTURE_PATH_LEN];
+    rot.nextPath(path, sizeof(path), 1000);
+
+    EXPECT_FALSE(rot.shouldRotate(999, 1000));
+    EXPECT_TRUE(rot.shouldRotate(1000, 1000));
+    EXPECT_FALSE(rot.shouldRotate(10, 60999));
+    EXPECT_TRUE(rot.shouldRotate(10, 61000));
+
+    // Age restarts with each file
+    rot.nextPath(path, sizeof(path), 61000);
+    EXPECT_FALSE(rot.shouldRotate(10, 61001));
+}
+
+TEST(CaptureRotationTest, OrderKeySortsSessionsAndForeignFiles) {
+    uint64_t legacy = CaptureRotation::orderKey("/captures/hs_AABBCC.pcap");
+    uint64_t a = CaptureRotation::orderKey("/captures/00000001_0009_x.pcap");
+    uint64_t b = CaptureRotation::orderKey("/captures/00000002_0000_x.pcap");
+    uint64_t c = CaptureRotation::orderKey("/captures/00000002_0001_y.pcap");
+
+    EXPECT_EQ(legacy, 0u);
+    EXPECT_LT(legacy, a);
+    EXPECT_LT(a, b);
+    EXPECT_LT(b, c);
+}
+
+TEST(CaptureRotationTest, EvictsOldestFirstUnderQuota) {
+    CaptureRotation rot(smallPolicy());   // 3500 byte cap
+
+    // Tracked out of order; ledger must still sort oldest first
+    rot.track("/captures/00000002_0000_x.pcap", 1000);
+    rot.track("/captures/hs_OLD.pcap", 1000);
+    rot.track("/captures/00000001_0000_x.pcap", 1000);
+    EXPECT_EQ(rot.totalBytes(), 3000u);
+
+    char victim[CAPTURE_PATH_LEN];
+    EXPECT_FALSE(rot.nextEviction(500, nullptr, victim, sizeof(victim)));
+
+    // Reserving a new 1000-byte file needs one eviction: the legacy file
+    ASSERT_TRUE(rot.nextEviction(1000, nullptr, victim, sizeof(victim)));
+    EXPECT_STREQ(victim, "/captures/hs_OLD.pcap");
+    rot.untrack(victim);
+
+    rot.track("/captures/00000002_0001_x.pcap", 1000);
+    ASSERT_TRUE(rot.nextEviction(1000, nullptr, victim, sizeof(victim)));
+    EXPECT_STREQ(victim, "/captures/00000001_0000_x.pcap");
+}
+
+TEST(CaptureRotationTest, NeverEvictsOpenFile) {
+    CaptureRotation rot(smallPolicy());
+    rot.track("/captures/00000001_0000_x.pcap", 5000);
+
+    char victim[CAPTURE_PATH_LEN];
+    EXPECT_FALSE(rot.nextEviction(0, "/captures/00000001_0000_x.pcap", victim, sizeof(victim)));
+}
+
+TEST(CaptureRotationTest, TrackUpdatesSize) {
+    CaptureRotation rot(smallPolicy());
+    rot.track("/captures/00000001_0000_x.pcap", 1000);   // Preallocated
+    rot.track("/captures/00000001_0000_x.pcap", 240);    // Truncated on close
+
+    EXPECT_EQ(rot.fileCount(), 1u);
+    EXPECT_EQ(rot.totalBytes(), 240u);
+}
+
+TEST(CaptureRotationTest, FullLedgerForcesEviction) {
+    CapturePolicy p = { 1000, 0, 0xFFFFFFFF, true };
+    CaptureRotation rot(p);
+
+    char path[CAPTURE_PATH_LEN];
+    for (size_t i = 0; i < CAPTURE_LEDGER_SLOTS; i++) {
+        snprintf(path, sizeof(path), "/captures/00000001_%04u_x.pcap", (unsigned)i);
+        EXPECT_TRUE(rot.track(path, 1));
+    }
+    EXPECT_FALSE(rot.track("/captures/00000002_0000_x.pcap", 1));
+
+    char victim[CAPTURE_PATH_LEN];
+    ASSERT_TRUE(rot.nextEviction(0, nullptr, victim, sizeof(victim)));
+    EXPECT_STREQ(victim, "/captures/00000001_0000_x.pcap");
+}
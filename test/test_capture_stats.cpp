@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "CaptureStats.h"
+
+using namespace Vanguard;
+
+TEST(CaptureStatsTest, WaitsForFullInterval) {
+    CaptureStats stats;
+    stats.reset(1000);
+    stats.countRx(6);
+
+    CaptureStatsSnapshot snap;
+    EXPECT_FALSE(stats.sample(1999, snap));
+    EXPECT_TRUE(stats.sample(2000, snap));
+    EXPECT_EQ(snap.rxPerSec, 1u);
+}
+
+TEST(CaptureStatsTest, ReportsPerSecondDeltas) {
+    CaptureStats stats;
+    stats.reset(0);
+
+    for (int i = 0; i < 100; i++) stats.countRx(1);
+    for (int i = 0; i < 50; i++) stats.countRx(6);
+    for (int i = 0; i < 30; i++) stats.countFiltered();
+    for (int i = 0; i < 115; i++) stats.countEnqueued();
+    for (int i = 0; i < 5; i++) stats.countDropped();
+    stats.countWrite(1000, 200);
+    stats.countWrite(3000, 1800);
+
+    CaptureStatsSnapshot snap;
+    ASSERT_TRUE(stats.sample(1000, snap));
+    EXPECT_EQ(snap.rxPerSec, 150u);
+    EXPECT_EQ(snap.filteredPerSec, 30u);
+    EXPECT_EQ(snap.enqueuedPerSec, 115u);
+    EXPECT_EQ(snap.droppedPerSec, 5u);
+    EXPECT_EQ(snap.bytesPerSec, 4000u);
+    EXPECT_EQ(snap.writeAvgUs, 1000u);
+    EXPECT_EQ(snap.writeMaxUs, 1800u);
+    EXPECT_EQ(snap.rxByChannel[1], 100);
+    EXPECT_EQ(snap.rxByChannel[6], 50);
+    EXPECT_EQ(snap.busiestChannel(), 1);
+
+    // Next interval only sees new traffic; max latency restarts
+    stats.countRx(11);
+    stats.countWrite(500, 100);
+    ASSERT_TRUE(stats.sample(2000, snap));
+    EXPECT_EQ(snap.rxPerSec, 1u);
+    EXPECT_EQ(snap.rxByChannel[1], 0);
+    EXPECT_EQ(snap.busiestChannel(), 11);
+    EXPECT_EQ(snap.writeMaxUs, 100u);
+    EXPECT_EQ(snap.droppedPerSec, 0u);
+    EXPECT_EQ(snap.totalDropped, 5u);
+    EXPECT_EQ(snap.totalBytes, 4500u);
+}
+
+TEST(CaptureStatsTest, ScalesLateSamplesToPerSecond) {
+    CaptureStats stats;
+    stats.reset(0);
+    for (int i = 0; i < 200; i++) stats.countRx(3);
+
+    CaptureStatsSnapshot snap;
+    ASSERT_TRUE(stats.sample(2000, snap));
+    EXPECT_EQ(snap.rxPerSec, 100u);
+    EXPECT_EQ(snap.rxByChannel[3], 100);
+}
+
+TEST(CaptureStatsTest, IgnoresInvalidChannels) {
+    CaptureStats stats;
+    stats.reset(0);
+    stats.countRx(0);
+    stats.countRx(36);
+
+    CaptureStatsSnapshot snap;
+    ASSERT_TRUE(stats.sample(1000, snap));
+    EXPECT_EQ(snap.rxPerSec, 2u);
+    EXPECT_EQ(snap.busiestChannel(), 0);
+}
+
+TEST(CaptureStatsTest, CsvColumnsMatchHeader) {
+    CaptureStatsSnapshot snap;
+    memset(&snap, 0, sizeof(snap));
+    snap.timestampMs = 5000;
+    snap.rxPerSec = 42;
+    snap.rxByChannel[14] = 7;
+
+    char header[256];
+    char line[256];
+    CaptureStats::formatCsvHeader(header, sizeof(header));
+    CaptureStats::formatCsv(snap, line, sizeof(line));
+
+    auto columns = [](const char* s) {
+        int n = 1;
+        for (; *s; s++) if (*s == ',') n++;
+        return n;
+    };
+    EXPECT_EQ(columns(header), columns(line));
+    EXPECT_EQ(strncmp(line, "5000,42,", 8), 0);
+    EXPECT_EQ(line[strlen(line) - 1], '7');
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "ChannelScheduler.h"
+
+using namespace Vanguard;
+
+namespace {
+
+/**
+ * Drives the scheduler with a simulated 10ms tick and a synthetic RF
+ * environment: framesPerSec[ch] frames arrive while tuned to ch.
+ * Returns total dwell time per channel.
+ */
+void simulate(ChannelScheduler& s, const float* framesPerSec, uint32_t durationMs,
+              uint32_t* dwellMs, uint32_t start = 0) {
+    uint8_t tuned = 0;
+    float carry = 0.0f;
+
+    for (uint32_t now = start; now < start + durationMs; now += 10) {
+        uint8_t next = s.tick(now);
+        if (next) tuned = next;
+        if (!tuned) continue;
+
+        dwellMs[tuned] += 10;
+        carry += framesPerSec[tuned] / 100.0f;
+        while (carry >= 1.0f) {
+            s.recordFrame(tuned);
+            carry -= 1.0f;
+        }
+    }
+}
+
+} // namespace
+
+TEST(ChannelSchedulerTest, FirstTickTunesImmediately) {
+    ChannelScheduler s;
+    s.reset(0);
+    EXPECT_EQ(s.tick(0), 1);
+    EXPECT_EQ(s.tick(SCHED_MIN_DWELL_MS - 1), 0);
+    EXPECT_EQ(s.tick(SCHED_MIN_DWELL_MS), 2);
+}
+
+TEST(ChannelSchedulerTest, QuietSweepVisitsEveryChannel) {
+    ChannelScheduler s;
+    s.reset(0);
+
+    bool seen[WIFI_CHANNEL_MAX + 1] = {false};
+    for (uint32_t now = 0; now < WIFI_CHANNEL_MAX * SCHED_MIN_DWELL_MS; now += 10) {
+        uint8_t ch = s.tick(now);
+        if (ch) seen[ch] = true;
+    }
+    for (uint8_t ch = WIFI_CHANNEL_MIN; ch <= WIFI_CHANNEL_MAX; ch++) {
+        EXPECT_EQ(seen[ch], ch != 14) << "channel " << (int)ch;
+    }
+}
+
+TEST(ChannelSchedulerTest, BusyChannelsGetLongerDwell) {
+    ChannelScheduler s;
+    s.reset(0);
+
+    float rates[WIFI_CHANNEL_MAX + 1] = {0};
+    rates[1] = 50.0f;
+    rates[6] = 400.0f;
+    rates[11] = 100.0f;
+
+    uint32_t dwell[WIFI_CHANNEL_MAX + 1] = {0};
+    simulate(s, rates, 60000, dwell);
+
+    EXPECT_GT(s.frameRate(6), s.frameRate(11));
+    EXPECT_GT(dwell[6], dwell[11]);
+    EXPECT_GT(dwell[11], dwell[3]);
+    EXPECT_EQ(s.dwellFor(6), SCHED_MAX_DWELL_MS);
+
+    // Quiet channels are still visited every sweep; 14 isn't by default
+    EXPECT_GT(dwell[3], 0u);
+    EXPECT_GT(dwell[13], 0u);
+    EXPECT_EQ(dwell[14], 0u);
+}
+
+TEST(ChannelSchedulerTest, TargetDensityWeightsDwell) {
+    ChannelScheduler s;
+    s.reset(0);
+    s.setTargetCount(3, 8);
+    s.setTargetCount(9, 2);
+
+    EXPECT_EQ(s.dwellFor(3), SCHED_MAX_DWELL_MS);
+    EXPECT_GT(s.dwellFor(9), SCHED_MIN_DWELL_MS);
+    EXPECT_LT(s.dwellFor(9), SCHED_MAX_DWELL_MS);
+    EXPECT_EQ(s.dwellFor(5), SCHED_MIN_DWELL_MS);
+}
+
+TEST(ChannelSchedulerTest, PinHoldsChannel) {
+    ChannelScheduler s;
+    s.reset(0);
+    s.pin(6);
+
+    EXPECT_EQ(s.tick(0), 6);
+    for (uint32_t now = 10; now < 5000; now += 10) {
+        EXPECT_EQ(s.tick(now), 0);
+    }
+    EXPECT_EQ(s.current(), 6);
+
+    s.pin(0);
+    EXPECT_EQ(s.tick(5000), 7);
+}
+
+TEST(ChannelSchedulerTest, FocusRestrictsSweep) {
+    ChannelScheduler s;
+    s.reset(0);
+    s.setFocus((1 << 1) | (1 << 6) | (1 << 11));
+
+    float rates[WIFI_CHANNEL_MAX + 1] = {0};
+    uint32_t dwell[WIFI_CHANNEL_MAX + 1] = {0};
+    simulate(s, rates, 3000, dwell);
+
+    for (uint8_t ch = WIFI_CHANNEL_MIN; ch <= WIFI_CHANNEL_MAX; ch++) {
+        bool focused = (ch == 1 || ch == 6 || ch == 11);
+        EXPECT_EQ(dwell[ch] > 0, focused) << "channel " << (int)ch;
+    }
+}
+
+TEST(ChannelSchedulerTest, LeavesChannelDroppedFromFocus) {
+    ChannelScheduler s;
+    s.reset(0);
+    s.setTargetCount(1, 10);   // Long dwell on channel 1
+
+    EXPECT_EQ(s.tick(0), 1);
+    s.setFocus(1 << 11);
+    EXPECT_EQ(s.tick(10), 11);
+
+    s.setFocus(0);   // Back to all channels
+    EXPECT_EQ(s.focus(), SCHED_ALL_CHANNELS);
+}
+
+TEST(ChannelSchedulerTest, Channel14OnlyWhenAskedFor) {
+    ChannelScheduler s;
+    s.reset(0);
+    EXPECT_FALSE(s.focus() & (1 << 14));
+
+    s.setFocus((1 << 13) | (1 << 14) | (1 << 15));
+    EXPECT_EQ(s.focus(), (1 << 13) | (1 << 14));
+    EXPECT_EQ(s.tick(0), 13);
+    EXPECT_EQ(s.tick(s.dwellFor(13)), 14);
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "DirtyRows.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace Vanguard;
+
+namespace {
+
+// TargetRadar's layout
+const int16_t WIDTH = 240, HEIGHT = 135, HEADER = 16, ROW = 24, ROWS = 4;
+const DirtyRect SCREEN = {0, 0, WIDTH, HEIGHT};
+const DirtyRect HEADER_RECT = {0, 0, WIDTH, HEADER};
+const DirtyRect SCROLL_RECT = {WIDTH - 3, HEADER + 2, 2, HEIGHT - HEADER - 4};
+
+DirtyRect rowRect(int i) {
+    DirtyRect r = {0, (int16_t)(HEADER + 2 + i * ROW), WIDTH - 6, ROW};
+    return r;
+}
+
+// Cardputer's ST7789 at 40 MHz SPI
+uint32_t spiUs(uint32_t bytes) {
+    return bytes * 8 / 40;
+}
+
+Target makeTarget(uint8_t id, int8_t rssi) {
+    Target t;
+    memset(&t, 0, sizeof(t));
+    t.bssid[5] = id;
+    snprintf(t.ssid, sizeof(t.ssid), "Net-%u", (unsigned)id);
+    t.type = TargetType::ACCESS_POINT;
+    t.security = SecurityType::WPA2_PSK;
+    t.channel = (uint8_t)(1 + id % 11);
+    t.rssi = rssi;
+    return t;
+}
+
+// One radar frame the way TargetRadar::render() decides it
+void renderFrame(DirtyRows& dirty, const std::vector<Target>& list, int highlight, int offset, uint32_t now) {
+    bool full = dirty.isFull();
+    char count[8];
+    snprintf(count, sizeof(count), "%u", (unsigned)list.size());
+    if (dirty.update(0, dirtyHashStr(0x811C9DC5u, count)) && !full) dirty.pushed(HEADER_RECT);
+
+    for (int i = 0; i < ROWS; i++) {
+        int idx = offset + i;
+        uint32_t sig = (idx < (int)list.size()) ? radarRowSignature(list[idx], idx == highlight, now) : DIRTY_EMPTY;
+        if (dirty.update(1 + i, sig) && !full) dirty.pushed(rowRect(i));
+    }
+
+    uint32_t pos[2] = {(uint32_t)offset, (uint32_t)list.size()};
+    if (dirty.update(1 + ROWS, dirtyHash(0x811C9DC5u, pos, sizeof(pos))) && !full) dirty.pushed(SCROLL_RECT);
+
+    if (full) dirty.pushed(SCREEN);
+    dirty.endFrame(0);
+}
+
+bool strongerFirst(const Target& a, const Target& b) {
+    return a.rssi > b.rssi;
+}
+
+} // namespace
+
+TEST(DirtyRowsTest, OnlyChangedRegionsAreDirty) {
+    DirtyRows dirty;
+    EXPECT_TRUE(dirty.isFull());
+    EXPECT_TRUE(dirty.update(1, 100));
+    EXPECT_TRUE(dirty.update(2, 200));
+    dirty.endFrame(0);
+
+    EXPECT_FALSE(dirty.isFull());
+    EXPECT_FALSE(dirty.update(1, 100));
+    EXPECT_TRUE(dirty.update(2, 201));
+    EXPECT_FALSE(dirty.update(2, 201));
+
+    // Invalidation repaints everything, even unchanged regions
+    dirty.invalidate();
+    EXPECT_TRUE(dirty.update(1, 100));
+    dirty.endFrame(0);
+    EXPECT_FALSE(dirty.update(1, 100));
+
+    // Out of range is always dirty rather than never drawn
+    EXPECT_TRUE(dirty.update(DIRTY_MAX_REGIONS, 1));
+}
+
+TEST(DirtyRowsTest, RowSignatureTracksWhatIsDrawn) {
+    Target t = makeTarget(1, -60);
+    uint32_t base = radarRowSignature(t, false, 0);
+    EXPECT_NE(base, DIRTY_EMPTY);
+    EXPECT_EQ(radarRowSignature(t, false, 5000), base);       // Time alone changes nothing
+    EXPECT_NE(radarRowSignature(t, true, 0), base);
+
+    Target moved = t;
+    moved.rssi = -61;
+    EXPECT_NE(radarRowSignature(moved, false, 0), base);
+
+    // Not drawn: no effect
+    moved = t;
+    moved.beaconCount = 900;
+    moved.lastSeenMs = 1234;
+    EXPECT_EQ(radarRowSignature(moved, false, 0), base);
+
+    // Remembered targets show their age in minutes instead of RSSI
+    Target restored = t;
+    restored.isRestored = true;
+    uint32_t r0 = radarRowSignature(restored, false, 60000);
+    restored.rssi = -90;
+    EXPECT_EQ(radarRowSignature(restored, false, 119999), r0);
+    EXPECT_NE(radarRowSignature(restored, false, 120000), r0);
+}
+
+TEST(DirtyRowsTest, StatsCountEveryFrame) {
+    DirtyRows dirty;
+    dirty.pushed(SCREEN);
+    dirty.endFrame(1000);
+    dirty.endFrame(10);                                      // Nothing changed
+    dirty.pushed(rowRect(0));
+    dirty.endFrame(500);
+
+    const FrameStats& s = dirty.stats();
+    EXPECT_EQ(s.frames, 3u);
+    EXPECT_EQ(s.fullFrames, 1u);
+    EXPECT_EQ(s.bytes, SCREEN.bytes() + rowRect(0).bytes());
+    EXPECT_EQ(s.usPerFrame(), 1510u / 3);
+
+    dirty.resetStats();
+    EXPECT_EQ(dirty.stats().frames, 0u);
+}
+
+TEST(DirtyRowsTest, SpiTrafficBenchmark) {
+    // A minute on the radar at 20 FPS: 12 APs refreshed every second,
+    // each RSSI jittering, the list re-sorted; the user moves down the
+    // list every 3 s and something covers the screen every 20 s
+    std::vector<Target> list;
+    for (uint8_t i = 0; i < 12; i++) list.push_back(makeTarget(i, (int8_t)(-50 - i * 3)));
+
+    DirtyRows dirty;
+    uint32_t rng = 7;
+    int highlight = 0, offset = 0;
+    for (uint32_t now = 0; now < 60000; now += 50) {
+        if (now % 1000 == 0) {
+            for (auto& t : list) {
+                rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+                if (rng % 3 == 0) t.rssi = (int8_t)(t.rssi + (int)(rng >> 8) % 5 - 2);
+            }
+            std::stable_sort(list.begin(), list.end(), strongerFirst);
+        }
+        if (now % 3000 == 0 && now > 0) {
+            highlight = (highlight + 1) % (int)list.size();
+            if (highlight < offset) offset = highlight;
+            if (highlight >= offset + ROWS) offset = highlight - ROWS + 1;
+        }
+        if (now % 20000 == 0) dirty.invalidate();
+        renderFrame(dirty, list, highlight, offset, now);
+    }
+
+    const FrameStats& s = dirty.stats();
+    uint32_t before = SCREEN.bytes();
+    uint32_t after = s.bytesPerFrame();
+    printf("[ radar ] full push: %u B/frame, %u us SPI; dirty regions: %u B/frame, %u us SPI (%u frames, %u full)\n",
+           (unsigned)before, (unsigned)spiUs(before), (unsigned)after, (unsigned)spiUs(after),
+           (unsigned)s.frames, (unsigned)s.fullFrames);
+    printf("[ radar ] at 20 FPS: %u KB/s before, %u KB/s after\n",
+           (unsigned)(before * 20 / 1000), (unsigned)(after * 20 / 1000));
+
+    EXPECT_EQ(s.frames, 1200u);
+    EXPECT_EQ(s.fullFrames, 3u);
+    EXPECT_LT(after * 10, before);
+}
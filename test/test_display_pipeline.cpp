@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "DisplayPipeline.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace Vanguard;
+
+namespace {
+
+const int16_t W = 240, H = 135;
+
+/**
+ * Panel on a simulated clock: a transfer takes its bytes at 40 MHz and
+ * its pixels land when it completes, so a buffer written while DMA
+ * still reads it shows up as a wrong panel.
+ */
+class FakePanel : public DisplaySink {
+public:
+    uint64_t nowUs = 0;
+    uint64_t blockedUs = 0;
+    std::vector<uint16_t> pixels;
+    std::vector<std::pair<int16_t, int16_t>> pushes;
+
+    FakePanel() : pixels((size_t)W * H, 0) {}
+
+    void push(int16_t y, int16_t h, const uint16_t* src) override {
+        EXPECT_FALSE(m_pending) << "push while a transfer is running";
+        m_pending = true;
+        m_y = y;
+        m_h = h;
+        m_src = src;
+        m_doneUs = nowUs + (uint64_t)h * W * 2 * 8 / 40;
+        pushes.push_back(std::make_pair(y, h));
+    }
+
+    bool busy() override {
+        if (m_pending && nowUs >= m_doneUs) complete();
+        return m_pending;
+    }
+
+    void finish() override {
+        if (!m_pending) return;
+        if (nowUs < m_doneUs) {
+            blockedUs += m_doneUs - nowUs;
+            nowUs = m_doneUs;
+        }
+        complete();
+    }
+
+private:
+    bool m_pending = false;
+    int16_t m_y = 0, m_h = 0;
+    const uint16_t* m_src = nullptr;
+    uint64_t m_doneUs = 0;
+
+    void complete() {
+        memcpy(&pixels[(size_t)m_y * W], m_src, (size_t)m_h * W * sizeof(uint16_t));
+        m_pending = false;
+    }
+};
+
+DirtyRect rect(int16_t y, int16_t h) {
+    DirtyRect r = {0, y, W, h};
+    return r;
+}
+
+void fillRows(uint16_t* buf, int16_t y, int16_t h, uint16_t value) {
+    for (size_t i = (size_t)y * W; i < (size_t)(y + h) * W; i++) buf[i] = value;
+}
+
+struct LoopResult {
+    uint64_t maxInputGapUs;
+    uint64_t blockedUs;
+    uint32_t frames;
+    uint32_t stalls;
+};
+
+/**
+ * The RADAR loop for `seconds`: engine tick and input every pass,
+ * a frame every 50 ms that takes composeUs of drawing and pushes the
+ * given rows (all of them: scrolling, the worst case).
+ */
+LoopResult runLoop(bool doubleBuffered, uint32_t composeUs, int16_t rows, uint32_t seconds) {
+    FakePanel panel;
+    std::vector<uint16_t> a((size_t)W * H), b((size_t)W * H);
+    DisplayPipeline pipe(panel, W, H);
+    pipe.attach(a.data(), doubleBuffered ? b.data() : nullptr);
+
+    LoopResult r = {0, 0, 0, 0};
+    uint64_t lastInput = 0, nextFrame = 0;
+    uint16_t value = 1;
+    while (panel.nowUs < (uint64_t)seconds * 1000000) {
+        uint64_t gap = panel.nowUs - lastInput;
+        if (gap > r.maxInputGapUs) r.maxInputGapUs = gap;
+        lastInput = panel.nowUs;
+        panel.nowUs += 200;                         // Engine tick + keyboard
+
+        pipe.poll();
+        if (panel.nowUs >= nextFrame) {
+            nextFrame += 50000;
+            panel.nowUs += composeUs;
+            fillRows(pipe.back(), 0, rows, value++);
+            DirtyRect all = rect(0, rows);
+            pipe.flush(&all, 1);
+            r.frames++;
+        }
+    }
+    r.blockedUs = panel.blockedUs;
+    r.stalls = pipe.stats().stalls;
+    pipe.fence();
+    EXPECT_EQ(panel.pixels[0], (uint16_t)(value - 1));
+    return r;
+}
+
+} // namespace
+
+TEST(DisplayPipelineTest, RectsBecomeMergedFullWidthStrips) {
+    FakePanel panel;
+    std::vector<uint16_t> a((size_t)W * H), b((size_t)W * H);
+    DisplayPipeline pipe(panel, W, H);
+    pipe.attach(a.data(), b.data());
+
+    // Header, then two adjacent rows out of order, one overlapping the
+    // next; a narrow scroll bar spanning them; nothing off-screen
+    DirtyRect rects[] = {
+        {0, 42, 234, 24}, {0, 0, 240, 16}, {0, 18, 234, 24},
+        {237, 18, 2, 40}, {0, 130, 240, 20}, {0, 5, 0, 5}
+    };
+    uint32_t bytes = pipe.flush(rects, sizeof(rects) / sizeof(rects[0]));
+    pipe.fence();
+
+    ASSERT_EQ(panel.pushes.size(), 3u);
+    EXPECT_EQ(panel.pushes[0], std::make_pair((int16_t)0, (int16_t)16));
+    EXPECT_EQ(panel.pushes[1], std::make_pair((int16_t)18, (int16_t)48));
+    EXPECT_EQ(panel.pushes[2], std::make_pair((int16_t)130, (int16_t)5));
+    EXPECT_EQ(bytes, (uint32_t)(16 + 48 + 5) * W * 2);
+
+    // Nothing dirty: no transfer, no swap
+    size_t back = pipe.backIndex();
+    EXPECT_EQ(pipe.flush(rects, 0), 0u);
+    EXPECT_EQ(pipe.backIndex(), back);
+
+    // Scattered beyond the strip limit: one strip, first row to last
+    panel.pushes.clear();
+    std::vector<DirtyRect> scattered;
+    for (int16_t i = 0; i < 8; i++) scattered.push_back(rect((int16_t)(i * 16), 4));
+    pipe.flush(scattered.data(), scattered.size());
+    pipe.fence();
+    ASSERT_EQ(panel.pushes.size(), 1u);
+    EXPECT_EQ(panel.pushes[0], std::make_pair((int16_t)0, (int16_t)116));
+}
+
+TEST(DisplayPipelineTest, PanelMatchesEveryComposedFrame) {
+    FakePanel panel;
+    std::vector<uint16_t> a((size_t)W * H), b((size_t)W * H);
+    DisplayPipeline pipe(panel, W, H);
+    pipe.attach(a.data(), b.data());
+    std::vector<uint16_t> expected((size_t)W * H, 0);
+
+    // Each frame redraws a few rows of whatever buffer is the back one;
+    // the panel only ever receives whole, current frames
+    uint32_t rng = 99;
+    for (uint16_t frame = 1; frame <= 300; frame++) {
+        std::vector<DirtyRect> dirty;
+        for (int k = 0; k < 3; k++) {
+            rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+            int16_t y = (int16_t)(rng % (H - 10));
+            int16_t h = (int16_t)(1 + (rng >> 8) % 10);
+            fillRows(pipe.back(), y, h, (uint16_t)(frame * 3 + k));
+            fillRows(expected.data(), y, h, (uint16_t)(frame * 3 + k));
+            dirty.push_back(rect(y, h));
+        }
+        pipe.flush(dirty.data(), dirty.size());
+
+        // Sometimes the transfer outlives the next compose, sometimes not
+        panel.nowUs += (frame % 3) * 400;
+        pipe.poll();
+        if (frame % 50 == 0) {
+            pipe.fence();
+            ASSERT_EQ(panel.pixels, expected) << "frame " << frame;
+        }
+    }
+
+    // And the next back buffer starts from what the panel shows
+    pipe.fence();
+    EXPECT_EQ(panel.pixels, expected);
+    EXPECT_EQ(memcmp(pipe.back(), expected.data(), expected.size() * 2), 0);
+}
+
+TEST(DisplayPipelineTest, SingleBufferFlushesSynchronously) {
+    FakePanel panel;
+    std::vector<uint16_t> a((size_t)W * H);
+    DisplayPipeline pipe(panel, W, H);
+    pipe.attach(a.data(), nullptr);
+    EXPECT_FALSE(pipe.isDoubleBuffered());
+
+    fillRows(pipe.back(), 0, H, 7);
+    DirtyRect all = rect(0, H);
+    pipe.flush(&all, 1);
+    EXPECT_FALSE(pipe.inFlight());
+    EXPECT_EQ(pipe.backIndex(), 0u);
+    EXPECT_EQ(panel.pixels[(size_t)W * H - 1], 7u);
+    EXPECT_EQ(panel.blockedUs, (uint64_t)W * H * 2 * 8 / 40);
+}
+
+TEST(DisplayPipelineTest, InputLatencyBenchmark) {
+    // Worst case: every frame pushes the full screen (scrolling)
+    const uint32_t COMPOSE_US = 2000;
+    LoopResult sync = runLoop(false, COMPOSE_US, H, 10);
+    LoopResult async = runLoop(true, COMPOSE_US, H, 10);
+
+    printf("[ display ] blocking push: %llu us blocked per frame, worst input gap %llu us\n",
+           (unsigned long long)(sync.blockedUs / sync.frames), (unsigned long long)sync.maxInputGapUs);
+    printf("[ display ] DMA pipeline:  %llu us blocked per frame, worst input gap %llu us (%u/%u frames waited)\n",
+           (unsigned long long)(async.blockedUs / async.frames), (unsigned long long)async.maxInputGapUs,
+           (unsigned)async.stalls, (unsigned)async.frames);
+
+    EXPECT_EQ(sync.frames, async.frames);
+    EXPECT_GT(sync.blockedUs / sync.frames, 12000u);     // The whole transfer
+    EXPECT_EQ(async.blockedUs, 0u);                       // Done before the next frame
+    EXPECT_EQ(async.stalls, 0u);
+    EXPECT_LT(async.maxInputGapUs, sync.maxInputGapUs / 4);
+}
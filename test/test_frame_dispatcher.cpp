@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "FrameDispatcher.h"
+
+using namespace Vanguard;
+
+namespace {
+
+// Beacon from AA:AA:AA:AA:AA:AA (header only + 4 body bytes)
+const uint8_t BEACON[] = {
+    0x80, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x00, 0x00,
+    0x01, 0x02, 0x03, 0x04
+};
+
+// QoS data ToDS: client CC:.. -> AP AA:.., carrying EAPOL SNAP
+const uint8_t QOS_DATA_TO_DS[] = {
+    0x88, 0x01, 0x00, 0x00,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+    0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0x00, 0x00,
+    0x00, 0x00,   // QoS control
+    0xAA, 0xAA, 0x03, 0x00, 0x00, 0x00, 0x88, 0x8E
+};
+
+} // namespace
+
+class FrameDispatcherTest : public ::testing::Test {
+protected:
+    FrameDispatcher frames;
+};
+
+TEST_F(FrameDispatcherTest, ParseBeacon) {
+    FrameView f;
+    ASSERT_TRUE(FrameDispatcher::parse(BEACON, sizeof(BEACON), -40, 6, f));
+    EXPECT_EQ(f.type, WIFI_TYPE_MGMT);
+    EXPECT_EQ(f.subtype, WIFI_SUBTYPE_BEACON);
+    EXPECT_EQ(f.dir, FRAME_DIR_NO_DS);
+    EXPECT_EQ(f.bssid(), BEACON + 16);
+    EXPECT_EQ(f.bodyLen, 4);
+    EXPECT_EQ(f.body[0], 0x01);
+    EXPECT_EQ(f.channel, 6);
+}
+
+TEST_F(FrameDispatcherTest, ParseQosDataSkipsQosControl) {
+    FrameView f;
+    ASSERT_TRUE(FrameDispatcher::parse(QOS_DATA_TO_DS, sizeof(QOS_DATA_TO_DS), -50, 1, f));
+    EXPECT_EQ(f.type, WIFI_TYPE_DATA);
+    EXPECT_EQ(f.subtype, WIFI_SUBTYPE_QOS_DATA);
+    EXPECT_EQ(f.dir, FRAME_DIR_TO_DS);
+    EXPECT_EQ(f.bssid()[0], 0xAA);
+    EXPECT_EQ(f.station()[0], 0xCC);
+    EXPECT_EQ(f.bodyLen, 8);
+    EXPECT_EQ(f.body[6], 0x88);
+}
+
+TEST_F(FrameDispatcherTest, RejectsTruncatedHeader) {
+    FrameView f;
+    EXPECT_FALSE(FrameDispatcher::parse(BEACON, 20, 0, 1, f));
+    EXPECT_FALSE(FrameDispatcher::parse(QOS_DATA_TO_DS, 25, 0, 1, f));
+}
+
+TEST_F(FrameDispatcherTest, RoutesOnlyMatchingConsumers) {
+    int beacons = 0, data = 0, all = 0;
+    frames.subscribe(FrameMask::mgmt(WIFI_SUBTYPE_BEACON), [&](const FrameView&) { beacons++; });
+    frames.subscribe(FrameMask::data(), [&](const FrameView&) { data++; });
+    frames.subscribe(FrameMask::any(), [&](const FrameView&) { all++; });
+
+    FrameView f;
+    FrameDispatcher::parse(BEACON, sizeof(BEACON), 0, 1, f);
+    EXPECT_EQ(frames.dispatch(f), 2u);
+
+    FrameDispatcher::parse(QOS_DATA_TO_DS, sizeof(QOS_DATA_TO_DS), 0, 1, f);
+    EXPECT_EQ(frames.dispatch(f), 2u);
+
+    EXPECT_EQ(beacons, 1);
+    EXPECT_EQ(data, 1);
+    EXPECT_EQ(all, 2);
+}
+
+TEST_F(FrameDispatcherTest, DirectionMask) {
+    int fromDs = 0;
+    frames.subscribe(FrameMask::data(FRAME_SUBTYPES_ANY, 1 << FRAME_DIR_FROM_DS),
+                     [&](const FrameView&) { fromDs++; });
+
+    FrameView f;
+    FrameDispatcher::parse(QOS_DATA_TO_DS, sizeof(QOS_DATA_TO_DS), 0, 1, f);
+    EXPECT_EQ(frames.dispatch(f), 0u);
+    EXPECT_EQ(fromDs, 0);
+}
+
+TEST_F(FrameDispatcherTest, UnsubscribeFreesSlot) {
+    int hits = 0;
+    int id = frames.subscribe(FrameMask::any(), [&](const FrameView&) { hits++; });
+    ASSERT_GE(id, 0);
+    frames.unsubscribe(id);
+    EXPECT_EQ(frames.count(), 0u);
+    EXPECT_EQ(frames.consumersFor(WIFI_TYPE_MGMT, WIFI_SUBTYPE_BEACON, FRAME_DIR_NO_DS), 0);
+
+    for (size_t i = 0; i < MAX_FRAME_CONSUMERS; i++) {
+        EXPECT_GE(frames.subscribe(FrameMask::any(), [](const FrameView&) {}), 0);
+    }
+    EXPECT_EQ(frames.subscribe(FrameMask::any(), [](const FrameView&) {}), -1);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "MacIndex.h"
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace Vanguard;
+
+namespace {
+
+void makeMac(uint8_t* mac, uint16_t id) {
+    mac[0] = 0xA4;
+    mac[1] = 0x83;
+    mac[2] = 0xE7;
+    mac[3] = 0x00;
+    mac[4] = (uint8_t)(id >> 8);
+    mac[5] = (uint8_t)id;
+}
+
+// Packed table with swap-remove, the way every owner uses the index
+struct Table {
+    std::vector<std::vector<uint8_t>> macs;
+    MacIndex<64> index;
+
+    const uint8_t* macOf(size_t e) const { return macs[e].data(); }
+
+    int find(const uint8_t* mac) const {
+        return index.find(mac, [this](size_t e) { return macOf(e); });
+    }
+
+    void add(const uint8_t* mac) {
+        macs.push_back(std::vector<uint8_t>(mac, mac + 6));
+        index.insert(macs.size() - 1, mac);
+    }
+
+    void removeAt(size_t entry) {
+        index.erase(entry, [this](size_t e) { return macOf(e); });
+        size_t last = macs.size() - 1;
+        if (entry != last) {
+            macs[entry] = macs[last];
+            index.repoint(macOf(entry), last, entry);
+        }
+        macs.pop_back();
+    }
+};
+
+} // namespace
+
+TEST(MacIndexTest, FindsWhatWasInserted) {
+    Table t;
+    uint8_t mac[6];
+    for (uint16_t i = 0; i < 32; i++) {
+        makeMac(mac, i);
+        t.add(mac);
+    }
+    for (uint16_t i = 0; i < 32; i++) {
+        makeMac(mac, i);
+        EXPECT_EQ(t.find(mac), (int)i);
+    }
+    makeMac(mac, 999);
+    EXPECT_EQ(t.find(mac), -1);
+}
+
+TEST(MacIndexTest, ChurnMatchesTable) {
+    // Random adds and swap-removes at load 0.5; every survivor stays findable
+    Table t;
+    std::mt19937 rng(7);
+    uint8_t mac[6];
+    uint16_t nextId = 0;
+
+    for (int round = 0; round < 20000; round++) {
+        if (t.macs.size() < 32 && (t.macs.empty() || rng() % 2)) {
+            makeMac(mac, nextId++);
+            t.add(mac);
+        } else {
+            size_t victim = rng() % t.macs.size();
+            memcpy(mac, t.macOf(victim), 6);
+            t.removeAt(victim);
+            ASSERT_EQ(t.find(mac), -1) << "round " << round;
+        }
+
+        if (round % 97 == 0) {
+            for (size_t e = 0; e < t.macs.size(); e++) {
+                ASSERT_EQ(t.find(t.macOf(e)), (int)e) << "round " << round;
+            }
+        }
+    }
+}
+
+TEST(MacIndexTest, EraseShiftsAcrossTheWrap) {
+    // Pre-hashed keys: three entries homed on the last slot wrap to the front
+    MacIndex<16> index;
+    std::vector<uint32_t> hashes = { 15, 15, 15, 0 };
+    auto homeOf = [&](size_t e) { return index.slot(hashes[e]); };
+    for (size_t e = 0; e < hashes.size(); e++) index.insert(homeOf(e), e);
+
+    index.erase(homeOf(0), 0, homeOf);
+
+    for (size_t e = 1; e < hashes.size(); e++) {
+        EXPECT_EQ(index.find(homeOf(e), [&](size_t x) { return x == e; }), (int)e);
+    }
+    EXPECT_EQ(index.find(homeOf(0), [](size_t x) { return x == 0; }), -1);
+}
+
+TEST(MacIndexTest, RuntimeSizedRoundsUp) {
+    MacIndex<> index;
+    index.resize(100);
+    EXPECT_EQ(index.slots(), 128u);
+    index.resize(3);
+    EXPECT_EQ(index.slots(), 16u);
+
+    uint8_t mac[6];
+    makeMac(mac, 1);
+    index.insert(0, mac);
+    EXPECT_EQ(index.find(mac, [&](size_t) { return mac; }), 0);
+    index.clear();
+    EXPECT_EQ(index.find(mac, [&](size_t) { return mac; }), -1);
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include "OuiLookup.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace Vanguard;
+
+TEST(OuiLookupTest, KnownVendors) {
+    uint8_t apple[6]     = {0x00, 0x03, 0x93, 0x12, 0x34, 0x56};
+    uint8_t espressif[6] = {0x24, 0x0A, 0xC4, 0x00, 0x00, 0x01};
+    uint8_t rpi[6]       = {0xB8, 0x27, 0xEB, 0xAA, 0xBB, 0xCC};
+
+    ASSERT_NE(OuiLookup::vendor(apple), nullptr);
+    EXPECT_STREQ(OuiLookup::vendor(apple), "Apple");
+    EXPECT_STREQ(OuiLookup::vendor(espressif), "Espressif");
+    EXPECT_STREQ(OuiLookup::vendor(rpi), "Raspberry Pi");
+}
+
+TEST(OuiLookupTest, UnknownLocalAndGroup) {
+    uint8_t unknown[6]   = {0x00, 0x00, 0x01, 0x00, 0x00, 0x00};
+    uint8_t randomMac[6] = {0x02, 0x03, 0x93, 0x12, 0x34, 0x56};   // Apple OUI, LA bit set
+    uint8_t multicast[6] = {0x01, 0x00, 0x5E, 0x00, 0x00, 0x01};
+
+    EXPECT_EQ(OuiLookup::vendor(unknown), nullptr);
+    EXPECT_EQ(OuiLookup::vendor(randomMac), nullptr);
+    EXPECT_TRUE(OuiLookup::isLocal(randomMac));
+    EXPECT_EQ(OuiLookup::vendor(multicast), nullptr);
+    EXPECT_EQ(OuiLookup::vendor(nullptr), nullptr);
+
+    uint8_t zero[6] = {0};   // Placeholder, not Xerox
+    EXPECT_EQ(OuiLookup::vendor(zero), nullptr);
+}
+
+TEST(OuiLookupTest, TargetAddressesByType) {
+    Target t;
+    memset(&t, 0, sizeof(t));
+
+    // WiFi: as transmitted
+    const uint8_t ap[6] = {0x00, 0x03, 0x93, 0x12, 0x34, 0x56};
+    t.type = TargetType::ACCESS_POINT;
+    memcpy(t.bssid, ap, 6);
+    EXPECT_STREQ(OuiLookup::vendor(t), "Apple");
+    EXPECT_FALSE(OuiLookup::isRandomized(t));
+    t.bssid[0] = 0x02;
+    EXPECT_EQ(OuiLookup::vendor(t), nullptr);
+    EXPECT_TRUE(OuiLookup::isRandomized(t));
+
+    // Public BLE address 24:0A:C4:00:00:01, stored as NimBLE's getNative()
+    const uint8_t native[6] = {0x01, 0x00, 0x00, 0xC4, 0x0A, 0x24};
+    t.type = TargetType::BLE_DEVICE;
+    memcpy(t.bssid, native, 6);
+    EXPECT_STREQ(OuiLookup::vendor(t), "Espressif");
+    EXPECT_FALSE(OuiLookup::isRandomized(t));
+
+    // Random BLE address: the address type says so, not the LA bit
+    t.isRandomAddress = true;
+    EXPECT_EQ(OuiLookup::vendor(t), nullptr);
+    EXPECT_TRUE(OuiLookup::isRandomized(t));
+    t.isRandomAddress = false;
+    t.bssid[5] = 0x26;               // LA bit in the most significant byte
+    t.bssid[0] = 0x02;               // ...and in the least; neither matters
+    EXPECT_FALSE(OuiLookup::isRandomized(t));
+
+    // Beacons are keyed by an identity hash: never a vendor
+    t.type = TargetType::BLE_BEACON;
+    memcpy(t.bssid, ap, 6);
+    EXPECT_EQ(OuiLookup::vendor(t), nullptr);
+    EXPECT_FALSE(OuiLookup::isRandomized(t));
+}
+
+TEST(OuiLookupTest, GeneratedTableIsSortedAndInBounds) {
+    ASSERT_GT(OuiLookup::count(), 0u);
+
+    uint32_t prev = 0;
+    for (size_t i = 0; i < OUI_COUNT; i++) {
+        const uint8_t* rec = OUI_TABLE + i * OUI_RECORD_BYTES;
+        uint32_t key = ((uint32_t)rec[0] << 16) | ((uint32_t)rec[1] << 8) | rec[2];
+        uint32_t off = ((uint32_t)rec[3] << 16) | ((uint32_t)rec[4] << 8) | rec[5];
+        if (i > 0) {
+            EXPECT_GT(key, prev) << "record " << i;
+        }
+        ASSERT_LT(off, OUI_POOL_BYTES);
+        EXPECT_LE(strlen(OUI_POOL + off), OUI_VENDOR_MAX);
+        prev = key;
+    }
+}
+
+TEST(OuiLookupTest, FindEdges) {
+    static const uint8_t table[] = {
+        0x00, 0x00, 0x10,  0x00, 0x00, 0x00,
+        0x00, 0x00, 0x20,  0x00, 0x00, 0x02,
+        0xFF, 0xFF, 0xFE,  0x00, 0x00, 0x04,
+    };
+    static const char pool[] = "A\0B\0C";
+
+    EXPECT_STREQ(OuiLookup::find(table, 3, pool, 0x000010), "A");
+    EXPECT_STREQ(OuiLookup::find(table, 3, pool, 0x000020), "B");
+    EXPECT_STREQ(OuiLookup::find(table, 3, pool, 0xFFFFFE), "C");
+    EXPECT_EQ(OuiLookup::find(table, 3, pool, 0x000000), nullptr);
+    EXPECT_EQ(OuiLookup::find(table, 3, pool, 0x000015), nullptr);
+    EXPECT_EQ(OuiLookup::find(table, 3, pool, 0xFFFFFF), nullptr);
+    EXPECT_EQ(OuiLookup::find(table, 0, pool, 0x000010), nullptr);
+}
+
+TEST(OuiLookupTest, LookupCost) {
+    const uint32_t N = 1000000;
+    uint8_t mac[6] = {0x00, 0x00, 0x00, 0x11, 0x22, 0x33};
+    uint32_t hits = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N; i++) {
+        // Walk real OUIs and misses alike
+        const uint8_t* rec = OUI_TABLE + (i % OUI_COUNT) * OUI_RECORD_BYTES;
+        memcpy(mac, rec, 3);
+        if (i & 1) mac[2] ^= 0x55;
+        if (OuiLookup::vendor(mac)) hits++;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / N;
+    printf("[ oui      ] %u OUIs, %u bytes flash, %.1f ns/lookup\n",
+           (unsigned)OuiLookup::count(), (unsigned)OuiLookup::flashBytes(), ns);
+    EXPECT_GE(hits, N / 2 - 1);
+}
+
+TEST(OuiLookupTest, FullRegistryScaleCost) {
+    // Same layout at IEEE MA-L size (~38k OUIs), every 400th OUI
+    const size_t count = 38000;
+    std::vector<uint8_t> table(count * OUI_RECORD_BYTES);
+    for (size_t i = 0; i < count; i++) {
+        uint32_t oui = (uint32_t)(i * 400 + 7);
+        uint8_t* rec = &table[i * OUI_RECORD_BYTES];
+        rec[0] = (uint8_t)(oui >> 16);
+        rec[1] = (uint8_t)(oui >> 8);
+        rec[2] = (uint8_t)oui;
+        rec[3] = rec[4] = rec[5] = 0;
+    }
+    static const char pool[] = "V";
+
+    const uint32_t N = 1000000;
+    uint32_t hits = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N; i++) {
+        uint32_t oui = (uint32_t)((i * 7919u) % count) * 400 + ((i & 1) ? 7 : 8);
+        if (OuiLookup::find(table.data(), count, pool, oui)) hits++;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / N;
+    printf("[ oui      ] %u OUIs, %u bytes of records, %.1f ns/lookup\n",
+           (unsigned)count, (unsigned)table.size(), ns);
+    EXPECT_EQ(hits, N / 2);
+}
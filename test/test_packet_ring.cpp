@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "PacketRing.h"
+
+using namespace Vanguard;
+
+TEST(PacketRingTest, RoundsCapacityToPowerOfTwo) {
+    PacketRing ring(1000);
+    EXPECT_EQ(ring.capacity(), 1024u);
+    EXPECT_EQ(ring.used(), 0u);
+}
+
+TEST(PacketRingTest, PreservesOrderAndMetadata) {
+    PacketRing ring(256);
+    uint8_t a[] = {1, 2, 3};
+    uint8_t b[] = {4, 5, 6, 7, 8};
+
+    ASSERT_TRUE(ring.push(a, sizeof(a), 6, -40, 1000));
+    ASSERT_TRUE(ring.push(b, sizeof(b), 11, -70, 1001));
+
+    PacketRecordHeader hdr;
+    uint8_t out[16];
+    ASSERT_TRUE(ring.pop(hdr, out, sizeof(out)));
+    EXPECT_EQ(hdr.len, 3);
+    EXPECT_EQ(hdr.channel, 6);
+    EXPECT_EQ(hdr.rssi, -40);
+    EXPECT_EQ(hdr.timestampMs, 1000u);
+    EXPECT_EQ(memcmp(out, a, sizeof(a)), 0);
+
+    ASSERT_TRUE(ring.pop(hdr, out, sizeof(out)));
+    EXPECT_EQ(hdr.len, 5);
+    EXPECT_EQ(hdr.channel, 11);
+    EXPECT_EQ(memcmp(out, b, sizeof(b)), 0);
+
+    EXPECT_FALSE(ring.pop(hdr, out, sizeof(out)));
+    EXPECT_EQ(ring.used(), 0u);
+}
+
+TEST(PacketRingTest, RejectsWhenFullWithoutCorruption) {
+    PacketRing ring(64);
+    uint8_t frame[20];
+    memset(frame, 0xAB, sizeof(frame));
+
+    // 8-byte header + 20 bytes = 28 per record: two fit in 64
+    EXPECT_TRUE(ring.push(frame, sizeof(frame), 1, 0, 0));
+    EXPECT_TRUE(ring.push(frame, sizeof(frame), 1, 0, 0));
+    EXPECT_FALSE(ring.push(frame, sizeof(frame), 1, 0, 0));
+    EXPECT_EQ(ring.highWater(), 56u);
+
+    PacketRecordHeader hdr;
+    uint8_t out[32];
+    EXPECT_TRUE(ring.pop(hdr, out, sizeof(out)));
+    EXPECT_TRUE(ring.pop(hdr, out, sizeof(out)));
+    EXPECT_FALSE(ring.pop(hdr, out, sizeof(out)));
+}
+
+TEST(PacketRingTest, WrapsRecordsAroundTheEnd) {
+    PacketRing ring(128);
+    uint8_t frame[40];
+    uint8_t out[64];
+    PacketRecordHeader hdr;
+
+    // Records never straddle the end, so sizes that don't divide the
+    // buffer force both marker and implicit wraps over many laps
+    for (uint32_t i = 0; i < 200; i++) {
+        uint16_t len = 1 + (i * 7) % 40;
+        memset(frame, (uint8_t)i, len);
+        ASSERT_TRUE(ring.push(frame, len, 1, 0, i)) << "push " << i;
+        ASSERT_TRUE(ring.pop(hdr, out, sizeof(out))) << "pop " << i;
+        EXPECT_EQ(hdr.len, len);
+        EXPECT_EQ(hdr.timestampMs, i);
+        EXPECT_EQ(out[0], (uint8_t)i);
+        EXPECT_EQ(out[len - 1], (uint8_t)i);
+    }
+    EXPECT_EQ(ring.used(), 0u);
+}
+
+TEST(PacketRingTest, TruncatesIntoSmallBuffer) {
+    PacketRing ring(256);
+    uint8_t frame[32];
+    for (uint8_t i = 0; i < sizeof(frame); i++) frame[i] = i;
+    ring.push(frame, sizeof(frame), 1, 0, 0);
+    ring.push(frame, 4, 2, 0, 0);
+
+    PacketRecordHeader hdr;
+    uint8_t out[8];
+    ASSERT_TRUE(ring.pop(hdr, out, sizeof(out)));
+    EXPECT_EQ(hdr.len, 32);
+    EXPECT_EQ(out[7], 7);
+
+    // The next record is still intact
+    ASSERT_TRUE(ring.pop(hdr, out, sizeof(out)));
+    EXPECT_EQ(hdr.channel, 2);
+}
+
+TEST(PacketRingTest, ClearDiscardsQueuedFrames) {
+    PacketRing ring(256);
+    uint8_t frame[10] = {0};
+    ring.push(frame, sizeof(frame), 1, 0, 0);
+    ring.clear();
+
+    PacketRecordHeader hdr;
+    EXPECT_FALSE(ring.pop(hdr, nullptr, 0));
+    EXPECT_TRUE(ring.push(frame, sizeof(frame), 1, 0, 0));
+}
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "SsidPool.h"
+#include "ProbeTable.h"
+#include "TargetTable.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace Vanguard;
+
+namespace {
+
+void makeMac(uint8_t* mac, uint16_t id) {
+    mac[0] = 0x3C;
+    mac[1] = 0x22;
+    mac[2] = 0xFB;
+    mac[3] = 0x00;
+    mac[4] = (uint8_t)(id >> 8);
+    mac[5] = (uint8_t)id;
+}
+
+uint16_t internStr(SsidPool& pool, const std::string& s) {
+    return pool.intern(s.data(), (uint8_t)s.size());
+}
+
+bool probe(ProbeTable& t, const uint8_t* mac, const std::string& ssid, uint32_t now) {
+    return t.observe(mac, ssid.data(), (uint8_t)ssid.size(), -60, 1, now);
+}
+
+} // namespace
+
+TEST(SsidPoolTest, InternsOnceAndCountsRefs) {
+    SsidPool pool;
+    uint16_t a = internStr(pool, "eduroam");
+    uint16_t b = internStr(pool, "eduroam");
+    uint16_t c = internStr(pool, "HomeNet");
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(pool.refs(a), 2u);
+    EXPECT_STREQ(pool.get(a), "eduroam");
+    EXPECT_EQ(pool.length(c), 7u);
+    EXPECT_EQ(pool.count(), 2u);
+    EXPECT_EQ(pool.bytesUsed(), 8u + 8u);
+
+    pool.release(a);
+    EXPECT_EQ(pool.find("eduroam", 7), a);
+    pool.release(a);
+    EXPECT_EQ(pool.find("eduroam", 7), SSID_NONE);
+    EXPECT_EQ(pool.count(), 1u);
+    EXPECT_STREQ(pool.get(a), "");
+
+    // Raw bytes, not C strings: embedded NULs and prefixes are distinct
+    const char raw[] = {'a', '\0', 'b'};
+    uint16_t r = pool.intern(raw, 3);
+    EXPECT_NE(r, pool.intern("a", 1));
+    EXPECT_EQ(pool.find(raw, 3), r);
+
+    EXPECT_EQ(pool.intern("x", 0), SSID_NONE);
+}
+
+TEST(SsidPoolTest, ReclaimsArenaSpace) {
+    SsidPool pool;
+    std::string big(SSID_MAX_LEN, 'x');
+
+    // Churn far more bytes than the arena holds, keeping a few alive
+    uint16_t keep = internStr(pool, "keeper");
+    for (int i = 0; i < 2000; i++) {
+        big[0] = (char)('A' + i % 26);
+        big[1] = (char)('A' + (i / 26) % 26);
+        uint16_t id = internStr(pool, big);
+        ASSERT_NE(id, SSID_NONE) << "round " << i;
+        EXPECT_EQ(memcmp(pool.get(id), big.data(), big.size()), 0);
+        pool.release(id);
+    }
+    EXPECT_STREQ(pool.get(keep), "keeper");
+    EXPECT_EQ(pool.count(), 1u);
+}
+
+TEST(SsidPoolTest, FullPoolRefusesNewStrings) {
+    SsidPool pool;
+    char name[8];
+    for (size_t i = 0; i < SSID_POOL_ENTRIES; i++) {
+        int n = snprintf(name, sizeof(name), "n%u", (unsigned)i);
+        ASSERT_NE(pool.intern(name, (uint8_t)n), SSID_NONE);
+    }
+    EXPECT_EQ(pool.intern("another", 7), SSID_NONE);
+    EXPECT_NE(pool.intern("n0", 2), SSID_NONE);      // Existing ones still resolve
+}
+
+TEST(ProbeTableTest, BuildsPnlMostRecentFirst) {
+    ProbeTable t;
+    uint8_t sta[6];
+    makeMac(sta, 1);
+
+    EXPECT_TRUE(probe(t, sta, "HomeNet", 100));
+    EXPECT_TRUE(probe(t, sta, "Office", 200));
+    EXPECT_TRUE(probe(t, sta, "Airport", 300));
+    EXPECT_FALSE(probe(t, sta, "HomeNet", 400));    // Known: moves to the front
+
+    const char* pnl[PNL_MAX_SSIDS];
+    ASSERT_EQ(t.ssidsOf(sta, pnl, PNL_MAX_SSIDS), 3u);
+    EXPECT_STREQ(pnl[0], "HomeNet");
+    EXPECT_STREQ(pnl[1], "Airport");
+    EXPECT_STREQ(pnl[2], "Office");
+
+    const ProbingStation* s = t.find(sta);
+    ASSERT_NE(s, nullptr);
+    EXPECT_EQ(s->probeCount, 4u);
+    EXPECT_EQ(s->firstSeenMs, 100u);
+    EXPECT_EQ(s->lastSeenMs, 400u);
+
+    // Wildcard probes carry nothing
+    EXPECT_FALSE(t.observe(sta, "", 0, -60, 1, 500));
+}
+
+TEST(ProbeTableTest, DropsLeastRecentlyProbedSsid) {
+    ProbeTable t;
+    uint8_t sta[6];
+    makeMac(sta, 1);
+
+    for (size_t i = 0; i <= PNL_MAX_SSIDS; i++) {
+        probe(t, sta, "net" + std::to_string(i), (uint32_t)i);
+    }
+    const char* pnl[PNL_MAX_SSIDS];
+    ASSERT_EQ(t.ssidsOf(sta, pnl, PNL_MAX_SSIDS), PNL_MAX_SSIDS);
+    EXPECT_EQ(std::string(pnl[0]), "net" + std::to_string(PNL_MAX_SSIDS));
+    EXPECT_EQ(t.stationsProbing("net0", 4), 0u);     // Released from the pool
+    EXPECT_EQ(t.pool().count(), PNL_MAX_SSIDS);
+}
+
+TEST(ProbeTableTest, SharedSsidsAreStoredOnce) {
+    ProbeTable t;
+    uint8_t sta[6];
+    const char* common[] = {"eduroam", "xfinitywifi", "Starbucks WiFi", "attwifi"};
+
+    for (uint16_t i = 0; i < MAX_PROBING_STATIONS; i++) {
+        makeMac(sta, i);
+        for (int k = 0; k < 4; k++) {
+            t.observe(sta, common[k], (uint8_t)strlen(common[k]), -70, 6, 1000 + i);
+        }
+    }
+
+    EXPECT_EQ(t.count(), MAX_PROBING_STATIONS);
+    EXPECT_EQ(t.pool().count(), 4u);
+    EXPECT_EQ(t.stationsProbing("eduroam", 7), MAX_PROBING_STATIONS);
+
+    size_t naive = MAX_PROBING_STATIONS * 4 * (SSID_MAX_LEN + 1);
+    printf("[ probes   ] %u stations x 4 SSIDs: %u pool bytes (vs %u as char[33]), %u bytes total\n",
+           (unsigned)t.count(), (unsigned)t.pool().bytesUsed(), (unsigned)naive,
+           (unsigned)sizeof(ProbeTable));
+    EXPECT_LT(t.pool().bytesUsed(), 64u);
+}
+
+TEST(ProbeTableTest, EvictionAndPruneReleaseSsids) {
+    ProbeTable t;
+    uint8_t sta[6];
+
+    for (uint16_t i = 0; i < MAX_PROBING_STATIONS + 10; i++) {
+        makeMac(sta, i);
+        probe(t, sta, "own" + std::to_string(i), 1000 + i);
+        probe(t, sta, "shared", 1000 + i);
+    }
+    EXPECT_EQ(t.count(), MAX_PROBING_STATIONS);
+    EXPECT_EQ(t.evictions(), 10u);
+    EXPECT_EQ(t.stationsProbing("own0", 4), 0u);
+    EXPECT_EQ(t.stationsProbing("shared", 6), MAX_PROBING_STATIONS);
+    makeMac(sta, 0);
+    EXPECT_EQ(t.find(sta), nullptr);
+
+    // Everything heard before the cutoff goes, and with it its SSIDs
+    uint32_t cutoff = 1000 + 200;
+    size_t pruned = t.pruneStale(cutoff + 5000, 5000);
+    EXPECT_EQ(pruned, 200u - 10u);
+    EXPECT_EQ(t.stationsProbing("shared", 6), t.count());
+    // One "own" name was refused while the pool was full (256 + "shared")
+    EXPECT_EQ(t.pool().count(), t.count());
+
+    for (size_t i = 0; i < t.count(); i++) {
+        EXPECT_EQ(t.find(t.data()[i].mac), &t.data()[i]);
+    }
+
+    t.clear();
+    EXPECT_EQ(t.count(), 0u);
+    EXPECT_EQ(t.pool().count(), 0u);
+}
+
+TEST(ProbeTableTest, TargetTableRecordsProbes) {
+    TargetTable table;
+    uint8_t sta[6];
+    makeMac(sta, 7);
+
+    EXPECT_TRUE(table.addProbe(sta, "HomeNet", 7, -50, 11, 1000));
+    EXPECT_FALSE(table.addProbe(sta, "HomeNet", 7, -50, 11, 2000));
+    EXPECT_EQ(table.probes().count(), 1u);
+
+    EXPECT_EQ(table.pruneProbes(2000 + PROBE_AGE_TIMEOUT_MS + 1), 1u);
+    EXPECT_EQ(table.probes().count(), 0u);
+
+    table.addProbe(sta, "HomeNet", 7, -50, 11, 1000);
+    table.clear();
+    EXPECT_EQ(table.probes().pool().count(), 0u);
+}
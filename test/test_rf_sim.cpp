@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "IPC.h"
+#include "BeaconParser.h"
+#include "TargetTable.h"
+#include "sim/RfSim.h"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace Vanguard;
+using namespace Vanguard::Sim;
+
+namespace {
+
+constexpr uint32_t TICK_MS = 10;   // Engine loop period
+
+uint32_t fnv(uint32_t h, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) h = (h ^ p[i]) * 16777619u;
+    return h;
+}
+
+uint32_t streamHash(uint32_t seed, uint32_t ms) {
+    SimConfig cfg;
+    cfg.seed = seed;
+    cfg.accessPoints = 50;
+    cfg.stations = 80;
+    cfg.bleDevices = 40;
+    cfg.meanStayMs = 3000;
+    RfSim sim(cfg);
+
+    uint32_t h = 2166136261u;
+    for (uint32_t t = 0; t < ms; t += TICK_MS) {
+        sim.step(TICK_MS, [&h](const SimEvent& e) {
+            h = fnv(h, &e.kind, 1);
+            h = fnv(h, &e.atMs, 4);
+            h = fnv(h, e.mac, 6);
+            h = fnv(h, &e.rssi, 1);
+        });
+    }
+    return h;
+}
+
+/**
+ * Radio -> System Task -> engine, as far as it runs on the host: the real
+ * BeaconThrottle, an event queue of the real depth that drops when full
+ * (sendEvent() uses a zero timeout), and a drain-everything engine tick
+ * that applies events to a real TargetTable.
+ */
+struct EventPathRig {
+    TargetTable           table;
+    BeaconThrottle        throttle;
+    std::vector<SimEvent> queue;
+
+    uint32_t offered = 0;       // Events the radios produced
+    uint32_t admitted = 0;      // Beacons past the throttle
+    uint32_t queued = 0;
+    uint32_t dropped = 0;       // Queue full
+    size_t   peakDepth = 0;
+    uint32_t ticks = 0;
+    double   applyNs = 0;       // Engine-side handling, total
+    double   sortUs = 0;        // Radar's getFiltered(), total
+    uint32_t sorts = 0;
+
+    void send(const SimEvent& e) {
+        if (queue.size() >= SYSTEM_EVENT_QUEUE_LEN) {
+            dropped++;
+            return;
+        }
+        queue.push_back(e);
+        queued++;
+        if (queue.size() > peakDepth) peakDepth = queue.size();
+    }
+
+    void produce(const SimEvent& e) {
+        switch (e.kind) {
+            case SimEventKind::BEACON:
+                offered++;
+                if (!throttle.admit(e.beacon, e.atMs)) return;
+                admitted++;
+                send(e);
+                break;
+            case SimEventKind::BLE_ADVERT:
+            case SimEventKind::ASSOCIATION:
+                offered++;
+                send(e);
+                break;
+            default:
+                break;   // Presence changes aren't visible to the radios
+        }
+    }
+
+    void consume(uint32_t now) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < queue.size(); i++) {
+            const SimEvent& e = queue[i];
+            if (e.kind == SimEventKind::BEACON) {
+                table.addOrUpdate(RfSim::toTarget(e.beacon, e.atMs));
+            } else if (e.kind == SimEventKind::BLE_ADVERT) {
+                Target t;
+                memset(&t, 0, sizeof(t));
+                memcpy(t.bssid, e.mac, 6);
+                t.type = TargetType::BLE_DEVICE;
+                t.rssi = e.rssi;
+                t.firstSeenMs = e.atMs;
+                t.lastSeenMs = e.atMs;
+                table.addOrUpdate(t);
+            } else {
+                table.addAssociation(e.mac, e.bssid, e.rssi, 0, e.atMs);
+            }
+        }
+        if (now % 1000 == 0) table.pruneStale(now);
+        auto t1 = std::chrono::steady_clock::now();
+        applyNs += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        queue.clear();
+        ticks++;
+
+        // Radar refresh
+        if (now % 100 == 0) {
+            TargetFilter filter;
+            auto s0 = std::chrono::steady_clock::now();
+            std::vector<Target> rows = table.getFiltered(filter);
+            auto s1 = std::chrono::steady_clock::now();
+            sortUs += std::chrono::duration<double, std::micro>(s1 - s0).count();
+            sorts++;
+            (void)rows;
+        }
+    }
+
+    void run(RfSim& sim, uint32_t ms) {
+        for (uint32_t t = 0; t < ms; t += TICK_MS) {
+            sim.step(TICK_MS, [this](const SimEvent& e) { produce(e); });
+            consume(sim.now());
+        }
+    }
+
+    void report(const char* label) const {
+        printf("[ rf-sim   ] %s: %u offered, %u queued, %u dropped, peak %u/%u per tick, "
+               "%.0f ns/event, sort %.1f us, %u targets\n",
+               label, offered, queued, dropped, (unsigned)peakDepth,
+               (unsigned)SYSTEM_EVENT_QUEUE_LEN,
+               queued ? applyNs / queued : 0.0,
+               sorts ? sortUs / sorts : 0.0, (unsigned)table.count());
+    }
+};
+
+} // namespace
+
+TEST(RfSimTest, SameSeedSameStream) {
+    uint32_t a = streamHash(42, 20000);
+    uint32_t b = streamHash(42, 20000);
+    uint32_t c = streamHash(43, 20000);
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+}
+
+TEST(RfSimTest, BeaconTimingAndRssiWalk) {
+    SimConfig cfg;
+    cfg.accessPoints = 100;
+    cfg.stations = 0;
+    cfg.bleDevices = 0;
+    cfg.meanStayMs = 10000000;   // Nobody leaves
+    RfSim sim(cfg);
+
+    uint32_t lateOrEarly = 0;
+    bool rssiInRange = true;
+    for (uint32_t t = 0; t < 10000; t += TICK_MS) {
+        sim.step(TICK_MS, [&](const SimEvent& e) {
+            if (e.atMs < t || e.atMs > t + TICK_MS) lateOrEarly++;
+            if (e.rssi < SIM_RSSI_MIN || e.rssi > SIM_RSSI_MAX) rssiInRange = false;
+            if (e.kind == SimEventKind::BEACON) {
+                EXPECT_EQ(e.beacon.rssi, e.rssi);
+                EXPECT_GE(e.beacon.channel, 1);
+                EXPECT_LE(e.beacon.channel, 13);
+            }
+        });
+    }
+
+    // Intervals of 50-200 TU: between ~5 and ~20 beacons per AP per second
+    double perApPerSec = sim.counters().beacons / 100.0 / 10.0;
+    EXPECT_GT(perApPerSec, 5.0);
+    EXPECT_LT(perApPerSec, 20.0);
+    EXPECT_EQ(lateOrEarly, 0u);
+    EXPECT_TRUE(rssiInRange);
+    EXPECT_EQ(sim.counters().departures, 0u);
+}
+
+TEST(RfSimTest, ChurnReplacesDevices) {
+    SimConfig cfg;
+    cfg.accessPoints = 30;
+    cfg.stations = 60;
+    cfg.bleDevices = 40;
+    cfg.meanStayMs = 5000;
+    cfg.meanAwayMs = 2000;
+    cfg.meanRoamMs = 3000;
+    RfSim sim(cfg);
+
+    uint32_t assocs = 0;
+    for (uint32_t t = 0; t < 60000; t += TICK_MS) {
+        sim.step(TICK_MS, [&](const SimEvent& e) {
+            if (e.kind == SimEventKind::ASSOCIATION) {
+                assocs++;
+                EXPECT_EQ(e.bssid[0], 0x02);   // Always an AP address
+            }
+        });
+    }
+
+    const SimCounters& c = sim.counters();
+    EXPECT_GT(c.arrivals, 100u);
+    EXPECT_GT(c.departures, 100u);
+    EXPECT_EQ(assocs, c.associations);
+
+    size_t total = cfg.accessPoints + cfg.stations + cfg.bleDevices;
+    size_t present = sim.present(TargetType::ACCESS_POINT) +
+                     sim.present(TargetType::STATION) +
+                     sim.present(TargetType::BLE_DEVICE);
+    EXPECT_EQ(present, total - c.departures + c.arrivals);
+}
+
+TEST(RfSimTest, EventPathWithinCapacity) {
+    // A busy office: fewer APs than throttle slots
+    SimConfig cfg;
+    cfg.seed = 7;
+    cfg.accessPoints = 48;
+    cfg.stations = 60;
+    cfg.bleDevices = 0;
+    cfg.meanStayMs = 10000000;
+    RfSim sim(cfg);
+
+    EventPathRig rig;
+    rig.run(sim, 30000);
+    rig.report("48 APs");
+
+    // Throttle holds every AP to ~1 report a second
+    uint32_t beaconsQueued = rig.admitted;
+    EXPECT_LE(beaconsQueued, 48u * 31u);
+    EXPECT_EQ(rig.dropped, 0u);
+    EXPECT_LE(rig.peakDepth, SYSTEM_EVENT_QUEUE_LEN);
+    EXPECT_EQ(rig.table.countByType(TargetType::ACCESS_POINT), 48u);
+}
+
+TEST(RfSimTest, ThousandsOfDevicesStayBounded) {
+    // Stadium scale: finds where the table, throttle and queue run out
+    SimConfig cfg;
+    cfg.seed = 2024;
+    cfg.accessPoints = 2000;
+    cfg.stations = 1500;
+    cfg.bleDevices = 800;
+    cfg.meanStayMs = 20000;
+    RfSim sim(cfg);
+
+    EventPathRig rig;
+    rig.run(sim, 20000);
+    rig.report("2000 APs");
+    printf("[ rf-sim   ] throttle passed %.0f%% of %u beacons\n",
+           sim.counters().beacons ? 100.0 * rig.admitted / sim.counters().beacons : 0.0,
+           sim.counters().beacons);
+
+    EXPECT_LE(rig.table.count(), MAX_TARGETS);
+    EXPECT_EQ(rig.table.count(), MAX_TARGETS);   // Full, and staying full
+    for (const Target& t : rig.table.getAll()) {
+        EXPECT_LE(t.clientCount, MAX_CLIENTS_PER_AP);
+    }
+    EXPECT_LE(rig.peakDepth, SYSTEM_EVENT_QUEUE_LEN);
+}
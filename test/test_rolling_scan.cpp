@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "RollingScan.h"
+#include "TargetTable.h"
+
+using namespace Vanguard;
+
+namespace {
+
+// Runs one step to completion at 'now'; returns the channel scanned
+uint8_t step(RollingScan& rolling, uint32_t& now) {
+    uint8_t ch = rolling.nextStep(now);
+    if (ch) rolling.completeStep(now, ch);
+    now += ROLLING_GAP_MS;
+    return ch;
+}
+
+} // namespace
+
+TEST(RollingScanTest, InactiveUntilStarted) {
+    RollingScan rolling;
+    EXPECT_FALSE(rolling.isActive());
+    EXPECT_EQ(rolling.nextStep(1000), 0);
+}
+
+TEST(RollingScanTest, SweepsInterleavedOrder) {
+    RollingScan rolling;
+    uint32_t now = 5000;
+    rolling.start(now);
+
+    EXPECT_EQ(step(rolling, now), 1);
+    EXPECT_EQ(step(rolling, now), 6);
+    EXPECT_EQ(step(rolling, now), 11);
+    EXPECT_EQ(step(rolling, now), 2);
+}
+
+TEST(RollingScanTest, DefaultSweepSkipsChannel14) {
+    RollingScan rolling;
+    uint32_t now = 0;
+    rolling.start(now);
+
+    uint8_t seen = 0;
+    while (rolling.sweeps() == 0) {
+        uint8_t ch = step(rolling, now);
+        EXPECT_NE(ch, 14);
+        if (ch) seen++;
+    }
+    EXPECT_EQ(seen, 13);
+}
+
+TEST(RollingScanTest, OneStepInFlightAtATime) {
+    RollingScan rolling;
+    rolling.start(0);
+
+    EXPECT_EQ(rolling.nextStep(0), 1);
+    EXPECT_TRUE(rolling.inFlight());
+    EXPECT_EQ(rolling.currentChannel(), 1);
+    EXPECT_EQ(rolling.nextStep(500), 0);
+
+    // Rests for the gap after results arrive
+    rolling.completeStep(500, 1);
+    EXPECT_EQ(rolling.nextStep(500 + ROLLING_GAP_MS - 1), 0);
+    EXPECT_EQ(rolling.nextStep(500 + ROLLING_GAP_MS), 6);
+}
+
+TEST(RollingScanTest, AbandonsLostStep) {
+    RollingScan rolling;
+    rolling.start(0);
+    EXPECT_EQ(rolling.nextStep(0), 1);
+
+    // No completion ever arrives
+    EXPECT_EQ(rolling.nextStep(ROLLING_STEP_TIMEOUT_MS - 1), 0);
+    EXPECT_EQ(rolling.nextStep(ROLLING_STEP_TIMEOUT_MS), 0);   // Timed out, now resting
+    EXPECT_EQ(rolling.nextStep(ROLLING_STEP_TIMEOUT_MS + ROLLING_GAP_MS), 6);
+}
+
+TEST(RollingScanTest, LateCompletionKeepsSweepPosition) {
+    RollingScan rolling;
+    rolling.start(0);
+    EXPECT_EQ(rolling.nextStep(0), 1);
+    EXPECT_EQ(rolling.nextStep(ROLLING_STEP_TIMEOUT_MS), 0);   // Abandoned
+
+    // Channel 1's results turn up anyway: still our sweep, but the step
+    // was already counted and the next one keeps its place
+    uint32_t late = ROLLING_STEP_TIMEOUT_MS + 100;
+    EXPECT_TRUE(rolling.isActive());
+    EXPECT_FALSE(rolling.inFlight());
+    EXPECT_FALSE(rolling.completeStep(late, 1));
+    EXPECT_EQ(rolling.sweeps(), 0u);
+    EXPECT_EQ(rolling.nextStep(ROLLING_STEP_TIMEOUT_MS + ROLLING_GAP_MS), 6);
+}
+
+TEST(RollingScanTest, LateCompletionLeavesNextStepInFlight) {
+    RollingScan rolling;
+    rolling.start(0);
+    EXPECT_EQ(rolling.nextStep(0), 1);
+    EXPECT_EQ(rolling.nextStep(ROLLING_STEP_TIMEOUT_MS), 0);   // Abandoned
+    uint32_t now = ROLLING_STEP_TIMEOUT_MS + ROLLING_GAP_MS;
+    EXPECT_EQ(rolling.nextStep(now), 6);
+
+    // Channel 1's results arrive while channel 6 is being scanned
+    EXPECT_FALSE(rolling.completeStep(now + 50, 1));
+    EXPECT_TRUE(rolling.inFlight());
+    EXPECT_EQ(rolling.currentChannel(), 6);
+
+    EXPECT_FALSE(rolling.completeStep(now + 120, 6));
+    EXPECT_EQ(rolling.nextStep(now + 120 + ROLLING_GAP_MS), 11);
+}
+
+TEST(RollingScanTest, LateCompletionDoesNotEndSweepEarly) {
+    RollingScan rolling;
+    uint32_t now = 0;
+    rolling.start(now, (1 << 3) | (1 << 6));
+
+    EXPECT_EQ(rolling.nextStep(now), 6);
+    now += ROLLING_STEP_TIMEOUT_MS;
+    EXPECT_EQ(rolling.nextStep(now), 0);                         // 6 abandoned
+    now += ROLLING_GAP_MS;
+    EXPECT_EQ(rolling.nextStep(now), 3);
+
+    // 6's late results must not close the sweep in 3's place
+    EXPECT_FALSE(rolling.completeStep(now + 50, 6));
+    EXPECT_EQ(rolling.sweeps(), 0u);
+    EXPECT_TRUE(rolling.completeStep(now + 120, 3));
+    EXPECT_EQ(rolling.sweeps(), 1u);
+}
+
+TEST(RollingScanTest, MaskLimitsChannelsAndCountsSweeps) {
+    RollingScan rolling;
+    uint32_t now = 0;
+    rolling.start(now, (1 << 3) | (1 << 6) | (1 << 9));
+
+    EXPECT_EQ(step(rolling, now), 6);
+    EXPECT_EQ(rolling.sweepProgress(), 33);
+    EXPECT_EQ(step(rolling, now), 3);
+
+    uint8_t ch = rolling.nextStep(now);
+    EXPECT_EQ(ch, 9);
+    EXPECT_TRUE(rolling.completeStep(now, ch));   // Last channel closes the sweep
+    EXPECT_EQ(rolling.sweeps(), 1u);
+    now += ROLLING_GAP_MS;
+
+    EXPECT_EQ(step(rolling, now), 6);
+}
+
+TEST(RollingScanTest, StopDropsInFlightStep) {
+    RollingScan rolling;
+    rolling.start(0);
+    rolling.nextStep(0);
+    rolling.stop();
+
+    EXPECT_FALSE(rolling.inFlight());
+    EXPECT_FALSE(rolling.completeStep(100, 1));
+    EXPECT_EQ(rolling.nextStep(10000), 0);
+}
+
+TEST(RollingScanTest, PruneByTypeKeepsOtherTargets) {
+    TargetTable table;
+
+    Target ap;
+    memset(&ap, 0, sizeof(ap));
+    ap.type = TargetType::ACCESS_POINT;
+    ap.bssid[5] = 1;
+    ap.lastSeenMs = 0;
+    table.addOrUpdate(ap);
+
+    Target ble = ap;
+    ble.type = TargetType::BLE_DEVICE;
+    ble.bssid[5] = 2;
+    table.addOrUpdate(ble);
+
+    EXPECT_EQ(table.pruneStale(TARGET_AGE_TIMEOUT + 1, TargetType::ACCESS_POINT), 1u);
+    EXPECT_EQ(table.count(), 1u);
+    EXPECT_EQ(table.getAll()[0].type, TargetType::BLE_DEVICE);
+}
+
+TEST(RollingScanTest, SweepAgingKeepsRestoredTargets) {
+    // What the engine runs when a sweep completes
+    TargetTable table;
+    AgingPolicy policy = AgingPolicy::defaults();
+
+    Target ap;
+    memset(&ap, 0, sizeof(ap));
+    ap.type = TargetType::ACCESS_POINT;
+    ap.lastSeenMs = 0;
+
+    Target saved = ap;
+    saved.bssid[5] = 2;
+    saved.isRestored = true;
+    table.restore(&saved, 1);
+
+    ap.bssid[5] = 1;
+    table.addOrUpdate(ap);
+
+    // Past the flat timeout but inside the AP policy: nothing goes
+    EXPECT_EQ(table.age(TARGET_AGE_TIMEOUT + 1, policy), 0u);
+
+    // Past the AP policy: the live AP goes, the restored one stays
+    EXPECT_EQ(table.age(policy.accessPointMs + 1, policy), 1u);
+    ASSERT_EQ(table.count(), 1u);
+    EXPECT_TRUE(table.getAll()[0].isRestored);
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "ScanCoordinator.h"
+
+using namespace Vanguard;
+
+namespace {
+
+// Completes whatever next() asked for; BLE windows report 'newDevices'
+ScanStep run(ScanCoordinator& coord, uint32_t& now, uint16_t newDevices = 0) {
+    ScanStep step = coord.next(now);
+    if (step.type == ScanSliceType::WIFI) {
+        now += 150;
+        coord.wifiStepDone(now);
+    } else if (step.type == ScanSliceType::BLE) {
+        now += step.durationMs;
+        coord.bleSliceDone(now, newDevices);
+    }
+    return step;
+}
+
+} // namespace
+
+TEST(ScanCoordinatorTest, InactiveUntilStarted) {
+    ScanCoordinator coord;
+    EXPECT_FALSE(coord.isActive());
+    EXPECT_EQ(coord.next(0).type, ScanSliceType::NONE);
+}
+
+TEST(ScanCoordinatorTest, AlternatesWifiAndBleSlices) {
+    ScanCoordinator coord;
+    uint32_t now = 1000;
+    coord.start(now);
+
+    // Three channels, then a BLE window, then the next three channels
+    ScanStep s = run(coord, now, 1);
+    EXPECT_EQ(s.type, ScanSliceType::WIFI);
+    EXPECT_EQ(s.channel, 1);
+    EXPECT_EQ(run(coord, now, 1).channel, 6);
+    EXPECT_EQ(run(coord, now, 1).channel, 11);
+
+    s = run(coord, now, 1);
+    EXPECT_EQ(s.type, ScanSliceType::BLE);
+    EXPECT_EQ(s.durationMs, ScanSlicePolicy::defaults().bleSliceMs);
+
+    s = run(coord, now, 1);
+    EXPECT_EQ(s.type, ScanSliceType::WIFI);
+    EXPECT_EQ(s.channel, 2);
+}
+
+TEST(ScanCoordinatorTest, OneRequestInFlight) {
+    ScanCoordinator coord;
+    coord.start(0);
+
+    EXPECT_EQ(coord.next(0).type, ScanSliceType::WIFI);
+    EXPECT_EQ(coord.next(10).type, ScanSliceType::NONE);
+    EXPECT_EQ(coord.next(500).type, ScanSliceType::NONE);
+}
+
+TEST(ScanCoordinatorTest, LostWifiCompletionTimesOut) {
+    ScanCoordinator coord;
+    coord.start(0);
+
+    EXPECT_EQ(coord.next(0).channel, 1);
+    ScanStep s = coord.next(COORD_WIFI_STEP_TIMEOUT_MS);
+    EXPECT_EQ(s.type, ScanSliceType::WIFI);
+    EXPECT_EQ(s.channel, 6);
+}
+
+TEST(ScanCoordinatorTest, QuietBleEndsEarly) {
+    ScanCoordinator coord;
+    uint32_t now = 0;
+    coord.start(now, 0, false, true);   // BLE only
+
+    // Nothing ever shows up: stops at bleMinMs, not bleMaxMs
+    int guard = 0;
+    while (coord.isActive() && guard++ < 100) run(coord, now, 0);
+
+    ScanSlicePolicy p = ScanSlicePolicy::defaults();
+    EXPECT_FALSE(coord.isActive());
+    EXPECT_GE(coord.bleListenedMs(), p.bleMinMs);
+    EXPECT_LT(coord.bleListenedMs(), p.bleMaxMs);
+}
+
+TEST(ScanCoordinatorTest, BusyBleRunsToCap) {
+    ScanCoordinator coord;
+    uint32_t now = 0;
+    coord.start(now, 0, false, true);
+
+    int guard = 0;
+    while (coord.isActive() && guard++ < 100) run(coord, now, 3);
+
+    EXPECT_EQ(coord.bleListenedMs(), ScanSlicePolicy::defaults().bleMaxMs);
+}
+
+TEST(ScanCoordinatorTest, WifiFinishesAfterOnePass) {
+    ScanCoordinator coord;
+    uint32_t now = 0;
+    uint16_t mask = (1 << 1) | (1 << 6) | (1 << 11);
+    coord.start(now, mask, true, false);   // WiFi only
+
+    EXPECT_EQ(run(coord, now).channel, 1);
+    EXPECT_EQ(run(coord, now).channel, 6);
+    EXPECT_EQ(run(coord, now).channel, 11);
+    EXPECT_TRUE(coord.wifiDone());
+    EXPECT_EQ(coord.next(now).type, ScanSliceType::DONE);
+    EXPECT_FALSE(coord.isActive());
+    EXPECT_EQ(coord.progress(), 100);
+}
+
+TEST(ScanCoordinatorTest, BleContinuesAfterWifiDone) {
+    ScanCoordinator coord;
+    uint32_t now = 0;
+    coord.start(now, (1 << 6), true, true);
+
+    EXPECT_EQ(run(coord, now, 1).type, ScanSliceType::WIFI);
+    EXPECT_EQ(run(coord, now, 1).type, ScanSliceType::BLE);
+    EXPECT_EQ(run(coord, now, 1).type, ScanSliceType::BLE);
+    EXPECT_TRUE(coord.wifiDone());
+    EXPECT_FALSE(coord.bleDone());
+}
+
+TEST(ScanCoordinatorTest, ProgressCoversBothRadios) {
+    ScanCoordinator coord;
+    uint32_t now = 0;
+    coord.start(now);
+    EXPECT_EQ(coord.progress(), 0);
+
+    uint8_t last = 0;
+    int guard = 0;
+    ScanStep s;
+    do {
+        s = run(coord, now, 1);
+        EXPECT_GE(coord.progress(), last);
+        last = coord.progress();
+    } while (s.type != ScanSliceType::DONE && guard++ < 200);
+
+    EXPECT_EQ(s.type, ScanSliceType::DONE);
+    EXPECT_EQ(coord.progress(), 100);
+}
+
+TEST(ScanCoordinatorTest, OnlyFirstBleSliceIsFresh) {
+    // The engine starts the BLE scan on the first slice and resumes it
+    // on the rest; a slice written off as lost still counts as listened
+    ScanCoordinator coord;
+    uint32_t now = 0;
+    coord.start(now, 1 << 1, false, true);
+
+    ScanStep s = coord.next(now);
+    ASSERT_EQ(s.type, ScanSliceType::BLE);
+    EXPECT_EQ(coord.bleListenedMs(), 0u);
+
+    now += s.durationMs + COORD_BLE_GRACE_MS;
+    s = coord.next(now);
+    ASSERT_EQ(s.type, ScanSliceType::BLE);
+    EXPECT_GT(coord.bleListenedMs(), 0u);
+
+    // A new scan starts fresh again
+    coord.start(now, 1 << 1, false, true);
+    EXPECT_EQ(coord.bleListenedMs(), 0u);
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "ScanIngest.h"
+#include "TargetTable.h"
+#include <chrono>
+#include <cstdio>
+
+using namespace Vanguard;
+
+namespace {
+
+// Deterministic synthetic scan: distinct BSSIDs, mixed auth modes,
+// every eighth AP hidden
+void fillRecord(ApRecord& rec, uint32_t i) {
+    rec.bssid[0] = 0x02;
+    rec.bssid[1] = 0x00;
+    rec.bssid[2] = (uint8_t)(i >> 24);
+    rec.bssid[3] = (uint8_t)(i >> 16);
+    rec.bssid[4] = (uint8_t)(i >> 8);
+    rec.bssid[5] = (uint8_t)i;
+    if (i % 8 == 0) rec.ssid[0] = '\0';
+    else snprintf(rec.ssid, sizeof(rec.ssid), "Net-%u", (unsigned)i);
+    rec.channel = 1 + i % 13;
+    rec.rssi = (int8_t)(-30 - (int)(i % 60));
+    rec.authMode = (uint8_t)(i % 8);
+}
+
+size_t fillScan(ScanIngest& ingest, uint32_t count, uint32_t offset = 0) {
+    ingest.begin();
+    ApRecord rec;
+    for (uint32_t i = 0; i < count; i++) {
+        fillRecord(rec, i + offset);
+        ApRecord* slot = ingest.slotFor(rec.rssi);
+        if (slot) *slot = rec;
+    }
+    return ingest.size();
+}
+
+// The pre-batch path: a zeroed Target and an addOrUpdate per AP
+void legacyIngest(TargetTable& table, const ScanIngest& ingest, uint32_t now) {
+    for (size_t i = 0; i < ingest.size(); i++) {
+        const ApRecord& rec = ingest.record(i);
+        Target t;
+        memset(&t, 0, sizeof(t));
+        memcpy(t.bssid, rec.bssid, 6);
+        strncpy(t.ssid, rec.ssid, SSID_MAX_LEN);
+        t.type = TargetType::ACCESS_POINT;
+        t.channel = rec.channel;
+        t.rssi = rec.rssi;
+        t.security = ScanIngest::securityFromAuthMode(rec.authMode);
+        t.isHidden = (strlen(t.ssid) == 0);
+        if (t.isHidden) strcpy(t.ssid, "[Hidden]");
+        t.firstSeenMs = now;
+        t.lastSeenMs = now;
+        t.beaconCount = 1;
+        table.addOrUpdate(t);
+    }
+}
+
+} // namespace
+
+TEST(ScanIngestTest, MapsRecordsToTargets) {
+    ScanIngest ingest;
+    ASSERT_EQ(fillScan(ingest, 9), 9u);
+
+    const Target* targets = ingest.map(1234);
+    EXPECT_EQ(targets[1].type, TargetType::ACCESS_POINT);
+    EXPECT_STREQ(targets[1].ssid, "Net-1");
+    EXPECT_EQ(targets[1].channel, 2);
+    EXPECT_EQ(targets[1].rssi, -31);
+    EXPECT_EQ(targets[1].security, SecurityType::WEP);
+    EXPECT_EQ(targets[1].lastSeenMs, 1234u);
+    EXPECT_EQ(targets[1].beaconCount, 1);
+    EXPECT_EQ(targets[1].clientCount, 0);
+
+    EXPECT_TRUE(targets[8].isHidden);
+    EXPECT_STREQ(targets[8].ssid, "[Hidden]");
+}
+
+TEST(ScanIngestTest, ReusedSlotsDropStaleFields) {
+    ScanIngest ingest;
+    fillScan(ingest, 2, 1);         // "Net-1", "Net-2"
+    ingest.map(0);
+
+    fillScan(ingest, 1, 8);         // Hidden AP lands in slot 0
+    const Target* targets = ingest.map(0);
+    EXPECT_TRUE(targets[0].isHidden);
+    EXPECT_STREQ(targets[0].ssid, "[Hidden]");
+
+    fillScan(ingest, 1, 1);
+    targets = ingest.map(0);
+    EXPECT_FALSE(targets[0].isHidden);
+    EXPECT_STREQ(targets[0].ssid, "Net-1");
+}
+
+TEST(ScanIngestTest, AuthModeMapping) {
+    EXPECT_EQ(ScanIngest::securityFromAuthMode(AP_AUTH_OPEN), SecurityType::OPEN);
+    EXPECT_EQ(ScanIngest::securityFromAuthMode(AP_AUTH_WPA_WPA2_PSK), SecurityType::WPA2_PSK);
+    EXPECT_EQ(ScanIngest::securityFromAuthMode(AP_AUTH_WPA2_WPA3_PSK), SecurityType::WPA2_PSK);
+    EXPECT_EQ(ScanIngest::securityFromAuthMode(AP_AUTH_WPA2_ENTERPRISE), SecurityType::WPA2_ENTERPRISE);
+    EXPECT_EQ(ScanIngest::securityFromAuthMode(AP_AUTH_WPA3_PSK), SecurityType::WPA3_SAE);
+    EXPECT_EQ(ScanIngest::securityFromAuthMode(200), SecurityType::UNKNOWN);
+}
+
+TEST(ScanIngestTest, KeepsStrongestWhenOverCapacity) {
+    ScanIngest ingest;
+    ingest.begin();
+    for (size_t i = 0; i < SCAN_INGEST_MAX; i++) {
+        ApRecord* slot = ingest.slotFor(-80);
+        ASSERT_NE(slot, nullptr);
+        slot->rssi = -80;
+    }
+    EXPECT_EQ(ingest.slotFor(-90), nullptr);
+
+    ApRecord* slot = ingest.slotFor(-40);
+    ASSERT_NE(slot, nullptr);
+    slot->rssi = -40;
+    EXPECT_EQ(ingest.size(), SCAN_INGEST_MAX);
+}
+
+TEST(ScanIngestTest, BatchMatchesPerEntryUpsert) {
+    ScanIngest ingest;
+    TargetTable legacy;
+    TargetTable batched;
+
+    // Two overlapping scans: the second updates half and adds new APs,
+    // pushing past MAX_TARGETS so eviction runs on both paths
+    for (uint32_t scan = 0; scan < 2; scan++) {
+        size_t n = fillScan(ingest, 48, scan * 24);
+        legacyIngest(legacy, ingest, 100 * (scan + 1));
+        batched.upsertBatch(ingest.map(100 * (scan + 1)), n);
+    }
+
+    ASSERT_EQ(batched.count(), legacy.count());
+    for (const Target& t : legacy.getAll()) {
+        const Target* b = batched.findByBssid(t.bssid);
+        ASSERT_NE(b, nullptr);
+        EXPECT_STREQ(b->ssid, t.ssid);
+        EXPECT_EQ(b->rssi, t.rssi);
+        EXPECT_EQ(b->beaconCount, t.beaconCount);
+        EXPECT_EQ(b->security, t.security);
+        EXPECT_EQ(b->lastSeenMs, t.lastSeenMs);
+    }
+}
+
+TEST(ScanIngestTest, UpsertBatchCountsNewTargets) {
+    ScanIngest ingest;
+    TargetTable table;
+
+    size_t n = fillScan(ingest, 10);
+    EXPECT_EQ(table.upsertBatch(ingest.map(0), n), 10u);
+    EXPECT_EQ(table.upsertBatch(ingest.map(1), n), 0u);
+    EXPECT_EQ(table.findByBssid(ingest.record(3).bssid)->beaconCount, 2);
+}
+
+// Host benchmark: prints per-AP cost of both paths. Not a pass/fail gate,
+// timings vary by machine.
+TEST(ScanIngestBenchmark, BatchVersusPerEntry) {
+    typedef std::chrono::steady_clock Clock;
+    const int ROUNDS = 2000;
+
+    ScanIngest ingest;
+    size_t n = fillScan(ingest, SCAN_INGEST_MAX);
+
+    TargetTable legacy;
+    Clock::time_point t0 = Clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        legacy.clear();
+        legacyIngest(legacy, ingest, r);
+        legacyIngest(legacy, ingest, r);   // Second pass hits the update path
+    }
+    Clock::time_point t1 = Clock::now();
+
+    TargetTable batched;
+    for (int r = 0; r < ROUNDS; r++) {
+        batched.clear();
+        batched.upsertBatch(ingest.map(r), n);
+        batched.upsertBatch(ingest.map(r), n);
+    }
+    Clock::time_point t2 = Clock::now();
+
+    double perAp = 1.0 / (ROUNDS * 2.0 * n);
+    double legacyNs = std::chrono::duration<double, std::nano>(t1 - t0).count() * perAp;
+    double batchNs = std::chrono::duration<double, std::nano>(t2 - t1).count() * perAp;
+    printf("[ bench    ] %u APs: per-entry %.1f ns/AP, batch %.1f ns/AP\n",
+           (unsigned)n, legacyNs, batchNs);
+
+    EXPECT_EQ(batched.count(), legacy.count());
+}
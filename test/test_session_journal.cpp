@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "SessionJournal.h"
+#include "JournalReplay.h"
+#include "TargetTable.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Vanguard;
+
+namespace {
+
+Target makeAp(uint8_t id, const char* ssid, int8_t rssi = -60) {
+    Target t;
+    memset(&t, 0, sizeof(t));
+    uint8_t bssid[6] = {0x10, 0x20, 0x30, 0x00, 0x00, id};
+    memcpy(t.bssid, bssid, 6);
+    strncpy(t.ssid, ssid, SSID_MAX_LEN);
+    t.type = TargetType::ACCESS_POINT;
+    t.channel = 1 + id % 11;
+    t.rssi = rssi;
+    t.security = SecurityType::WPA2_PSK;
+    return t;
+}
+
+std::vector<uint8_t> bytes(const SessionJournal& journal) {
+    return std::vector<uint8_t>(journal.data(), journal.data() + journal.size());
+}
+
+} // namespace
+
+TEST(SessionJournalTest, HeaderAndRecordFraming) {
+    SessionJournal journal;
+    journal.begin();
+    EXPECT_EQ(journal.size(), JOURNAL_HEADER_SIZE);
+
+    journal.tableCleared(1234);
+    EXPECT_EQ(journal.size(), JOURNAL_HEADER_SIZE + JOURNAL_RECORD_HEAD);
+
+    std::vector<uint8_t> buf = bytes(journal);
+    JournalReader reader(buf.data(), buf.size());
+    ASSERT_TRUE(reader.valid());
+
+    JournalRecord rec;
+    ASSERT_TRUE(reader.next(rec));
+    EXPECT_EQ(rec.event, JournalEvent::TABLE_CLEARED);
+    EXPECT_EQ(rec.timestampMs, 1234u);
+    EXPECT_EQ(rec.length, 0);
+    EXPECT_FALSE(reader.next(rec));
+}
+
+TEST(SessionJournalTest, TargetPayloadRoundTrip) {
+    Target in = makeAp(7, "CoffeeShop", -48);
+    in.isHidden = true;
+    in.clientCount = 3;
+
+    uint8_t payload[64];
+    uint8_t len = SessionJournal::encodeTarget(payload, in);
+    EXPECT_EQ(len, 13 + strlen("CoffeeShop"));
+
+    Target out;
+    ASSERT_TRUE(SessionJournal::decodeTarget(payload, len, out));
+    EXPECT_EQ(memcmp(out.bssid, in.bssid, 6), 0);
+    EXPECT_STREQ(out.ssid, "CoffeeShop");
+    EXPECT_EQ(out.rssi, -48);
+    EXPECT_EQ(out.channel, in.channel);
+    EXPECT_TRUE(out.isHidden);
+    EXPECT_EQ(out.clientCount, 3);
+
+    EXPECT_FALSE(SessionJournal::decodeTarget(payload, 10, out));
+}
+
+TEST(SessionJournalTest, TornTailStopsCleanly) {
+    SessionJournal journal;
+    journal.begin();
+    journal.targetAdded(10, makeAp(1, "A"));
+    journal.targetAdded(20, makeAp(2, "B"));
+
+    std::vector<uint8_t> buf = bytes(journal);
+    JournalReader reader(buf.data(), buf.size() - 3);
+
+    JournalRecord rec;
+    EXPECT_TRUE(reader.next(rec));
+    EXPECT_FALSE(reader.next(rec));
+}
+
+TEST(SessionJournalTest, FullBufferDropsAndCounts) {
+    SessionJournal journal;
+    journal.begin();
+    for (int i = 0; i < 2000; i++) journal.tableCleared(i);
+
+    EXPECT_LE(journal.size(), JOURNAL_BUFFER_BYTES);
+    EXPECT_GT(journal.dropped(), 0u);
+    EXPECT_TRUE(journal.wantsFlush());
+
+    journal.drain();
+    EXPECT_EQ(journal.size(), 0u);
+}
+
+TEST(SessionJournalTest, ReplayRebuildsTable) {
+    SessionJournal journal;
+    journal.begin();
+
+    uint8_t sta[6] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x01};
+    Target a = makeAp(1, "Alpha");
+    Target b = makeAp(2, "Bravo");
+
+    journal.scanPhase(0, ScanState::WIFI_SCANNING, 0);
+    journal.targetAdded(100, a);
+    journal.targetAdded(110, b);
+    a.rssi = -40;
+    journal.targetUpdated(200, a);
+    journal.association(250, sta, a.bssid);
+    journal.targetRemoved(300, b.bssid);
+    journal.scanPhase(400, ScanState::COMPLETE, 100);
+    journal.actionStart(500, ActionType::DEAUTH_ALL, a.bssid);
+    journal.actionStop(900, ActionResult::SUCCESS);
+
+    std::vector<uint8_t> buf = bytes(journal);
+    TargetTable table;
+    JournalReplay replay(table);
+
+    int phases = 0;
+    replay.onRecord([&phases](const JournalRecord& rec) {
+        if (rec.event == JournalEvent::SCAN_PHASE) phases++;
+    });
+    ASSERT_TRUE(replay.run(buf.data(), buf.size()));
+
+    EXPECT_EQ(replay.stats().records, 9u);
+    EXPECT_EQ(replay.stats().malformed, 0u);
+    EXPECT_EQ(replay.stats().lastMs, 900u);
+    EXPECT_EQ(phases, 2);
+
+    ASSERT_EQ(table.count(), 1u);
+    const Target* t = table.findByBssid(a.bssid);
+    ASSERT_NE(t, nullptr);
+    EXPECT_EQ(t->rssi, -40);
+    EXPECT_EQ(t->lastSeenMs, 200u);
+    EXPECT_TRUE(t->hasClient(sta));
+}
+
+TEST(SessionJournalTest, ReplayClearAndRejectsNonJournal) {
+    SessionJournal journal;
+    journal.begin();
+    journal.targetAdded(1, makeAp(1, "A"));
+    journal.tableCleared(2);
+    journal.targetAdded(3, makeAp(2, "B"));
+
+    std::vector<uint8_t> buf = bytes(journal);
+    TargetTable table;
+    JournalReplay replay(table);
+    ASSERT_TRUE(replay.run(buf.data(), buf.size()));
+    EXPECT_EQ(table.count(), 1u);
+
+    uint8_t junk[16] = {0};
+    EXPECT_FALSE(replay.run(junk, sizeof(junk)));
+}
+
+// Replay driver: a synthetic session by default, or a real one pulled
+// off the card with VANGUARD_JOURNAL=/path/to/0000002A.vgj
+TEST(SessionJournalTest, ReplayThroughput) {
+    std::vector<uint8_t> image;
+
+    const char* path = getenv("VANGUARD_JOURNAL");
+    if (path) {
+        FILE* f = fopen(path, "rb");
+        ASSERT_NE(f, nullptr) << path;
+        uint8_t chunk[4096];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) image.insert(image.end(), chunk, chunk + n);
+        fclose(f);
+    } else {
+        // ~10 min of beacons from 48 APs at 1 update/s each, in 4 KB flushes
+        SessionJournal journal;
+        journal.begin();
+        for (uint32_t sec = 0; sec < 600; sec++) {
+            for (uint8_t ap = 0; ap < 48; ap++) {
+                Target t = makeAp(ap, "Net", (int8_t)(-40 - (int)((sec + ap) % 40)));
+                if (sec == 0) journal.targetAdded(sec * 1000, t);
+                else journal.targetUpdated(sec * 1000 + ap, t);
+                if (journal.wantsFlush()) {
+                    std::vector<uint8_t> part = bytes(journal);
+                    image.insert(image.end(), part.begin(), part.end());
+                    journal.drain();
+                }
+            }
+        }
+        std::vector<uint8_t> part = bytes(journal);
+        image.insert(image.end(), part.begin(), part.end());
+    }
+
+    TargetTable table;
+    JournalReplay replay(table);
+
+    auto t0 = std::chrono::steady_clock::now();
+    ASSERT_TRUE(replay.run(image.data(), image.size()));
+    auto t1 = std::chrono::steady_clock::now();
+
+    double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    const ReplayStats& st = replay.stats();
+    double sessionMs = (double)(st.lastMs - st.firstMs);
+    printf("[ replay   ] %u records (%u bytes) in %.2f ms, %.0fx real time, %u targets\n",
+           st.records, (unsigned)image.size(), ms,
+           ms > 0 ? sessionMs / ms : 0.0, (unsigned)table.count());
+
+    EXPECT_EQ(st.malformed, 0u);
+    if (!path) {
+        EXPECT_EQ(table.count(), 48u);
+        EXPECT_GT(sessionMs, ms);   // Faster than the session took live
+    }
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "StationTable.h"
+#include "TargetTable.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <set>
+
+using namespace Vanguard;
+
+namespace {
+
+void makeMac(uint8_t* mac, uint8_t prefix, uint16_t id) {
+    mac[0] = prefix;
+    mac[1] = 0x11;
+    mac[2] = 0x22;
+    mac[3] = 0x33;
+    mac[4] = (uint8_t)(id >> 8);
+    mac[5] = (uint8_t)id;
+}
+
+// Every station findable, every chain consistent with the counts
+void checkConsistent(const StationTable& st) {
+    size_t chained = 0;
+    std::set<const Station*> seen;
+
+    for (size_t i = 0; i < st.count(); i++) {
+        const Station& s = st.data()[i];
+        ASSERT_EQ(st.find(s.mac), &s) << "entry " << i;
+
+        if (!s.hasAp()) continue;
+        // Count each AP's chain once, from its first member
+        if (seen.count(&s)) continue;
+        const Station* list[MAX_STATIONS];
+        size_t n = st.clientsOf(s.bssid, list, MAX_STATIONS);
+        EXPECT_EQ(n, st.clientCount(s.bssid));
+        for (size_t k = 0; k < n; k++) {
+            EXPECT_EQ(memcmp(list[k]->bssid, s.bssid, 6), 0);
+            EXPECT_TRUE(seen.insert(list[k]).second);
+        }
+        chained += n;
+    }
+
+    size_t withAp = 0;
+    for (size_t i = 0; i < st.count(); i++) if (st.data()[i].hasAp()) withAp++;
+    EXPECT_EQ(chained, withAp);
+}
+
+} // namespace
+
+TEST(StationTableTest, ObserveTracksFields) {
+    StationTable st;
+    uint8_t sta[6], ap[6];
+    makeMac(sta, 0x10, 1);
+    makeMac(ap, 0x20, 1);
+
+    EXPECT_TRUE(st.observe(sta, ap, -55, 6, 1000));
+    EXPECT_FALSE(st.observe(sta, ap, 0, 0, 2000));   // AP transmitted: RSSI kept
+
+    const Station* s = st.find(sta);
+    ASSERT_NE(s, nullptr);
+    EXPECT_EQ(s->rssi, -55);
+    EXPECT_EQ(s->channel, 6);
+    EXPECT_EQ(s->frameCount, 2u);
+    EXPECT_EQ(s->firstSeenMs, 1000u);
+    EXPECT_EQ(s->lastSeenMs, 2000u);
+    EXPECT_EQ(memcmp(s->bssid, ap, 6), 0);
+    EXPECT_EQ(st.clientCount(ap), 1u);
+}
+
+TEST(StationTableTest, NoPerApCap) {
+    StationTable st;
+    uint8_t ap[6], sta[6];
+    makeMac(ap, 0x20, 7);
+
+    for (uint16_t i = 0; i < 100; i++) {
+        makeMac(sta, 0x10, i);
+        st.observe(sta, ap, -60, 1, i);
+    }
+    EXPECT_EQ(st.clientCount(ap), 100u);
+
+    const Station* list[10];
+    EXPECT_EQ(st.clientsOf(ap, list, 10), 10u);
+    makeMac(sta, 0x10, 99);
+    EXPECT_EQ(memcmp(list[0]->mac, sta, 6), 0);   // Newest first
+    checkConsistent(st);
+}
+
+TEST(StationTableTest, RoamMovesBetweenAps) {
+    StationTable st;
+    uint8_t sta[6], ap1[6], ap2[6];
+    makeMac(sta, 0x10, 1);
+    makeMac(ap1, 0x20, 1);
+    makeMac(ap2, 0x20, 2);
+
+    st.observe(sta, ap1, -50, 1, 0);
+    EXPECT_TRUE(st.observe(sta, ap2, -50, 6, 10));
+    EXPECT_EQ(st.clientCount(ap1), 0u);
+    EXPECT_EQ(st.clientCount(ap2), 1u);
+
+    EXPECT_FALSE(st.observe(sta, nullptr, -40, 0, 20));   // No AP: stays put
+    EXPECT_EQ(st.clientCount(ap2), 1u);
+    checkConsistent(st);
+}
+
+TEST(StationTableTest, EvictsLeastRecentlySeenWhenFull) {
+    StationTable st;
+    uint8_t sta[6], ap[6];
+    makeMac(ap, 0x20, 1);
+
+    for (uint16_t i = 0; i < MAX_STATIONS + 20; i++) {
+        makeMac(sta, 0x10, i);
+        st.observe(sta, ap, -60, 1, 1000 + i);
+    }
+    EXPECT_EQ(st.count(), MAX_STATIONS);
+    EXPECT_EQ(st.evictions(), 20u);
+    EXPECT_EQ(st.clientCount(ap), MAX_STATIONS);
+
+    makeMac(sta, 0x10, 0);
+    EXPECT_EQ(st.find(sta), nullptr);
+    makeMac(sta, 0x10, MAX_STATIONS + 19);
+    EXPECT_NE(st.find(sta), nullptr);
+    checkConsistent(st);
+}
+
+TEST(StationTableTest, PruneAndRemoveKeepIndexesIntact) {
+    StationTable st;
+    uint8_t sta[6], ap[6];
+
+    // Interleave APs so removal swaps entries across chains
+    for (uint16_t i = 0; i < 200; i++) {
+        makeMac(sta, 0x10, i);
+        makeMac(ap, 0x20, i % 7);
+        st.observe(sta, ap, -60, 1, (i % 2) ? 100000 : 1000);
+    }
+    EXPECT_EQ(st.pruneStale(100000, 50000), 100u);
+    EXPECT_EQ(st.count(), 100u);
+    checkConsistent(st);
+
+    makeMac(sta, 0x10, 1);
+    EXPECT_TRUE(st.remove(sta));
+    EXPECT_FALSE(st.remove(sta));
+    checkConsistent(st);
+
+    st.clear();
+    EXPECT_EQ(st.count(), 0u);
+    makeMac(ap, 0x20, 1);
+    EXPECT_EQ(st.clientCount(ap), 0u);
+}
+
+TEST(StationTableTest, TargetTableRecordsStationsBeyondApLimit) {
+    TargetTable table;
+    Target ap;
+    memset(&ap, 0, sizeof(ap));
+    makeMac(ap.bssid, 0x20, 1);
+    ap.type = TargetType::ACCESS_POINT;
+    table.addOrUpdate(ap);
+
+    uint8_t sta[6];
+    for (uint16_t i = 0; i < 40; i++) {
+        makeMac(sta, 0x10, i);
+        EXPECT_TRUE(table.addAssociation(sta, ap.bssid, -50, 1, 100));
+    }
+    EXPECT_FALSE(table.addAssociation(sta, ap.bssid, -50, 1, 200));
+
+    EXPECT_EQ(table.findByBssid(ap.bssid)->clientCount, MAX_CLIENTS_PER_AP);
+    EXPECT_EQ(table.stations().clientCount(ap.bssid), 40u);
+
+    // Stations of APs not (yet) in the table are kept too
+    uint8_t unknownAp[6];
+    makeMac(unknownAp, 0x20, 99);
+    EXPECT_TRUE(table.addAssociation(sta, unknownAp, -50, 1, 300));
+    EXPECT_EQ(table.stations().clientCount(unknownAp), 1u);
+    EXPECT_EQ(table.stations().clientCount(ap.bssid), 39u);
+
+    table.clear();
+    EXPECT_EQ(table.stations().count(), 0u);
+}
+
+TEST(StationTableTest, LookupCostAtCapacity) {
+    StationTable st;
+    uint8_t sta[6], ap[6];
+    for (uint16_t i = 0; i < MAX_STATIONS; i++) {
+        makeMac(sta, 0x10, i * 37);
+        makeMac(ap, 0x20, i % 40);
+        st.observe(sta, ap, -60, 1, i);
+    }
+
+    const uint32_t N = MAX_STATIONS * 2 * 2000;   // Half hits, half misses
+    uint32_t hits = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < N; i++) {
+        makeMac(sta, 0x10, (uint16_t)((i % (MAX_STATIONS * 2)) * 37));
+        if (st.find(sta)) hits++;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / N;
+    printf("[ stations ] %u stations, %u bytes, %.1f ns/lookup\n",
+           (unsigned)st.count(), (unsigned)sizeof(StationTable), ns);
+    EXPECT_EQ(hits, N / 2);
+}
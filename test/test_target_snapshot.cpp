@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "TargetSnapshot.h"
+#include "TargetTable.h"
+#include <cstring>
+#include <vector>
+
+using namespace Vanguard;
+
+namespace {
+
+Target makeAp(uint8_t id, const char* ssid, uint32_t lastSeen) {
+    Target t;
+    memset(&t, 0, sizeof(t));
+    uint8_t bssid[6] = {0xAA, 0xBB, 0xCC, 0x00, 0x00, id};
+    memcpy(t.bssid, bssid, 6);
+    strncpy(t.ssid, ssid, SSID_MAX_LEN);
+    t.type = TargetType::ACCESS_POINT;
+    t.channel = 6;
+    t.rssi = -55;
+    t.security = SecurityType::WPA2_PSK;
+    t.lastSeenMs = lastSeen;
+    t.beaconCount = 12;
+    return t;
+}
+
+// Encodes targets into a full snapshot image
+std::vector<uint8_t> image(TargetSnapshot& snap, const Target* targets, size_t n, uint32_t now) {
+    std::vector<uint8_t> buf(SNAPSHOT_HEADER_SIZE + n * SNAPSHOT_SLOT_SIZE);
+    TargetSnapshot::encodeHeader(buf.data(), (uint16_t)n, now);
+    for (size_t i = 0; i < n; i++) {
+        snap.encodeSlot(i, targets[i], buf.data() + TargetSnapshot::slotOffset(i));
+    }
+    return buf;
+}
+
+} // namespace
+
+TEST(TargetSnapshotTest, Crc32KnownValue) {
+    const char* text = "123456789";
+    EXPECT_EQ(crc32((const uint8_t*)text, 9), 0xCBF43926u);
+}
+
+TEST(TargetSnapshotTest, RoundTrip) {
+    Target in[2] = { makeAp(1, "HomeNet", 1000), makeAp(2, "", 4000) };
+    in[0].clientCount = 2;
+    in[0].clientMacs[1][5] = 0x42;
+    in[1].isHidden = true;
+    in[1].hasHandshake = true;
+    in[1].isRandomAddress = true;
+
+    TargetSnapshot snap;
+    std::vector<uint8_t> buf = image(snap, in, 2, 5000);
+
+    Target out[MAX_TARGETS];
+    ASSERT_EQ(TargetSnapshot::decode(buf.data(), buf.size(), out, MAX_TARGETS, 5000), 2u);
+    EXPECT_STREQ(out[0].ssid, "HomeNet");
+    EXPECT_EQ(memcmp(out[0].bssid, in[0].bssid, 6), 0);
+    EXPECT_EQ(out[0].security, SecurityType::WPA2_PSK);
+    EXPECT_EQ(out[0].clientCount, 2);
+    EXPECT_EQ(out[0].clientMacs[1][5], 0x42);
+    EXPECT_EQ(out[0].beaconCount, 12);
+    EXPECT_TRUE(out[0].isRestored);
+    EXPECT_TRUE(out[1].isHidden);
+    EXPECT_TRUE(out[1].hasHandshake);
+    EXPECT_FALSE(out[0].isRandomAddress);
+    EXPECT_TRUE(out[1].isRandomAddress);
+}
+
+TEST(TargetSnapshotTest, AgesRebasedOntoNewBoot) {
+    // Seen 4 s before the save; next boot loads it 2 s after power-on
+    Target in = makeAp(1, "Cafe", 96000);
+    TargetSnapshot snap;
+    std::vector<uint8_t> buf = image(snap, &in, 1, 100000);
+
+    Target out;
+    ASSERT_EQ(TargetSnapshot::decode(buf.data(), buf.size(), &out, 1, 2000), 1u);
+    EXPECT_EQ(2000u - out.lastSeenMs, 4000u);
+    EXPECT_TRUE(out.isStale(2000 + TARGET_AGE_TIMEOUT));
+}
+
+TEST(TargetSnapshotTest, CorruptSlotSkipped) {
+    Target in[3] = { makeAp(1, "A", 0), makeAp(2, "B", 0), makeAp(3, "C", 0) };
+    TargetSnapshot snap;
+    std::vector<uint8_t> buf = image(snap, in, 3, 0);
+    buf[TargetSnapshot::slotOffset(1) + 10] ^= 0xFF;
+
+    Target out[MAX_TARGETS];
+    ASSERT_EQ(TargetSnapshot::decode(buf.data(), buf.size(), out, MAX_TARGETS, 0), 2u);
+    EXPECT_STREQ(out[0].ssid, "A");
+    EXPECT_STREQ(out[1].ssid, "C");
+}
+
+TEST(TargetSnapshotTest, BadHeaderRejected) {
+    Target in = makeAp(1, "A", 0);
+    TargetSnapshot snap;
+    std::vector<uint8_t> buf = image(snap, &in, 1, 0);
+    Target out;
+
+    std::vector<uint8_t> bad = buf;
+    bad[8] = 9;   // Count changed without fixing the CRC
+    EXPECT_EQ(TargetSnapshot::decode(bad.data(), bad.size(), &out, 1, 0), 0u);
+
+    EXPECT_EQ(TargetSnapshot::decode(buf.data(), 10, &out, 1, 0), 0u);
+}
+
+TEST(TargetSnapshotTest, TruncatedImageKeepsWholeSlots) {
+    Target in[2] = { makeAp(1, "A", 0), makeAp(2, "B", 0) };
+    TargetSnapshot snap;
+    std::vector<uint8_t> buf = image(snap, in, 2, 0);
+
+    Target out[MAX_TARGETS];
+    EXPECT_EQ(TargetSnapshot::decode(buf.data(), buf.size() - 5, out, MAX_TARGETS, 0), 1u);
+}
+
+TEST(TargetSnapshotTest, OnlyChangedSlotsDirty) {
+    Target in[3] = { makeAp(1, "A", 10), makeAp(2, "B", 10), makeAp(3, "C", 10) };
+    TargetSnapshot snap;
+    uint8_t slot[SNAPSHOT_SLOT_SIZE];
+
+    // Nothing on disk yet: everything is dirty
+    for (size_t i = 0; i < 3; i++) EXPECT_TRUE(snap.encodeSlot(i, in[i], slot));
+    snap.commit(3);
+
+    in[1].rssi = -40;
+    EXPECT_FALSE(snap.encodeSlot(0, in[0], slot));
+    EXPECT_TRUE(snap.encodeSlot(1, in[1], slot));
+    EXPECT_FALSE(snap.encodeSlot(2, in[2], slot));
+
+    // Growing the table: new slots are dirty
+    Target extra = makeAp(4, "D", 10);
+    EXPECT_TRUE(snap.encodeSlot(3, extra, slot));
+
+    snap.invalidate();
+    EXPECT_TRUE(snap.encodeSlot(0, in[0], slot));
+}
+
+TEST(TargetSnapshotTest, VirtualTargetsNotPersisted) {
+    Target t;
+    memset(&t, 0, sizeof(t));
+    t.type = TargetType::IR_DEVICE;
+    EXPECT_FALSE(TargetSnapshot::shouldPersist(t));
+    EXPECT_TRUE(TargetSnapshot::shouldPersist(makeAp(1, "A", 0)));
+}
+
+TEST(TargetSnapshotTest, RestoreLoadsTableAndLiveSightingClearsFlag) {
+    Target in[2] = { makeAp(1, "A", 0), makeAp(2, "B", 0) };
+    in[0].isRestored = true;
+    in[1].isRestored = true;
+
+    TargetTable table;
+    EXPECT_EQ(table.restore(in, 2), 2u);
+    EXPECT_EQ(table.count(), 2u);
+
+    Target live = makeAp(1, "A", 500);
+    table.addOrUpdate(live);
+    EXPECT_FALSE(table.findByBssid(in[0].bssid)->isRestored);
+    EXPECT_TRUE(table.findByBssid(in[1].bssid)->isRestored);
+}
+
+TEST(TargetSnapshotTest, FormatAge) {
+    char buf[16];
+    TargetSnapshot::formatAge(buf, sizeof(buf), 30000);
+    EXPECT_STREQ(buf, "<1m ago");
+    TargetSnapshot::formatAge(buf, sizeof(buf), 5 * 60000);
+    EXPECT_STREQ(buf, "5m ago");
+    TargetSnapshot::formatAge(buf, sizeof(buf), 3 * 3600000UL);
+    EXPECT_STREQ(buf, "3h ago");
+    TargetSnapshot::formatAge(buf, sizeof(buf), 72 * 3600000UL);
+    EXPECT_STREQ(buf, "3d ago");
+}
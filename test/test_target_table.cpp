@@ -66,6 +66,39 @@ TEST_F(TargetTableTest, PruneStale) {
     EXPECT_EQ(table.count(), 0);
 }
 
+TEST_F(TargetTableTest, AgeAppliesPerTypePolicy) {
+    AgingPolicy policy = AgingPolicy::defaults();
+    const TargetType types[] = {TargetType::ACCESS_POINT, TargetType::BLE_DEVICE,
+                                TargetType::BLE_DEVICE, TargetType::BLE_BEACON,
+                                TargetType::IR_DEVICE, TargetType::ACCESS_POINT};
+    for (uint8_t i = 0; i < 6; i++) {
+        Target t;
+        memset(&t, 0, sizeof(Target));
+        t.bssid[5] = i + 1;
+        t.type = types[i];
+        t.isRandomAddress = (i == 1);
+        t.isRestored = (i == 5);
+        table.addOrUpdate(t);
+    }
+    uint8_t ap[6] = {0, 0, 0, 0, 0, 1};
+    uint8_t randomBle[6] = {0, 0, 0, 0, 0, 2};
+    uint8_t publicBle[6] = {0, 0, 0, 0, 0, 3};
+
+    // Only the random-address device is past its age
+    EXPECT_EQ(table.age(policy.bleRandomMs + 1, policy), 1u);
+    EXPECT_EQ(table.findByBssid(randomBle), nullptr);
+    EXPECT_NE(table.findByBssid(publicBle), nullptr);
+
+    EXPECT_EQ(table.age(policy.blePublicMs + 1, policy), 2u);   // Public BLE, beacon
+    EXPECT_NE(table.findByBssid(ap), nullptr);
+
+    // Virtual and restored targets outlive everything; order is kept
+    EXPECT_EQ(table.age(policy.accessPointMs + 1, policy), 1u);
+    ASSERT_EQ(table.count(), 2u);
+    EXPECT_EQ(table.getAll()[0].type, TargetType::IR_DEVICE);
+    EXPECT_TRUE(table.getAll()[1].isRestored);
+}
+
 TEST_F(TargetTableTest, Association) {
     uint8_t apMac[6] = {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA};
     uint8_t cliMac[6] = {0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC};
@@ -81,3 +114,45 @@ TEST_F(TargetTableTest, Association) {
     EXPECT_EQ(found->clientCount, 1);
     EXPECT_TRUE(found->hasClient(cliMac));
 }
+
+TEST_F(TargetTableTest, StationsListedFromStationTable) {
+    Target ap;
+    memset(&ap, 0, sizeof(Target));
+    uint8_t bssid[6] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+    uint8_t other[6] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x66};
+    memcpy(ap.bssid, bssid, 6);
+    strcpy(ap.ssid, "HomeNet");
+    ap.type = TargetType::ACCESS_POINT;
+    ap.security = SecurityType::WPA2_PSK;
+    ap.rssi = -40;
+    table.addOrUpdate(ap);
+
+    // One station roams between two APs, one only received
+    uint8_t phone[6] = {0xDA, 0x01, 0x02, 0x03, 0x04, 0x05};
+    uint8_t quiet[6] = {0xDA, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E};
+    table.addAssociation(phone, other, -70, 1, 1000);
+    table.addAssociation(phone, bssid, -55, 6, 2000);
+    table.addAssociation(quiet, bssid, 0, 6, 2000);
+
+    TargetFilter filter;
+    std::vector<Target> list = table.getFiltered(filter);
+    ASSERT_EQ(list.size(), 3u);
+    EXPECT_EQ(list[0].type, TargetType::ACCESS_POINT);
+
+    const Target& row = list[1];
+    EXPECT_EQ(row.type, TargetType::STATION);
+    EXPECT_EQ(memcmp(row.bssid, phone, 6), 0);
+    EXPECT_STREQ(row.ssid, "DA:01:02:03:04:05");
+    EXPECT_EQ(row.rssi, -55);
+    EXPECT_EQ(row.channel, 6);
+    EXPECT_EQ(row.clientCount, 2);          // APs it was seen with
+    EXPECT_EQ(list[2].rssi, -100);          // Never heard: sorts last
+    EXPECT_EQ(table.count(), 1u);           // Listed, not stored
+
+    filter.showStations = false;
+    EXPECT_EQ(table.getFiltered(filter).size(), 1u);
+
+    filter.showStations = true;
+    filter.minRssi = -80;
+    EXPECT_EQ(table.getFiltered(filter).size(), 2u);
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "TrackerDetector.h"
+#include "TrackerWatch.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+using namespace Vanguard;
+
+namespace {
+
+const uint32_t MINUTE = 60000;
+
+// Find My separated-mode advert: Apple, type 0x12, status, 22 key bytes,
+// key bits, hint. The key rotates with the address.
+RawAdvert findMy(uint8_t device, uint8_t epoch, uint8_t status, int8_t rssi, uint32_t now) {
+    RawAdvert adv;
+    memset(&adv, 0, sizeof(adv));
+    const uint8_t addr[6] = {(uint8_t)(epoch * 37 + device), epoch, device, 0x22, 0x11, 0xC4};
+    memcpy(adv.address, addr, 6);
+    adv.rssi = rssi;
+    adv.timestampMs = now;
+
+    uint8_t* p = adv.payload;
+    size_t n = 0;
+    p[n++] = 0x1E; p[n++] = 0xFF; p[n++] = 0x4C; p[n++] = 0x00;
+    p[n++] = FINDMY_TYPE; p[n++] = 0x19; p[n++] = status;
+    for (int i = 0; i < 22; i++) p[n++] = (uint8_t)(device * 31 + epoch * 17 + i * 7);
+    p[n++] = (uint8_t)(epoch & 0x03);
+    p[n++] = (uint8_t)(device ^ epoch);
+    adv.len = (uint8_t)n;
+    return adv;
+}
+
+RawAdvert fromPayload(const uint8_t* payload, size_t len, uint8_t addrLow) {
+    RawAdvert adv;
+    memset(&adv, 0, sizeof(adv));
+    const uint8_t addr[6] = {addrLow, 0x01, 0x02, 0x03, 0x04, 0xC5};
+    memcpy(adv.address, addr, 6);
+    adv.rssi = -70;
+    adv.len = (uint8_t)len;
+    memcpy(adv.payload, payload, len);
+    return adv;
+}
+
+TrackerKind classify(const RawAdvert& adv) {
+    AdvertFields f;
+    parseAdvertFields(adv.payload, adv.len, f);
+    return classifyTracker(adv, f);
+}
+
+uint32_t fingerprint(const RawAdvert& adv) {
+    AdvertFields f;
+    parseAdvertFields(adv.payload, adv.len, f);
+    return trackerFingerprint(adv, f, classifyTracker(adv, f));
+}
+
+bool feed(TrackerDetector& det, const RawAdvert& adv, TrackerAlert& alert) {
+    AdvertFields f;
+    parseAdvertFields(adv.payload, adv.len, f);
+    return det.observe(adv, f, alert);
+}
+
+// The engine rescans: heard for 10 s of every 30 s
+bool scanning(uint32_t now) {
+    return now % 30000 < 10000;
+}
+
+} // namespace
+
+TEST(TrackerDetectorTest, ClassifiesTrackerFamilies) {
+    const uint8_t smartTag[] = {0x02, 0x01, 0x06, 0x06, 0x16, 0x5A, 0xFD, 0x11, 0xB2, 0x4F};
+    const uint8_t tile[]     = {0x02, 0x01, 0x06, 0x03, 0x03, 0xED, 0xFE};
+    const uint8_t fmdn[]     = {0x03, 0x03, 0xAA, 0xFE, 0x06, 0x16, 0xAA, 0xFE, 0x41, 0x12, 0x34};
+    const uint8_t eddystone[] = {0x03, 0x03, 0xAA, 0xFE, 0x06, 0x16, 0xAA, 0xFE, 0x00, 0xE7, 0xED};
+    const uint8_t nearby[]   = {0x07, 0xFF, 0x4C, 0x00, 0x10, 0x05, 0x01, 0x18};
+
+    EXPECT_EQ(classify(findMy(1, 0, 0x10, -60, 0)), TrackerKind::FIND_MY);
+    EXPECT_EQ(classify(fromPayload(smartTag, sizeof(smartTag), 1)), TrackerKind::SMARTTAG);
+    EXPECT_EQ(classify(fromPayload(tile, sizeof(tile), 1)), TrackerKind::TILE);
+    EXPECT_EQ(classify(fromPayload(fmdn, sizeof(fmdn), 1)), TrackerKind::FMDN);
+    EXPECT_EQ(classify(fromPayload(eddystone, sizeof(eddystone), 1)), TrackerKind::NONE);
+    EXPECT_EQ(classify(fromPayload(nearby, sizeof(nearby), 1)), TrackerKind::NONE);
+}
+
+TEST(TrackerDetectorTest, FingerprintSurvivesRotation) {
+    // New address and key: same fingerprint. Different status: not.
+    EXPECT_EQ(fingerprint(findMy(1, 0, 0x10, -60, 0)), fingerprint(findMy(1, 1, 0x10, -60, 0)));
+    EXPECT_EQ(fingerprint(findMy(1, 0, 0x10, -60, 0)), fingerprint(findMy(2, 0, 0x10, -60, 0)));
+    EXPECT_NE(fingerprint(findMy(1, 0, 0x10, -60, 0)), fingerprint(findMy(1, 0, 0x50, -60, 0)));
+}
+
+TEST(TrackerDetectorTest, FollowingTrackerAlertsOnceAcrossRotations) {
+    TrackerDetector det;
+    TrackerAlert alert, first;
+    int alerts = 0;
+
+    // Advertises every 2 s, new address every 10 minutes, for 40 minutes
+    for (uint32_t now = 0; now < 40 * MINUTE; now += 2000) {
+        if (!scanning(now)) continue;
+        int8_t rssi = (int8_t)(-60 + (int)((now / 2000) % 5) - 2);
+        if (feed(det, findMy(1, (uint8_t)(now / (10 * MINUTE)), 0x10, rssi, now), alert)) {
+            if (alerts++ == 0) first = alert;
+        }
+    }
+
+    EXPECT_EQ(alerts, 1);
+    EXPECT_EQ(det.trackCount(), 1u);
+    EXPECT_EQ(det.rotations(), 3u);
+    EXPECT_EQ(first.kind, TrackerKind::FIND_MY);
+    EXPECT_EQ(first.addresses, 2u);
+    EXPECT_GE(first.followingMs, TRACKER_ALERT_SPAN_MS);
+    EXPECT_GE(first.windows, TRACKER_ALERT_WINDOWS);
+    EXPECT_NEAR((int)first.intervalMs, 2000, 200);
+    EXPECT_GE(first.rssiTrend, -TRACKER_FADING_DB);
+
+    // The alert names the address in use now
+    RawAdvert latest = findMy(1, 1, 0x10, -60, 0);
+    EXPECT_EQ(memcmp(first.address, latest.address, 6), 0);
+}
+
+TEST(TrackerDetectorTest, BackgroundWatchAlertsWhereOneShotScansDoNot) {
+    // Same tracker, two ways of listening: a 5 s scan every 3 minutes,
+    // and the watch, paused 6 minutes by a foreground scan
+    TrackerDetector oneShot, watched;
+    TrackerWatch watch;
+    TrackerAlert alert;
+    int oneShotAlerts = 0, watchedAlerts = 0;
+    uint32_t listenEndMs = 0;
+    watch.start(0);
+
+    for (uint32_t now = 0; now < 30 * MINUTE; now += 2000) {
+        RawAdvert adv = findMy(1, (uint8_t)(now / (15 * MINUTE)), 0x10, -60, now);
+
+        if (now % (3 * MINUTE) < 5000) oneShotAlerts += feed(oneShot, adv, alert);
+
+        bool radioFree = now < 4 * MINUTE || now >= 10 * MINUTE;
+        if (watch.isListening() && now >= listenEndMs) watch.listenDone(now);
+        uint32_t ms = watch.nextListen(now, radioFree);
+        if (ms) listenEndMs = now + ms;
+        if (watch.isListening()) watchedAlerts += feed(watched, adv, alert);
+    }
+
+    EXPECT_EQ(oneShotAlerts, 0);
+    EXPECT_EQ(watchedAlerts, 1);
+    EXPECT_EQ(watched.trackCount(), 1u);
+}
+
+TEST(TrackerDetectorTest, PassingAndFadingTrackersDoNotAlert) {
+    TrackerDetector det;
+    TrackerAlert alert;
+    int alerts = 0;
+
+    // Tag 1 passes by for five minutes
+    for (uint32_t now = 0; now < 5 * MINUTE; now += 2000) {
+        alerts += feed(det, findMy(1, 0, 0x10, -70, now), alert);
+    }
+
+    // Tag 2 stays for 14 minutes, then is left behind: -1 dB per advert
+    // until out of range, just as the span would be reached
+    int8_t rssi = -60;
+    for (uint32_t now = 0; now < 20 * MINUTE && rssi > -95; now += 2000) {
+        if (now >= 14 * MINUTE) rssi--;
+        alerts += feed(det, findMy(2, 0, 0x50, rssi, now), alert);
+    }
+
+    EXPECT_EQ(alerts, 0);
+    EXPECT_EQ(det.trackCount(), 2u);
+    const TrackerTrack* fading = det.find(findMy(2, 0, 0x50, 0, 0).address);
+    ASSERT_NE(fading, nullptr);
+    EXPECT_LT(TrackerDetector::rssiTrend(*fading), -TRACKER_FADING_DB);
+}
+
+TEST(TrackerDetectorTest, LookalikeTrackersStaySeparate) {
+    TrackerDetector det;
+    TrackerAlert alert;
+
+    // Two tags with identical fingerprints, adverts 1 s apart; tag 1
+    // rotates at 5 minutes
+    for (uint32_t now = 0; now < 10 * MINUTE; now += 1000) {
+        if (now % 2000 == 0) feed(det, findMy(1, now >= 5 * MINUTE ? 1 : 0, 0x10, -60, now), alert);
+        else                 feed(det, findMy(2, 0, 0x10, -65, now), alert);
+    }
+
+    EXPECT_EQ(det.trackCount(), 2u);
+    EXPECT_EQ(det.rotations(), 1u);
+    const TrackerTrack* tag1 = det.find(findMy(1, 0, 0x10, 0, 0).address);
+    const TrackerTrack* tag2 = det.find(findMy(2, 0, 0x10, 0, 0).address);
+    ASSERT_NE(tag1, nullptr);
+    ASSERT_NE(tag2, nullptr);
+    EXPECT_NE(tag1, tag2);
+    EXPECT_EQ(det.find(findMy(1, 1, 0x10, 0, 0).address), tag1);
+    EXPECT_EQ(tag1->addresses, 2u);
+
+    // A third lookalike shows up in tag 1's gap and is linked to it; tag
+    // 1's next advert gives it away and it is split off
+    uint32_t now = 10 * MINUTE;
+    feed(det, findMy(3, 0, 0x10, -70, now - 100), alert);
+    EXPECT_EQ(det.find(findMy(3, 0, 0x10, 0, 0).address), tag1);
+    feed(det, findMy(1, 1, 0x10, -60, now), alert);
+
+    EXPECT_EQ(det.trackCount(), 3u);
+    EXPECT_EQ(det.rotations(), 1u);
+    EXPECT_NE(det.find(findMy(3, 0, 0x10, 0, 0).address), tag1);
+    EXPECT_EQ(tag1->addresses, 2u);
+}
+
+TEST(TrackerDetectorTest, MemoryStaysBoundedUnderChurn) {
+    TrackerDetector det;
+    TrackerAlert alert;
+    const uint8_t nearby[] = {0x07, 0xFF, 0x4C, 0x00, 0x10, 0x05, 0x01, 0x18};
+    const uint32_t ADVERTS = 200000;
+
+    // Every advert a new device: tracks and addresses recycle in place
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < ADVERTS; i++) {
+        RawAdvert adv = findMy((uint8_t)i, (uint8_t)(i >> 8), (uint8_t)(i >> 16), -80, i * 50);
+        feed(det, adv, alert);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    RawAdvert other = fromPayload(nearby, sizeof(nearby), 1);
+    for (uint32_t i = 0; i < ADVERTS; i++) {
+        other.timestampMs = i;
+        feed(det, other, alert);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    EXPECT_LE(det.trackCount(), TRACKER_MAX_TRACKS);
+    printf("[ trackers ] %u bytes; %.1f ns/tracker advert, %.1f ns/other advert (incl. parse)\n",
+           (unsigned)sizeof(TrackerDetector),
+           std::chrono::duration<double, std::nano>(t1 - t0).count() / ADVERTS,
+           std::chrono::duration<double, std::nano>(t2 - t1).count() / ADVERTS);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "Arduino.h"
+#include "TrackerWatch.h"
+
+using namespace Vanguard;
+
+TEST(TrackerWatchTest, InactiveUntilStarted) {
+    TrackerWatch watch;
+    EXPECT_FALSE(watch.isActive());
+    EXPECT_EQ(watch.nextListen(100000, true), 0u);
+}
+
+TEST(TrackerWatchTest, ListensThenRests) {
+    TrackerWatch watch;
+    watch.start(1000);
+
+    EXPECT_EQ(watch.nextListen(1000, true), TRACKER_WATCH_LISTEN_MS);
+    EXPECT_TRUE(watch.isListening());
+    EXPECT_EQ(watch.nextListen(2000, true), 0u);           // Still running
+
+    uint32_t done = 1000 + TRACKER_WATCH_LISTEN_MS;
+    watch.listenDone(done);
+    EXPECT_FALSE(watch.isListening());
+    EXPECT_EQ(watch.nextListen(done + TRACKER_WATCH_REST_MS - 1, true), 0u);
+    EXPECT_EQ(watch.nextListen(done + TRACKER_WATCH_REST_MS, true), TRACKER_WATCH_LISTEN_MS);
+    EXPECT_EQ(watch.listens(), 2u);
+}
+
+TEST(TrackerWatchTest, WaitsForTheRadio) {
+    TrackerWatch watch;
+    watch.start(0);
+
+    EXPECT_EQ(watch.nextListen(0, false), 0u);
+    EXPECT_EQ(watch.nextListen(300000, false), 0u);
+    EXPECT_FALSE(watch.isListening());
+
+    // Free again after a long foreground scan: no extra rest owed
+    EXPECT_EQ(watch.nextListen(300001, true), TRACKER_WATCH_LISTEN_MS);
+}
+
+TEST(TrackerWatchTest, LostCompletionTimesOut) {
+    TrackerWatch watch;
+    watch.start(0);
+    watch.nextListen(0, true);
+
+    uint32_t limit = TRACKER_WATCH_LISTEN_MS + TRACKER_WATCH_SLACK_MS;
+    EXPECT_EQ(watch.nextListen(limit - 1, true), 0u);
+    EXPECT_TRUE(watch.isListening());
+
+    // Dropped at the limit; the next listen waits out a normal rest
+    EXPECT_EQ(watch.nextListen(limit, true), 0u);
+    EXPECT_FALSE(watch.isListening());
+    EXPECT_EQ(watch.nextListen(limit + TRACKER_WATCH_REST_MS, true), TRACKER_WATCH_LISTEN_MS);
+}
+
+TEST(TrackerWatchTest, StopLetsTheRunningListenFinish) {
+    TrackerWatch watch;
+    watch.start(0);
+    watch.nextListen(0, true);
+
+    watch.stop();
+    EXPECT_FALSE(watch.isActive());
+    EXPECT_TRUE(watch.isListening());      // Its completion is still ours
+
+    watch.listenDone(5000);
+    EXPECT_FALSE(watch.isListening());
+    EXPECT_EQ(watch.nextListen(100000, true), 0u);
+}
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Generate src/core/OuiData.cpp from an IEEE MA-L registry CSV.
+
+The output is one sorted array of 6-byte records (3-byte OUI, 3-byte
+offset into a string pool) and a deduplicated, NUL-separated pool of
+shortened vendor names. Both are const, so on the ESP32 they stay in
+flash rodata and OuiLookup binary-searches them in place.
+
+    python tools/gen_oui.py                        # tools/oui_seed.csv
+    python tools/gen_oui.py --input oui.csv        # full registry from
+                                                   # standards-oui.ieee.org/oui/oui.csv
+    pio run -t oui                                 # same, via tools/pio_oui.py
+"""
+
+import argparse
+import csv
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_INPUT = os.path.join(ROOT, "tools", "oui_seed.csv")
+DEFAULT_OUTPUT = os.path.join(ROOT, "src", "core", "OuiData.cpp")
+
+VENDOR_MAX = 20     # Keep in sync with OUI_VENDOR_MAX in OuiLookup.h
+RECORD_BYTES = 6    # Keep in sync with OUI_RECORD_BYTES
+
+# Corporate suffixes that only cost flash and screen width
+SUFFIXES = re.compile(
+    r"[\s,.]*\b(inc|incorporated|corp|corporation|corporate|co|company|ltd|limited|"
+    r"llc|gmbh|ag|sa|s\.a|bv|b\.v|plc|pte|pty|oy|ab|as|kk|srl|spa|"
+    r"technologies|technology|electronics|systems|networks|communications|"
+    r"semiconductor|international|trading|foundation|computer)\b[.,]*",
+    re.IGNORECASE)
+
+
+def shorten(name):
+    name = " ".join(name.split())
+    prev = None
+    while prev != name:
+        prev = name
+        name = SUFFIXES.sub("", name).strip(" ,.-")
+    if not name:
+        name = prev
+    # Upper-case registrations read badly on a small screen
+    if name.isupper() and len(name) > 4:
+        name = " ".join(w.capitalize() if w.isalpha() and len(w) > 3 else w for w in name.split())
+    return name[:VENDOR_MAX].rstrip()
+
+
+def read_registry(path):
+    entries = {}
+    with open(path, newline="", encoding="utf-8") as f:
+        for row in csv.DictReader(f):
+            if row.get("Registry", "MA-L") != "MA-L":
+                continue
+            oui = int(row["Assignment"], 16)
+            name = shorten(row["Organization Name"])
+            if oui in entries and entries[oui] != name:
+                sys.exit("gen_oui: %06X listed twice (%s / %s)" % (oui, entries[oui], name))
+            entries[oui] = name
+    return entries
+
+
+def build(entries):
+    pool = bytearray()
+    offsets = {}
+    records = bytearray()
+    for oui in sorted(entries):
+        name = entries[oui]
+        if name not in offsets:
+            offsets[name] = len(pool)
+            pool += name.encode("ascii", "replace") + b"\0"
+        off = offsets[name]
+        records += bytes([(oui >> 16) & 0xFF, (oui >> 8) & 0xFF, oui & 0xFF,
+                          (off >> 16) & 0xFF, (off >> 8) & 0xFF, off & 0xFF])
+    if len(pool) >= 1 << 24:
+        sys.exit("gen_oui: string pool too large for 24-bit offsets")
+    return records, pool, len(offsets)
+
+
+def c_bytes(data, indent="    ", per_line=12):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02X" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def c_pool(pool):
+    lines = []
+    for chunk in bytes(pool).split(b"\0")[:-1]:
+        text = chunk.decode("ascii").replace("\\", "\\\\").replace('"', '\\"')
+        lines.append('    "%s\\0"' % text)
+    return "\n".join(lines)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--input", default=DEFAULT_INPUT, help="IEEE MA-L CSV")
+    ap.add_argument("--output", default=DEFAULT_OUTPUT)
+    args = ap.parse_args()
+
+    entries = read_registry(args.input)
+    if not entries:
+        sys.exit("gen_oui: no MA-L entries in %s" % args.input)
+    records, pool, vendors = build(entries)
+    count = len(records) // RECORD_BYTES
+
+    with open(args.output, "w", newline="\n") as f:
+        f.write("""/**
+ * @file OuiData.cpp
+ * @brief Generated OUI vendor table - do not edit
+ *
+ * Source: %s
+ * Regenerate with: python tools/gen_oui.py --input <oui.csv>
+ *
+ * %u OUIs, %u vendors, %u bytes of flash
+ */
+
+#include "OuiLookup.h"
+
+namespace Vanguard {
+
+extern const size_t OUI_COUNT = %u;
+extern const size_t OUI_POOL_BYTES = %u;
+
+// OUI (3, big-endian) | pool offset (3, big-endian), sorted by OUI
+extern const uint8_t OUI_TABLE[] = {
+%s
+};
+
+extern const char OUI_POOL[] =
+%s;
+
+} // namespace Vanguard
+""" % (os.path.basename(args.input), count, vendors, len(records) + len(pool),
+       count, len(pool), c_bytes(records, per_line=RECORD_BYTES * 2), c_pool(pool)))
+
+    print("gen_oui: %u OUIs, %u vendors, %u + %u bytes -> %s"
+          % (count, vendors, len(records), len(pool), os.path.relpath(args.output, ROOT)))
+
+
+if __name__ == "__main__":
+    main()
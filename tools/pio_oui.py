@@ -0,0 +1,17 @@
+# PlatformIO extra script: adds `pio run -t oui` to regenerate the OUI table.
+# Drop the IEEE registry at tools/oui.csv first to build the full table;
+# without it the checked-in seed list is used.
+Import("env")
+
+import os
+
+oui_csv = os.path.join("tools", "oui.csv")
+source = oui_csv if os.path.exists(oui_csv) else os.path.join("tools", "oui_seed.csv")
+
+env.AddCustomTarget(
+    name="oui",
+    dependencies=None,
+    actions=['"$PYTHONEXE" tools/gen_oui.py --input "%s"' % source],
+    title="Generate OUI table",
+    description="Rebuild src/core/OuiData.cpp from the IEEE OUI registry",
+)